@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// STL includes
+#include <chrono>
+#include <complex>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+// oneMKL/SYCL includes
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/mkl.hpp"
+
+constexpr int N = 8;
+constexpr int warmup_calls = 100;
+constexpr int timed_calls = 10000;
+
+// Average time in microseconds of submit() followed by a wait, over timed_calls calls.
+template <typename SubmitT>
+double time_per_call(SubmitT submit) {
+    for (int i = 0; i < warmup_calls; ++i) {
+        submit().wait();
+    }
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < timed_calls; ++i) {
+        submit().wait();
+    }
+    const std::chrono::duration<double, std::micro> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count() / timed_calls;
+}
+
+void run_example(const sycl::device& cpu_device) {
+    // Catch asynchronous exceptions for cpu
+    auto cpu_error_handler = [&](sycl::exception_list exceptions) {
+        for (auto const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (sycl::exception const& e) {
+                // Handle not dft related exceptions that happened during asynchronous call
+                std::cerr << "Caught asynchronous SYCL exception:" << std::endl;
+                std::cerr << "\t" << e.what() << std::endl;
+            }
+        }
+        std::exit(2);
+    };
+
+    sycl::queue cpu_queue(cpu_device, cpu_error_handler);
+
+    auto* data = sycl::malloc_shared<std::complex<float>>(N, cpu_queue);
+
+    // 1. create and commit a descriptor of a transform small enough for its cost to be the
+    //    overhead of the call
+    oneapi::mkl::dft::descriptor<oneapi::mkl::dft::precision::SINGLE,
+                                 oneapi::mkl::dft::domain::COMPLEX>
+        desc(N);
+    desc.commit(oneapi::mkl::backend_selector<oneapi::mkl::backend::mklcpu>{ cpu_queue });
+
+    // 2. time an empty host task, the least a compute call can cost, and compute_forward
+    const double empty_us = time_per_call([&]() {
+        return cpu_queue.submit([&](sycl::handler& cgh) { cgh.host_task([]() {}); });
+    });
+    const double forward_us = time_per_call([&]() {
+        return oneapi::mkl::dft::compute_forward(desc, data);
+    });
+
+    // 3. check the transform of an impulse
+    for (int i = 0; i < N; ++i) {
+        data[i] = i == 0 ? 1.0f : 0.0f;
+    }
+    oneapi::mkl::dft::compute_forward(desc, data).wait();
+    bool ok = true;
+    for (int i = 0; i < N; ++i) {
+        ok = ok && std::abs(data[i] - std::complex<float>(1.0f, 0.0f)) < 1e-5f;
+    }
+    sycl::free(data, cpu_queue);
+    if (!ok) {
+        throw std::runtime_error("wrong result of compute_forward");
+    }
+
+    std::cout << "\tempty host task : " << empty_us << " us per call" << std::endl;
+    std::cout << "\tcompute_forward : " << forward_us << " us per call" << std::endl;
+    std::cout << "\toverhead        : " << forward_us - empty_us << " us per call" << std::endl;
+}
+
+//
+// Description of example setup, apis used and supported floating point type precisions
+//
+void print_example_banner() {
+    std::cout << "\n"
+                 "########################################################################\n"
+                 "# Per-call overhead of a small complex in-place forward transform:\n"
+                 "#\n"
+                 "# Using APIs:\n"
+                 "#   Compile-time dispatch API\n"
+                 "#   USM forward complex in-place\n"
+                 "#\n"
+                 "# Using single precision (float) data type\n"
+                 "#\n"
+                 "# For Intel CPU with Intel MKLCPU backend.\n"
+                 "#\n"
+                 "# The environment variable SYCL_DEVICE_FILTER can be used to specify\n"
+                 "# SYCL device\n"
+                 "########################################################################\n"
+              << std::endl;
+}
+
+//
+// Main entry point for example.
+//
+int main() {
+    print_example_banner();
+
+    try {
+        sycl::device cpu_device((sycl::cpu_selector_v));
+        std::cout << "Running DFT per-call overhead USM example" << std::endl;
+        std::cout << "Using compile-time dispatch API with MKLCPU." << std::endl;
+        std::cout << "Running with single precision complex data type on:" << std::endl;
+        std::cout << "\tCPU device :" << cpu_device.get_info<sycl::info::device::name>()
+                  << std::endl;
+
+        run_example(cpu_device);
+        std::cout << "DFT per-call overhead example ran OK on MKLCPU" << std::endl;
+    }
+    catch (sycl::exception const& e) {
+        // Handle not dft related exceptions that happened during synchronous call
+        std::cerr << "Caught synchronous SYCL exception:" << std::endl;
+        std::cerr << "\t" << e.what() << std::endl;
+        std::cerr << "\tSYCL error code: " << e.code().value() << std::endl;
+        return 1;
+    }
+    catch (std::exception const& e) {
+        // Handle not SYCL related exceptions that happened during synchronous call
+        std::cerr << "Caught synchronous std::exception:" << std::endl;
+        std::cerr << "\t" << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
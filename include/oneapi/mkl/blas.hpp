@@ -27,6 +27,7 @@
 #endif
 #include <complex>
 #include <cstdint>
+#include <type_traits>
 
 #include "oneapi/mkl/detail/config.hpp"
 #include "oneapi/mkl/types.hpp"
@@ -34,6 +35,9 @@
 #include "oneapi/mkl/detail/get_device_id.hpp"
 
 #include "oneapi/mkl/blas/detail/blas_loader.hpp"
+#include "oneapi/mkl/blas/detail/gemm_multi_queue.hpp"
+#include "oneapi/mkl/blas/capture.hpp"
+#include "oneapi/mkl/blas/reproducibility.hpp"
 #ifdef ENABLE_CUBLAS_BACKEND
 #include "oneapi/mkl/blas/detail/cublas/blas_ct.hpp"
 #endif
@@ -1708,6 +1708,197 @@ static inline void omatadd(sycl::queue &queue, transpose transa, transpose trans
                     c, ldc);
 }
 
+static inline void gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
+    sycl::buffer<float, 1> &b, std::int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+    std::int64_t ldc, sycl::buffer<float, 1> &bias, activation act, float clamp_min,
+    float clamp_max) {
+    detail::gemm_epilogue(get_device_id(queue), queue, transa, transb, offset_bias, m, n, k, alpha,
+                          a, lda, b, ldb, beta, c, ldc, bias, act, clamp_min, clamp_max);
+}
+
+static inline void gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, sycl::buffer<sycl::half, 1> &a, std::int64_t lda,
+    sycl::buffer<sycl::half, 1> &b, std::int64_t ldb, float beta, sycl::buffer<sycl::half, 1> &c,
+    std::int64_t ldc, sycl::buffer<float, 1> &bias, activation act, float clamp_min,
+    float clamp_max) {
+    detail::gemm_epilogue(get_device_id(queue), queue, transa, transb, offset_bias, m, n, k, alpha,
+                          a, lda, b, ldb, beta, c, ldc, bias, act, clamp_min, clamp_max);
+}
+
+static inline void gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, sycl::buffer<sycl::half, 1> &a, std::int64_t lda,
+    sycl::buffer<sycl::half, 1> &b, std::int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+    std::int64_t ldc, sycl::buffer<float, 1> &bias, activation act, float clamp_min,
+    float clamp_max) {
+    detail::gemm_epilogue(get_device_id(queue), queue, transa, transb, offset_bias, m, n, k, alpha,
+                          a, lda, b, ldb, beta, c, ldc, bias, act, clamp_min, clamp_max);
+}
+
+static inline void gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+    sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta, sycl::buffer<bfloat16, 1> &c,
+    std::int64_t ldc, sycl::buffer<float, 1> &bias, activation act, float clamp_min,
+    float clamp_max) {
+    detail::gemm_epilogue(get_device_id(queue), queue, transa, transb, offset_bias, m, n, k, alpha,
+                          a, lda, b, ldb, beta, c, ldc, bias, act, clamp_min, clamp_max);
+}
+
+static inline void gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+    sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+    std::int64_t ldc, sycl::buffer<float, 1> &bias, activation act, float clamp_min,
+    float clamp_max) {
+    detail::gemm_epilogue(get_device_id(queue), queue, transa, transb, offset_bias, m, n, k, alpha,
+                          a, lda, b, ldb, beta, c, ldc, bias, act, clamp_min, clamp_max);
+}
+
+static inline std::int64_t sgemm_pack_get_size(sycl::queue &queue, gemm_pack_matrix identifier,
+                                               std::int64_t m, std::int64_t n, std::int64_t k) {
+    return detail::sgemm_pack_get_size(get_device_id(queue), queue, identifier, m, n, k);
+}
+
+static inline std::int64_t dgemm_pack_get_size(sycl::queue &queue, gemm_pack_matrix identifier,
+                                               std::int64_t m, std::int64_t n, std::int64_t k) {
+    return detail::dgemm_pack_get_size(get_device_id(queue), queue, identifier, m, n, k);
+}
+
+template <typename T>
+static inline std::int64_t gemm_pack_get_size(sycl::queue &queue, gemm_pack_matrix identifier,
+                                              std::int64_t m, std::int64_t n, std::int64_t k) {
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+                  "gemm_pack_get_size supports float and double");
+    if constexpr (std::is_same_v<T, float>)
+        return sgemm_pack_get_size(queue, identifier, m, n, k);
+    else
+        return dgemm_pack_get_size(queue, identifier, m, n, k);
+}
+
+static inline void gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans,
+                             std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                             sycl::buffer<float, 1> &src, std::int64_t ld,
+                             sycl::buffer<float, 1> &dest) {
+    detail::gemm_pack(get_device_id(queue), queue, identifier, trans, m, n, k, alpha, src, ld,
+                      dest);
+}
+
+static inline void gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans,
+                             std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                             sycl::buffer<double, 1> &src, std::int64_t ld,
+                             sycl::buffer<double, 1> &dest) {
+    detail::gemm_pack(get_device_id(queue), queue, identifier, trans, m, n, k, alpha, src, ld,
+                      dest);
+}
+
+static inline void gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa,
+                                transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                                sycl::buffer<float, 1> &a, std::int64_t lda,
+                                sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                                sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    detail::gemm_compute(get_device_id(queue), queue, packed, transa, transb, m, n, k, a, lda, b,
+                         ldb, beta, c, ldc);
+}
+
+static inline void gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa,
+                                transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                                sycl::buffer<double, 1> &a, std::int64_t lda,
+                                sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+                                sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    detail::gemm_compute(get_device_id(queue), queue, packed, transa, transb, m, n, k, a, lda, b,
+                         ldb, beta, c, ldc);
+}
+
+static inline void axpy_dot(sycl::queue &queue, std::int64_t n, float alpha,
+                            sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
+                            std::int64_t incy, sycl::buffer<float, 1> &z, std::int64_t incz,
+                            sycl::buffer<float, 1> &result) {
+    detail::axpy_dot(get_device_id(queue), queue, n, alpha, x, incx, y, incy, z, incz, result);
+}
+
+static inline void axpy_dot(
+    sycl::queue &queue, std::int64_t n, double alpha, sycl::buffer<double, 1> &x, std::int64_t incx,
+    sycl::buffer<double, 1> &y, std::int64_t incy, sycl::buffer<double, 1> &z, std::int64_t incz,
+    sycl::buffer<double, 1> &result) {
+    detail::axpy_dot(get_device_id(queue), queue, n, alpha, x, incx, y, incy, z, incz, result);
+}
+
+static inline void dot2(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                        std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+                        sycl::buffer<float, 1> &z, std::int64_t incz,
+                        sycl::buffer<float, 1> &result) {
+    detail::dot2(get_device_id(queue), queue, n, x, incx, y, incy, z, incz, result);
+}
+
+static inline void dot2(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                        std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy,
+                        sycl::buffer<double, 1> &z, std::int64_t incz,
+                        sycl::buffer<double, 1> &result) {
+    detail::dot2(get_device_id(queue), queue, n, x, incx, y, incy, z, incz, result);
+}
+
+static inline void axpby_nrm2(
+    sycl::queue &queue, std::int64_t n, float alpha, sycl::buffer<float, 1> &x, std::int64_t incx,
+    float beta, sycl::buffer<float, 1> &y, std::int64_t incy, sycl::buffer<float, 1> &result) {
+    detail::axpby_nrm2(get_device_id(queue), queue, n, alpha, x, incx, beta, y, incy, result);
+}
+
+static inline void axpby_nrm2(
+    sycl::queue &queue, std::int64_t n, double alpha, sycl::buffer<double, 1> &x, std::int64_t incx,
+    double beta, sycl::buffer<double, 1> &y, std::int64_t incy, sycl::buffer<double, 1> &result) {
+    detail::axpby_nrm2(get_device_id(queue), queue, n, alpha, x, incx, beta, y, incy, result);
+}
+
+static inline void axpby_nrm2(sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                              sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &y,
+                              std::int64_t incy, sycl::buffer<float, 1> &result) {
+    detail::axpby_nrm2(get_device_id(queue), queue, n, alpha, x, incx, beta, y, incy, result);
+}
+
+static inline void axpby_nrm2(sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                              sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &y,
+                              std::int64_t incy, sycl::buffer<double, 1> &result) {
+    detail::axpby_nrm2(get_device_id(queue), queue, n, alpha, x, incx, beta, y, incy, result);
+}
+
+static inline void mdot(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                        std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+                        std::int64_t stridey, sycl::buffer<float, 1> &result,
+                        std::int64_t batch_size) {
+    detail::mdot(get_device_id(queue), queue, n, x, incx, y, incy, stridey, result, batch_size);
+}
+
+static inline void mdot(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                        std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy,
+                        std::int64_t stridey, sycl::buffer<double, 1> &result,
+                        std::int64_t batch_size) {
+    detail::mdot(get_device_id(queue), queue, n, x, incx, y, incy, stridey, result, batch_size);
+}
+
+static inline void gemm3m(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
+    std::int64_t lda, sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+    std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    detail::gemm3m(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                   beta, c, ldc);
+}
+
+static inline void gemm3m(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
+    std::int64_t lda, sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+    std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    detail::gemm3m(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                   beta, c, ldc);
+}
+
 // USM APIs
 
 static inline sycl::event asum(sycl::queue &queue, std::int64_t n,
@@ -4293,3 +4484,573 @@ static inline sycl::event imatcopy_batch(sycl::queue& queue, transpose* trans, s
                                        ldb, group_count, groupsize, dependencies);
     return done;
 }
+
+static inline sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda, const float *b,
+    std::int64_t ldb, float beta, float *c, std::int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_epilogue(get_device_id(queue), queue, transa, transb, offset_bias, m,
+                                      n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+                                      clamp_min, clamp_max, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, const sycl::half *a, std::int64_t lda,
+    const sycl::half *b, std::int64_t ldb, float beta, sycl::half *c, std::int64_t ldc,
+    const float *bias, activation act, float clamp_min, float clamp_max,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_epilogue(get_device_id(queue), queue, transa, transb, offset_bias, m,
+                                      n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+                                      clamp_min, clamp_max, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, const sycl::half *a, std::int64_t lda,
+    const sycl::half *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+    const float *bias, activation act, float clamp_min, float clamp_max,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_epilogue(get_device_id(queue), queue, transa, transb, offset_bias, m,
+                                      n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+                                      clamp_min, clamp_max, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, const bfloat16 *a, std::int64_t lda,
+    const bfloat16 *b, std::int64_t ldb, float beta, bfloat16 *c, std::int64_t ldc,
+    const float *bias, activation act, float clamp_min, float clamp_max,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_epilogue(get_device_id(queue), queue, transa, transb, offset_bias, m,
+                                      n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+                                      clamp_min, clamp_max, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, const bfloat16 *a, std::int64_t lda,
+    const bfloat16 *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc, const float *bias,
+    activation act, float clamp_min, float clamp_max,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_epilogue(get_device_id(queue), queue, transa, transb, offset_bias, m,
+                                      n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+                                      clamp_min, clamp_max, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier,
+                                    transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                                    float alpha, const float *src, std::int64_t ld, float *dest,
+                                    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_pack(get_device_id(queue), queue, identifier, trans, m, n, k, alpha,
+                                  src, ld, dest, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier,
+                                    transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                                    double alpha, const double *src, std::int64_t ld, double *dest,
+                                    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_pack(get_device_id(queue), queue, identifier, trans, m, n, k, alpha,
+                                  src, ld, dest, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_compute(
+    sycl::queue &queue, gemm_pack_matrix packed, transpose transa, transpose transb, std::int64_t m,
+    std::int64_t n, std::int64_t k, const float *a, std::int64_t lda, const float *b,
+    std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_compute(get_device_id(queue), queue, packed, transa, transb, m, n, k,
+                                     a, lda, b, ldb, beta, c, ldc, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_compute(
+    sycl::queue &queue, gemm_pack_matrix packed, transpose transa, transpose transb, std::int64_t m,
+    std::int64_t n, std::int64_t k, const double *a, std::int64_t lda, const double *b,
+    std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_compute(get_device_id(queue), queue, packed, transa, transb, m, n, k,
+                                     a, lda, b, ldb, beta, c, ldc, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_vbatch(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t *m, std::int64_t *n,
+    std::int64_t *k, float alpha, const float **a, std::int64_t *lda, const float **b,
+    std::int64_t *ldb, float beta, float **c, std::int64_t *ldc, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_vbatch(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a,
+                                    lda, b, ldb, beta, c, ldc, batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_vbatch(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t *m, std::int64_t *n,
+    std::int64_t *k, double alpha, const double **a, std::int64_t *lda, const double **b,
+    std::int64_t *ldb, double beta, double **c, std::int64_t *ldc, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_vbatch(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a,
+                                    lda, b, ldb, beta, c, ldc, batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_vbatch(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t *m, std::int64_t *n,
+    std::int64_t *k, std::complex<float> alpha, const std::complex<float> **a, std::int64_t *lda,
+    const std::complex<float> **b, std::int64_t *ldb, std::complex<float> beta,
+    std::complex<float> **c, std::int64_t *ldc, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_vbatch(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a,
+                                    lda, b, ldb, beta, c, ldc, batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_vbatch(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t *m, std::int64_t *n,
+    std::int64_t *k, std::complex<double> alpha, const std::complex<double> **a, std::int64_t *lda,
+    const std::complex<double> **b, std::int64_t *ldb, std::complex<double> beta,
+    std::complex<double> **c, std::int64_t *ldc, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_vbatch(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a,
+                                    lda, b, ldb, beta, c, ldc, batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm(const std::vector<sycl::queue> &queues, transpose transa,
+                               transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                               float alpha, const float *a, std::int64_t lda, const float *b,
+                               std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+                               const std::vector<sycl::event> &dependencies = {}) {
+    auto tile_gemm = [&](sycl::queue &queue, std::int64_t m_tile, std::int64_t n_tile,
+                         const float *a_tile, std::int64_t lda_tile, const float *b_tile,
+                         std::int64_t ldb_tile, float *c_tile,
+                         const std::vector<sycl::event> &tile_dependencies) {
+        return gemm(queue, transa, transb, m_tile, n_tile, k, alpha, a_tile, lda_tile, b_tile,
+                    ldb_tile, beta, c_tile, ldc, tile_dependencies);
+    };
+    auto done = oneapi::mkl::blas::detail::gemm_multi_queue(queues, detail::is_column_major, transa,
+                                                            transb, m, n, k, a, lda, b, ldb, c, ldc,
+                                                            dependencies, tile_gemm);
+    return done;
+}
+
+static inline sycl::event gemm(const std::vector<sycl::queue> &queues, transpose transa,
+                               transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                               double alpha, const double *a, std::int64_t lda, const double *b,
+                               std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+                               const std::vector<sycl::event> &dependencies = {}) {
+    auto tile_gemm = [&](sycl::queue &queue, std::int64_t m_tile, std::int64_t n_tile,
+                         const double *a_tile, std::int64_t lda_tile, const double *b_tile,
+                         std::int64_t ldb_tile, double *c_tile,
+                         const std::vector<sycl::event> &tile_dependencies) {
+        return gemm(queue, transa, transb, m_tile, n_tile, k, alpha, a_tile, lda_tile, b_tile,
+                    ldb_tile, beta, c_tile, ldc, tile_dependencies);
+    };
+    auto done = oneapi::mkl::blas::detail::gemm_multi_queue(queues, detail::is_column_major, transa,
+                                                            transb, m, n, k, a, lda, b, ldb, c, ldc,
+                                                            dependencies, tile_gemm);
+    return done;
+}
+
+static inline sycl::event gemm(
+    const std::vector<sycl::queue> &queues, transpose transa, transpose transb, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::complex<float> alpha, const std::complex<float> *a,
+    std::int64_t lda, const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+    std::complex<float> *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies = {}) {
+    auto tile_gemm = [&](sycl::queue &queue, std::int64_t m_tile, std::int64_t n_tile,
+                         const std::complex<float> *a_tile, std::int64_t lda_tile,
+                         const std::complex<float> *b_tile, std::int64_t ldb_tile,
+                         std::complex<float> *c_tile,
+                         const std::vector<sycl::event> &tile_dependencies) {
+        return gemm(queue, transa, transb, m_tile, n_tile, k, alpha, a_tile, lda_tile, b_tile,
+                    ldb_tile, beta, c_tile, ldc, tile_dependencies);
+    };
+    auto done = oneapi::mkl::blas::detail::gemm_multi_queue(queues, detail::is_column_major, transa,
+                                                            transb, m, n, k, a, lda, b, ldb, c, ldc,
+                                                            dependencies, tile_gemm);
+    return done;
+}
+
+static inline sycl::event gemm(
+    const std::vector<sycl::queue> &queues, transpose transa, transpose transb, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+    std::int64_t lda, const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+    std::complex<double> *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies = {}) {
+    auto tile_gemm = [&](sycl::queue &queue, std::int64_t m_tile, std::int64_t n_tile,
+                         const std::complex<double> *a_tile, std::int64_t lda_tile,
+                         const std::complex<double> *b_tile, std::int64_t ldb_tile,
+                         std::complex<double> *c_tile,
+                         const std::vector<sycl::event> &tile_dependencies) {
+        return gemm(queue, transa, transb, m_tile, n_tile, k, alpha, a_tile, lda_tile, b_tile,
+                    ldb_tile, beta, c_tile, ldc, tile_dependencies);
+    };
+    auto done = oneapi::mkl::blas::detail::gemm_multi_queue(queues, detail::is_column_major, transa,
+                                                            transb, m, n, k, a, lda, b, ldb, c, ldc,
+                                                            dependencies, tile_gemm);
+    return done;
+}
+
+static inline sycl::event axpy_dot(sycl::queue &queue, std::int64_t n, float alpha, const float *x,
+                                   std::int64_t incx, float *y, std::int64_t incy, const float *z,
+                                   std::int64_t incz, float *result,
+                                   const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpy_dot(get_device_id(queue), queue, n, alpha, x, incx, y, incy, z, incz,
+                                 result, dependencies);
+    return done;
+}
+
+static inline sycl::event axpy_dot(sycl::queue &queue, std::int64_t n, double alpha,
+                                   const double *x, std::int64_t incx, double *y, std::int64_t incy,
+                                   const double *z, std::int64_t incz, double *result,
+                                   const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpy_dot(get_device_id(queue), queue, n, alpha, x, incx, y, incy, z, incz,
+                                 result, dependencies);
+    return done;
+}
+
+static inline sycl::event dot2(sycl::queue &queue, std::int64_t n, const float *x,
+                               std::int64_t incx, const float *y, std::int64_t incy, const float *z,
+                               std::int64_t incz, float *result,
+                               const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::dot2(get_device_id(queue), queue, n, x, incx, y, incy, z, incz, result,
+                             dependencies);
+    return done;
+}
+
+static inline sycl::event dot2(sycl::queue &queue, std::int64_t n, const double *x,
+                               std::int64_t incx, const double *y, std::int64_t incy,
+                               const double *z, std::int64_t incz, double *result,
+                               const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::dot2(get_device_id(queue), queue, n, x, incx, y, incy, z, incz, result,
+                             dependencies);
+    return done;
+}
+
+static inline sycl::event axpby_nrm2(
+    sycl::queue &queue, std::int64_t n, float alpha, const float *x, std::int64_t incx, float beta,
+    float *y, std::int64_t incy, float *result, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpby_nrm2(get_device_id(queue), queue, n, alpha, x, incx, beta, y, incy,
+                                   result, dependencies);
+    return done;
+}
+
+static inline sycl::event axpby_nrm2(sycl::queue &queue, std::int64_t n, double alpha,
+                                     const double *x, std::int64_t incx, double beta, double *y,
+                                     std::int64_t incy, double *result,
+                                     const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpby_nrm2(get_device_id(queue), queue, n, alpha, x, incx, beta, y, incy,
+                                   result, dependencies);
+    return done;
+}
+
+static inline sycl::event axpby_nrm2(
+    sycl::queue &queue, std::int64_t n, std::complex<float> alpha, const std::complex<float> *x,
+    std::int64_t incx, std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
+    float *result, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpby_nrm2(get_device_id(queue), queue, n, alpha, x, incx, beta, y, incy,
+                                   result, dependencies);
+    return done;
+}
+
+static inline sycl::event axpby_nrm2(
+    sycl::queue &queue, std::int64_t n, std::complex<double> alpha, const std::complex<double> *x,
+    std::int64_t incx, std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
+    double *result, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpby_nrm2(get_device_id(queue), queue, n, alpha, x, incx, beta, y, incy,
+                                   result, dependencies);
+    return done;
+}
+
+static inline sycl::event mdot(sycl::queue &queue, std::int64_t n, const float *x,
+                               std::int64_t incx, const float *y, std::int64_t incy,
+                               std::int64_t stridey, float *result, std::int64_t batch_size,
+                               const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::mdot(get_device_id(queue), queue, n, x, incx, y, incy, stridey, result,
+                             batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event mdot(sycl::queue &queue, std::int64_t n, const double *x,
+                               std::int64_t incx, const double *y, std::int64_t incy,
+                               std::int64_t stridey, double *result, std::int64_t batch_size,
+                               const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::mdot(get_device_id(queue), queue, n, x, incx, y, incy, stridey, result,
+                             batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event axpy_device_scalars(sycl::queue &queue, std::int64_t n,
+                                              const float *alpha, const float *x, std::int64_t incx,
+                                              float *y, std::int64_t incy,
+                                              const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpy(get_device_id(queue), queue, n, alpha, x, incx, y, incy, dependencies);
+    return done;
+}
+
+static inline sycl::event axpy_device_scalars(sycl::queue &queue, std::int64_t n,
+                                              const double *alpha, const double *x,
+                                              std::int64_t incx, double *y, std::int64_t incy,
+                                              const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpy(get_device_id(queue), queue, n, alpha, x, incx, y, incy, dependencies);
+    return done;
+}
+
+static inline sycl::event axpy_device_scalars(sycl::queue &queue, std::int64_t n,
+                                              const std::complex<float> *alpha,
+                                              const std::complex<float> *x, std::int64_t incx,
+                                              std::complex<float> *y, std::int64_t incy,
+                                              const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpy(get_device_id(queue), queue, n, alpha, x, incx, y, incy, dependencies);
+    return done;
+}
+
+static inline sycl::event axpy_device_scalars(sycl::queue &queue, std::int64_t n,
+                                              const std::complex<double> *alpha,
+                                              const std::complex<double> *x, std::int64_t incx,
+                                              std::complex<double> *y, std::int64_t incy,
+                                              const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpy(get_device_id(queue), queue, n, alpha, x, incx, y, incy, dependencies);
+    return done;
+}
+
+static inline sycl::event axpby_device_scalars(sycl::queue &queue, std::int64_t n,
+                                               const float *alpha, const float *x,
+                                               std::int64_t incx, const float *beta, float *y,
+                                               std::int64_t incy,
+                                               const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpby(get_device_id(queue), queue, n, alpha, x, incx, beta, y, incy,
+                              dependencies);
+    return done;
+}
+
+static inline sycl::event axpby_device_scalars(sycl::queue &queue, std::int64_t n,
+                                               const double *alpha, const double *x,
+                                               std::int64_t incx, const double *beta, double *y,
+                                               std::int64_t incy,
+                                               const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpby(get_device_id(queue), queue, n, alpha, x, incx, beta, y, incy,
+                              dependencies);
+    return done;
+}
+
+static inline sycl::event axpby_device_scalars(sycl::queue &queue, std::int64_t n,
+                                               const std::complex<float> *alpha,
+                                               const std::complex<float> *x, std::int64_t incx,
+                                               const std::complex<float> *beta,
+                                               std::complex<float> *y, std::int64_t incy,
+                                               const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpby(get_device_id(queue), queue, n, alpha, x, incx, beta, y, incy,
+                              dependencies);
+    return done;
+}
+
+static inline sycl::event axpby_device_scalars(sycl::queue &queue, std::int64_t n,
+                                               const std::complex<double> *alpha,
+                                               const std::complex<double> *x, std::int64_t incx,
+                                               const std::complex<double> *beta,
+                                               std::complex<double> *y, std::int64_t incy,
+                                               const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpby(get_device_id(queue), queue, n, alpha, x, incx, beta, y, incy,
+                              dependencies);
+    return done;
+}
+
+static inline sycl::event scal_device_scalars(sycl::queue &queue, std::int64_t n,
+                                              const float *alpha, float *x, std::int64_t incx,
+                                              const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::scal(get_device_id(queue), queue, n, alpha, x, incx, dependencies);
+    return done;
+}
+
+static inline sycl::event scal_device_scalars(sycl::queue &queue, std::int64_t n,
+                                              const double *alpha, double *x, std::int64_t incx,
+                                              const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::scal(get_device_id(queue), queue, n, alpha, x, incx, dependencies);
+    return done;
+}
+
+static inline sycl::event scal_device_scalars(sycl::queue &queue, std::int64_t n,
+                                              const std::complex<float> *alpha,
+                                              std::complex<float> *x, std::int64_t incx,
+                                              const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::scal(get_device_id(queue), queue, n, alpha, x, incx, dependencies);
+    return done;
+}
+
+static inline sycl::event scal_device_scalars(sycl::queue &queue, std::int64_t n,
+                                              const std::complex<double> *alpha,
+                                              std::complex<double> *x, std::int64_t incx,
+                                              const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::scal(get_device_id(queue), queue, n, alpha, x, incx, dependencies);
+    return done;
+}
+
+static inline sycl::event gemv_device_scalars(sycl::queue &queue, transpose trans, std::int64_t m,
+                                              std::int64_t n, const float *alpha, const float *a,
+                                              std::int64_t lda, const float *x, std::int64_t incx,
+                                              const float *beta, float *y, std::int64_t incy,
+                                              const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemv(get_device_id(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta,
+                             y, incy, dependencies);
+    return done;
+}
+
+static inline sycl::event gemv_device_scalars(sycl::queue &queue, transpose trans, std::int64_t m,
+                                              std::int64_t n, const double *alpha, const double *a,
+                                              std::int64_t lda, const double *x, std::int64_t incx,
+                                              const double *beta, double *y, std::int64_t incy,
+                                              const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemv(get_device_id(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta,
+                             y, incy, dependencies);
+    return done;
+}
+
+static inline sycl::event gemv_device_scalars(sycl::queue &queue, transpose trans, std::int64_t m,
+                                              std::int64_t n, const std::complex<float> *alpha,
+                                              const std::complex<float> *a, std::int64_t lda,
+                                              const std::complex<float> *x, std::int64_t incx,
+                                              const std::complex<float> *beta,
+                                              std::complex<float> *y, std::int64_t incy,
+                                              const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemv(get_device_id(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta,
+                             y, incy, dependencies);
+    return done;
+}
+
+static inline sycl::event gemv_device_scalars(sycl::queue &queue, transpose trans, std::int64_t m,
+                                              std::int64_t n, const std::complex<double> *alpha,
+                                              const std::complex<double> *a, std::int64_t lda,
+                                              const std::complex<double> *x, std::int64_t incx,
+                                              const std::complex<double> *beta,
+                                              std::complex<double> *y, std::int64_t incy,
+                                              const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemv(get_device_id(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta,
+                             y, incy, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_device_scalars(sycl::queue &queue, transpose transa,
+                                              transpose transb, std::int64_t m, std::int64_t n,
+                                              std::int64_t k, const float *alpha, const float *a,
+                                              std::int64_t lda, const float *b, std::int64_t ldb,
+                                              const float *beta, float *c, std::int64_t ldc,
+                                              const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                             ldb, beta, c, ldc, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_device_scalars(sycl::queue &queue, transpose transa,
+                                              transpose transb, std::int64_t m, std::int64_t n,
+                                              std::int64_t k, const double *alpha, const double *a,
+                                              std::int64_t lda, const double *b, std::int64_t ldb,
+                                              const double *beta, double *c, std::int64_t ldc,
+                                              const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                             ldb, beta, c, ldc, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_device_scalars(sycl::queue &queue, transpose transa,
+                                              transpose transb, std::int64_t m, std::int64_t n,
+                                              std::int64_t k, const std::complex<float> *alpha,
+                                              const std::complex<float> *a, std::int64_t lda,
+                                              const std::complex<float> *b, std::int64_t ldb,
+                                              const std::complex<float> *beta,
+                                              std::complex<float> *c, std::int64_t ldc,
+                                              const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                             ldb, beta, c, ldc, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_device_scalars(sycl::queue &queue, transpose transa,
+                                              transpose transb, std::int64_t m, std::int64_t n,
+                                              std::int64_t k, const std::complex<double> *alpha,
+                                              const std::complex<double> *a, std::int64_t lda,
+                                              const std::complex<double> *b, std::int64_t ldb,
+                                              const std::complex<double> *beta,
+                                              std::complex<double> *c, std::int64_t ldc,
+                                              const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                             ldb, beta, c, ldc, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_batch_device_scalars(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, const float *alpha, const float *a, std::int64_t lda, std::int64_t stride_a,
+    const float *b, std::int64_t ldb, std::int64_t stride_b, const float *beta, float *c,
+    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_batch(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a,
+                                   lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                                   batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_batch_device_scalars(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, const double *alpha, const double *a, std::int64_t lda, std::int64_t stride_a,
+    const double *b, std::int64_t ldb, std::int64_t stride_b, const double *beta, double *c,
+    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_batch(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a,
+                                   lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                                   batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_batch_device_scalars(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, const std::complex<float> *alpha, const std::complex<float> *a,
+    std::int64_t lda, std::int64_t stride_a, const std::complex<float> *b, std::int64_t ldb,
+    std::int64_t stride_b, const std::complex<float> *beta, std::complex<float> *c,
+    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_batch(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a,
+                                   lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                                   batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_batch_device_scalars(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, const std::complex<double> *alpha, const std::complex<double> *a,
+    std::int64_t lda, std::int64_t stride_a, const std::complex<double> *b, std::int64_t ldb,
+    std::int64_t stride_b, const std::complex<double> *beta, std::complex<double> *c,
+    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_batch(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a,
+                                   lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                                   batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm3m(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+    std::complex<float> *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm3m(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                               b, ldb, beta, c, ldc, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm3m(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+    std::complex<double> *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm3m(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                               b, ldb, beta, c, ldc, dependencies);
+    return done;
+}
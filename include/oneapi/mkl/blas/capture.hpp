@@ -0,0 +1,248 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_CAPTURE_HPP_
+#define _ONEMKL_BLAS_CAPTURE_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "oneapi/mkl/exceptions.hpp"
+
+// Record-and-replay of sequences of BLAS calls.
+//
+// begin_capture(queue) switches the queue to recording into a SYCL command
+// graph (sycl_ext_oneapi_graph): the calls that follow are not run, their
+// kernels are recorded with the arguments they were given. end_capture(queue)
+// returns the sequence, finalized, and replay(queue) submits all of it at
+// once, without the argument conversion, dispatch and submission each call
+// costs on the host.
+//
+// Without the graph extension, capture(queue, sequence) keeps the callable
+// itself as the command list and replay runs it again; begin_capture and
+// end_capture are unavailable there. Without sycl_ext_oneapi_enqueue_barrier
+// as well, replay waits for the queue and returns a default event.
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+
+namespace detail {
+
+/** USM scratch allocated by backends for the commands of a recorded graph.
+ *  Every replay runs on the same scratch, so it lives as long as the
+ *  sequence and is freed once the replays submitted so far have completed.
+**/
+class capture_resources {
+public:
+    explicit capture_resources(sycl::context context) : context_(std::move(context)) {}
+
+    capture_resources(const capture_resources &) = delete;
+    capture_resources &operator=(const capture_resources &) = delete;
+
+    ~capture_resources() {
+        for (auto &event : replays_) {
+            event.wait();
+        }
+        for (void *ptr : scratch_) {
+            sycl::free(ptr, context_);
+        }
+    }
+
+    void add_scratch(void *ptr) {
+        std::lock_guard<std::mutex> guard(lock_);
+        scratch_.push_back(ptr);
+    }
+
+    void add_replay(sycl::event event) {
+        std::lock_guard<std::mutex> guard(lock_);
+        std::vector<sycl::event> pending;
+        for (auto &replay : replays_) {
+            if (replay.get_info<sycl::info::event::command_execution_status>() !=
+                sycl::info::event_command_status::complete) {
+                pending.push_back(std::move(replay));
+            }
+        }
+        pending.push_back(std::move(event));
+        replays_ = std::move(pending);
+    }
+
+private:
+    std::mutex lock_;
+    sycl::context context_;
+    std::vector<void *> scratch_;
+    std::vector<sycl::event> replays_;
+};
+
+} // namespace detail
+
+#endif // SYCL_EXT_ONEAPI_GRAPH
+
+class captured_sequence {
+public:
+    /** Submits the recorded sequence to queue, which must be on the device and
+     *  context the sequence was captured on. Returns an event that completes
+     *  with the last command of the sequence.
+    **/
+    sycl::event replay(sycl::queue &queue) const {
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+        if (graph_) {
+            sycl::event event = queue.ext_oneapi_graph(*graph_);
+            resources_->add_replay(event);
+            return event;
+        }
+#endif
+        sequence_(queue);
+#ifdef SYCL_EXT_ONEAPI_ENQUEUE_BARRIER
+        return queue.ext_oneapi_submit_barrier();
+#else
+        // Without a barrier there is no event for the calls of the sequence.
+        queue.wait();
+        return sycl::event();
+#endif
+    }
+
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+    using executable_graph = sycl::ext::oneapi::experimental::command_graph<
+        sycl::ext::oneapi::experimental::graph_state::executable>;
+
+    captured_sequence(executable_graph graph, std::shared_ptr<detail::capture_resources> resources)
+            : graph_(std::move(graph)),
+              resources_(std::move(resources)) {}
+#endif
+
+    explicit captured_sequence(std::function<void(sycl::queue &)> sequence)
+            : sequence_(std::move(sequence)) {}
+
+private:
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+    std::optional<executable_graph> graph_;
+    std::shared_ptr<detail::capture_resources> resources_;
+#endif
+    std::function<void(sycl::queue &)> sequence_;
+};
+
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+
+namespace detail {
+
+using modifiable_graph = sycl::ext::oneapi::experimental::command_graph<
+    sycl::ext::oneapi::experimental::graph_state::modifiable>;
+
+struct recording {
+    modifiable_graph graph;
+    std::shared_ptr<capture_resources> resources;
+};
+
+/** Graphs being recorded, by queue. **/
+struct capture_registry {
+    std::mutex lock;
+    std::unordered_map<sycl::queue, recording> graphs;
+};
+
+inline capture_registry &get_capture_registry() {
+    static capture_registry registry;
+    return registry;
+}
+
+/** Hands the USM allocation ptr, used by commands recorded on queue, to the
+ *  sequence being captured there, which frees it when it is destroyed.
+ *  Returns false if queue is not recording through begin_capture.
+**/
+inline bool add_capture_scratch(const sycl::queue &queue, void *ptr) {
+    auto &registry = get_capture_registry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    auto it = registry.graphs.find(queue);
+    if (it == registry.graphs.end()) {
+        return false;
+    }
+    it->second.resources->add_scratch(ptr);
+    return true;
+}
+
+} // namespace detail
+
+/** Starts recording the commands submitted to queue. **/
+inline void begin_capture(sycl::queue &queue) {
+    auto &registry = detail::get_capture_registry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    auto &graphs = registry.graphs;
+    if (graphs.count(queue)) {
+        throw invalid_argument("blas", "begin_capture", "queue is already being captured");
+    }
+    detail::recording recording{
+        detail::modifiable_graph(queue.get_context(), queue.get_device()),
+        std::make_shared<detail::capture_resources>(queue.get_context())
+    };
+    auto it = graphs.emplace(queue, std::move(recording)).first;
+    it->second.graph.begin_recording(queue);
+}
+
+/** Stops recording on queue and returns the recorded sequence. **/
+inline captured_sequence end_capture(sycl::queue &queue) {
+    auto &registry = detail::get_capture_registry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    auto &graphs = registry.graphs;
+    auto it = graphs.find(queue);
+    if (it == graphs.end()) {
+        throw invalid_argument("blas", "end_capture", "queue is not being captured");
+    }
+    it->second.graph.end_recording(queue);
+    captured_sequence sequence(it->second.graph.finalize(), std::move(it->second.resources));
+    graphs.erase(it);
+    return sequence;
+}
+
+#endif // SYCL_EXT_ONEAPI_GRAPH
+
+/** Captures the calls sequence(queue) makes on queue. **/
+template <typename Sequence>
+captured_sequence capture(sycl::queue &queue, Sequence &&sequence) {
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+    begin_capture(queue);
+    try {
+        sequence(queue);
+    }
+    catch (...) {
+        end_capture(queue);
+        throw;
+    }
+    return end_capture(queue);
+#else
+    return captured_sequence(std::function<void(sycl::queue &)>(std::forward<Sequence>(sequence)));
+#endif
+}
+
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _ONEMKL_BLAS_CAPTURE_HPP_
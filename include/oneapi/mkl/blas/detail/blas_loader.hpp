@@ -39,6 +39,8 @@ namespace blas {
 namespace column_major {
 namespace detail {
 
+constexpr bool is_column_major = true;
+
 #include "blas_loader.hxx"
 
 } //namespace detail
@@ -46,6 +48,8 @@ namespace detail {
 namespace row_major {
 namespace detail {
 
+constexpr bool is_column_major = false;
+
 #include "blas_loader.hxx"
 
 } //namespace detail
@@ -994,6 +994,112 @@ void omatadd(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
              std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
              sycl::buffer<std::complex<double>, 1> &c, int64_t ldc);
 
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<float, 1> &a,
+                   int64_t lda, sycl::buffer<float, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max);
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<sycl::half, 1> &a,
+                   int64_t lda, sycl::buffer<sycl::half, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<sycl::half, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max);
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<sycl::half, 1> &a,
+                   int64_t lda, sycl::buffer<sycl::half, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max);
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a,
+                   int64_t lda, sycl::buffer<bfloat16, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<bfloat16, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max);
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a,
+                   int64_t lda, sycl::buffer<bfloat16, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max);
+
+int64_t sgemm_pack_get_size(sycl::queue &queue, gemm_pack_matrix identifier, int64_t m, int64_t n,
+                            int64_t k);
+
+int64_t dgemm_pack_get_size(sycl::queue &queue, gemm_pack_matrix identifier, int64_t m, int64_t n,
+                            int64_t k);
+
+void gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+               int64_t n, int64_t k, float alpha, sycl::buffer<float, 1> &src, int64_t ld,
+               sycl::buffer<float, 1> &dest);
+
+void gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+               int64_t n, int64_t k, double alpha, sycl::buffer<double, 1> &src, int64_t ld,
+               sycl::buffer<double, 1> &dest);
+
+void gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa, transpose transb,
+                  int64_t m, int64_t n, int64_t k, sycl::buffer<float, 1> &a, int64_t lda,
+                  sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+                  int64_t ldc);
+
+void gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa, transpose transb,
+                  int64_t m, int64_t n, int64_t k, sycl::buffer<double, 1> &a, int64_t lda,
+                  sycl::buffer<double, 1> &b, int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+                  int64_t ldc);
+
+void axpy_dot(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+              sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+              sycl::buffer<float, 1> &result);
+
+void axpy_dot(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x, int64_t incx,
+              sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+              sycl::buffer<double, 1> &result);
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+          sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+          sycl::buffer<float, 1> &result);
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+          sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+          sycl::buffer<double, 1> &result);
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+                float beta, sycl::buffer<float, 1> &y, int64_t incy,
+                sycl::buffer<float, 1> &result);
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x,
+                int64_t incx, double beta, sycl::buffer<double, 1> &y, int64_t incy,
+                sycl::buffer<double, 1> &result);
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<float> alpha,
+                sycl::buffer<std::complex<float>, 1> &x, int64_t incx, std::complex<float> beta,
+                sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
+                sycl::buffer<float, 1> &result);
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<double> alpha,
+                sycl::buffer<std::complex<double>, 1> &x, int64_t incx, std::complex<double> beta,
+                sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
+                sycl::buffer<double, 1> &result);
+
+void mdot(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+          sycl::buffer<float, 1> &y, int64_t incy, int64_t stridey, sycl::buffer<float, 1> &result,
+          int64_t batch_size);
+
+void mdot(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+          sycl::buffer<double, 1> &y, int64_t incy, int64_t stridey,
+          sycl::buffer<double, 1> &result, int64_t batch_size);
+
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+            std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+            sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
+            sycl::buffer<std::complex<float>, 1> &c, int64_t ldc);
+
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+            std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+            sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
+            sycl::buffer<std::complex<double>, 1> &c, int64_t ldc);
+
 // USM APIs
 
 sycl::event asum(sycl::queue &queue, std::int64_t n, const std::complex<float> *x,
@@ -2310,3 +2416,242 @@ sycl::event imatcopy_batch(sycl::queue& queue, transpose* trans, int64_t* m, int
                            std::complex<double>* alpha, std::complex<double>** ab, int64_t* lda,
                            int64_t* ldb, int64_t group_count, int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies = {});
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb,
+                          offset offset_bias, int64_t m, int64_t n, int64_t k, float alpha,
+                          const float *a, int64_t lda, const float *b, int64_t ldb, float beta,
+                          float *c, int64_t ldc, const float *bias, activation act, float clamp_min,
+                          float clamp_max, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const sycl::half *a, int64_t lda, const sycl::half *b,
+    int64_t ldb, float beta, sycl::half *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const sycl::half *a, int64_t lda, const sycl::half *b,
+    int64_t ldb, float beta, float *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const bfloat16 *a, int64_t lda, const bfloat16 *b,
+    int64_t ldb, float beta, bfloat16 *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const bfloat16 *a, int64_t lda, const bfloat16 *b,
+    int64_t ldb, float beta, float *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+                      int64_t n, int64_t k, float alpha, const float *src, int64_t ld, float *dest,
+                      const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+                      int64_t n, int64_t k, double alpha, const double *src, int64_t ld,
+                      double *dest, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa,
+                         transpose transb, int64_t m, int64_t n, int64_t k, const float *a,
+                         int64_t lda, const float *b, int64_t ldb, float beta, float *c,
+                         int64_t ldc, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa,
+                         transpose transb, int64_t m, int64_t n, int64_t k, const double *a,
+                         int64_t lda, const double *b, int64_t ldb, double beta, double *c,
+                         int64_t ldc, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, int64_t *m,
+                        int64_t *n, int64_t *k, float alpha, const float **a, int64_t *lda,
+                        const float **b, int64_t *ldb, float beta, float **c, int64_t *ldc,
+                        int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, int64_t *m,
+                        int64_t *n, int64_t *k, double alpha, const double **a, int64_t *lda,
+                        const double **b, int64_t *ldb, double beta, double **c, int64_t *ldc,
+                        int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_vbatch(
+    sycl::queue &queue, transpose transa, transpose transb, int64_t *m, int64_t *n, int64_t *k,
+    std::complex<float> alpha, const std::complex<float> **a, int64_t *lda,
+    const std::complex<float> **b, int64_t *ldb, std::complex<float> beta, std::complex<float> **c,
+    int64_t *ldc, int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, int64_t *m,
+                        int64_t *n, int64_t *k, std::complex<double> alpha,
+                        const std::complex<double> **a, int64_t *lda,
+                        const std::complex<double> **b, int64_t *ldb, std::complex<double> beta,
+                        std::complex<double> **c, int64_t *ldc, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                     float *y, int64_t incy, const float *z, int64_t incz, float *result,
+                     const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                     double *y, int64_t incy, const double *z, int64_t incz, double *result,
+                     const std::vector<sycl::event> &dependencies = {});
+
+sycl::event dot2(sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
+                 int64_t incy, const float *z, int64_t incz, float *result,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event dot2(sycl::queue &queue, int64_t n, const double *x, int64_t incx, const double *y,
+                 int64_t incy, const double *z, int64_t incz, double *result,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                       float beta, float *y, int64_t incy, float *result,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                       double beta, double *y, int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<float> alpha,
+                       const std::complex<float> *x, int64_t incx, std::complex<float> beta,
+                       std::complex<float> *y, int64_t incy, float *result,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<double> alpha,
+                       const std::complex<double> *x, int64_t incx, std::complex<double> beta,
+                       std::complex<double> *y, int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event mdot(sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
+                 int64_t incy, int64_t stridey, float *result, int64_t batch_size,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event mdot(sycl::queue &queue, int64_t n, const double *x, int64_t incx, const double *y,
+                 int64_t incy, int64_t stridey, double *result, int64_t batch_size,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const float *alpha, const float *x, int64_t incx,
+                 float *y, int64_t incy, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const double *alpha, const double *x, int64_t incx,
+                 double *y, int64_t incy, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                 const std::complex<float> *x, int64_t incx, std::complex<float> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                 const std::complex<double> *x, int64_t incx, std::complex<double> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const float *alpha, const float *x, int64_t incx,
+                  const float *beta, float *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const double *alpha, const double *x, int64_t incx,
+                  const double *beta, double *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                  const std::complex<float> *x, int64_t incx, const std::complex<float> *beta,
+                  std::complex<float> *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                  const std::complex<double> *x, int64_t incx, const std::complex<double> *beta,
+                  std::complex<double> *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies = {});
+
+sycl::event scal(sycl::queue &queue, int64_t n, const float *alpha, float *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event scal(sycl::queue &queue, int64_t n, const double *alpha, double *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event scal(sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                 std::complex<float> *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event scal(sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                 std::complex<double> *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, const float *alpha,
+                 const float *a, int64_t lda, const float *x, int64_t incx, const float *beta,
+                 float *y, int64_t incy, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, const double *alpha,
+                 const double *a, int64_t lda, const double *x, int64_t incx, const double *beta,
+                 double *y, int64_t incy, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                 const std::complex<float> *alpha, const std::complex<float> *a, int64_t lda,
+                 const std::complex<float> *x, int64_t incx, const std::complex<float> *beta,
+                 std::complex<float> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                 const std::complex<double> *alpha, const std::complex<double> *a, int64_t lda,
+                 const std::complex<double> *x, int64_t incx, const std::complex<double> *beta,
+                 std::complex<double> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const float *alpha, const float *a, int64_t lda, const float *b,
+                 int64_t ldb, const float *beta, float *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const double *alpha, const double *a, int64_t lda, const double *b,
+                 int64_t ldb, const double *beta, double *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const std::complex<float> *alpha, const std::complex<float> *a,
+                 int64_t lda, const std::complex<float> *b, int64_t ldb,
+                 const std::complex<float> *beta, std::complex<float> *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const std::complex<double> *alpha, const std::complex<double> *a,
+                 int64_t lda, const std::complex<double> *b, int64_t ldb,
+                 const std::complex<double> *beta, std::complex<double> *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const float *alpha, const float *a, int64_t lda, int64_t stride_a,
+                       const float *b, int64_t ldb, int64_t stride_b, const float *beta, float *c,
+                       int64_t ldc, int64_t stride_c, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const double *alpha, const double *a, int64_t lda,
+                       int64_t stride_a, const double *b, int64_t ldb, int64_t stride_b,
+                       const double *beta, double *c, int64_t ldc, int64_t stride_c,
+                       int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const std::complex<float> *alpha, const std::complex<float> *a,
+                       int64_t lda, int64_t stride_a, const std::complex<float> *b, int64_t ldb,
+                       int64_t stride_b, const std::complex<float> *beta, std::complex<float> *c,
+                       int64_t ldc, int64_t stride_c, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const std::complex<double> *alpha, const std::complex<double> *a,
+                       int64_t lda, int64_t stride_a, const std::complex<double> *b, int64_t ldb,
+                       int64_t stride_b, const std::complex<double> *beta, std::complex<double> *c,
+                       int64_t ldc, int64_t stride_c, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                   const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                   std::complex<float> *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                   int64_t lda, const std::complex<double> *b, int64_t ldb,
+                   std::complex<double> beta, std::complex<double> *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies = {});
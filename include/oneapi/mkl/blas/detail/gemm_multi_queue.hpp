@@ -0,0 +1,181 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_GEMM_MULTI_QUEUE_HPP_
+#define _ONEMKL_BLAS_GEMM_MULTI_QUEUE_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/types.hpp"
+
+// One GEMM spread over several queues, typically one per sub-device of a
+// partitioned CPU or GPU. C is cut into a grid of tiles, one per queue, and
+// each queue computes its tile with its own gemm call, dispatched to the
+// backend of its device. Tiles in the same row of the grid read the same rows
+// of op(A) and tiles in the same column the same columns of op(B), so the grid
+// is shaped to keep tiles close to square, which minimises the panel data each
+// queue reads.
+//
+// On a sub-device the panels of A and B a tile reads are first copied into
+// memory allocated on that sub-device, by a kernel running there, so for a
+// NUMA-partitioned CPU the pages land on the node that multiplies them. Whole
+// devices use the caller's operands in place.
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace detail {
+
+struct gemm_multi_queue_tile {
+    std::int64_t row, col, rows, cols;
+};
+
+/** Cuts the m x n matrix C into a grid of num_tiles tiles. The grid is chosen
+ *  to minimise the perimeter of the largest tile; tile i is in row i / q and
+ *  column i % q of a p x q grid. Tiles can be empty when C is smaller than the
+ *  grid.
+**/
+inline std::vector<gemm_multi_queue_tile> gemm_multi_queue_tiles(std::int64_t num_tiles,
+                                                                  std::int64_t m, std::int64_t n) {
+    std::int64_t best_p = 1;
+    std::int64_t best_cost = std::numeric_limits<std::int64_t>::max();
+    for (std::int64_t p = 1; p <= num_tiles; ++p) {
+        if (num_tiles % p != 0) {
+            continue;
+        }
+        const std::int64_t q = num_tiles / p;
+        const std::int64_t cost = (m + p - 1) / p + (n + q - 1) / q;
+        if (cost < best_cost) {
+            best_cost = cost;
+            best_p = p;
+        }
+    }
+    const std::int64_t p = best_p;
+    const std::int64_t q = num_tiles / p;
+    std::vector<gemm_multi_queue_tile> tiles;
+    tiles.reserve(num_tiles);
+    for (std::int64_t r = 0; r < p; ++r) {
+        const std::int64_t row = m * r / p;
+        const std::int64_t rows = m * (r + 1) / p - row;
+        for (std::int64_t s = 0; s < q; ++s) {
+            const std::int64_t col = n * s / q;
+            const std::int64_t cols = n * (s + 1) / q - col;
+            tiles.push_back({ row, col, rows, cols });
+        }
+    }
+    return tiles;
+}
+
+inline bool is_sub_device(const sycl::device &device) {
+    return device.get_info<sycl::info::device::partition_type_property>() !=
+           sycl::info::partition_property::no_partition;
+}
+
+/** Copies count vectors of len contiguous elements, ld apart in src, into a
+ *  dense block allocated on the device of queue.
+**/
+template <typename T>
+T *gemm_multi_queue_pack(sycl::queue &queue, const T *src, std::int64_t ld, std::int64_t len,
+                         std::int64_t count, const std::vector<sycl::event> &dependencies,
+                         std::vector<sycl::event> &packed) {
+    T *dst = sycl::malloc_device<T>(len * count, queue);
+    packed.push_back(queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.parallel_for(sycl::range<2>(count, len), [=](sycl::item<2> item) {
+            dst[item[0] * len + item[1]] = src[item[0] * ld + item[1]];
+        });
+    }));
+    return dst;
+}
+
+/** C := alpha * op(A) * op(B) + beta * C over queues. tile_gemm(queue, rows,
+ *  cols, a, lda, b, ldb, c, dependencies) computes one tile with the gemm of
+ *  the calling layout. The returned event completes when every tile is done
+ *  and the packed panels have been freed.
+**/
+template <typename T, typename TileGemm>
+sycl::event gemm_multi_queue(const std::vector<sycl::queue> &queues, bool column_major,
+                             transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                             std::int64_t k, const T *a, std::int64_t lda, const T *b,
+                             std::int64_t ldb, T *c, std::int64_t ldc,
+                             const std::vector<sycl::event> &dependencies, TileGemm tile_gemm) {
+    if (queues.empty()) {
+        throw invalid_argument("blas", "gemm", "queues must not be empty");
+    }
+    // Whether consecutive rows of op(A), or consecutive columns of op(B), are
+    // lda (ldb) elements apart rather than adjacent.
+    const bool a_rows_strided = column_major != (transa == transpose::nontrans);
+    const bool b_cols_strided = column_major == (transb == transpose::nontrans);
+
+    const auto tiles = gemm_multi_queue_tiles(static_cast<std::int64_t>(queues.size()), m, n);
+    std::vector<sycl::event> tile_events;
+    for (std::size_t i = 0; i < queues.size(); ++i) {
+        const gemm_multi_queue_tile &tile = tiles[i];
+        if (tile.rows == 0 || tile.cols == 0) {
+            continue;
+        }
+        sycl::queue queue = queues[i];
+        const T *a_tile = a + (a_rows_strided ? tile.row * lda : tile.row);
+        const T *b_tile = b + (b_cols_strided ? tile.col * ldb : tile.col);
+        T *c_tile = c + (column_major ? tile.row + tile.col * ldc : tile.row * ldc + tile.col);
+
+        if (k == 0 || !is_sub_device(queue.get_device())) {
+            tile_events.push_back(tile_gemm(queue, tile.rows, tile.cols, a_tile, lda, b_tile, ldb,
+                                            c_tile, dependencies));
+            continue;
+        }
+
+        std::vector<sycl::event> packed;
+        const std::int64_t a_len = a_rows_strided ? k : tile.rows;
+        const std::int64_t b_len = b_cols_strided ? k : tile.cols;
+        T *a_packed = gemm_multi_queue_pack(queue, a_tile, lda, a_len,
+                                            a_rows_strided ? tile.rows : k, dependencies, packed);
+        T *b_packed = gemm_multi_queue_pack(queue, b_tile, ldb, b_len,
+                                            b_cols_strided ? tile.cols : k, dependencies, packed);
+        auto gemm_event = tile_gemm(queue, tile.rows, tile.cols, static_cast<const T *>(a_packed),
+                                    a_len, static_cast<const T *>(b_packed), b_len, c_tile,
+                                    packed);
+        tile_events.push_back(queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(gemm_event);
+            cgh.host_task([=]() {
+                sycl::free(a_packed, queue);
+                sycl::free(b_packed, queue);
+            });
+        }));
+    }
+    sycl::queue joint_queue = queues.front();
+    return joint_queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(tile_events.empty() ? dependencies : tile_events);
+    });
+}
+
+} // namespace detail
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_BLAS_GEMM_MULTI_QUEUE_HPP_
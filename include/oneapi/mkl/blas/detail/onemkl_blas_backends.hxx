@@ -1224,6 +1224,133 @@ ONEMKL_EXPORT void omatadd(sycl::queue &queue, oneapi::mkl::transpose transa,
                            sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                            sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
 
+ONEMKL_EXPORT void gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+    sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb,
+    float beta, sycl::buffer<float, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+    oneapi::mkl::activation act, float clamp_min, float clamp_max);
+
+ONEMKL_EXPORT void gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+    sycl::buffer<sycl::half, 1> &a, std::int64_t lda, sycl::buffer<sycl::half, 1> &b,
+    std::int64_t ldb, float beta, sycl::buffer<sycl::half, 1> &c, std::int64_t ldc,
+    sycl::buffer<float, 1> &bias, oneapi::mkl::activation act, float clamp_min, float clamp_max);
+
+ONEMKL_EXPORT void gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+    sycl::buffer<sycl::half, 1> &a, std::int64_t lda, sycl::buffer<sycl::half, 1> &b,
+    std::int64_t ldb, float beta, sycl::buffer<float, 1> &c, std::int64_t ldc,
+    sycl::buffer<float, 1> &bias, oneapi::mkl::activation act, float clamp_min, float clamp_max);
+
+ONEMKL_EXPORT void gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+    sycl::buffer<bfloat16, 1> &a, std::int64_t lda, sycl::buffer<bfloat16, 1> &b, std::int64_t ldb,
+    float beta, sycl::buffer<bfloat16, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+    oneapi::mkl::activation act, float clamp_min, float clamp_max);
+
+ONEMKL_EXPORT void gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+    sycl::buffer<bfloat16, 1> &a, std::int64_t lda, sycl::buffer<bfloat16, 1> &b, std::int64_t ldb,
+    float beta, sycl::buffer<float, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+    oneapi::mkl::activation act, float clamp_min, float clamp_max);
+
+ONEMKL_EXPORT std::int64_t sgemm_pack_get_size(sycl::queue &queue,
+                                               oneapi::mkl::gemm_pack_matrix identifier,
+                                               std::int64_t m, std::int64_t n, std::int64_t k);
+
+ONEMKL_EXPORT std::int64_t dgemm_pack_get_size(sycl::queue &queue,
+                                               oneapi::mkl::gemm_pack_matrix identifier,
+                                               std::int64_t m, std::int64_t n, std::int64_t k);
+
+ONEMKL_EXPORT void gemm_pack(sycl::queue &queue, oneapi::mkl::gemm_pack_matrix identifier,
+                             oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                             std::int64_t k, float alpha, sycl::buffer<float, 1> &src,
+                             std::int64_t ld, sycl::buffer<float, 1> &dest);
+
+ONEMKL_EXPORT void gemm_pack(sycl::queue &queue, oneapi::mkl::gemm_pack_matrix identifier,
+                             oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                             std::int64_t k, double alpha, sycl::buffer<double, 1> &src,
+                             std::int64_t ld, sycl::buffer<double, 1> &dest);
+
+ONEMKL_EXPORT void gemm_compute(
+    sycl::queue &queue, oneapi::mkl::gemm_pack_matrix packed, oneapi::mkl::transpose transa,
+    oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+    sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb,
+    float beta, sycl::buffer<float, 1> &c, std::int64_t ldc);
+
+ONEMKL_EXPORT void gemm_compute(
+    sycl::queue &queue, oneapi::mkl::gemm_pack_matrix packed, oneapi::mkl::transpose transa,
+    oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+    sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb,
+    double beta, sycl::buffer<double, 1> &c, std::int64_t ldc);
+
+ONEMKL_EXPORT void axpy_dot(sycl::queue &queue, std::int64_t n, float alpha,
+                            sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
+                            std::int64_t incy, sycl::buffer<float, 1> &z, std::int64_t incz,
+                            sycl::buffer<float, 1> &result);
+
+ONEMKL_EXPORT void axpy_dot(
+    sycl::queue &queue, std::int64_t n, double alpha, sycl::buffer<double, 1> &x, std::int64_t incx,
+    sycl::buffer<double, 1> &y, std::int64_t incy, sycl::buffer<double, 1> &z, std::int64_t incz,
+    sycl::buffer<double, 1> &result);
+
+ONEMKL_EXPORT void dot2(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                        std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+                        sycl::buffer<float, 1> &z, std::int64_t incz,
+                        sycl::buffer<float, 1> &result);
+
+ONEMKL_EXPORT void dot2(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                        std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy,
+                        sycl::buffer<double, 1> &z, std::int64_t incz,
+                        sycl::buffer<double, 1> &result);
+
+ONEMKL_EXPORT void axpby_nrm2(
+    sycl::queue &queue, std::int64_t n, float alpha, sycl::buffer<float, 1> &x, std::int64_t incx,
+    float beta, sycl::buffer<float, 1> &y, std::int64_t incy, sycl::buffer<float, 1> &result);
+
+ONEMKL_EXPORT void axpby_nrm2(
+    sycl::queue &queue, std::int64_t n, double alpha, sycl::buffer<double, 1> &x, std::int64_t incx,
+    double beta, sycl::buffer<double, 1> &y, std::int64_t incy, sycl::buffer<double, 1> &result);
+
+ONEMKL_EXPORT void axpby_nrm2(sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                              sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                              std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &y,
+                              std::int64_t incy, sycl::buffer<float, 1> &result);
+
+ONEMKL_EXPORT void axpby_nrm2(sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                              sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                              std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &y,
+                              std::int64_t incy, sycl::buffer<double, 1> &result);
+
+ONEMKL_EXPORT void mdot(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                        std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+                        std::int64_t stridey, sycl::buffer<float, 1> &result,
+                        std::int64_t batch_size);
+
+ONEMKL_EXPORT void mdot(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                        std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy,
+                        std::int64_t stridey, sycl::buffer<double, 1> &result,
+                        std::int64_t batch_size);
+
+ONEMKL_EXPORT void gemm3m(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+    sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+    sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+    sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+
+ONEMKL_EXPORT void gemm3m(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+    sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+    sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+    sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+
 // USM APIs
 
 ONEMKL_EXPORT sycl::event gemm(sycl::queue &queue, oneapi::mkl::transpose transa,
@@ -2867,3 +2994,285 @@ ONEMKL_EXPORT sycl::event imatcopy_batch(sycl::queue& queue, transpose* trans, s
                                          std::int64_t* ldb, std::int64_t group_count,
                                          std::int64_t* groupsize,
                                          const std::vector<sycl::event>& dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+    const float *a, std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c,
+    std::int64_t ldc, const float *bias, oneapi::mkl::activation act, float clamp_min,
+    float clamp_max, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+    const sycl::half *a, std::int64_t lda, const sycl::half *b, std::int64_t ldb, float beta,
+    sycl::half *c, std::int64_t ldc, const float *bias, oneapi::mkl::activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+    const sycl::half *a, std::int64_t lda, const sycl::half *b, std::int64_t ldb, float beta,
+    float *c, std::int64_t ldc, const float *bias, oneapi::mkl::activation act, float clamp_min,
+    float clamp_max, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+    const bfloat16 *a, std::int64_t lda, const bfloat16 *b, std::int64_t ldb, float beta,
+    bfloat16 *c, std::int64_t ldc, const float *bias, oneapi::mkl::activation act, float clamp_min,
+    float clamp_max, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+    const bfloat16 *a, std::int64_t lda, const bfloat16 *b, std::int64_t ldb, float beta, float *c,
+    std::int64_t ldc, const float *bias, oneapi::mkl::activation act, float clamp_min,
+    float clamp_max, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_pack(sycl::queue &queue, oneapi::mkl::gemm_pack_matrix identifier,
+                                    oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                    std::int64_t k, float alpha, const float *src, std::int64_t ld,
+                                    float *dest, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_pack(
+    sycl::queue &queue, oneapi::mkl::gemm_pack_matrix identifier, oneapi::mkl::transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *src,
+    std::int64_t ld, double *dest, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_compute(
+    sycl::queue &queue, oneapi::mkl::gemm_pack_matrix packed, oneapi::mkl::transpose transa,
+    oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, const float *a,
+    std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_compute(
+    sycl::queue &queue, oneapi::mkl::gemm_pack_matrix packed, oneapi::mkl::transpose transa,
+    oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, const double *a,
+    std::int64_t lda, const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_vbatch(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t *m, std::int64_t *n, std::int64_t *k, float alpha, const float **a,
+    std::int64_t *lda, const float **b, std::int64_t *ldb, float beta, float **c, std::int64_t *ldc,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_vbatch(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t *m, std::int64_t *n, std::int64_t *k, double alpha, const double **a,
+    std::int64_t *lda, const double **b, std::int64_t *ldb, double beta, double **c,
+    std::int64_t *ldc, std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_vbatch(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t *m, std::int64_t *n, std::int64_t *k, std::complex<float> alpha,
+    const std::complex<float> **a, std::int64_t *lda, const std::complex<float> **b,
+    std::int64_t *ldb, std::complex<float> beta, std::complex<float> **c, std::int64_t *ldc,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_vbatch(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t *m, std::int64_t *n, std::int64_t *k, std::complex<double> alpha,
+    const std::complex<double> **a, std::int64_t *lda, const std::complex<double> **b,
+    std::int64_t *ldb, std::complex<double> beta, std::complex<double> **c, std::int64_t *ldc,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpy_dot(sycl::queue &queue, std::int64_t n, float alpha, const float *x,
+                                   std::int64_t incx, float *y, std::int64_t incy, const float *z,
+                                   std::int64_t incz, float *result,
+                                   const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpy_dot(sycl::queue &queue, std::int64_t n, double alpha,
+                                   const double *x, std::int64_t incx, double *y, std::int64_t incy,
+                                   const double *z, std::int64_t incz, double *result,
+                                   const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event dot2(sycl::queue &queue, std::int64_t n, const float *x,
+                               std::int64_t incx, const float *y, std::int64_t incy, const float *z,
+                               std::int64_t incz, float *result,
+                               const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event dot2(sycl::queue &queue, std::int64_t n, const double *x,
+                               std::int64_t incx, const double *y, std::int64_t incy,
+                               const double *z, std::int64_t incz, double *result,
+                               const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpby_nrm2(
+    sycl::queue &queue, std::int64_t n, float alpha, const float *x, std::int64_t incx, float beta,
+    float *y, std::int64_t incy, float *result, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpby_nrm2(sycl::queue &queue, std::int64_t n, double alpha,
+                                     const double *x, std::int64_t incx, double beta, double *y,
+                                     std::int64_t incy, double *result,
+                                     const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpby_nrm2(
+    sycl::queue &queue, std::int64_t n, std::complex<float> alpha, const std::complex<float> *x,
+    std::int64_t incx, std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
+    float *result, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpby_nrm2(
+    sycl::queue &queue, std::int64_t n, std::complex<double> alpha, const std::complex<double> *x,
+    std::int64_t incx, std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
+    double *result, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event mdot(sycl::queue &queue, std::int64_t n, const float *x,
+                               std::int64_t incx, const float *y, std::int64_t incy,
+                               std::int64_t stridey, float *result, std::int64_t batch_size,
+                               const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event mdot(sycl::queue &queue, std::int64_t n, const double *x,
+                               std::int64_t incx, const double *y, std::int64_t incy,
+                               std::int64_t stridey, double *result, std::int64_t batch_size,
+                               const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpy(sycl::queue &queue, std::int64_t n, const float *alpha,
+                               const float *x, std::int64_t incx, float *y, std::int64_t incy,
+                               const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpy(sycl::queue &queue, std::int64_t n, const double *alpha,
+                               const double *x, std::int64_t incx, double *y, std::int64_t incy,
+                               const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpy(sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+                               const std::complex<float> *x, std::int64_t incx,
+                               std::complex<float> *y, std::int64_t incy,
+                               const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpy(sycl::queue &queue, std::int64_t n,
+                               const std::complex<double> *alpha, const std::complex<double> *x,
+                               std::int64_t incx, std::complex<double> *y, std::int64_t incy,
+                               const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpby(sycl::queue &queue, std::int64_t n, const float *alpha,
+                                const float *x, std::int64_t incx, const float *beta, float *y,
+                                std::int64_t incy,
+                                const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpby(sycl::queue &queue, std::int64_t n, const double *alpha,
+                                const double *x, std::int64_t incx, const double *beta, double *y,
+                                std::int64_t incy,
+                                const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpby(
+    sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+    const std::complex<float> *x, std::int64_t incx, const std::complex<float> *beta,
+    std::complex<float> *y, std::int64_t incy, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpby(
+    sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+    const std::complex<double> *x, std::int64_t incx, const std::complex<double> *beta,
+    std::complex<double> *y, std::int64_t incy, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event scal(sycl::queue &queue, std::int64_t n, const float *alpha, float *x,
+                               std::int64_t incx,
+                               const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event scal(sycl::queue &queue, std::int64_t n, const double *alpha, double *x,
+                               std::int64_t incx,
+                               const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event scal(sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+                               std::complex<float> *x, std::int64_t incx,
+                               const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event scal(
+    sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha, std::complex<double> *x,
+    std::int64_t incx, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemv(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, const float *alpha, const float *a, std::int64_t lda,
+                               const float *x, std::int64_t incx, const float *beta, float *y,
+                               std::int64_t incy,
+                               const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemv(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, const double *alpha, const double *a,
+                               std::int64_t lda, const double *x, std::int64_t incx,
+                               const double *beta, double *y, std::int64_t incy,
+                               const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemv(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    const std::complex<float> *alpha, const std::complex<float> *a, std::int64_t lda,
+    const std::complex<float> *x, std::int64_t incx, const std::complex<float> *beta,
+    std::complex<float> *y, std::int64_t incy, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemv(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    const std::complex<double> *alpha, const std::complex<double> *a, std::int64_t lda,
+    const std::complex<double> *x, std::int64_t incx, const std::complex<double> *beta,
+    std::complex<double> *y, std::int64_t incy, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm(sycl::queue &queue, oneapi::mkl::transpose transa,
+                               oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                               std::int64_t k, const float *alpha, const float *a, std::int64_t lda,
+                               const float *b, std::int64_t ldb, const float *beta, float *c,
+                               std::int64_t ldc, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, const double *alpha, const double *a,
+    std::int64_t lda, const double *b, std::int64_t ldb, const double *beta, double *c,
+    std::int64_t ldc, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<float> *alpha,
+    const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+    const std::complex<float> *beta, std::complex<float> *c, std::int64_t ldc,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<double> *alpha,
+    const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+    std::int64_t ldb, const std::complex<double> *beta, std::complex<double> *c, std::int64_t ldc,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_batch(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, const float *alpha, const float *a,
+    std::int64_t lda, std::int64_t stride_a, const float *b, std::int64_t ldb,
+    std::int64_t stride_b, const float *beta, float *c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_batch(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, const double *alpha, const double *a,
+    std::int64_t lda, std::int64_t stride_a, const double *b, std::int64_t ldb,
+    std::int64_t stride_b, const double *beta, double *c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_batch(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<float> *alpha,
+    const std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+    const std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+    const std::complex<float> *beta, std::complex<float> *c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_batch(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<double> *alpha,
+    const std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+    const std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+    const std::complex<double> *beta, std::complex<double> *c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm3m(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+    const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+    std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm3m(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+    const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+    std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+    const std::vector<sycl::event> &dependencies = {});
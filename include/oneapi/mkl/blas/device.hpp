@@ -0,0 +1,47 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_BLAS_SYCL_DEVICE_HPP__
+#define _MKL_BLAS_SYCL_DEVICE_HPP__
+
+#include <cstdint>
+
+#include <sycl/sycl.hpp>
+
+#include "oneapi/mkl/types.hpp"
+#include "oneapi/mkl/blas/device/detail/blas_device_impl.hpp"
+
+namespace oneapi::mkl::blas::device {
+namespace column_major {
+
+#define ONEMKL_BLAS_DEVICE_LAYOUT layout::col_major
+#include "oneapi/mkl/blas/device/blas_device.hxx"
+#undef ONEMKL_BLAS_DEVICE_LAYOUT
+
+} // namespace column_major
+namespace row_major {
+
+#define ONEMKL_BLAS_DEVICE_LAYOUT layout::row_major
+#include "oneapi/mkl/blas/device/blas_device.hxx"
+#undef ONEMKL_BLAS_DEVICE_LAYOUT
+
+} // namespace row_major
+} // namespace oneapi::mkl::blas::device
+
+#endif // _MKL_BLAS_SYCL_DEVICE_HPP__
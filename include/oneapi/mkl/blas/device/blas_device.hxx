@@ -0,0 +1,118 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Device routines are called by a single work-item, or cooperatively by all
+// work-items of a sub-group when a sycl::sub_group is passed first. Sizes are
+// template parameters so that the loops are fully unrolled; operands may live
+// in private, local or global memory, except that the sub-group variants
+// need outputs visible to the whole sub-group.
+
+// Level 1
+
+template <std::int64_t N, typename T>
+inline T dot(const T* x, std::int64_t incx, const T* y, std::int64_t incy) {
+    static_assert(!detail::is_complex<T>::value, "use dotc or dotu for complex types");
+    return detail::dot<N, false>(x, incx, y, incy);
+}
+
+template <std::int64_t N, typename T>
+inline T dot(const sycl::sub_group& sg, const T* x, std::int64_t incx, const T* y,
+             std::int64_t incy) {
+    static_assert(!detail::is_complex<T>::value, "use dotc or dotu for complex types");
+    return detail::dot<N, false>(sg, x, incx, y, incy);
+}
+
+template <std::int64_t N, typename T>
+inline T dotc(const T* x, std::int64_t incx, const T* y, std::int64_t incy) {
+    return detail::dot<N, true>(x, incx, y, incy);
+}
+
+template <std::int64_t N, typename T>
+inline T dotc(const sycl::sub_group& sg, const T* x, std::int64_t incx, const T* y,
+              std::int64_t incy) {
+    return detail::dot<N, true>(sg, x, incx, y, incy);
+}
+
+template <std::int64_t N, typename T>
+inline T dotu(const T* x, std::int64_t incx, const T* y, std::int64_t incy) {
+    return detail::dot<N, false>(x, incx, y, incy);
+}
+
+template <std::int64_t N, typename T>
+inline T dotu(const sycl::sub_group& sg, const T* x, std::int64_t incx, const T* y,
+              std::int64_t incy) {
+    return detail::dot<N, false>(sg, x, incx, y, incy);
+}
+
+template <std::int64_t N, typename T>
+inline void axpy(T alpha, const T* x, std::int64_t incx, T* y, std::int64_t incy) {
+    detail::axpy<N>(alpha, x, incx, y, incy);
+}
+
+template <std::int64_t N, typename T>
+inline void axpy(const sycl::sub_group& sg, T alpha, const T* x, std::int64_t incx, T* y,
+                 std::int64_t incy) {
+    detail::axpy<N>(sg, alpha, x, incx, y, incy);
+}
+
+// Level 2
+
+template <std::int64_t M, std::int64_t N, transpose Trans = transpose::nontrans, typename T>
+inline void gemv(T alpha, const T* a, std::int64_t lda, const T* x, std::int64_t incx, T beta,
+                 T* y, std::int64_t incy) {
+    detail::gemv<M, N, Trans, ONEMKL_BLAS_DEVICE_LAYOUT>(alpha, a, lda, x, incx, beta, y, incy);
+}
+
+template <std::int64_t M, std::int64_t N, transpose Trans = transpose::nontrans, typename T>
+inline void gemv(const sycl::sub_group& sg, T alpha, const T* a, std::int64_t lda, const T* x,
+                 std::int64_t incx, T beta, T* y, std::int64_t incy) {
+    detail::gemv<M, N, Trans, ONEMKL_BLAS_DEVICE_LAYOUT>(sg, alpha, a, lda, x, incx, beta, y,
+                                                         incy);
+}
+
+template <std::int64_t N, uplo Uplo, transpose Trans = transpose::nontrans,
+          diag Diag = diag::nonunit, typename T>
+inline void trsv(const T* a, std::int64_t lda, T* x, std::int64_t incx) {
+    detail::trsv<N, Uplo, Trans, Diag, ONEMKL_BLAS_DEVICE_LAYOUT>(a, lda, x, incx);
+}
+
+template <std::int64_t N, uplo Uplo, transpose Trans = transpose::nontrans,
+          diag Diag = diag::nonunit, typename T>
+inline void trsv(const sycl::sub_group& sg, const T* a, std::int64_t lda, T* x,
+                 std::int64_t incx) {
+    detail::trsv<N, Uplo, Trans, Diag, ONEMKL_BLAS_DEVICE_LAYOUT>(sg, a, lda, x, incx);
+}
+
+// Level 3
+
+template <std::int64_t M, std::int64_t N, std::int64_t K, transpose TransA = transpose::nontrans,
+          transpose TransB = transpose::nontrans, typename T>
+inline void gemm(T alpha, const T* a, std::int64_t lda, const T* b, std::int64_t ldb, T beta,
+                 T* c, std::int64_t ldc) {
+    detail::gemm<M, N, K, TransA, TransB, ONEMKL_BLAS_DEVICE_LAYOUT>(alpha, a, lda, b, ldb, beta,
+                                                                     c, ldc);
+}
+
+template <std::int64_t M, std::int64_t N, std::int64_t K, transpose TransA = transpose::nontrans,
+          transpose TransB = transpose::nontrans, typename T>
+inline void gemm(const sycl::sub_group& sg, T alpha, const T* a, std::int64_t lda, const T* b,
+                 std::int64_t ldb, T beta, T* c, std::int64_t ldc) {
+    detail::gemm<M, N, K, TransA, TransB, ONEMKL_BLAS_DEVICE_LAYOUT>(sg, alpha, a, lda, b, ldb,
+                                                                     beta, c, ldc);
+}
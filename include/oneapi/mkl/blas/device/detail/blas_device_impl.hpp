@@ -0,0 +1,294 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_BLAS_DEVICE_IMPL_HPP_
+#define _MKL_BLAS_DEVICE_IMPL_HPP_
+
+#include <complex>
+#include <cstdint>
+#include <type_traits>
+
+#include <sycl/sycl.hpp>
+
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi::mkl::blas::device::detail {
+
+template <typename T>
+struct is_complex : std::false_type {};
+
+template <typename T>
+struct is_complex<std::complex<T>> : std::true_type {};
+
+template <bool Conj, typename T>
+inline T conj_if(T x) {
+    if constexpr (Conj && is_complex<T>::value) {
+        return std::conj(x);
+    }
+    else {
+        return x;
+    }
+}
+
+// Element (i, j) of a matrix stored with leading dimension ld.
+template <layout Layout, typename T>
+inline T& elem(T* a, std::int64_t ld, std::int64_t i, std::int64_t j) {
+    if constexpr (Layout == layout::col_major) {
+        return a[i + j * ld];
+    }
+    else {
+        return a[j + i * ld];
+    }
+}
+
+// Element (i, j) of op(A).
+template <layout Layout, transpose Trans, typename T>
+inline T op_elem(const T* a, std::int64_t ld, std::int64_t i, std::int64_t j) {
+    if constexpr (Trans == transpose::nontrans) {
+        return elem<Layout>(a, ld, i, j);
+    }
+    else {
+        return conj_if<Trans == transpose::conjtrans>(elem<Layout>(a, ld, j, i));
+    }
+}
+
+// beta*y, without reading y when beta is zero as required by BLAS.
+template <typename T>
+inline T scale_output(T beta, T y) {
+    return (beta == T(0)) ? T(0) : beta * y;
+}
+
+// Sum of a value over the sub-group; sycl::plus is not defined for
+// std::complex, so complex values are reduced by parts.
+template <typename T>
+inline T sub_group_sum(const sycl::sub_group& sg, T x) {
+    if constexpr (is_complex<T>::value) {
+        using Real = typename T::value_type;
+        return T(sycl::reduce_over_group(sg, x.real(), sycl::plus<Real>()),
+                 sycl::reduce_over_group(sg, x.imag(), sycl::plus<Real>()));
+    }
+    else {
+        return sycl::reduce_over_group(sg, x, sycl::plus<T>());
+    }
+}
+
+// Level 1
+
+template <std::int64_t N, bool Conj, typename T>
+inline T dot(const T* x, std::int64_t incx, const T* y, std::int64_t incy) {
+    T sum = T(0);
+#pragma unroll
+    for (std::int64_t i = 0; i < N; ++i) {
+        sum += conj_if<Conj>(x[i * incx]) * y[i * incy];
+    }
+    return sum;
+}
+
+template <std::int64_t N, bool Conj, typename T>
+inline T dot(const sycl::sub_group& sg, const T* x, std::int64_t incx, const T* y,
+             std::int64_t incy) {
+    const std::int64_t lid = sg.get_local_linear_id();
+    const std::int64_t sg_size = sg.get_local_linear_range();
+    T sum = T(0);
+    for (std::int64_t i = lid; i < N; i += sg_size) {
+        sum += conj_if<Conj>(x[i * incx]) * y[i * incy];
+    }
+    return sub_group_sum(sg, sum);
+}
+
+template <std::int64_t N, typename T>
+inline void axpy(T alpha, const T* x, std::int64_t incx, T* y, std::int64_t incy) {
+#pragma unroll
+    for (std::int64_t i = 0; i < N; ++i) {
+        y[i * incy] += alpha * x[i * incx];
+    }
+}
+
+template <std::int64_t N, typename T>
+inline void axpy(const sycl::sub_group& sg, T alpha, const T* x, std::int64_t incx, T* y,
+                 std::int64_t incy) {
+    const std::int64_t lid = sg.get_local_linear_id();
+    const std::int64_t sg_size = sg.get_local_linear_range();
+    for (std::int64_t i = lid; i < N; i += sg_size) {
+        y[i * incy] += alpha * x[i * incx];
+    }
+    sycl::group_barrier(sg);
+}
+
+// Level 2
+
+template <std::int64_t M, std::int64_t N, transpose Trans, layout Layout, typename T>
+inline T gemv_row(std::int64_t i, const T* a, std::int64_t lda, const T* x, std::int64_t incx) {
+    constexpr std::int64_t cols = (Trans == transpose::nontrans) ? N : M;
+    T sum = T(0);
+#pragma unroll
+    for (std::int64_t j = 0; j < cols; ++j) {
+        sum += op_elem<Layout, Trans>(a, lda, i, j) * x[j * incx];
+    }
+    return sum;
+}
+
+template <std::int64_t M, std::int64_t N, transpose Trans, layout Layout, typename T>
+inline void gemv(T alpha, const T* a, std::int64_t lda, const T* x, std::int64_t incx, T beta,
+                 T* y, std::int64_t incy) {
+    constexpr std::int64_t rows = (Trans == transpose::nontrans) ? M : N;
+#pragma unroll
+    for (std::int64_t i = 0; i < rows; ++i) {
+        y[i * incy] = alpha * gemv_row<M, N, Trans, Layout>(i, a, lda, x, incx) +
+                      scale_output(beta, y[i * incy]);
+    }
+}
+
+template <std::int64_t M, std::int64_t N, transpose Trans, layout Layout, typename T>
+inline void gemv(const sycl::sub_group& sg, T alpha, const T* a, std::int64_t lda, const T* x,
+                 std::int64_t incx, T beta, T* y, std::int64_t incy) {
+    constexpr std::int64_t rows = (Trans == transpose::nontrans) ? M : N;
+    const std::int64_t lid = sg.get_local_linear_id();
+    const std::int64_t sg_size = sg.get_local_linear_range();
+    for (std::int64_t i = lid; i < rows; i += sg_size) {
+        y[i * incy] = alpha * gemv_row<M, N, Trans, Layout>(i, a, lda, x, incx) +
+                      scale_output(beta, y[i * incy]);
+    }
+    sycl::group_barrier(sg);
+}
+
+// op(A) is lower triangular when A is lower and not transposed, or upper and
+// transposed; the solve then runs forwards, otherwise backwards.
+template <uplo Uplo, transpose Trans>
+constexpr bool trsv_forward() {
+    return (Uplo == uplo::lower) == (Trans == transpose::nontrans);
+}
+
+template <std::int64_t N, uplo Uplo, transpose Trans, diag Diag, layout Layout, typename T>
+inline void trsv(const T* a, std::int64_t lda, T* x, std::int64_t incx) {
+    constexpr bool forward = trsv_forward<Uplo, Trans>();
+    T xv[N];
+#pragma unroll
+    for (std::int64_t i = 0; i < N; ++i) {
+        xv[i] = x[i * incx];
+    }
+#pragma unroll
+    for (std::int64_t step = 0; step < N; ++step) {
+        const std::int64_t i = forward ? step : N - 1 - step;
+        T t = xv[i];
+        if constexpr (forward) {
+#pragma unroll
+            for (std::int64_t j = 0; j < i; ++j) {
+                t -= op_elem<Layout, Trans>(a, lda, i, j) * xv[j];
+            }
+        }
+        else {
+#pragma unroll
+            for (std::int64_t j = i + 1; j < N; ++j) {
+                t -= op_elem<Layout, Trans>(a, lda, i, j) * xv[j];
+            }
+        }
+        if constexpr (Diag == diag::nonunit) {
+            t /= op_elem<Layout, Trans>(a, lda, i, i);
+        }
+        xv[i] = t;
+    }
+#pragma unroll
+    for (std::int64_t i = 0; i < N; ++i) {
+        x[i * incx] = xv[i];
+    }
+}
+
+// Column oriented substitution: once x[j] is final, the work-items of the
+// sub-group update the remaining entries of x in parallel. x must be visible
+// to the whole sub-group, i.e. in local or global memory.
+template <std::int64_t N, uplo Uplo, transpose Trans, diag Diag, layout Layout, typename T>
+inline void trsv(const sycl::sub_group& sg, const T* a, std::int64_t lda, T* x,
+                 std::int64_t incx) {
+    constexpr bool forward = trsv_forward<Uplo, Trans>();
+    const std::int64_t lid = sg.get_local_linear_id();
+    const std::int64_t sg_size = sg.get_local_linear_range();
+    for (std::int64_t step = 0; step < N; ++step) {
+        const std::int64_t j = forward ? step : N - 1 - step;
+        T xj = x[j * incx];
+        if constexpr (Diag == diag::nonunit) {
+            xj /= op_elem<Layout, Trans>(a, lda, j, j);
+        }
+        // Every work-item has read x[j] before it is overwritten.
+        sycl::group_barrier(sg);
+        if constexpr (forward) {
+            for (std::int64_t i = j + 1 + lid; i < N; i += sg_size) {
+                x[i * incx] -= op_elem<Layout, Trans>(a, lda, i, j) * xj;
+            }
+        }
+        else {
+            for (std::int64_t i = lid; i < j; i += sg_size) {
+                x[i * incx] -= op_elem<Layout, Trans>(a, lda, i, j) * xj;
+            }
+        }
+        if (lid == 0) {
+            x[j * incx] = xj;
+        }
+        sycl::group_barrier(sg);
+    }
+}
+
+// Level 3
+
+template <std::int64_t K, transpose TransA, transpose TransB, layout Layout, typename T>
+inline T gemm_elem(std::int64_t i, std::int64_t j, const T* a, std::int64_t lda, const T* b,
+                   std::int64_t ldb) {
+    T sum = T(0);
+#pragma unroll
+    for (std::int64_t p = 0; p < K; ++p) {
+        sum += op_elem<Layout, TransA>(a, lda, i, p) * op_elem<Layout, TransB>(b, ldb, p, j);
+    }
+    return sum;
+}
+
+template <std::int64_t M, std::int64_t N, std::int64_t K, transpose TransA, transpose TransB,
+          layout Layout, typename T>
+inline void gemm(T alpha, const T* a, std::int64_t lda, const T* b, std::int64_t ldb, T beta,
+                 T* c, std::int64_t ldc) {
+#pragma unroll
+    for (std::int64_t j = 0; j < N; ++j) {
+#pragma unroll
+        for (std::int64_t i = 0; i < M; ++i) {
+            T& cij = elem<Layout>(c, ldc, i, j);
+            cij = alpha * gemm_elem<K, TransA, TransB, Layout>(i, j, a, lda, b, ldb) +
+                  scale_output(beta, cij);
+        }
+    }
+}
+
+template <std::int64_t M, std::int64_t N, std::int64_t K, transpose TransA, transpose TransB,
+          layout Layout, typename T>
+inline void gemm(const sycl::sub_group& sg, T alpha, const T* a, std::int64_t lda, const T* b,
+                 std::int64_t ldb, T beta, T* c, std::int64_t ldc) {
+    const std::int64_t lid = sg.get_local_linear_id();
+    const std::int64_t sg_size = sg.get_local_linear_range();
+    // Consecutive work-items take consecutive elements of C in memory order.
+    for (std::int64_t idx = lid; idx < M * N; idx += sg_size) {
+        const std::int64_t i = (Layout == layout::col_major) ? idx % M : idx / N;
+        const std::int64_t j = (Layout == layout::col_major) ? idx / M : idx % N;
+        T& cij = elem<Layout>(c, ldc, i, j);
+        cij = alpha * gemm_elem<K, TransA, TransB, Layout>(i, j, a, lda, b, ldb) +
+              scale_output(beta, cij);
+    }
+    sycl::group_barrier(sg);
+}
+
+} // namespace oneapi::mkl::blas::device::detail
+
+#endif // _MKL_BLAS_DEVICE_IMPL_HPP_
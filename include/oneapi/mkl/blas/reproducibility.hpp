@@ -0,0 +1,72 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_REPRODUCIBILITY_HPP_
+#define _ONEMKL_BLAS_REPRODUCIBILITY_HPP_
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+
+// Bitwise-reproducible mode. When it is on, the backends fix the order of
+// every floating-point reduction: level 1 reductions (dot, nrm2, asum) add
+// their partial sums in an order that does not depend on the device, the
+// work-group size or the number of threads, and level 3 routines use a fixed
+// k-blocking rather than one picked by timing or by the machine. Repeated
+// runs on the same device and backend then give identical results.
+//
+// The mode starts from the environment, ONEMKL_BLAS_REPRODUCIBLE=1 (or on),
+// and can be changed with set_reproducible. Backends that can only select it
+// before their first computation, such as mklcpu with MKL's conditional
+// numerical reproducibility, throw from the calls made in reproducible mode
+// once that is no longer possible.
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace detail {
+
+inline std::atomic<bool> &reproducible_flag() {
+    static std::atomic<bool> flag([] {
+        const char *env = std::getenv("ONEMKL_BLAS_REPRODUCIBLE");
+        if (env == nullptr) {
+            return false;
+        }
+        const std::string value(env);
+        return value == "1" || value == "on";
+    }());
+    return flag;
+}
+
+} // namespace detail
+
+/** Turns bitwise-reproducible mode on or off for the calls that follow. **/
+inline void set_reproducible(bool enable) {
+    detail::reproducible_flag().store(enable, std::memory_order_relaxed);
+}
+
+inline bool is_reproducible() {
+    return detail::reproducible_flag().load(std::memory_order_relaxed);
+}
+
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _ONEMKL_BLAS_REPRODUCIBILITY_HPP_
@@ -35,5 +35,6 @@
 #include "oneapi/mkl/dft/descriptor.hpp"
 #include "oneapi/mkl/dft/forward.hpp"
 #include "oneapi/mkl/dft/backward.hpp"
+#include "oneapi/mkl/dft/convolution.hpp"
 
 #endif // _ONEMKL_DFT_HPP_
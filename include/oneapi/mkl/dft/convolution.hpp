@@ -0,0 +1,118 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_DFT_CONVOLUTION_HPP_
+#define _ONEMKL_DFT_CONVOLUTION_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "detail/types_impl.hpp"
+
+// Circular convolution and correlation through the committed descriptor: the data is transformed
+// forward, multiplied by the filter and transformed back, in place. The filter is the backward
+// domain of one transform, packed in row-major order, and is applied to every transform of the
+// batch. For real transforms the last dimension of the filter has length / 2 + 1 elements. The
+// filter of a BACKWARD_SCRAMBLED descriptor is in the same order as the backward domain.
+//
+// The descriptor must be committed in place with COMPLEX_COMPLEX storage, in up to three
+// dimensions for complex transforms and in one dimension for real transforms. Its forward and
+// backward transforms must be usable on the same data without recommitting, as for a call to
+// compute_forward followed by compute_backward. The forward and backward scales are applied as
+// usual: the result of a 1 / N backward scale is the convolution itself.
+
+namespace oneapi::mkl::dft {
+
+//Buffer version
+
+//In-place convolution
+template <typename descriptor_type, typename data_type, typename filter_type>
+void compute_convolution(descriptor_type &desc, sycl::buffer<data_type, 1> &inout,
+                         sycl::buffer<filter_type, 1> &filter) {
+    static_assert(detail::valid_compute_arg<descriptor_type, data_type>::value,
+                  "unexpected type for data_type");
+    static_assert(detail::valid_compute_arg<descriptor_type, filter_type>::value,
+                  "unexpected type for filter_type");
+
+    using fwd_type = typename detail::descriptor_info<descriptor_type>::forward_type;
+    using bwd_type = typename detail::descriptor_info<descriptor_type>::backward_type;
+    auto type_corrected_inout = inout.template reinterpret<fwd_type, 1>(
+        detail::reinterpret_range<data_type, fwd_type>(inout.size()));
+    auto type_corrected_filter = filter.template reinterpret<bwd_type, 1>(
+        detail::reinterpret_range<filter_type, bwd_type>(filter.size()));
+    get_commit(desc)->convolve_ip_cc(desc, type_corrected_inout, type_corrected_filter, false);
+}
+
+//In-place correlation
+template <typename descriptor_type, typename data_type, typename filter_type>
+void compute_correlation(descriptor_type &desc, sycl::buffer<data_type, 1> &inout,
+                         sycl::buffer<filter_type, 1> &filter) {
+    static_assert(detail::valid_compute_arg<descriptor_type, data_type>::value,
+                  "unexpected type for data_type");
+    static_assert(detail::valid_compute_arg<descriptor_type, filter_type>::value,
+                  "unexpected type for filter_type");
+
+    using fwd_type = typename detail::descriptor_info<descriptor_type>::forward_type;
+    using bwd_type = typename detail::descriptor_info<descriptor_type>::backward_type;
+    auto type_corrected_inout = inout.template reinterpret<fwd_type, 1>(
+        detail::reinterpret_range<data_type, fwd_type>(inout.size()));
+    auto type_corrected_filter = filter.template reinterpret<bwd_type, 1>(
+        detail::reinterpret_range<filter_type, bwd_type>(filter.size()));
+    get_commit(desc)->convolve_ip_cc(desc, type_corrected_inout, type_corrected_filter, true);
+}
+
+//USM version
+
+//In-place convolution
+template <typename descriptor_type, typename data_type, typename filter_type>
+sycl::event compute_convolution(descriptor_type &desc, data_type *inout, const filter_type *filter,
+                                const std::vector<sycl::event> &dependencies = {}) {
+    static_assert(detail::valid_compute_arg<descriptor_type, data_type>::value,
+                  "unexpected type for data_type");
+    static_assert(detail::valid_compute_arg<descriptor_type, filter_type>::value,
+                  "unexpected type for filter_type");
+
+    using fwd_type = typename detail::descriptor_info<descriptor_type>::forward_type;
+    using bwd_type = typename detail::descriptor_info<descriptor_type>::backward_type;
+    return get_commit(desc)->convolve_ip_cc(desc, reinterpret_cast<fwd_type *>(inout),
+                                            reinterpret_cast<const bwd_type *>(filter), false,
+                                            dependencies);
+}
+
+//In-place correlation
+template <typename descriptor_type, typename data_type, typename filter_type>
+sycl::event compute_correlation(descriptor_type &desc, data_type *inout, const filter_type *filter,
+                                const std::vector<sycl::event> &dependencies = {}) {
+    static_assert(detail::valid_compute_arg<descriptor_type, data_type>::value,
+                  "unexpected type for data_type");
+    static_assert(detail::valid_compute_arg<descriptor_type, filter_type>::value,
+                  "unexpected type for filter_type");
+
+    using fwd_type = typename detail::descriptor_info<descriptor_type>::forward_type;
+    using bwd_type = typename detail::descriptor_info<descriptor_type>::backward_type;
+    return get_commit(desc)->convolve_ip_cc(desc, reinterpret_cast<fwd_type *>(inout),
+                                            reinterpret_cast<const bwd_type *>(filter), true,
+                                            dependencies);
+}
+} // namespace oneapi::mkl::dft
+
+#endif // _ONEMKL_DFT_CONVOLUTION_HPP_
@@ -21,6 +21,7 @@
 #define _ONEMKL_DFT_DESCRIPTOR_HPP_
 
 #include "detail/descriptor_impl.hpp"
+#include "detail/plan_cache.hpp"
 #include "types.hpp"
 
 namespace oneapi {
@@ -26,6 +26,7 @@
 #include <CL/sycl.hpp>
 #endif
 
+#include "convolution_impl.hpp"
 #include "descriptor_impl.hpp"
 #include "external_workspace_helper.hpp"
 
@@ -52,13 +53,21 @@ public:
 protected:
     external_workspace_helper<prec, dom> external_workspace_helper_;
 
+    // Completes when the plan started by commit_async is built.
+    sycl::event commit_event_;
+
+    // The convolution layout of the committed configuration. Backends set it when they commit,
+    // so that convolutions are checked against the configuration the plan was built for.
+    committed_convolution_layout committed_convolution_;
+
 public:
     commit_impl(sycl::queue queue, mkl::backend backend,
                 const dft::detail::dft_values<prec, dom> &config_values)
             : queue_(queue),
               backend_(backend),
               external_workspace_helper_(config_values.workspace_placement ==
-                                         dft::detail::config_value::WORKSPACE_EXTERNAL) {}
+                                         dft::detail::config_value::WORKSPACE_EXTERNAL),
+              committed_convolution_(config_values) {}
 
     // rule of three
     commit_impl(const commit_impl &other) = delete;
@@ -77,6 +86,28 @@ public:
 
     virtual void commit(const dft_values<prec, dom> &) = 0;
 
+    /** Start building the plan for the given configuration and return without waiting for it.
+     *  Backends that build their plans in the background override this; compute calls made before
+     *  the build completes are ordered after it. By default the plan is built before returning.
+     * @param config_values The configuration to commit.
+     * @return An event that completes when the plan is built.
+    */
+    virtual sycl::event commit_async(const dft_values<prec, dom> &config_values) {
+        commit(config_values);
+        commit_event_ = sycl::event{};
+        return commit_event_;
+    }
+
+    /// The event of the last commit_async, or a completed event.
+    sycl::event get_commit_event() const noexcept {
+        return commit_event_;
+    }
+
+    /// The convolution layout of the committed configuration.
+    const committed_convolution_layout &get_committed_convolution_layout() const noexcept {
+        return committed_convolution_;
+    }
+
     inline std::int64_t get_workspace_external_bytes() {
         return external_workspace_helper_.get_rqd_workspace_bytes(*this);
     };
@@ -136,6 +167,40 @@ public:
                                        scalar_type *in_im, scalar_type *out_re, scalar_type *out_im,
                                        const std::vector<sycl::event> &dependencies) = 0;
 
+    /** In-place convolution of the data with a filter given in the backward domain, or
+     *  correlation when conjugate_filter is set. By default the forward transform, the product
+     *  with the filter and the backward transform are separate passes over the data. Backends
+     *  override these to fuse the product into the transforms.
+    */
+    virtual void convolve_ip_cc(descriptor_type &desc, sycl::buffer<fwd_type, 1> &inout,
+                                sycl::buffer<bwd_type, 1> &filter, bool conjugate_filter) {
+        const auto layout = committed_convolution_.get("compute_convolution");
+        check_filter_size(filter.size(), layout, "compute_convolution");
+        forward_ip_cc(desc, inout);
+        auto spectrum = inout.template reinterpret<bwd_type, 1>(
+            reinterpret_range<fwd_type, bwd_type>(inout.size()));
+        queue_.submit([&](sycl::handler &cgh) {
+            auto data_acc = spectrum.template get_access<sycl::access::mode::read_write>(cgh);
+            auto filter_acc = filter.template get_access<sycl::access::mode::read>(cgh);
+            convolution_multiply_kernel<bwd_type>(cgh, data_acc, filter_acc, layout,
+                                                  conjugate_filter);
+        });
+        backward_ip_cc(desc, inout);
+    }
+    virtual sycl::event convolve_ip_cc(descriptor_type &desc, fwd_type *inout,
+                                       const bwd_type *filter, bool conjugate_filter,
+                                       const std::vector<sycl::event> &dependencies) {
+        const auto layout = committed_convolution_.get("compute_convolution");
+        auto forward_event = forward_ip_cc(desc, inout, dependencies);
+        auto *spectrum = reinterpret_cast<bwd_type *>(inout);
+        auto multiply_event = queue_.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(forward_event);
+            convolution_multiply_kernel<bwd_type>(cgh, spectrum, filter, layout,
+                                                  conjugate_filter);
+        });
+        return backward_ip_cc(desc, inout, { multiply_event });
+    }
+
     /** For compute calls, throw errors for the external workspace as required.
      * @tparam ArgTs The non-descriptor arg(s) for the compute call. First one is used to check
      * buffer or USM call.
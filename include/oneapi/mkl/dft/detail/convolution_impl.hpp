@@ -0,0 +1,189 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_DFT_CONVOLUTION_IMPL_HPP_
+#define _ONEMKL_DFT_CONVOLUTION_IMPL_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <complex>
+#include <cstdint>
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/dft/detail/types_impl.hpp"
+
+namespace oneapi::mkl::dft::detail {
+
+/** The backward domain of an in-place convolution. Element i of the spectrum of batch b, counted
+ *  in row-major order over lengths, is at data_offset(b, i) in the data and at i in the filter.
+**/
+struct convolution_layout {
+    static constexpr std::size_t max_rank = 3;
+
+    std::int64_t rank;
+    std::int64_t lengths[max_rank];
+    std::int64_t strides[max_rank];
+    std::int64_t offset;
+    std::int64_t distance;
+    std::int64_t batch;
+
+    /// The number of elements in the spectrum of one transform, and in the filter.
+    std::int64_t spectrum_size() const {
+        std::int64_t size = 1;
+        for (std::int64_t d = 0; d < rank; ++d) {
+            size *= lengths[d];
+        }
+        return size;
+    }
+
+    std::int64_t data_offset(std::int64_t b, std::int64_t i) const {
+        std::int64_t idx = offset + b * distance;
+        for (std::int64_t d = rank - 1; d >= 0; --d) {
+            idx += (i % lengths[d]) * strides[d];
+            i /= lengths[d];
+        }
+        return idx;
+    }
+};
+
+/** Why a configuration other than its placement cannot be used for a convolution.
+ * @return The message of the unimplemented exception to throw, or nullptr if it can be used.
+**/
+template <precision prec, domain dom>
+const char *convolution_unsupported_reason(const dft_values<prec, dom> &values) noexcept {
+    if (values.complex_storage != config_value::COMPLEX_COMPLEX) {
+        return "Convolutions are only computed with COMPLEX_COMPLEX storage.";
+    }
+    const auto rank = values.dimensions.size();
+    if (rank > convolution_layout::max_rank) {
+        return "Convolutions are only computed in up to three dimensions.";
+    }
+    if (dom == domain::REAL && rank > 1) {
+        return "Real convolutions are only computed in one dimension.";
+    }
+    return nullptr;
+}
+
+/** The backward domain of a configuration for which convolution_unsupported_reason returns
+ *  nullptr. The spectrum is read through the output strides, where the in-place forward transform
+ *  writes it.
+**/
+template <precision prec, domain dom>
+convolution_layout make_convolution_layout(const dft_values<prec, dom> &values) noexcept {
+    const auto rank = values.dimensions.size();
+    convolution_layout layout{};
+    layout.rank = static_cast<std::int64_t>(rank);
+    for (std::size_t d = 0; d < rank; ++d) {
+        layout.lengths[d] = values.dimensions[d];
+        layout.strides[d] = values.output_strides[d + 1];
+    }
+    if constexpr (dom == domain::REAL) {
+        layout.lengths[rank - 1] = layout.lengths[rank - 1] / 2 + 1;
+    }
+    layout.offset = values.output_strides[0];
+    layout.distance = values.bwd_dist;
+    layout.batch = values.number_of_transforms;
+    return layout;
+}
+
+/** The backward domain of a configuration, with the reason it cannot be used for a convolution,
+ *  if any. Backends keep one from commit time, so that their compute calls use the committed
+ *  configuration even if the descriptor has been changed since.
+**/
+class committed_convolution_layout {
+public:
+    committed_convolution_layout() = default;
+
+    template <precision prec, domain dom>
+    explicit committed_convolution_layout(const dft_values<prec, dom> &values) noexcept
+            : in_place_(values.placement == config_value::INPLACE),
+              error_(convolution_unsupported_reason(values)) {
+        if (!error_) {
+            layout_ = make_convolution_layout(values);
+        }
+    }
+
+    /** Check that the configuration can be used for a convolution and get its backward domain.
+     * @param function_name The function name to use in generated exceptions.
+    **/
+    convolution_layout get(const char *function_name) const {
+        if (!in_place_) {
+            throw mkl::invalid_argument("DFT", function_name,
+                                        "Convolutions are only computed in place.");
+        }
+        if (error_) {
+            throw mkl::unimplemented("DFT", function_name, error_);
+        }
+        return layout_;
+    }
+
+private:
+    bool in_place_ = false;
+    const char *error_ = nullptr;
+    convolution_layout layout_{};
+};
+
+/** Check that a configuration can be used for a convolution and get its backward domain.
+ * @param values The committed configuration.
+ * @param function_name The function name to use in generated exceptions.
+**/
+template <precision prec, domain dom>
+convolution_layout get_convolution_layout(const dft_values<prec, dom> &values,
+                                          const char *function_name) {
+    return committed_convolution_layout(values).get(function_name);
+}
+
+/// Throw if a filter buffer cannot hold the spectrum of one transform.
+inline void check_filter_size(std::size_t filter_size, const convolution_layout &layout,
+                              const char *function_name) {
+    if (static_cast<std::int64_t>(filter_size) < layout.spectrum_size()) {
+        throw mkl::invalid_argument("DFT", function_name, "The filter is too small.");
+    }
+}
+
+/// The product of a spectrum element with a filter element, conjugated for a correlation.
+template <typename T>
+inline T apply_filter(T value, T filter, bool conjugate_filter) {
+    return value * (conjugate_filter ? std::conj(filter) : filter);
+}
+
+/** Multiply the spectra of the batch by the filter, in place.
+ * @param data The backward domain, as a USM pointer or an accessor.
+ * @param filter The filter, as a USM pointer or an accessor.
+**/
+template <typename T, typename DataPtrT, typename FilterPtrT>
+void convolution_multiply_kernel(sycl::handler &cgh, DataPtrT data, FilterPtrT filter,
+                                 convolution_layout layout, bool conjugate_filter) {
+    const sycl::range<2> range(static_cast<std::size_t>(layout.batch),
+                               static_cast<std::size_t>(layout.spectrum_size()));
+    cgh.parallel_for(range, [=](sycl::item<2> item) {
+        const auto b = static_cast<std::int64_t>(item[0]);
+        const auto i = static_cast<std::int64_t>(item[1]);
+        const std::int64_t idx = layout.data_offset(b, i);
+        data[idx] = apply_filter<T>(data[idx], filter[i], conjugate_filter);
+    });
+}
+
+} // namespace oneapi::mkl::dft::detail
+
+#endif //_ONEMKL_DFT_CONVOLUTION_IMPL_HPP_
@@ -55,12 +55,18 @@ public:
     // Syntax for d-dimensional DFT
     descriptor(std::vector<std::int64_t> dimensions);
 
-    // Copy operations are included in the oneAPI oneMKL specification, but not yet
-    // implemented here. If you need copies, please open an issue at
-    // https://github.com/oneapi-src/oneMKL/issues
+    // A copy has its own configuration values and shares the committed plan of
+    // the original, so the same transform can be computed from several threads
+    // without committing once per thread. Committing or reconfiguring either
+    // descriptor afterwards does not affect the other. With WORKSPACE_EXTERNAL
+    // the workspace is set on the plan, so the copy of a committed descriptor
+    // is left uncommitted and needs its own commit and workspace.
+    descriptor(const descriptor&);
 
     descriptor(descriptor&&);
 
+    descriptor& operator=(const descriptor&);
+
     descriptor& operator=(descriptor&&);
 
     ~descriptor();
@@ -91,6 +97,31 @@ public:
     void commit(backend_selector<backend::portfft> selector);
 #endif
 
+    // Like commit, but returns once the backend has started building the plan. The event
+    // completes when the plan is built, and compute calls made before then are ordered after the
+    // build. Backends that cannot build in the background commit before returning.
+    sycl::event commit_async(sycl::queue& queue);
+
+#ifdef ENABLE_MKLCPU_BACKEND
+    sycl::event commit_async(backend_selector<backend::mklcpu> selector);
+#endif
+
+#ifdef ENABLE_MKLGPU_BACKEND
+    sycl::event commit_async(backend_selector<backend::mklgpu> selector);
+#endif
+
+#ifdef ENABLE_CUFFT_BACKEND
+    sycl::event commit_async(backend_selector<backend::cufft> selector);
+#endif
+
+#ifdef ENABLE_ROCFFT_BACKEND
+    sycl::event commit_async(backend_selector<backend::rocfft> selector);
+#endif
+
+#ifdef ENABLE_PORTFFT_BACKEND
+    sycl::event commit_async(backend_selector<backend::portfft> selector);
+#endif
+
     const dft_values<prec, dom>& get_values() const noexcept {
         return values_;
     };
@@ -100,8 +131,9 @@ public:
     void set_workspace(sycl::buffer<scalar_type>& buffer_workspace);
 
 private:
-    // Has a value when the descriptor is committed.
-    std::unique_ptr<commit_impl<prec, dom>> pimpl_;
+    // Has a value when the descriptor is committed. Shared with other
+    // descriptors when the plan comes from the plan cache.
+    std::shared_ptr<commit_impl<prec, dom>> pimpl_;
 
     // descriptor configuration values_ and structs
     dft_values<prec, dom> values_;
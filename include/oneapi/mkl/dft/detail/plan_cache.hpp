@@ -0,0 +1,340 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_DFT_DETAIL_PLAN_CACHE_HPP_
+#define _ONEMKL_DFT_DETAIL_PLAN_CACHE_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "oneapi/mkl/detail/backends.hpp"
+#include "oneapi/mkl/dft/detail/descriptor_impl.hpp"
+
+// Process-wide cache of committed DFT plans.
+//
+// Committing a descriptor builds a backend plan: a pair of MKL descriptors
+// committed on the host, cuFFT or rocFFT plans, or portFFT kernel bundles.
+// With the cache enabled, commit first looks for a plan already committed
+// with the same configuration, on the same queue and backend, and the
+// descriptor shares it rather than building its own. The queue is part of the
+// key, not only its device and context, because a plan submits its work to
+// the queue it was committed on. The cache keeps at most its capacity in
+// plans and evicts the least recently used one; descriptors keep the plan
+// they share alive after it is evicted.
+//
+// The cache is off until a capacity is given, by
+// ONEMKL_DFT_PLAN_CACHE_CAPACITY in the environment or set_plan_cache_capacity.
+// Descriptors with WORKSPACE_EXTERNAL always get a plan of their own, since the
+// workspace set on a plan belongs to one descriptor.
+
+namespace oneapi {
+namespace mkl {
+namespace dft {
+
+struct plan_cache_stats {
+    /// Commits that shared a cached plan.
+    std::uint64_t hits;
+    /// Commits that built a new plan and added it to the cache.
+    std::uint64_t misses;
+    /// Plans dropped from the cache to stay within its capacity.
+    std::uint64_t evictions;
+    std::size_t size;
+    std::size_t capacity;
+};
+
+namespace detail {
+
+struct plan_cache_entry_base {
+    virtual ~plan_cache_entry_base() = default;
+    // Whether the cache holds the last reference to the plan.
+    virtual bool plan_unique() const = 0;
+
+    std::size_t hash;
+    precision entry_prec;
+    domain entry_dom;
+    sycl::queue queue;
+    std::optional<mkl::backend> backend;
+};
+
+template <precision prec, domain dom>
+struct plan_cache_entry final : plan_cache_entry_base {
+    bool plan_unique() const override {
+        return plan.use_count() == 1;
+    }
+
+    dft_values<prec, dom> values;
+    std::shared_ptr<commit_impl<prec, dom>> plan;
+};
+
+struct plan_cache {
+    using entry_list = std::list<std::unique_ptr<plan_cache_entry_base>>;
+
+    std::mutex lock;
+    std::size_t capacity;
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;
+    // Most recently used first.
+    entry_list entries;
+    std::unordered_multimap<std::size_t, entry_list::iterator> index;
+
+    explicit plan_cache(std::size_t initial_capacity) : capacity(initial_capacity) {}
+};
+
+inline plan_cache &get_plan_cache() {
+    // Never destroyed: cached plans can hold state of backend libraries that
+    // are unloaded before static destructors run.
+    static plan_cache *cache = new plan_cache([] {
+        const char *env = std::getenv("ONEMKL_DFT_PLAN_CACHE_CAPACITY");
+        return env ? static_cast<std::size_t>(std::strtoull(env, nullptr, 10)) : std::size_t(0);
+    }());
+    return *cache;
+}
+
+inline void plan_cache_hash_combine(std::size_t &seed, std::size_t value) {
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+template <precision prec, domain dom>
+std::size_t plan_cache_hash(const sycl::queue &queue, std::optional<mkl::backend> backend,
+                            const dft_values<prec, dom> &values) {
+    std::size_t seed = std::hash<sycl::queue>{}(queue);
+    plan_cache_hash_combine(seed, static_cast<std::size_t>(prec));
+    plan_cache_hash_combine(seed, static_cast<std::size_t>(dom));
+    plan_cache_hash_combine(seed, backend ? static_cast<std::size_t>(*backend) + 1 : 0);
+    for (const auto *v : { &values.dimensions, &values.input_strides, &values.output_strides }) {
+        for (std::int64_t x : *v) {
+            plan_cache_hash_combine(seed, std::hash<std::int64_t>{}(x));
+        }
+    }
+    plan_cache_hash_combine(seed, std::hash<std::int64_t>{}(values.number_of_transforms));
+    plan_cache_hash_combine(seed, std::hash<std::int64_t>{}(values.fwd_dist));
+    plan_cache_hash_combine(seed, std::hash<std::int64_t>{}(values.bwd_dist));
+    plan_cache_hash_combine(seed, static_cast<std::size_t>(values.placement));
+    return seed;
+}
+
+template <precision prec, domain dom>
+bool same_config(const dft_values<prec, dom> &a, const dft_values<prec, dom> &b) {
+    return a.dimensions == b.dimensions && a.input_strides == b.input_strides &&
+           a.output_strides == b.output_strides && a.bwd_scale == b.bwd_scale &&
+           a.fwd_scale == b.fwd_scale && a.number_of_transforms == b.number_of_transforms &&
+           a.fwd_dist == b.fwd_dist && a.bwd_dist == b.bwd_dist && a.placement == b.placement &&
+           a.complex_storage == b.complex_storage && a.real_storage == b.real_storage &&
+           a.conj_even_storage == b.conj_even_storage && a.workspace == b.workspace &&
+           a.workspace_placement == b.workspace_placement && a.ordering == b.ordering &&
+           a.transpose == b.transpose && a.packed_format == b.packed_format;
+}
+
+/** Returns the cached plan for the key and marks it most recently used, or
+ *  null. The cache lock must be held.
+**/
+template <precision prec, domain dom>
+std::shared_ptr<commit_impl<prec, dom>> plan_cache_find(plan_cache &cache, std::size_t hash,
+                                                        const sycl::queue &queue,
+                                                        std::optional<mkl::backend> backend,
+                                                        const dft_values<prec, dom> &values) {
+    auto range = cache.index.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        plan_cache_entry_base *base = it->second->get();
+        if (base->entry_prec != prec || base->entry_dom != dom || base->queue != queue ||
+            base->backend != backend) {
+            continue;
+        }
+        auto *entry = static_cast<plan_cache_entry<prec, dom> *>(base);
+        if (same_config(entry->values, values)) {
+            cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+            return entry->plan;
+        }
+    }
+    return nullptr;
+}
+
+/** Moves the least recently used entries beyond the capacity of the cache into
+ *  evicted. The cache lock must be held.
+**/
+inline void plan_cache_evict(plan_cache &cache,
+                             std::vector<std::unique_ptr<plan_cache_entry_base>> &evicted) {
+    while (cache.entries.size() > cache.capacity) {
+        auto last = std::prev(cache.entries.end());
+        auto range = cache.index.equal_range((*last)->hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == last) {
+                cache.index.erase(it);
+                break;
+            }
+        }
+        evicted.push_back(std::move(*last));
+        cache.entries.erase(last);
+        ++cache.evictions;
+    }
+}
+
+/** Releases evicted plans, after the work already submitted with the plans no
+ *  descriptor uses any more has completed.
+**/
+inline void plan_cache_release(std::vector<std::unique_ptr<plan_cache_entry_base>> &evicted) {
+    for (auto &entry : evicted) {
+        if (entry->plan_unique()) {
+            entry->queue.wait();
+        }
+    }
+    evicted.clear();
+}
+
+template <precision prec, domain dom>
+sycl::event commit_plan(commit_impl<prec, dom> &plan, const dft_values<prec, dom> &values,
+                        bool async) {
+    if (async) {
+        return plan.commit_async(values);
+    }
+    plan.commit(values);
+    return sycl::event{};
+}
+
+/** Points pimpl at a plan committed with values on queue. create() returns a
+ *  new, uncommitted commit_impl for queue; backend is the backend selected by
+ *  the caller, or empty when it is chosen by run-time dispatch. With async the
+ *  plan is built by commit_async; the returned event completes when the plan
+ *  is built.
+**/
+template <precision prec, domain dom, typename CreateCommit>
+sycl::event commit_with_plan_cache(std::shared_ptr<commit_impl<prec, dom>> &pimpl,
+                                   const dft_values<prec, dom> &values, sycl::queue queue,
+                                   std::optional<mkl::backend> backend, CreateCommit create,
+                                   bool async = false) {
+    if (pimpl && pimpl->get_queue() != queue) {
+        pimpl->get_queue().wait();
+    }
+    plan_cache &cache = get_plan_cache();
+    bool enabled;
+    {
+        std::lock_guard<std::mutex> guard(cache.lock);
+        enabled = cache.capacity > 0;
+    }
+    if (!enabled || values.workspace_placement == config_value::WORKSPACE_EXTERNAL) {
+        // A plan shared with other descriptors must not be reconfigured.
+        if (!pimpl || pimpl->get_queue() != queue || pimpl.use_count() > 1) {
+            pimpl.reset(create());
+        }
+        return commit_plan(*pimpl, values, async);
+    }
+
+    const std::size_t hash = plan_cache_hash(queue, backend, values);
+    {
+        std::lock_guard<std::mutex> guard(cache.lock);
+        if (auto plan = plan_cache_find(cache, hash, queue, backend, values)) {
+            ++cache.hits;
+            pimpl = std::move(plan);
+            return pimpl->get_commit_event();
+        }
+        ++cache.misses;
+    }
+
+    // The plan is built without the lock held, so other descriptors can commit
+    // meanwhile. If one of them cached the same configuration first, its plan
+    // is used and this one dropped.
+    std::shared_ptr<commit_impl<prec, dom>> plan(create());
+    sycl::event commit_event = commit_plan(*plan, values, async);
+    std::vector<std::unique_ptr<plan_cache_entry_base>> evicted;
+    {
+        std::lock_guard<std::mutex> guard(cache.lock);
+        if (auto cached = plan_cache_find(cache, hash, queue, backend, values)) {
+            plan = std::move(cached);
+            commit_event = plan->get_commit_event();
+        }
+        else {
+            auto entry = std::make_unique<plan_cache_entry<prec, dom>>();
+            entry->hash = hash;
+            entry->entry_prec = prec;
+            entry->entry_dom = dom;
+            entry->queue = queue;
+            entry->backend = backend;
+            entry->values = values;
+            entry->plan = plan;
+            cache.entries.push_front(std::move(entry));
+            cache.index.emplace(hash, cache.entries.begin());
+            plan_cache_evict(cache, evicted);
+        }
+    }
+    pimpl = std::move(plan);
+    plan_cache_release(evicted);
+    return commit_event;
+}
+
+} // namespace detail
+
+/** Sets the number of plans the cache keeps; 0 turns the cache off and empties
+ *  it. Descriptors already sharing a plan keep using it.
+**/
+inline void set_plan_cache_capacity(std::size_t capacity) {
+    auto &cache = detail::get_plan_cache();
+    std::vector<std::unique_ptr<detail::plan_cache_entry_base>> evicted;
+    {
+        std::lock_guard<std::mutex> guard(cache.lock);
+        cache.capacity = capacity;
+        detail::plan_cache_evict(cache, evicted);
+    }
+    detail::plan_cache_release(evicted);
+}
+
+/** Drops every cached plan and resets the statistics. **/
+inline void clear_plan_cache() {
+    auto &cache = detail::get_plan_cache();
+    std::vector<std::unique_ptr<detail::plan_cache_entry_base>> evicted;
+    {
+        std::lock_guard<std::mutex> guard(cache.lock);
+        for (auto &entry : cache.entries) {
+            evicted.push_back(std::move(entry));
+        }
+        cache.entries.clear();
+        cache.index.clear();
+        cache.hits = 0;
+        cache.misses = 0;
+        cache.evictions = 0;
+    }
+    detail::plan_cache_release(evicted);
+}
+
+inline plan_cache_stats get_plan_cache_stats() {
+    auto &cache = detail::get_plan_cache();
+    std::lock_guard<std::mutex> guard(cache.lock);
+    return { cache.hits, cache.misses, cache.evictions, cache.entries.size(), cache.capacity };
+}
+
+} // namespace dft
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _ONEMKL_DFT_DETAIL_PLAN_CACHE_HPP_
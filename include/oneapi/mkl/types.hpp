@@ -50,6 +50,10 @@ enum class offset : char { row = 0, column = 1, fix = 2, R = 0, C = 1, F = 2 };
 
 enum class layout : char { row_major = 0, col_major = 1, R = 0, C = 1 };
 
+enum class activation : char { none = 0, relu = 1, gelu = 2, sigmoid = 3 };
+
+enum class gemm_pack_matrix : char { A = 0, B = 1 };
+
 enum class index_base : char {
     zero = 0,
     one = 1,
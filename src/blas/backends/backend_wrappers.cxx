@@ -240,6 +240,29 @@ oneapi::mkl::blas::BACKEND::MAJOR::omatadd,
 oneapi::mkl::blas::BACKEND::MAJOR::omatadd,
 oneapi::mkl::blas::BACKEND::MAJOR::omatadd,
 oneapi::mkl::blas::BACKEND::MAJOR::omatadd,    
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_epilogue,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_epilogue,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_epilogue,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_epilogue,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_epilogue,
+oneapi::mkl::blas::BACKEND::MAJOR::sgemm_pack_get_size,
+oneapi::mkl::blas::BACKEND::MAJOR::dgemm_pack_get_size,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_compute,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_compute,
+oneapi::mkl::blas::BACKEND::MAJOR::axpy_dot,
+oneapi::mkl::blas::BACKEND::MAJOR::axpy_dot,
+oneapi::mkl::blas::BACKEND::MAJOR::dot2,
+oneapi::mkl::blas::BACKEND::MAJOR::dot2,
+oneapi::mkl::blas::BACKEND::MAJOR::axpby_nrm2,
+oneapi::mkl::blas::BACKEND::MAJOR::axpby_nrm2,
+oneapi::mkl::blas::BACKEND::MAJOR::axpby_nrm2,
+oneapi::mkl::blas::BACKEND::MAJOR::axpby_nrm2,
+oneapi::mkl::blas::BACKEND::MAJOR::mdot,
+oneapi::mkl::blas::BACKEND::MAJOR::mdot,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm3m,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm3m,
 oneapi::mkl::blas::BACKEND::MAJOR::asum,
 oneapi::mkl::blas::BACKEND::MAJOR::asum,
 oneapi::mkl::blas::BACKEND::MAJOR::asum,
@@ -499,4 +522,53 @@ oneapi::mkl::blas::BACKEND::MAJOR::imatcopy_batch,
 oneapi::mkl::blas::BACKEND::MAJOR::imatcopy_batch,
 oneapi::mkl::blas::BACKEND::MAJOR::imatcopy_batch,
 oneapi::mkl::blas::BACKEND::MAJOR::imatcopy_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_epilogue,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_epilogue,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_epilogue,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_epilogue,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_epilogue,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_compute,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_compute,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_vbatch,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_vbatch,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_vbatch,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_vbatch,
+oneapi::mkl::blas::BACKEND::MAJOR::axpy_dot,
+oneapi::mkl::blas::BACKEND::MAJOR::axpy_dot,
+oneapi::mkl::blas::BACKEND::MAJOR::dot2,
+oneapi::mkl::blas::BACKEND::MAJOR::dot2,
+oneapi::mkl::blas::BACKEND::MAJOR::axpby_nrm2,
+oneapi::mkl::blas::BACKEND::MAJOR::axpby_nrm2,
+oneapi::mkl::blas::BACKEND::MAJOR::axpby_nrm2,
+oneapi::mkl::blas::BACKEND::MAJOR::axpby_nrm2,
+oneapi::mkl::blas::BACKEND::MAJOR::mdot,
+oneapi::mkl::blas::BACKEND::MAJOR::mdot,
+oneapi::mkl::blas::BACKEND::MAJOR::axpy,
+oneapi::mkl::blas::BACKEND::MAJOR::axpy,
+oneapi::mkl::blas::BACKEND::MAJOR::axpy,
+oneapi::mkl::blas::BACKEND::MAJOR::axpy,
+oneapi::mkl::blas::BACKEND::MAJOR::axpby,
+oneapi::mkl::blas::BACKEND::MAJOR::axpby,
+oneapi::mkl::blas::BACKEND::MAJOR::axpby,
+oneapi::mkl::blas::BACKEND::MAJOR::axpby,
+oneapi::mkl::blas::BACKEND::MAJOR::scal,
+oneapi::mkl::blas::BACKEND::MAJOR::scal,
+oneapi::mkl::blas::BACKEND::MAJOR::scal,
+oneapi::mkl::blas::BACKEND::MAJOR::scal,
+oneapi::mkl::blas::BACKEND::MAJOR::gemv,
+oneapi::mkl::blas::BACKEND::MAJOR::gemv,
+oneapi::mkl::blas::BACKEND::MAJOR::gemv,
+oneapi::mkl::blas::BACKEND::MAJOR::gemv,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm3m,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm3m,
     // clang-format on
@@ -200,6 +200,182 @@ OMATADD_LAUNCHER(std::complex<double>, cublasZgeam)
 
 #undef OMATADD_LAUNCHER
 
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<float, 1> &a,
+                   int64_t lda, sycl::buffer<float, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    throw unimplemented("blas", "gemm_epilogue", "for column_major layout");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<sycl::half, 1> &a,
+                   int64_t lda, sycl::buffer<sycl::half, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<sycl::half, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    throw unimplemented("blas", "gemm_epilogue", "for column_major layout");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<sycl::half, 1> &a,
+                   int64_t lda, sycl::buffer<sycl::half, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    throw unimplemented("blas", "gemm_epilogue", "for column_major layout");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a,
+                   int64_t lda, sycl::buffer<bfloat16, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<bfloat16, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    throw unimplemented("blas", "gemm_epilogue", "for column_major layout");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a,
+                   int64_t lda, sycl::buffer<bfloat16, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    throw unimplemented("blas", "gemm_epilogue", "for column_major layout");
+}
+
+int64_t sgemm_pack_get_size(sycl::queue &queue, gemm_pack_matrix identifier, int64_t m, int64_t n,
+                            int64_t k) {
+    throw unimplemented("blas", "sgemm_pack_get_size", "for column_major layout");
+}
+
+int64_t dgemm_pack_get_size(sycl::queue &queue, gemm_pack_matrix identifier, int64_t m, int64_t n,
+                            int64_t k) {
+    throw unimplemented("blas", "dgemm_pack_get_size", "for column_major layout");
+}
+
+void gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+               int64_t n, int64_t k, float alpha, sycl::buffer<float, 1> &src, int64_t ld,
+               sycl::buffer<float, 1> &dest) {
+    throw unimplemented("blas", "gemm_pack", "for column_major layout");
+}
+
+void gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+               int64_t n, int64_t k, double alpha, sycl::buffer<double, 1> &src, int64_t ld,
+               sycl::buffer<double, 1> &dest) {
+    throw unimplemented("blas", "gemm_pack", "for column_major layout");
+}
+
+void gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa, transpose transb,
+                  int64_t m, int64_t n, int64_t k, sycl::buffer<float, 1> &a, int64_t lda,
+                  sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+                  int64_t ldc) {
+    throw unimplemented("blas", "gemm_compute", "for column_major layout");
+}
+
+void gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa, transpose transb,
+                  int64_t m, int64_t n, int64_t k, sycl::buffer<double, 1> &a, int64_t lda,
+                  sycl::buffer<double, 1> &b, int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+                  int64_t ldc) {
+    throw unimplemented("blas", "gemm_compute", "for column_major layout");
+}
+
+void axpy_dot(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+              sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+              sycl::buffer<float, 1> &result) {
+    throw unimplemented("blas", "axpy_dot", "for column_major layout");
+}
+
+void axpy_dot(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x, int64_t incx,
+              sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+              sycl::buffer<double, 1> &result) {
+    throw unimplemented("blas", "axpy_dot", "for column_major layout");
+}
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+          sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+          sycl::buffer<float, 1> &result) {
+    throw unimplemented("blas", "dot2", "for column_major layout");
+}
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+          sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+          sycl::buffer<double, 1> &result) {
+    throw unimplemented("blas", "dot2", "for column_major layout");
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+                float beta, sycl::buffer<float, 1> &y, int64_t incy,
+                sycl::buffer<float, 1> &result) {
+    throw unimplemented("blas", "axpby_nrm2", "for column_major layout");
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x,
+                int64_t incx, double beta, sycl::buffer<double, 1> &y, int64_t incy,
+                sycl::buffer<double, 1> &result) {
+    throw unimplemented("blas", "axpby_nrm2", "for column_major layout");
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<float> alpha,
+                sycl::buffer<std::complex<float>, 1> &x, int64_t incx, std::complex<float> beta,
+                sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
+                sycl::buffer<float, 1> &result) {
+    throw unimplemented("blas", "axpby_nrm2", "for column_major layout");
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<double> alpha,
+                sycl::buffer<std::complex<double>, 1> &x, int64_t incx, std::complex<double> beta,
+                sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
+                sycl::buffer<double, 1> &result) {
+    throw unimplemented("blas", "axpby_nrm2", "for column_major layout");
+}
+
+void mdot(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+          sycl::buffer<float, 1> &y, int64_t incy, int64_t stridey, sycl::buffer<float, 1> &result,
+          int64_t batch_size) {
+    throw unimplemented("blas", "mdot", "for column_major layout");
+}
+
+void mdot(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+          sycl::buffer<double, 1> &y, int64_t incy, int64_t stridey,
+          sycl::buffer<double, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "mdot", "for column_major layout");
+}
+
+template <typename Func, typename T>
+void gemm3m(const char *func_name, Func func, sycl::queue &queue, transpose transa,
+            transpose transb, int64_t m, int64_t n, int64_t k, T alpha, sycl::buffer<T, 1> &a,
+            int64_t lda, sycl::buffer<T, 1> &b, int64_t ldb, T beta, sycl::buffer<T, 1> &c,
+            int64_t ldc) {
+    using cuDataType = typename CudaEquivalentType<T>::Type;
+    overflow_check(m, n, k, lda, ldb, ldc);
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c.template get_access<sycl::access::mode::read_write>(cgh);
+        onemkl_cublas_host_task(cgh, queue, [=](CublasScopedContextHandler &sc) {
+            auto handle = sc.get_handle(queue);
+            auto a_ = sc.get_mem<cuDataType *>(a_acc);
+            auto b_ = sc.get_mem<cuDataType *>(b_acc);
+            auto c_ = sc.get_mem<cuDataType *>(c_acc);
+            cublasStatus_t err;
+            CUBLAS_ERROR_FUNC_T_SYNC(func_name, func, err, handle, get_cublas_operation(transa),
+                                     get_cublas_operation(transb), m, n, k, (cuDataType *)&alpha,
+                                     a_, lda, b_, ldb, (cuDataType *)&beta, c_, ldc);
+        });
+    });
+}
+
+#define GEMM3M_LAUNCHER(TYPE, CUBLAS_ROUTINE)                                                     \
+    void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,     \
+                int64_t k, TYPE alpha, sycl::buffer<TYPE, 1> &a, int64_t lda,                     \
+                sycl::buffer<TYPE, 1> &b, int64_t ldb, TYPE beta, sycl::buffer<TYPE, 1> &c,       \
+                int64_t ldc) {                                                                    \
+        gemm3m(#CUBLAS_ROUTINE, CUBLAS_ROUTINE, queue, transa, transb, m, n, k, alpha, a, lda, b, \
+               ldb, beta, c, ldc);                                                                \
+    }
+
+GEMM3M_LAUNCHER(std::complex<float>, cublasCgemm3m)
+GEMM3M_LAUNCHER(std::complex<double>, cublasZgemm3m)
+
+#undef GEMM3M_LAUNCHER
+
 // USM APIs
 
 sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
@@ -386,6 +562,364 @@ OMATADD_LAUNCHER_USM(std::complex<double>, cublasZgeam)
 
 #undef OMATADD_LAUNCHER_USM
 
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb,
+                          offset offset_bias, int64_t m, int64_t n, int64_t k, float alpha,
+                          const float *a, int64_t lda, const float *b, int64_t ldb, float beta,
+                          float *c, int64_t ldc, const float *bias, activation act, float clamp_min,
+                          float clamp_max, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "for column_major layout");
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const sycl::half *a, int64_t lda, const sycl::half *b,
+    int64_t ldb, float beta, sycl::half *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "for column_major layout");
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const sycl::half *a, int64_t lda, const sycl::half *b,
+    int64_t ldb, float beta, float *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "for column_major layout");
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const bfloat16 *a, int64_t lda, const bfloat16 *b,
+    int64_t ldb, float beta, bfloat16 *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "for column_major layout");
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const bfloat16 *a, int64_t lda, const bfloat16 *b,
+    int64_t ldb, float beta, float *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "for column_major layout");
+}
+
+sycl::event gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+                      int64_t n, int64_t k, float alpha, const float *src, int64_t ld, float *dest,
+                      const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_pack", "for column_major layout");
+}
+
+sycl::event gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+                      int64_t n, int64_t k, double alpha, const double *src, int64_t ld,
+                      double *dest, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_pack", "for column_major layout");
+}
+
+sycl::event gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa,
+                         transpose transb, int64_t m, int64_t n, int64_t k, const float *a,
+                         int64_t lda, const float *b, int64_t ldb, float beta, float *c,
+                         int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_compute", "for column_major layout");
+}
+
+sycl::event gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa,
+                         transpose transb, int64_t m, int64_t n, int64_t k, const double *a,
+                         int64_t lda, const double *b, int64_t ldb, double beta, double *c,
+                         int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_compute", "for column_major layout");
+}
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, int64_t *m,
+                        int64_t *n, int64_t *k, float alpha, const float **a, int64_t *lda,
+                        const float **b, int64_t *ldb, float beta, float **c, int64_t *ldc,
+                        int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_vbatch", "for column_major layout");
+}
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, int64_t *m,
+                        int64_t *n, int64_t *k, double alpha, const double **a, int64_t *lda,
+                        const double **b, int64_t *ldb, double beta, double **c, int64_t *ldc,
+                        int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_vbatch", "for column_major layout");
+}
+
+sycl::event gemm_vbatch(
+    sycl::queue &queue, transpose transa, transpose transb, int64_t *m, int64_t *n, int64_t *k,
+    std::complex<float> alpha, const std::complex<float> **a, int64_t *lda,
+    const std::complex<float> **b, int64_t *ldb, std::complex<float> beta, std::complex<float> **c,
+    int64_t *ldc, int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_vbatch", "for column_major layout");
+}
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, int64_t *m,
+                        int64_t *n, int64_t *k, std::complex<double> alpha,
+                        const std::complex<double> **a, int64_t *lda,
+                        const std::complex<double> **b, int64_t *ldb, std::complex<double> beta,
+                        std::complex<double> **c, int64_t *ldc, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_vbatch", "for column_major layout");
+}
+
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                     float *y, int64_t incy, const float *z, int64_t incz, float *result,
+                     const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy_dot", "for column_major layout");
+}
+
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                     double *y, int64_t incy, const double *z, int64_t incz, double *result,
+                     const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy_dot", "for column_major layout");
+}
+
+sycl::event dot2(sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
+                 int64_t incy, const float *z, int64_t incz, float *result,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "dot2", "for column_major layout");
+}
+
+sycl::event dot2(sycl::queue &queue, int64_t n, const double *x, int64_t incx, const double *y,
+                 int64_t incy, const double *z, int64_t incz, double *result,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "dot2", "for column_major layout");
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                       float beta, float *y, int64_t incy, float *result,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby_nrm2", "for column_major layout");
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                       double beta, double *y, int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby_nrm2", "for column_major layout");
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<float> alpha,
+                       const std::complex<float> *x, int64_t incx, std::complex<float> beta,
+                       std::complex<float> *y, int64_t incy, float *result,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby_nrm2", "for column_major layout");
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<double> alpha,
+                       const std::complex<double> *x, int64_t incx, std::complex<double> beta,
+                       std::complex<double> *y, int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby_nrm2", "for column_major layout");
+}
+
+sycl::event mdot(sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
+                 int64_t incy, int64_t stridey, float *result, int64_t batch_size,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "mdot", "for column_major layout");
+}
+
+sycl::event mdot(sycl::queue &queue, int64_t n, const double *x, int64_t incx, const double *y,
+                 int64_t incy, int64_t stridey, double *result, int64_t batch_size,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "mdot", "for column_major layout");
+}
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const float *alpha, const float *x, int64_t incx,
+                 float *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", "for column_major layout");
+}
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const double *alpha, const double *x, int64_t incx,
+                 double *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", "for column_major layout");
+}
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                 const std::complex<float> *x, int64_t incx, std::complex<float> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", "for column_major layout");
+}
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                 const std::complex<double> *x, int64_t incx, std::complex<double> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", "for column_major layout");
+}
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const float *alpha, const float *x, int64_t incx,
+                  const float *beta, float *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby", "for column_major layout");
+}
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const double *alpha, const double *x, int64_t incx,
+                  const double *beta, double *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby", "for column_major layout");
+}
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                  const std::complex<float> *x, int64_t incx, const std::complex<float> *beta,
+                  std::complex<float> *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby", "for column_major layout");
+}
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                  const std::complex<double> *x, int64_t incx, const std::complex<double> *beta,
+                  std::complex<double> *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby", "for column_major layout");
+}
+
+sycl::event scal(sycl::queue &queue, int64_t n, const float *alpha, float *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "for column_major layout");
+}
+
+sycl::event scal(sycl::queue &queue, int64_t n, const double *alpha, double *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "for column_major layout");
+}
+
+sycl::event scal(sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                 std::complex<float> *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "for column_major layout");
+}
+
+sycl::event scal(sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                 std::complex<double> *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "for column_major layout");
+}
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, const float *alpha,
+                 const float *a, int64_t lda, const float *x, int64_t incx, const float *beta,
+                 float *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemv", "for column_major layout");
+}
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, const double *alpha,
+                 const double *a, int64_t lda, const double *x, int64_t incx, const double *beta,
+                 double *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemv", "for column_major layout");
+}
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                 const std::complex<float> *alpha, const std::complex<float> *a, int64_t lda,
+                 const std::complex<float> *x, int64_t incx, const std::complex<float> *beta,
+                 std::complex<float> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemv", "for column_major layout");
+}
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                 const std::complex<double> *alpha, const std::complex<double> *a, int64_t lda,
+                 const std::complex<double> *x, int64_t incx, const std::complex<double> *beta,
+                 std::complex<double> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemv", "for column_major layout");
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const float *alpha, const float *a, int64_t lda, const float *b,
+                 int64_t ldb, const float *beta, float *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm", "for column_major layout");
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const double *alpha, const double *a, int64_t lda, const double *b,
+                 int64_t ldb, const double *beta, double *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm", "for column_major layout");
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const std::complex<float> *alpha, const std::complex<float> *a,
+                 int64_t lda, const std::complex<float> *b, int64_t ldb,
+                 const std::complex<float> *beta, std::complex<float> *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm", "for column_major layout");
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const std::complex<double> *alpha, const std::complex<double> *a,
+                 int64_t lda, const std::complex<double> *b, int64_t ldb,
+                 const std::complex<double> *beta, std::complex<double> *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm", "for column_major layout");
+}
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const float *alpha, const float *a, int64_t lda, int64_t stride_a,
+                       const float *b, int64_t ldb, int64_t stride_b, const float *beta, float *c,
+                       int64_t ldc, int64_t stride_c, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_batch", "for column_major layout");
+}
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const double *alpha, const double *a, int64_t lda,
+                       int64_t stride_a, const double *b, int64_t ldb, int64_t stride_b,
+                       const double *beta, double *c, int64_t ldc, int64_t stride_c,
+                       int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_batch", "for column_major layout");
+}
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const std::complex<float> *alpha, const std::complex<float> *a,
+                       int64_t lda, int64_t stride_a, const std::complex<float> *b, int64_t ldb,
+                       int64_t stride_b, const std::complex<float> *beta, std::complex<float> *c,
+                       int64_t ldc, int64_t stride_c, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_batch", "for column_major layout");
+}
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const std::complex<double> *alpha, const std::complex<double> *a,
+                       int64_t lda, int64_t stride_a, const std::complex<double> *b, int64_t ldb,
+                       int64_t stride_b, const std::complex<double> *beta, std::complex<double> *c,
+                       int64_t ldc, int64_t stride_c, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_batch", "for column_major layout");
+}
+
+template <typename Func, typename T>
+sycl::event gemm3m(const char *func_name, Func func, sycl::queue &queue, transpose transa,
+                   transpose transb, int64_t m, int64_t n, int64_t k, T alpha, const T *a,
+                   int64_t lda, const T *b, int64_t ldb, T beta, T *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    using cuDataType = typename CudaEquivalentType<T>::Type;
+    overflow_check(m, n, k, lda, ldb, ldc);
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        onemkl_cublas_host_task(cgh, queue, [=](CublasScopedContextHandler &sc) {
+            auto handle = sc.get_handle(queue);
+            auto a_ = reinterpret_cast<const cuDataType *>(a);
+            auto b_ = reinterpret_cast<const cuDataType *>(b);
+            auto c_ = reinterpret_cast<cuDataType *>(c);
+            cublasStatus_t err;
+            CUBLAS_ERROR_FUNC_T_SYNC(func_name, func, err, handle, get_cublas_operation(transa),
+                                     get_cublas_operation(transb), m, n, k, (cuDataType *)&alpha,
+                                     a_, lda, b_, ldb, (cuDataType *)&beta, c_, ldc);
+        });
+    });
+    return done;
+}
+
+#define GEMM3M_LAUNCHER_USM(TYPE, CUBLAS_ROUTINE)                                                \
+    sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m,        \
+                       int64_t n, int64_t k, TYPE alpha, const TYPE *a, int64_t lda,             \
+                       const TYPE *b, int64_t ldb, TYPE beta, TYPE *c, int64_t ldc,              \
+                       const std::vector<sycl::event> &dependencies) {                           \
+        return gemm3m(#CUBLAS_ROUTINE, CUBLAS_ROUTINE, queue, transa, transb, m, n, k, alpha, a, \
+                      lda, b, ldb, beta, c, ldc, dependencies);                                  \
+    }
+
+GEMM3M_LAUNCHER_USM(std::complex<float>, cublasCgemm3m)
+GEMM3M_LAUNCHER_USM(std::complex<double>, cublasZgemm3m)
+
+#undef GEMM3M_LAUNCHER_USM
+
 } // namespace column_major
 
 namespace row_major {
@@ -563,6 +1097,183 @@ OMATADD_LAUNCHER(std::complex<double>, cublasZgeam)
 
 #undef OMATADD_LAUNCHER
 
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<float, 1> &a,
+                   int64_t lda, sycl::buffer<float, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    throw unimplemented("blas", "gemm_epilogue", "for row_major layout");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<sycl::half, 1> &a,
+                   int64_t lda, sycl::buffer<sycl::half, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<sycl::half, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    throw unimplemented("blas", "gemm_epilogue", "for row_major layout");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<sycl::half, 1> &a,
+                   int64_t lda, sycl::buffer<sycl::half, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    throw unimplemented("blas", "gemm_epilogue", "for row_major layout");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a,
+                   int64_t lda, sycl::buffer<bfloat16, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<bfloat16, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    throw unimplemented("blas", "gemm_epilogue", "for row_major layout");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a,
+                   int64_t lda, sycl::buffer<bfloat16, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    throw unimplemented("blas", "gemm_epilogue", "for row_major layout");
+}
+
+int64_t sgemm_pack_get_size(sycl::queue &queue, gemm_pack_matrix identifier, int64_t m, int64_t n,
+                            int64_t k) {
+    throw unimplemented("blas", "sgemm_pack_get_size", "for row_major layout");
+}
+
+int64_t dgemm_pack_get_size(sycl::queue &queue, gemm_pack_matrix identifier, int64_t m, int64_t n,
+                            int64_t k) {
+    throw unimplemented("blas", "dgemm_pack_get_size", "for row_major layout");
+}
+
+void gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+               int64_t n, int64_t k, float alpha, sycl::buffer<float, 1> &src, int64_t ld,
+               sycl::buffer<float, 1> &dest) {
+    throw unimplemented("blas", "gemm_pack", "for row_major layout");
+}
+
+void gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+               int64_t n, int64_t k, double alpha, sycl::buffer<double, 1> &src, int64_t ld,
+               sycl::buffer<double, 1> &dest) {
+    throw unimplemented("blas", "gemm_pack", "for row_major layout");
+}
+
+void gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa, transpose transb,
+                  int64_t m, int64_t n, int64_t k, sycl::buffer<float, 1> &a, int64_t lda,
+                  sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+                  int64_t ldc) {
+    throw unimplemented("blas", "gemm_compute", "for row_major layout");
+}
+
+void gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa, transpose transb,
+                  int64_t m, int64_t n, int64_t k, sycl::buffer<double, 1> &a, int64_t lda,
+                  sycl::buffer<double, 1> &b, int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+                  int64_t ldc) {
+    throw unimplemented("blas", "gemm_compute", "for row_major layout");
+}
+
+void axpy_dot(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+              sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+              sycl::buffer<float, 1> &result) {
+    throw unimplemented("blas", "axpy_dot", "for row_major layout");
+}
+
+void axpy_dot(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x, int64_t incx,
+              sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+              sycl::buffer<double, 1> &result) {
+    throw unimplemented("blas", "axpy_dot", "for row_major layout");
+}
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+          sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+          sycl::buffer<float, 1> &result) {
+    throw unimplemented("blas", "dot2", "for row_major layout");
+}
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+          sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+          sycl::buffer<double, 1> &result) {
+    throw unimplemented("blas", "dot2", "for row_major layout");
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+                float beta, sycl::buffer<float, 1> &y, int64_t incy,
+                sycl::buffer<float, 1> &result) {
+    throw unimplemented("blas", "axpby_nrm2", "for row_major layout");
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x,
+                int64_t incx, double beta, sycl::buffer<double, 1> &y, int64_t incy,
+                sycl::buffer<double, 1> &result) {
+    throw unimplemented("blas", "axpby_nrm2", "for row_major layout");
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<float> alpha,
+                sycl::buffer<std::complex<float>, 1> &x, int64_t incx, std::complex<float> beta,
+                sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
+                sycl::buffer<float, 1> &result) {
+    throw unimplemented("blas", "axpby_nrm2", "for row_major layout");
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<double> alpha,
+                sycl::buffer<std::complex<double>, 1> &x, int64_t incx, std::complex<double> beta,
+                sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
+                sycl::buffer<double, 1> &result) {
+    throw unimplemented("blas", "axpby_nrm2", "for row_major layout");
+}
+
+void mdot(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+          sycl::buffer<float, 1> &y, int64_t incy, int64_t stridey, sycl::buffer<float, 1> &result,
+          int64_t batch_size) {
+    throw unimplemented("blas", "mdot", "for row_major layout");
+}
+
+void mdot(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+          sycl::buffer<double, 1> &y, int64_t incy, int64_t stridey,
+          sycl::buffer<double, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "mdot", "for row_major layout");
+}
+
+template <typename Func, typename T>
+void gemm3m(const char *func_name, Func func, sycl::queue &queue, transpose transa,
+            transpose transb, int64_t m, int64_t n, int64_t k, T alpha, sycl::buffer<T, 1> &a,
+            int64_t lda, sycl::buffer<T, 1> &b, int64_t ldb, T beta, sycl::buffer<T, 1> &c,
+            int64_t ldc) {
+    using cuDataType = typename CudaEquivalentType<T>::Type;
+    overflow_check(m, n, k, lda, ldb, ldc);
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c.template get_access<sycl::access::mode::read_write>(cgh);
+        onemkl_cublas_host_task(cgh, queue, [=](CublasScopedContextHandler &sc) {
+            auto handle = sc.get_handle(queue);
+            auto a_ = sc.get_mem<cuDataType *>(a_acc);
+            auto b_ = sc.get_mem<cuDataType *>(b_acc);
+            auto c_ = sc.get_mem<cuDataType *>(c_acc);
+            cublasStatus_t err;
+            // C^T = op(B)^T * op(A)^T in column-major terms.
+            CUBLAS_ERROR_FUNC_T_SYNC(func_name, func, err, handle, get_cublas_operation(transb),
+                                     get_cublas_operation(transa), n, m, k, (cuDataType *)&alpha,
+                                     b_, ldb, a_, lda, (cuDataType *)&beta, c_, ldc);
+        });
+    });
+}
+
+#define GEMM3M_LAUNCHER(TYPE, CUBLAS_ROUTINE)                                                     \
+    void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,     \
+                int64_t k, TYPE alpha, sycl::buffer<TYPE, 1> &a, int64_t lda,                     \
+                sycl::buffer<TYPE, 1> &b, int64_t ldb, TYPE beta, sycl::buffer<TYPE, 1> &c,       \
+                int64_t ldc) {                                                                    \
+        gemm3m(#CUBLAS_ROUTINE, CUBLAS_ROUTINE, queue, transa, transb, m, n, k, alpha, a, lda, b, \
+               ldb, beta, c, ldc);                                                                \
+    }
+
+GEMM3M_LAUNCHER(std::complex<float>, cublasCgemm3m)
+GEMM3M_LAUNCHER(std::complex<double>, cublasZgemm3m)
+
+#undef GEMM3M_LAUNCHER
+
 // USM APIs
 
 sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
@@ -749,6 +1460,365 @@ OMATADD_LAUNCHER_USM(std::complex<double>, cublasZgeam)
 
 #undef OMATADD_LAUNCHER_USM
 
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb,
+                          offset offset_bias, int64_t m, int64_t n, int64_t k, float alpha,
+                          const float *a, int64_t lda, const float *b, int64_t ldb, float beta,
+                          float *c, int64_t ldc, const float *bias, activation act, float clamp_min,
+                          float clamp_max, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "for row_major layout");
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const sycl::half *a, int64_t lda, const sycl::half *b,
+    int64_t ldb, float beta, sycl::half *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "for row_major layout");
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const sycl::half *a, int64_t lda, const sycl::half *b,
+    int64_t ldb, float beta, float *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "for row_major layout");
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const bfloat16 *a, int64_t lda, const bfloat16 *b,
+    int64_t ldb, float beta, bfloat16 *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "for row_major layout");
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const bfloat16 *a, int64_t lda, const bfloat16 *b,
+    int64_t ldb, float beta, float *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "for row_major layout");
+}
+
+sycl::event gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+                      int64_t n, int64_t k, float alpha, const float *src, int64_t ld, float *dest,
+                      const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_pack", "for row_major layout");
+}
+
+sycl::event gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+                      int64_t n, int64_t k, double alpha, const double *src, int64_t ld,
+                      double *dest, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_pack", "for row_major layout");
+}
+
+sycl::event gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa,
+                         transpose transb, int64_t m, int64_t n, int64_t k, const float *a,
+                         int64_t lda, const float *b, int64_t ldb, float beta, float *c,
+                         int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_compute", "for row_major layout");
+}
+
+sycl::event gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa,
+                         transpose transb, int64_t m, int64_t n, int64_t k, const double *a,
+                         int64_t lda, const double *b, int64_t ldb, double beta, double *c,
+                         int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_compute", "for row_major layout");
+}
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, int64_t *m,
+                        int64_t *n, int64_t *k, float alpha, const float **a, int64_t *lda,
+                        const float **b, int64_t *ldb, float beta, float **c, int64_t *ldc,
+                        int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_vbatch", "for row_major layout");
+}
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, int64_t *m,
+                        int64_t *n, int64_t *k, double alpha, const double **a, int64_t *lda,
+                        const double **b, int64_t *ldb, double beta, double **c, int64_t *ldc,
+                        int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_vbatch", "for row_major layout");
+}
+
+sycl::event gemm_vbatch(
+    sycl::queue &queue, transpose transa, transpose transb, int64_t *m, int64_t *n, int64_t *k,
+    std::complex<float> alpha, const std::complex<float> **a, int64_t *lda,
+    const std::complex<float> **b, int64_t *ldb, std::complex<float> beta, std::complex<float> **c,
+    int64_t *ldc, int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_vbatch", "for row_major layout");
+}
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, int64_t *m,
+                        int64_t *n, int64_t *k, std::complex<double> alpha,
+                        const std::complex<double> **a, int64_t *lda,
+                        const std::complex<double> **b, int64_t *ldb, std::complex<double> beta,
+                        std::complex<double> **c, int64_t *ldc, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_vbatch", "for row_major layout");
+}
+
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                     float *y, int64_t incy, const float *z, int64_t incz, float *result,
+                     const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy_dot", "for row_major layout");
+}
+
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                     double *y, int64_t incy, const double *z, int64_t incz, double *result,
+                     const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy_dot", "for row_major layout");
+}
+
+sycl::event dot2(sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
+                 int64_t incy, const float *z, int64_t incz, float *result,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "dot2", "for row_major layout");
+}
+
+sycl::event dot2(sycl::queue &queue, int64_t n, const double *x, int64_t incx, const double *y,
+                 int64_t incy, const double *z, int64_t incz, double *result,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "dot2", "for row_major layout");
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                       float beta, float *y, int64_t incy, float *result,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby_nrm2", "for row_major layout");
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                       double beta, double *y, int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby_nrm2", "for row_major layout");
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<float> alpha,
+                       const std::complex<float> *x, int64_t incx, std::complex<float> beta,
+                       std::complex<float> *y, int64_t incy, float *result,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby_nrm2", "for row_major layout");
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<double> alpha,
+                       const std::complex<double> *x, int64_t incx, std::complex<double> beta,
+                       std::complex<double> *y, int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby_nrm2", "for row_major layout");
+}
+
+sycl::event mdot(sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
+                 int64_t incy, int64_t stridey, float *result, int64_t batch_size,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "mdot", "for row_major layout");
+}
+
+sycl::event mdot(sycl::queue &queue, int64_t n, const double *x, int64_t incx, const double *y,
+                 int64_t incy, int64_t stridey, double *result, int64_t batch_size,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "mdot", "for row_major layout");
+}
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const float *alpha, const float *x, int64_t incx,
+                 float *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", "for row_major layout");
+}
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const double *alpha, const double *x, int64_t incx,
+                 double *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", "for row_major layout");
+}
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                 const std::complex<float> *x, int64_t incx, std::complex<float> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", "for row_major layout");
+}
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                 const std::complex<double> *x, int64_t incx, std::complex<double> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", "for row_major layout");
+}
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const float *alpha, const float *x, int64_t incx,
+                  const float *beta, float *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby", "for row_major layout");
+}
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const double *alpha, const double *x, int64_t incx,
+                  const double *beta, double *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby", "for row_major layout");
+}
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                  const std::complex<float> *x, int64_t incx, const std::complex<float> *beta,
+                  std::complex<float> *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby", "for row_major layout");
+}
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                  const std::complex<double> *x, int64_t incx, const std::complex<double> *beta,
+                  std::complex<double> *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby", "for row_major layout");
+}
+
+sycl::event scal(sycl::queue &queue, int64_t n, const float *alpha, float *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "for row_major layout");
+}
+
+sycl::event scal(sycl::queue &queue, int64_t n, const double *alpha, double *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "for row_major layout");
+}
+
+sycl::event scal(sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                 std::complex<float> *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "for row_major layout");
+}
+
+sycl::event scal(sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                 std::complex<double> *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "for row_major layout");
+}
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, const float *alpha,
+                 const float *a, int64_t lda, const float *x, int64_t incx, const float *beta,
+                 float *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemv", "for row_major layout");
+}
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, const double *alpha,
+                 const double *a, int64_t lda, const double *x, int64_t incx, const double *beta,
+                 double *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemv", "for row_major layout");
+}
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                 const std::complex<float> *alpha, const std::complex<float> *a, int64_t lda,
+                 const std::complex<float> *x, int64_t incx, const std::complex<float> *beta,
+                 std::complex<float> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemv", "for row_major layout");
+}
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                 const std::complex<double> *alpha, const std::complex<double> *a, int64_t lda,
+                 const std::complex<double> *x, int64_t incx, const std::complex<double> *beta,
+                 std::complex<double> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemv", "for row_major layout");
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const float *alpha, const float *a, int64_t lda, const float *b,
+                 int64_t ldb, const float *beta, float *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm", "for row_major layout");
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const double *alpha, const double *a, int64_t lda, const double *b,
+                 int64_t ldb, const double *beta, double *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm", "for row_major layout");
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const std::complex<float> *alpha, const std::complex<float> *a,
+                 int64_t lda, const std::complex<float> *b, int64_t ldb,
+                 const std::complex<float> *beta, std::complex<float> *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm", "for row_major layout");
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const std::complex<double> *alpha, const std::complex<double> *a,
+                 int64_t lda, const std::complex<double> *b, int64_t ldb,
+                 const std::complex<double> *beta, std::complex<double> *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm", "for row_major layout");
+}
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const float *alpha, const float *a, int64_t lda, int64_t stride_a,
+                       const float *b, int64_t ldb, int64_t stride_b, const float *beta, float *c,
+                       int64_t ldc, int64_t stride_c, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_batch", "for row_major layout");
+}
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const double *alpha, const double *a, int64_t lda,
+                       int64_t stride_a, const double *b, int64_t ldb, int64_t stride_b,
+                       const double *beta, double *c, int64_t ldc, int64_t stride_c,
+                       int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_batch", "for row_major layout");
+}
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const std::complex<float> *alpha, const std::complex<float> *a,
+                       int64_t lda, int64_t stride_a, const std::complex<float> *b, int64_t ldb,
+                       int64_t stride_b, const std::complex<float> *beta, std::complex<float> *c,
+                       int64_t ldc, int64_t stride_c, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_batch", "for row_major layout");
+}
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const std::complex<double> *alpha, const std::complex<double> *a,
+                       int64_t lda, int64_t stride_a, const std::complex<double> *b, int64_t ldb,
+                       int64_t stride_b, const std::complex<double> *beta, std::complex<double> *c,
+                       int64_t ldc, int64_t stride_c, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_batch", "for row_major layout");
+}
+
+template <typename Func, typename T>
+sycl::event gemm3m(const char *func_name, Func func, sycl::queue &queue, transpose transa,
+                   transpose transb, int64_t m, int64_t n, int64_t k, T alpha, const T *a,
+                   int64_t lda, const T *b, int64_t ldb, T beta, T *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    using cuDataType = typename CudaEquivalentType<T>::Type;
+    overflow_check(m, n, k, lda, ldb, ldc);
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        onemkl_cublas_host_task(cgh, queue, [=](CublasScopedContextHandler &sc) {
+            auto handle = sc.get_handle(queue);
+            auto a_ = reinterpret_cast<const cuDataType *>(a);
+            auto b_ = reinterpret_cast<const cuDataType *>(b);
+            auto c_ = reinterpret_cast<cuDataType *>(c);
+            cublasStatus_t err;
+            // C^T = op(B)^T * op(A)^T in column-major terms.
+            CUBLAS_ERROR_FUNC_T_SYNC(func_name, func, err, handle, get_cublas_operation(transb),
+                                     get_cublas_operation(transa), n, m, k, (cuDataType *)&alpha,
+                                     b_, ldb, a_, lda, (cuDataType *)&beta, c_, ldc);
+        });
+    });
+    return done;
+}
+
+#define GEMM3M_LAUNCHER_USM(TYPE, CUBLAS_ROUTINE)                                                \
+    sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m,        \
+                       int64_t n, int64_t k, TYPE alpha, const TYPE *a, int64_t lda,             \
+                       const TYPE *b, int64_t ldb, TYPE beta, TYPE *c, int64_t ldc,              \
+                       const std::vector<sycl::event> &dependencies) {                           \
+        return gemm3m(#CUBLAS_ROUTINE, CUBLAS_ROUTINE, queue, transa, transb, m, n, k, alpha, a, \
+                      lda, b, ldb, beta, c, ldc, dependencies);                                  \
+    }
+
+GEMM3M_LAUNCHER_USM(std::complex<float>, cublasCgemm3m)
+GEMM3M_LAUNCHER_USM(std::complex<double>, cublasZgemm3m)
+
+#undef GEMM3M_LAUNCHER_USM
+
 } // namespace row_major
 } // namespace cublas
 } // namespace blas
@@ -245,6 +245,29 @@ extern "C" blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::cublas::column_major::omatadd,
     oneapi::mkl::blas::cublas::column_major::omatadd,
     oneapi::mkl::blas::cublas::column_major::omatadd,
+    oneapi::mkl::blas::cublas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::column_major::sgemm_pack_get_size,
+    oneapi::mkl::blas::cublas::column_major::dgemm_pack_get_size,
+    oneapi::mkl::blas::cublas::column_major::gemm_pack,
+    oneapi::mkl::blas::cublas::column_major::gemm_pack,
+    oneapi::mkl::blas::cublas::column_major::gemm_compute,
+    oneapi::mkl::blas::cublas::column_major::gemm_compute,
+    oneapi::mkl::blas::cublas::column_major::axpy_dot,
+    oneapi::mkl::blas::cublas::column_major::axpy_dot,
+    oneapi::mkl::blas::cublas::column_major::dot2,
+    oneapi::mkl::blas::cublas::column_major::dot2,
+    oneapi::mkl::blas::cublas::column_major::axpby_nrm2,
+    oneapi::mkl::blas::cublas::column_major::axpby_nrm2,
+    oneapi::mkl::blas::cublas::column_major::axpby_nrm2,
+    oneapi::mkl::blas::cublas::column_major::axpby_nrm2,
+    oneapi::mkl::blas::cublas::column_major::mdot,
+    oneapi::mkl::blas::cublas::column_major::mdot,
+    oneapi::mkl::blas::cublas::column_major::gemm3m,
+    oneapi::mkl::blas::cublas::column_major::gemm3m,
     oneapi::mkl::blas::cublas::column_major::asum,
     oneapi::mkl::blas::cublas::column_major::asum,
     oneapi::mkl::blas::cublas::column_major::asum,
@@ -504,6 +527,55 @@ extern "C" blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::cublas::column_major::imatcopy_batch,
     oneapi::mkl::blas::cublas::column_major::imatcopy_batch,
     oneapi::mkl::blas::cublas::column_major::imatcopy_batch,
+    oneapi::mkl::blas::cublas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::column_major::gemm_pack,
+    oneapi::mkl::blas::cublas::column_major::gemm_pack,
+    oneapi::mkl::blas::cublas::column_major::gemm_compute,
+    oneapi::mkl::blas::cublas::column_major::gemm_compute,
+    oneapi::mkl::blas::cublas::column_major::gemm_vbatch,
+    oneapi::mkl::blas::cublas::column_major::gemm_vbatch,
+    oneapi::mkl::blas::cublas::column_major::gemm_vbatch,
+    oneapi::mkl::blas::cublas::column_major::gemm_vbatch,
+    oneapi::mkl::blas::cublas::column_major::axpy_dot,
+    oneapi::mkl::blas::cublas::column_major::axpy_dot,
+    oneapi::mkl::blas::cublas::column_major::dot2,
+    oneapi::mkl::blas::cublas::column_major::dot2,
+    oneapi::mkl::blas::cublas::column_major::axpby_nrm2,
+    oneapi::mkl::blas::cublas::column_major::axpby_nrm2,
+    oneapi::mkl::blas::cublas::column_major::axpby_nrm2,
+    oneapi::mkl::blas::cublas::column_major::axpby_nrm2,
+    oneapi::mkl::blas::cublas::column_major::mdot,
+    oneapi::mkl::blas::cublas::column_major::mdot,
+    oneapi::mkl::blas::cublas::column_major::axpy,
+    oneapi::mkl::blas::cublas::column_major::axpy,
+    oneapi::mkl::blas::cublas::column_major::axpy,
+    oneapi::mkl::blas::cublas::column_major::axpy,
+    oneapi::mkl::blas::cublas::column_major::axpby,
+    oneapi::mkl::blas::cublas::column_major::axpby,
+    oneapi::mkl::blas::cublas::column_major::axpby,
+    oneapi::mkl::blas::cublas::column_major::axpby,
+    oneapi::mkl::blas::cublas::column_major::scal,
+    oneapi::mkl::blas::cublas::column_major::scal,
+    oneapi::mkl::blas::cublas::column_major::scal,
+    oneapi::mkl::blas::cublas::column_major::scal,
+    oneapi::mkl::blas::cublas::column_major::gemv,
+    oneapi::mkl::blas::cublas::column_major::gemv,
+    oneapi::mkl::blas::cublas::column_major::gemv,
+    oneapi::mkl::blas::cublas::column_major::gemv,
+    oneapi::mkl::blas::cublas::column_major::gemm,
+    oneapi::mkl::blas::cublas::column_major::gemm,
+    oneapi::mkl::blas::cublas::column_major::gemm,
+    oneapi::mkl::blas::cublas::column_major::gemm,
+    oneapi::mkl::blas::cublas::column_major::gemm_batch,
+    oneapi::mkl::blas::cublas::column_major::gemm_batch,
+    oneapi::mkl::blas::cublas::column_major::gemm_batch,
+    oneapi::mkl::blas::cublas::column_major::gemm_batch,
+    oneapi::mkl::blas::cublas::column_major::gemm3m,
+    oneapi::mkl::blas::cublas::column_major::gemm3m,
     oneapi::mkl::blas::cublas::row_major::asum,
     oneapi::mkl::blas::cublas::row_major::asum,
     oneapi::mkl::blas::cublas::row_major::asum,
@@ -726,6 +798,29 @@ extern "C" blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::cublas::row_major::omatadd,
     oneapi::mkl::blas::cublas::row_major::omatadd,
     oneapi::mkl::blas::cublas::row_major::omatadd,
+    oneapi::mkl::blas::cublas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::row_major::sgemm_pack_get_size,
+    oneapi::mkl::blas::cublas::row_major::dgemm_pack_get_size,
+    oneapi::mkl::blas::cublas::row_major::gemm_pack,
+    oneapi::mkl::blas::cublas::row_major::gemm_pack,
+    oneapi::mkl::blas::cublas::row_major::gemm_compute,
+    oneapi::mkl::blas::cublas::row_major::gemm_compute,
+    oneapi::mkl::blas::cublas::row_major::axpy_dot,
+    oneapi::mkl::blas::cublas::row_major::axpy_dot,
+    oneapi::mkl::blas::cublas::row_major::dot2,
+    oneapi::mkl::blas::cublas::row_major::dot2,
+    oneapi::mkl::blas::cublas::row_major::axpby_nrm2,
+    oneapi::mkl::blas::cublas::row_major::axpby_nrm2,
+    oneapi::mkl::blas::cublas::row_major::axpby_nrm2,
+    oneapi::mkl::blas::cublas::row_major::axpby_nrm2,
+    oneapi::mkl::blas::cublas::row_major::mdot,
+    oneapi::mkl::blas::cublas::row_major::mdot,
+    oneapi::mkl::blas::cublas::row_major::gemm3m,
+    oneapi::mkl::blas::cublas::row_major::gemm3m,
     oneapi::mkl::blas::cublas::row_major::asum,
     oneapi::mkl::blas::cublas::row_major::asum,
     oneapi::mkl::blas::cublas::row_major::asum,
@@ -985,4 +1080,53 @@ extern "C" blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::cublas::row_major::imatcopy_batch,
     oneapi::mkl::blas::cublas::row_major::imatcopy_batch,
     oneapi::mkl::blas::cublas::row_major::imatcopy_batch,
+    oneapi::mkl::blas::cublas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::cublas::row_major::gemm_pack,
+    oneapi::mkl::blas::cublas::row_major::gemm_pack,
+    oneapi::mkl::blas::cublas::row_major::gemm_compute,
+    oneapi::mkl::blas::cublas::row_major::gemm_compute,
+    oneapi::mkl::blas::cublas::row_major::gemm_vbatch,
+    oneapi::mkl::blas::cublas::row_major::gemm_vbatch,
+    oneapi::mkl::blas::cublas::row_major::gemm_vbatch,
+    oneapi::mkl::blas::cublas::row_major::gemm_vbatch,
+    oneapi::mkl::blas::cublas::row_major::axpy_dot,
+    oneapi::mkl::blas::cublas::row_major::axpy_dot,
+    oneapi::mkl::blas::cublas::row_major::dot2,
+    oneapi::mkl::blas::cublas::row_major::dot2,
+    oneapi::mkl::blas::cublas::row_major::axpby_nrm2,
+    oneapi::mkl::blas::cublas::row_major::axpby_nrm2,
+    oneapi::mkl::blas::cublas::row_major::axpby_nrm2,
+    oneapi::mkl::blas::cublas::row_major::axpby_nrm2,
+    oneapi::mkl::blas::cublas::row_major::mdot,
+    oneapi::mkl::blas::cublas::row_major::mdot,
+    oneapi::mkl::blas::cublas::row_major::axpy,
+    oneapi::mkl::blas::cublas::row_major::axpy,
+    oneapi::mkl::blas::cublas::row_major::axpy,
+    oneapi::mkl::blas::cublas::row_major::axpy,
+    oneapi::mkl::blas::cublas::row_major::axpby,
+    oneapi::mkl::blas::cublas::row_major::axpby,
+    oneapi::mkl::blas::cublas::row_major::axpby,
+    oneapi::mkl::blas::cublas::row_major::axpby,
+    oneapi::mkl::blas::cublas::row_major::scal,
+    oneapi::mkl::blas::cublas::row_major::scal,
+    oneapi::mkl::blas::cublas::row_major::scal,
+    oneapi::mkl::blas::cublas::row_major::scal,
+    oneapi::mkl::blas::cublas::row_major::gemv,
+    oneapi::mkl::blas::cublas::row_major::gemv,
+    oneapi::mkl::blas::cublas::row_major::gemv,
+    oneapi::mkl::blas::cublas::row_major::gemv,
+    oneapi::mkl::blas::cublas::row_major::gemm,
+    oneapi::mkl::blas::cublas::row_major::gemm,
+    oneapi::mkl::blas::cublas::row_major::gemm,
+    oneapi::mkl::blas::cublas::row_major::gemm,
+    oneapi::mkl::blas::cublas::row_major::gemm_batch,
+    oneapi::mkl::blas::cublas::row_major::gemm_batch,
+    oneapi::mkl::blas::cublas::row_major::gemm_batch,
+    oneapi::mkl::blas::cublas::row_major::gemm_batch,
+    oneapi::mkl::blas::cublas::row_major::gemm3m,
+    oneapi::mkl::blas::cublas::row_major::gemm3m,
 };
@@ -989,3 +989,116 @@ sycl::event imatcopy_batch(sycl::queue& queue, transpose* trans, int64_t* m, int
     return blas_major::imatcopy_batch(queue, trans, m, n, alpha, ab, lda, ldb, group_count,
                                       groupsize, dependencies);
 }
+
+// Variable-size batches go to the group API with entries of equal shape
+// merged into one group and the groups ordered by decreasing flop count, so
+// the largest products are scheduled first and repeated small shapes share
+// a group instead of getting one group each.
+template <typename T>
+struct gemm_vbatch_groups {
+    std::vector<transpose> transa, transb;
+    std::vector<int64_t> m, n, k, lda, ldb, ldc, size;
+    std::vector<T> alpha, beta;
+};
+
+template <typename T>
+sycl::event gemm_vbatch_grouped(sycl::queue &queue, transpose transa, transpose transb, int64_t *m,
+                                int64_t *n, int64_t *k, T alpha, const T **a, int64_t *lda,
+                                const T **b, int64_t *ldb, T beta, T **c, int64_t *ldc,
+                                int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    if (batch_size <= 0) {
+        return queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(dependencies);
+            cgh.host_task([]() {});
+        });
+    }
+    auto shape = [&](int64_t i) {
+        return std::make_tuple(m[i], n[i], k[i], lda[i], ldb[i], ldc[i]);
+    };
+    auto cost = [&](int64_t i) { return double(m[i]) * double(n[i]) * (double(k[i]) + 1.0); };
+    std::vector<int64_t> order(batch_size);
+    std::iota(order.begin(), order.end(), int64_t(0));
+    std::stable_sort(order.begin(), order.end(), [&](int64_t x, int64_t y) {
+        return cost(x) != cost(y) ? cost(x) > cost(y) : shape(x) < shape(y);
+    });
+
+    // The pointer arrays are read on the device, so the reordered copies are
+    // kept in shared memory until the batch has completed.
+    void **ptrs = sycl::malloc_shared<void *>(3 * batch_size, queue);
+    auto a_sorted = reinterpret_cast<const T **>(ptrs);
+    auto b_sorted = reinterpret_cast<const T **>(ptrs + batch_size);
+    auto c_sorted = reinterpret_cast<T **>(ptrs + 2 * batch_size);
+    auto groups = std::make_shared<gemm_vbatch_groups<T>>();
+    for (int64_t pos = 0; pos < batch_size; pos++) {
+        const int64_t i = order[pos];
+        a_sorted[pos] = a[i];
+        b_sorted[pos] = b[i];
+        c_sorted[pos] = c[i];
+        if (pos == 0 || shape(i) != shape(order[pos - 1])) {
+            groups->m.push_back(m[i]);
+            groups->n.push_back(n[i]);
+            groups->k.push_back(k[i]);
+            groups->lda.push_back(lda[i]);
+            groups->ldb.push_back(ldb[i]);
+            groups->ldc.push_back(ldc[i]);
+            groups->size.push_back(0);
+        }
+        groups->size.back()++;
+    }
+    const int64_t group_count = groups->size.size();
+    groups->transa.assign(group_count, transa);
+    groups->transb.assign(group_count, transb);
+    groups->alpha.assign(group_count, alpha);
+    groups->beta.assign(group_count, beta);
+
+    auto done = blas_major::gemm_batch(
+        queue, groups->transa.data(), groups->transb.data(), groups->m.data(), groups->n.data(),
+        groups->k.data(), groups->alpha.data(), a_sorted, groups->lda.data(), b_sorted,
+        groups->ldb.data(), groups->beta.data(), c_sorted, groups->ldc.data(), group_count,
+        groups->size.data(), dependencies);
+    // The host task holds the last reference to the group arrays, which the
+    // library may read until the batch has completed.
+    auto context = queue.get_context();
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(done);
+        cgh.host_task([=]() {
+            (void)groups;
+            sycl::free(ptrs, context);
+        });
+    });
+}
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, int64_t *m,
+                        int64_t *n, int64_t *k, float alpha, const float **a, int64_t *lda,
+                        const float **b, int64_t *ldb, float beta, float **c, int64_t *ldc,
+                        int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return gemm_vbatch_grouped(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                               batch_size, dependencies);
+}
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, int64_t *m,
+                        int64_t *n, int64_t *k, double alpha, const double **a, int64_t *lda,
+                        const double **b, int64_t *ldb, double beta, double **c, int64_t *ldc,
+                        int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return gemm_vbatch_grouped(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                               batch_size, dependencies);
+}
+
+sycl::event gemm_vbatch(
+    sycl::queue &queue, transpose transa, transpose transb, int64_t *m, int64_t *n, int64_t *k,
+    std::complex<float> alpha, const std::complex<float> **a, int64_t *lda,
+    const std::complex<float> **b, int64_t *ldb, std::complex<float> beta, std::complex<float> **c,
+    int64_t *ldc, int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return gemm_vbatch_grouped(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                               batch_size, dependencies);
+}
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, int64_t *m,
+                        int64_t *n, int64_t *k, std::complex<double> alpha,
+                        const std::complex<double> **a, int64_t *lda,
+                        const std::complex<double> **b, int64_t *ldb, std::complex<double> beta,
+                        std::complex<double> **c, int64_t *ldc, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return gemm_vbatch_grouped(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                               batch_size, dependencies);
+}
@@ -17,6 +17,75 @@
 * SPDX-License-Identifier: Apache-2.0
 *******************************************************************************/
 
+// oneMKL has no fused level 1 routines, so axpy_dot, dot2, axpby_nrm2 and
+// mdot are composed from the corresponding oneMKL calls here. mdot maps onto
+// a single GEMV when the vectors form a matrix with one unit stride; it does
+// not depend on the layout, so the column-major GEMV serves both namespaces.
+
+template <typename T>
+void dot2_buffer(sycl::queue &queue, int64_t n, sycl::buffer<T, 1> &x, int64_t incx,
+                 sycl::buffer<T, 1> &y, int64_t incy, sycl::buffer<T, 1> &z, int64_t incz,
+                 sycl::buffer<T, 1> &result) {
+    sycl::buffer<T, 1> dot_y{ sycl::range<1>(1) };
+    sycl::buffer<T, 1> dot_z{ sycl::range<1>(1) };
+    blas_major::dot(queue, n, x, incx, y, incy, dot_y);
+    blas_major::dot(queue, n, x, incx, z, incz, dot_z);
+    queue.submit([&](sycl::handler &cgh) {
+        auto dot_y_acc = dot_y.template get_access<sycl::access::mode::read>(cgh);
+        auto dot_z_acc = dot_z.template get_access<sycl::access::mode::read>(cgh);
+        auto result_acc = result.template get_access<sycl::access::mode::write>(cgh);
+        cgh.single_task([=]() {
+            result_acc[0] = dot_y_acc[0];
+            result_acc[1] = dot_z_acc[0];
+        });
+    });
+}
+
+inline bool mdot_as_gemv(int64_t n, int64_t incy, int64_t stridey, int64_t batch_size,
+                         transpose &trans, int64_t &m_gemv, int64_t &n_gemv, int64_t &ld) {
+    if (incy == 1 && stridey >= std::max<int64_t>(n, 1)) {
+        trans = transpose::trans;
+        m_gemv = n;
+        n_gemv = batch_size;
+        ld = stridey;
+        return true;
+    }
+    if (stridey == 1 && incy >= std::max<int64_t>(batch_size, 1)) {
+        trans = transpose::nontrans;
+        m_gemv = batch_size;
+        n_gemv = n;
+        ld = incy;
+        return true;
+    }
+    return false;
+}
+
+template <typename T>
+void mdot_gemv(sycl::queue &queue, int64_t n, sycl::buffer<T, 1> &x, int64_t incx,
+               sycl::buffer<T, 1> &y, int64_t incy, int64_t stridey, sycl::buffer<T, 1> &result,
+               int64_t batch_size) {
+    transpose trans;
+    int64_t m_gemv, n_gemv, ld;
+    if (!mdot_as_gemv(n, incy, stridey, batch_size, trans, m_gemv, n_gemv, ld)) {
+        throw unimplemented("blas", "mdot", "for vectors that are not unit strided");
+    }
+    ::oneapi::mkl::blas::column_major::gemv(queue, trans, m_gemv, n_gemv, T(1), y, ld, x, incx,
+                                            T(0), result, 1);
+}
+
+template <typename T>
+sycl::event mdot_gemv(sycl::queue &queue, int64_t n, const T *x, int64_t incx, const T *y,
+                      int64_t incy, int64_t stridey, T *result, int64_t batch_size,
+                      const std::vector<sycl::event> &dependencies) {
+    transpose trans;
+    int64_t m_gemv, n_gemv, ld;
+    if (!mdot_as_gemv(n, incy, stridey, batch_size, trans, m_gemv, n_gemv, ld)) {
+        throw unimplemented("blas", "mdot", "for vectors that are not unit strided");
+    }
+    return ::oneapi::mkl::blas::column_major::gemv(queue, trans, m_gemv, n_gemv, T(1), y, ld, x,
+                                                   incx, T(0), result, 1, dependencies);
+}
+
 // Buffer APIs
 
 void gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset offsetc, int64_t m,
@@ -176,6 +245,244 @@ void omatadd(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
     blas_major::omatadd(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<float, 1> &a,
+                   int64_t lda, sycl::buffer<float, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    throw unimplemented("blas", "gemm_epilogue", "");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<sycl::half, 1> &a,
+                   int64_t lda, sycl::buffer<sycl::half, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<sycl::half, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    throw unimplemented("blas", "gemm_epilogue", "");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<sycl::half, 1> &a,
+                   int64_t lda, sycl::buffer<sycl::half, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    throw unimplemented("blas", "gemm_epilogue", "");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a,
+                   int64_t lda, sycl::buffer<bfloat16, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<bfloat16, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    throw unimplemented("blas", "gemm_epilogue", "");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a,
+                   int64_t lda, sycl::buffer<bfloat16, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    throw unimplemented("blas", "gemm_epilogue", "");
+}
+
+// The packed GEMM API maps onto the packed GEMM of the host MKL library,
+// which is only reachable from the CPU backend.
+#ifdef MKLCPU_PACKED_GEMM_LAYOUT
+
+int64_t sgemm_pack_get_size(sycl::queue &queue, gemm_pack_matrix identifier, int64_t m, int64_t n,
+                            int64_t k) {
+    return host_gemm_pack_get_size<float>(identifier, m, n, k);
+}
+
+int64_t dgemm_pack_get_size(sycl::queue &queue, gemm_pack_matrix identifier, int64_t m, int64_t n,
+                            int64_t k) {
+    return host_gemm_pack_get_size<double>(identifier, m, n, k);
+}
+
+void gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+               int64_t n, int64_t k, float alpha, sycl::buffer<float, 1> &src, int64_t ld,
+               sycl::buffer<float, 1> &dest) {
+    check_reproducible("gemm_pack");
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_src = src.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_dest = dest.get_access<sycl::access::mode::write>(cgh);
+        cgh.host_task([=]() {
+            host_gemm_pack(MKLCPU_PACKED_GEMM_LAYOUT, identifier, trans, m, n, k, alpha,
+                           accessor_src.MKLCPU_HOST_PTR, ld, accessor_dest.MKLCPU_HOST_PTR);
+        });
+    });
+}
+
+void gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+               int64_t n, int64_t k, double alpha, sycl::buffer<double, 1> &src, int64_t ld,
+               sycl::buffer<double, 1> &dest) {
+    check_reproducible("gemm_pack");
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_src = src.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_dest = dest.get_access<sycl::access::mode::write>(cgh);
+        cgh.host_task([=]() {
+            host_gemm_pack(MKLCPU_PACKED_GEMM_LAYOUT, identifier, trans, m, n, k, alpha,
+                           accessor_src.MKLCPU_HOST_PTR, ld, accessor_dest.MKLCPU_HOST_PTR);
+        });
+    });
+}
+
+void gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa, transpose transb,
+                  int64_t m, int64_t n, int64_t k, sycl::buffer<float, 1> &a, int64_t lda,
+                  sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+                  int64_t ldc) {
+    check_reproducible("gemm_compute");
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_gemm_compute(MKLCPU_PACKED_GEMM_LAYOUT, packed, transa, transb, m, n, k,
+                              accessor_a.MKLCPU_HOST_PTR, lda, accessor_b.MKLCPU_HOST_PTR,
+                              ldb, beta, accessor_c.MKLCPU_HOST_PTR, ldc);
+        });
+    });
+}
+
+void gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa, transpose transb,
+                  int64_t m, int64_t n, int64_t k, sycl::buffer<double, 1> &a, int64_t lda,
+                  sycl::buffer<double, 1> &b, int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+                  int64_t ldc) {
+    check_reproducible("gemm_compute");
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_gemm_compute(MKLCPU_PACKED_GEMM_LAYOUT, packed, transa, transb, m, n, k,
+                              accessor_a.MKLCPU_HOST_PTR, lda, accessor_b.MKLCPU_HOST_PTR,
+                              ldb, beta, accessor_c.MKLCPU_HOST_PTR, ldc);
+        });
+    });
+}
+
+#else
+
+int64_t sgemm_pack_get_size(sycl::queue &queue, gemm_pack_matrix identifier, int64_t m, int64_t n,
+                            int64_t k) {
+    throw unimplemented("blas", "sgemm_pack_get_size", "");
+}
+
+int64_t dgemm_pack_get_size(sycl::queue &queue, gemm_pack_matrix identifier, int64_t m, int64_t n,
+                            int64_t k) {
+    throw unimplemented("blas", "dgemm_pack_get_size", "");
+}
+
+void gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+               int64_t n, int64_t k, float alpha, sycl::buffer<float, 1> &src, int64_t ld,
+               sycl::buffer<float, 1> &dest) {
+    throw unimplemented("blas", "gemm_pack", "");
+}
+
+void gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+               int64_t n, int64_t k, double alpha, sycl::buffer<double, 1> &src, int64_t ld,
+               sycl::buffer<double, 1> &dest) {
+    throw unimplemented("blas", "gemm_pack", "");
+}
+
+void gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa, transpose transb,
+                  int64_t m, int64_t n, int64_t k, sycl::buffer<float, 1> &a, int64_t lda,
+                  sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+                  int64_t ldc) {
+    throw unimplemented("blas", "gemm_compute", "");
+}
+
+void gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa, transpose transb,
+                  int64_t m, int64_t n, int64_t k, sycl::buffer<double, 1> &a, int64_t lda,
+                  sycl::buffer<double, 1> &b, int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+                  int64_t ldc) {
+    throw unimplemented("blas", "gemm_compute", "");
+}
+
+#endif
+
+void axpy_dot(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+              sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+              sycl::buffer<float, 1> &result) {
+    blas_major::axpy(queue, n, alpha, x, incx, y, incy);
+    blas_major::dot(queue, n, y, incy, z, incz, result);
+}
+
+void axpy_dot(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x, int64_t incx,
+              sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+              sycl::buffer<double, 1> &result) {
+    blas_major::axpy(queue, n, alpha, x, incx, y, incy);
+    blas_major::dot(queue, n, y, incy, z, incz, result);
+}
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+          sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+          sycl::buffer<float, 1> &result) {
+    dot2_buffer(queue, n, x, incx, y, incy, z, incz, result);
+}
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+          sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+          sycl::buffer<double, 1> &result) {
+    dot2_buffer(queue, n, x, incx, y, incy, z, incz, result);
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+                float beta, sycl::buffer<float, 1> &y, int64_t incy,
+                sycl::buffer<float, 1> &result) {
+    blas_major::axpby(queue, n, alpha, x, incx, beta, y, incy);
+    blas_major::nrm2(queue, n, y, std::abs(incy), result);
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x,
+                int64_t incx, double beta, sycl::buffer<double, 1> &y, int64_t incy,
+                sycl::buffer<double, 1> &result) {
+    blas_major::axpby(queue, n, alpha, x, incx, beta, y, incy);
+    blas_major::nrm2(queue, n, y, std::abs(incy), result);
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<float> alpha,
+                sycl::buffer<std::complex<float>, 1> &x, int64_t incx, std::complex<float> beta,
+                sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
+                sycl::buffer<float, 1> &result) {
+    blas_major::axpby(queue, n, alpha, x, incx, beta, y, incy);
+    blas_major::nrm2(queue, n, y, std::abs(incy), result);
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<double> alpha,
+                sycl::buffer<std::complex<double>, 1> &x, int64_t incx, std::complex<double> beta,
+                sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
+                sycl::buffer<double, 1> &result) {
+    blas_major::axpby(queue, n, alpha, x, incx, beta, y, incy);
+    blas_major::nrm2(queue, n, y, std::abs(incy), result);
+}
+
+void mdot(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+          sycl::buffer<float, 1> &y, int64_t incy, int64_t stridey, sycl::buffer<float, 1> &result,
+          int64_t batch_size) {
+    mdot_gemv(queue, n, x, incx, y, incy, stridey, result, batch_size);
+}
+
+void mdot(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+          sycl::buffer<double, 1> &y, int64_t incy, int64_t stridey,
+          sycl::buffer<double, 1> &result, int64_t batch_size) {
+    mdot_gemv(queue, n, x, incx, y, incy, stridey, result, batch_size);
+}
+
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+            std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+            sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
+            sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+            std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+            sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
+            sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
 // USM APIs
 
 sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
@@ -357,3 +664,399 @@ sycl::event omatadd(sycl::queue &queue, transpose transa, transpose transb, int6
     return blas_major::omatadd(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
                                dependencies);
 }
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb,
+                          offset offset_bias, int64_t m, int64_t n, int64_t k, float alpha,
+                          const float *a, int64_t lda, const float *b, int64_t ldb, float beta,
+                          float *c, int64_t ldc, const float *bias, activation act, float clamp_min,
+                          float clamp_max, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "");
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const sycl::half *a, int64_t lda, const sycl::half *b,
+    int64_t ldb, float beta, sycl::half *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "");
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const sycl::half *a, int64_t lda, const sycl::half *b,
+    int64_t ldb, float beta, float *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "");
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const bfloat16 *a, int64_t lda, const bfloat16 *b,
+    int64_t ldb, float beta, bfloat16 *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "");
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const bfloat16 *a, int64_t lda, const bfloat16 *b,
+    int64_t ldb, float beta, float *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "");
+}
+
+#ifdef MKLCPU_PACKED_GEMM_LAYOUT
+
+sycl::event gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+                      int64_t n, int64_t k, float alpha, const float *src, int64_t ld, float *dest,
+                      const std::vector<sycl::event> &dependencies) {
+    check_reproducible("gemm_pack");
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_gemm_pack(MKLCPU_PACKED_GEMM_LAYOUT, identifier, trans, m, n, k, alpha, src, ld,
+                           dest);
+        });
+    });
+}
+
+sycl::event gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+                      int64_t n, int64_t k, double alpha, const double *src, int64_t ld,
+                      double *dest, const std::vector<sycl::event> &dependencies) {
+    check_reproducible("gemm_pack");
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_gemm_pack(MKLCPU_PACKED_GEMM_LAYOUT, identifier, trans, m, n, k, alpha, src, ld,
+                           dest);
+        });
+    });
+}
+
+sycl::event gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa,
+                         transpose transb, int64_t m, int64_t n, int64_t k, const float *a,
+                         int64_t lda, const float *b, int64_t ldb, float beta, float *c,
+                         int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    check_reproducible("gemm_compute");
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_gemm_compute(MKLCPU_PACKED_GEMM_LAYOUT, packed, transa, transb, m, n, k, a,
+                              lda, b, ldb, beta, c, ldc);
+        });
+    });
+}
+
+sycl::event gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa,
+                         transpose transb, int64_t m, int64_t n, int64_t k, const double *a,
+                         int64_t lda, const double *b, int64_t ldb, double beta, double *c,
+                         int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    check_reproducible("gemm_compute");
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_gemm_compute(MKLCPU_PACKED_GEMM_LAYOUT, packed, transa, transb, m, n, k, a,
+                              lda, b, ldb, beta, c, ldc);
+        });
+    });
+}
+
+#else
+
+sycl::event gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+                      int64_t n, int64_t k, float alpha, const float *src, int64_t ld, float *dest,
+                      const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_pack", "");
+}
+
+sycl::event gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+                      int64_t n, int64_t k, double alpha, const double *src, int64_t ld,
+                      double *dest, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_pack", "");
+}
+
+sycl::event gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa,
+                         transpose transb, int64_t m, int64_t n, int64_t k, const float *a,
+                         int64_t lda, const float *b, int64_t ldb, float beta, float *c,
+                         int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_compute", "");
+}
+
+sycl::event gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa,
+                         transpose transb, int64_t m, int64_t n, int64_t k, const double *a,
+                         int64_t lda, const double *b, int64_t ldb, double beta, double *c,
+                         int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_compute", "");
+}
+
+#endif
+
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                     float *y, int64_t incy, const float *z, int64_t incz, float *result,
+                     const std::vector<sycl::event> &dependencies) {
+    auto axpy_done = blas_major::axpy(queue, n, alpha, x, incx, y, incy, dependencies);
+    return blas_major::dot(queue, n, y, incy, z, incz, result,
+                           std::vector<sycl::event>{ axpy_done });
+}
+
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                     double *y, int64_t incy, const double *z, int64_t incz, double *result,
+                     const std::vector<sycl::event> &dependencies) {
+    auto axpy_done = blas_major::axpy(queue, n, alpha, x, incx, y, incy, dependencies);
+    return blas_major::dot(queue, n, y, incy, z, incz, result,
+                           std::vector<sycl::event>{ axpy_done });
+}
+
+sycl::event dot2(sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
+                 int64_t incy, const float *z, int64_t incz, float *result,
+                 const std::vector<sycl::event> &dependencies) {
+    auto dot_y = blas_major::dot(queue, n, x, incx, y, incy, result, dependencies);
+    auto dot_z = blas_major::dot(queue, n, x, incx, z, incz, result + 1, dependencies);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on({ dot_y, dot_z });
+        cgh.host_task([]() {});
+    });
+}
+
+sycl::event dot2(sycl::queue &queue, int64_t n, const double *x, int64_t incx, const double *y,
+                 int64_t incy, const double *z, int64_t incz, double *result,
+                 const std::vector<sycl::event> &dependencies) {
+    auto dot_y = blas_major::dot(queue, n, x, incx, y, incy, result, dependencies);
+    auto dot_z = blas_major::dot(queue, n, x, incx, z, incz, result + 1, dependencies);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on({ dot_y, dot_z });
+        cgh.host_task([]() {});
+    });
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                       float beta, float *y, int64_t incy, float *result,
+                       const std::vector<sycl::event> &dependencies) {
+    auto axpby_done =
+        blas_major::axpby(queue, n, alpha, x, incx, beta, y, incy, dependencies);
+    return blas_major::nrm2(queue, n, y, std::abs(incy), result,
+                            std::vector<sycl::event>{ axpby_done });
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                       double beta, double *y, int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies) {
+    auto axpby_done =
+        blas_major::axpby(queue, n, alpha, x, incx, beta, y, incy, dependencies);
+    return blas_major::nrm2(queue, n, y, std::abs(incy), result,
+                            std::vector<sycl::event>{ axpby_done });
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<float> alpha,
+                       const std::complex<float> *x, int64_t incx, std::complex<float> beta,
+                       std::complex<float> *y, int64_t incy, float *result,
+                       const std::vector<sycl::event> &dependencies) {
+    auto axpby_done =
+        blas_major::axpby(queue, n, alpha, x, incx, beta, y, incy, dependencies);
+    return blas_major::nrm2(queue, n, y, std::abs(incy), result,
+                            std::vector<sycl::event>{ axpby_done });
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<double> alpha,
+                       const std::complex<double> *x, int64_t incx, std::complex<double> beta,
+                       std::complex<double> *y, int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies) {
+    auto axpby_done =
+        blas_major::axpby(queue, n, alpha, x, incx, beta, y, incy, dependencies);
+    return blas_major::nrm2(queue, n, y, std::abs(incy), result,
+                            std::vector<sycl::event>{ axpby_done });
+}
+
+sycl::event mdot(sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
+                 int64_t incy, int64_t stridey, float *result, int64_t batch_size,
+                 const std::vector<sycl::event> &dependencies) {
+    return mdot_gemv(queue, n, x, incx, y, incy, stridey, result, batch_size,
+                     dependencies);
+}
+
+sycl::event mdot(sycl::queue &queue, int64_t n, const double *x, int64_t incx, const double *y,
+                 int64_t incy, int64_t stridey, double *result, int64_t batch_size,
+                 const std::vector<sycl::event> &dependencies) {
+    return mdot_gemv(queue, n, x, incx, y, incy, stridey, result, batch_size,
+                     dependencies);
+}
+
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                   const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                   std::complex<float> *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    return blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            dependencies);
+}
+
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                   int64_t lda, const std::complex<double> *b, int64_t ldb,
+                   std::complex<double> beta, std::complex<double> *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    return blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            dependencies);
+}
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const float *alpha, const float *x, int64_t incx,
+                 float *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", "");
+}
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const double *alpha, const double *x, int64_t incx,
+                 double *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", "");
+}
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                 const std::complex<float> *x, int64_t incx, std::complex<float> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", "");
+}
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                 const std::complex<double> *x, int64_t incx, std::complex<double> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", "");
+}
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const float *alpha, const float *x, int64_t incx,
+                  const float *beta, float *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby", "");
+}
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const double *alpha, const double *x, int64_t incx,
+                  const double *beta, double *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby", "");
+}
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                  const std::complex<float> *x, int64_t incx, const std::complex<float> *beta,
+                  std::complex<float> *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby", "");
+}
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                  const std::complex<double> *x, int64_t incx, const std::complex<double> *beta,
+                  std::complex<double> *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby", "");
+}
+
+sycl::event scal(sycl::queue &queue, int64_t n, const float *alpha, float *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "");
+}
+
+sycl::event scal(sycl::queue &queue, int64_t n, const double *alpha, double *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "");
+}
+
+sycl::event scal(sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                 std::complex<float> *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "");
+}
+
+sycl::event scal(sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                 std::complex<double> *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "");
+}
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, const float *alpha,
+                 const float *a, int64_t lda, const float *x, int64_t incx, const float *beta,
+                 float *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemv", "");
+}
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, const double *alpha,
+                 const double *a, int64_t lda, const double *x, int64_t incx, const double *beta,
+                 double *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemv", "");
+}
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                 const std::complex<float> *alpha, const std::complex<float> *a, int64_t lda,
+                 const std::complex<float> *x, int64_t incx, const std::complex<float> *beta,
+                 std::complex<float> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemv", "");
+}
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                 const std::complex<double> *alpha, const std::complex<double> *a, int64_t lda,
+                 const std::complex<double> *x, int64_t incx, const std::complex<double> *beta,
+                 std::complex<double> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemv", "");
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const float *alpha, const float *a, int64_t lda, const float *b,
+                 int64_t ldb, const float *beta, float *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm", "");
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const double *alpha, const double *a, int64_t lda, const double *b,
+                 int64_t ldb, const double *beta, double *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm", "");
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const std::complex<float> *alpha, const std::complex<float> *a,
+                 int64_t lda, const std::complex<float> *b, int64_t ldb,
+                 const std::complex<float> *beta, std::complex<float> *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm", "");
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const std::complex<double> *alpha, const std::complex<double> *a,
+                 int64_t lda, const std::complex<double> *b, int64_t ldb,
+                 const std::complex<double> *beta, std::complex<double> *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm", "");
+}
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const float *alpha, const float *a, int64_t lda, int64_t stride_a,
+                       const float *b, int64_t ldb, int64_t stride_b, const float *beta, float *c,
+                       int64_t ldc, int64_t stride_c, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_batch", "");
+}
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const double *alpha, const double *a, int64_t lda,
+                       int64_t stride_a, const double *b, int64_t ldb, int64_t stride_b,
+                       const double *beta, double *c, int64_t ldc, int64_t stride_c,
+                       int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_batch", "");
+}
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const std::complex<float> *alpha, const std::complex<float> *a,
+                       int64_t lda, int64_t stride_a, const std::complex<float> *b, int64_t ldb,
+                       int64_t stride_b, const std::complex<float> *beta, std::complex<float> *c,
+                       int64_t ldc, int64_t stride_c, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_batch", "");
+}
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const std::complex<double> *alpha, const std::complex<double> *a,
+                       int64_t lda, int64_t stride_a, const std::complex<double> *b, int64_t ldb,
+                       int64_t stride_b, const std::complex<double> *beta, std::complex<double> *c,
+                       int64_t ldc, int64_t stride_c, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_batch", "");
+}
@@ -23,9 +23,16 @@
 #include <CL/sycl.hpp>
 #endif
 
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
 #include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
 
 #include "../mkl_common/mkl_blas_backend.hpp"
+#include "mklcpu_reproducibility.hpp"
 
 namespace oneapi {
 namespace mkl {
@@ -33,13 +40,13 @@ namespace blas {
 namespace mklcpu {
 namespace column_major {
 
-namespace blas_major = ::oneapi::mkl::blas::column_major;
+MKLCPU_CHECKED_BLAS_MAJOR(column_major)
 #include "../mkl_common/mkl_batch.cxx"
 
 } // namespace column_major
 namespace row_major {
 
-namespace blas_major = ::oneapi::mkl::blas::row_major;
+MKLCPU_CHECKED_BLAS_MAJOR(row_major)
 #include "../mkl_common/mkl_batch.cxx"
 
 } // namespace row_major
@@ -25,23 +25,96 @@
 
 #include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
 
+#include <algorithm>
+#include <type_traits>
+
+#include "mkl_cblas.h"
+
 #include "oneapi/mkl/exceptions.hpp"
 #include "../mkl_common/mkl_blas_backend.hpp"
+#include "mklcpu_reproducibility.hpp"
+
+#define MKLCPU_HOST_PTR template get_multi_ptr<sycl::access::decorated::no>().get()
 
 namespace oneapi {
 namespace mkl {
 namespace blas {
 namespace mklcpu {
+
+// Host MKL packed GEMM, called from host tasks. Packed sizes are reported in
+// elements of the data type rather than in bytes.
+inline CBLAS_IDENTIFIER to_cblas_identifier(gemm_pack_matrix identifier) {
+    return identifier == gemm_pack_matrix::A ? CblasAMatrix : CblasBMatrix;
+}
+
+inline CBLAS_TRANSPOSE to_cblas_trans(transpose trans) {
+    return trans == transpose::nontrans ? CblasNoTrans
+                                        : (trans == transpose::trans ? CblasTrans : CblasConjTrans);
+}
+
+inline MKL_INT to_cblas_compute_trans(bool is_packed, transpose trans) {
+    return is_packed ? (MKL_INT)CblasPacked : (MKL_INT)to_cblas_trans(trans);
+}
+
+template <typename T>
+int64_t host_gemm_pack_get_size(gemm_pack_matrix identifier, int64_t m, int64_t n, int64_t k) {
+    const auto id = to_cblas_identifier(identifier);
+    std::size_t bytes;
+    if constexpr (std::is_same_v<T, float>)
+        bytes = ::cblas_sgemm_pack_get_size(id, (MKL_INT)m, (MKL_INT)n, (MKL_INT)k);
+    else
+        bytes = ::cblas_dgemm_pack_get_size(id, (MKL_INT)m, (MKL_INT)n, (MKL_INT)k);
+    return static_cast<int64_t>((bytes + sizeof(T) - 1) / sizeof(T));
+}
+
+inline void host_gemm_pack(CBLAS_LAYOUT layout, gemm_pack_matrix identifier, transpose trans,
+                           int64_t m, int64_t n, int64_t k, float alpha, const float *src,
+                           int64_t ld, float *dest) {
+    ::cblas_sgemm_pack(layout, to_cblas_identifier(identifier), to_cblas_trans(trans), (MKL_INT)m,
+                       (MKL_INT)n, (MKL_INT)k, alpha, src, (MKL_INT)ld, dest);
+}
+
+inline void host_gemm_pack(CBLAS_LAYOUT layout, gemm_pack_matrix identifier, transpose trans,
+                           int64_t m, int64_t n, int64_t k, double alpha, const double *src,
+                           int64_t ld, double *dest) {
+    ::cblas_dgemm_pack(layout, to_cblas_identifier(identifier), to_cblas_trans(trans), (MKL_INT)m,
+                       (MKL_INT)n, (MKL_INT)k, alpha, src, (MKL_INT)ld, dest);
+}
+
+inline void host_gemm_compute(CBLAS_LAYOUT layout, gemm_pack_matrix packed, transpose transa,
+                              transpose transb, int64_t m, int64_t n, int64_t k, const float *a,
+                              int64_t lda, const float *b, int64_t ldb, float beta, float *c,
+                              int64_t ldc) {
+    const MKL_INT ta = to_cblas_compute_trans(packed == gemm_pack_matrix::A, transa);
+    const MKL_INT tb = to_cblas_compute_trans(packed == gemm_pack_matrix::B, transb);
+    ::cblas_sgemm_compute(layout, ta, tb, (MKL_INT)m, (MKL_INT)n, (MKL_INT)k, a, (MKL_INT)lda, b,
+                          (MKL_INT)ldb, beta, c, (MKL_INT)ldc);
+}
+
+inline void host_gemm_compute(CBLAS_LAYOUT layout, gemm_pack_matrix packed, transpose transa,
+                              transpose transb, int64_t m, int64_t n, int64_t k, const double *a,
+                              int64_t lda, const double *b, int64_t ldb, double beta, double *c,
+                              int64_t ldc) {
+    const MKL_INT ta = to_cblas_compute_trans(packed == gemm_pack_matrix::A, transa);
+    const MKL_INT tb = to_cblas_compute_trans(packed == gemm_pack_matrix::B, transb);
+    ::cblas_dgemm_compute(layout, ta, tb, (MKL_INT)m, (MKL_INT)n, (MKL_INT)k, a, (MKL_INT)lda, b,
+                          (MKL_INT)ldb, beta, c, (MKL_INT)ldc);
+}
+
 namespace column_major {
 
-namespace blas_major = ::oneapi::mkl::blas::column_major;
+MKLCPU_CHECKED_BLAS_MAJOR(column_major)
+#define MKLCPU_PACKED_GEMM_LAYOUT CblasColMajor
 #include "../mkl_common/mkl_extensions.cxx"
+#undef MKLCPU_PACKED_GEMM_LAYOUT
 
 } // namespace column_major
 namespace row_major {
 
-namespace blas_major = ::oneapi::mkl::blas::row_major;
+MKLCPU_CHECKED_BLAS_MAJOR(row_major)
+#define MKLCPU_PACKED_GEMM_LAYOUT CblasRowMajor
 #include "../mkl_common/mkl_extensions.cxx"
+#undef MKLCPU_PACKED_GEMM_LAYOUT
 
 } // namespace row_major
 } // namespace mklcpu
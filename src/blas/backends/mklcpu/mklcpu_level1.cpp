@@ -26,6 +26,7 @@
 #include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
 
 #include "../mkl_common/mkl_blas_backend.hpp"
+#include "mklcpu_reproducibility.hpp"
 
 namespace oneapi {
 namespace mkl {
@@ -33,13 +34,13 @@ namespace blas {
 namespace mklcpu {
 namespace column_major {
 
-namespace blas_major = ::oneapi::mkl::blas::column_major;
+MKLCPU_CHECKED_BLAS_MAJOR(column_major)
 #include "../mkl_common/mkl_level1.cxx"
 
 } // namespace column_major
 namespace row_major {
 
-namespace blas_major = ::oneapi::mkl::blas::row_major;
+MKLCPU_CHECKED_BLAS_MAJOR(row_major)
 #include "../mkl_common/mkl_level1.cxx"
 
 } // namespace row_major
@@ -0,0 +1,164 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKLCPU_REPRODUCIBILITY_HPP_
+#define _MKLCPU_REPRODUCIBILITY_HPP_
+
+#include <atomic>
+#include <utility>
+
+#include "mkl_cbwr.h"
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/blas/reproducibility.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace mklcpu {
+
+// Reproducible mode maps to MKL's conditional numerical reproducibility. MKL
+// only accepts a CNR setting before its first computation, so the setting is
+// applied when the backend is loaded. STRICT also makes the results
+// independent of the number of threads. If the application has already called
+// MKL itself the request fails and MKL keeps its current mode.
+inline const int cnr_status = oneapi::mkl::blas::is_reproducible()
+                                  ? mkl_cbwr_set(MKL_CBWR_AUTO | MKL_CBWR_STRICT)
+                                  : MKL_CBWR_SUCCESS;
+
+// Whether MKL runs with CNR. If the mode was turned on after the backend was
+// loaded, the setting is tried once more; it still succeeds as long as MKL has
+// not computed anything yet. Once MKL has computed, a later attempt cannot
+// succeed either, so the outcome of that attempt is kept.
+inline bool cnr_active() {
+    enum : int { unknown, active, unavailable };
+    static std::atomic<int> state{ unknown };
+    const int known = state.load(std::memory_order_relaxed);
+    if (known != unknown) {
+        return known == active;
+    }
+    if (cnr_status != MKL_CBWR_SUCCESS || mkl_cbwr_get(MKL_CBWR_BRANCH) == MKL_CBWR_BRANCH_OFF) {
+        mkl_cbwr_set(MKL_CBWR_AUTO | MKL_CBWR_STRICT);
+    }
+    const bool is_active = mkl_cbwr_get(MKL_CBWR_BRANCH) != MKL_CBWR_BRANCH_OFF;
+    state.store(is_active ? active : unavailable, std::memory_order_relaxed);
+    return is_active;
+}
+
+// Called by every routine before it reaches MKL: results in reproducible mode
+// must not silently depend on the thread count.
+inline void check_reproducible(const char *function_name) {
+    if (oneapi::mkl::blas::is_reproducible() && !cnr_active()) {
+        throw oneapi::mkl::exception(
+            "blas", function_name,
+            "reproducible mode is on but MKL conditional numerical reproducibility could not be "
+            "enabled; turn the mode on before MKL is first used");
+    }
+}
+
+// Stands in for the MKL namespace in the shared mkl_common sources, so that
+// every MKL call made by this backend goes through check_reproducible.
+#define MKLCPU_CHECKED_ROUTINE(name)                         \
+    template <typename... Args>                              \
+    static decltype(auto) name(Args &&... args) {            \
+        check_reproducible(#name);                           \
+        return mkl_major::name(std::forward<Args>(args)...); \
+    }
+
+#define MKLCPU_CHECKED_ROUTINES            \
+    MKLCPU_CHECKED_ROUTINE(asum)           \
+    MKLCPU_CHECKED_ROUTINE(axpby)          \
+    MKLCPU_CHECKED_ROUTINE(axpy)           \
+    MKLCPU_CHECKED_ROUTINE(axpy_batch)     \
+    MKLCPU_CHECKED_ROUTINE(copy)           \
+    MKLCPU_CHECKED_ROUTINE(copy_batch)     \
+    MKLCPU_CHECKED_ROUTINE(dgmm_batch)     \
+    MKLCPU_CHECKED_ROUTINE(dot)            \
+    MKLCPU_CHECKED_ROUTINE(dotc)           \
+    MKLCPU_CHECKED_ROUTINE(dotu)           \
+    MKLCPU_CHECKED_ROUTINE(gbmv)           \
+    MKLCPU_CHECKED_ROUTINE(gemm)           \
+    MKLCPU_CHECKED_ROUTINE(gemm_batch)     \
+    MKLCPU_CHECKED_ROUTINE(gemm_bias)      \
+    MKLCPU_CHECKED_ROUTINE(gemmt)          \
+    MKLCPU_CHECKED_ROUTINE(gemv)           \
+    MKLCPU_CHECKED_ROUTINE(gemv_batch)     \
+    MKLCPU_CHECKED_ROUTINE(ger)            \
+    MKLCPU_CHECKED_ROUTINE(gerc)           \
+    MKLCPU_CHECKED_ROUTINE(geru)           \
+    MKLCPU_CHECKED_ROUTINE(hbmv)           \
+    MKLCPU_CHECKED_ROUTINE(hemm)           \
+    MKLCPU_CHECKED_ROUTINE(hemv)           \
+    MKLCPU_CHECKED_ROUTINE(her)            \
+    MKLCPU_CHECKED_ROUTINE(her2)           \
+    MKLCPU_CHECKED_ROUTINE(her2k)          \
+    MKLCPU_CHECKED_ROUTINE(herk)           \
+    MKLCPU_CHECKED_ROUTINE(hpmv)           \
+    MKLCPU_CHECKED_ROUTINE(hpr)            \
+    MKLCPU_CHECKED_ROUTINE(hpr2)           \
+    MKLCPU_CHECKED_ROUTINE(iamax)          \
+    MKLCPU_CHECKED_ROUTINE(iamin)          \
+    MKLCPU_CHECKED_ROUTINE(imatcopy)       \
+    MKLCPU_CHECKED_ROUTINE(imatcopy_batch) \
+    MKLCPU_CHECKED_ROUTINE(nrm2)           \
+    MKLCPU_CHECKED_ROUTINE(omatadd)        \
+    MKLCPU_CHECKED_ROUTINE(omatadd_batch)  \
+    MKLCPU_CHECKED_ROUTINE(omatcopy)       \
+    MKLCPU_CHECKED_ROUTINE(omatcopy_batch) \
+    MKLCPU_CHECKED_ROUTINE(rot)            \
+    MKLCPU_CHECKED_ROUTINE(rotg)           \
+    MKLCPU_CHECKED_ROUTINE(rotm)           \
+    MKLCPU_CHECKED_ROUTINE(rotmg)          \
+    MKLCPU_CHECKED_ROUTINE(sbmv)           \
+    MKLCPU_CHECKED_ROUTINE(scal)           \
+    MKLCPU_CHECKED_ROUTINE(sdsdot)         \
+    MKLCPU_CHECKED_ROUTINE(spmv)           \
+    MKLCPU_CHECKED_ROUTINE(spr)            \
+    MKLCPU_CHECKED_ROUTINE(spr2)           \
+    MKLCPU_CHECKED_ROUTINE(swap)           \
+    MKLCPU_CHECKED_ROUTINE(symm)           \
+    MKLCPU_CHECKED_ROUTINE(symv)           \
+    MKLCPU_CHECKED_ROUTINE(syr)            \
+    MKLCPU_CHECKED_ROUTINE(syr2)           \
+    MKLCPU_CHECKED_ROUTINE(syr2k)          \
+    MKLCPU_CHECKED_ROUTINE(syrk)           \
+    MKLCPU_CHECKED_ROUTINE(syrk_batch)     \
+    MKLCPU_CHECKED_ROUTINE(tbmv)           \
+    MKLCPU_CHECKED_ROUTINE(tbsv)           \
+    MKLCPU_CHECKED_ROUTINE(tpmv)           \
+    MKLCPU_CHECKED_ROUTINE(tpsv)           \
+    MKLCPU_CHECKED_ROUTINE(trmm)           \
+    MKLCPU_CHECKED_ROUTINE(trmv)           \
+    MKLCPU_CHECKED_ROUTINE(trsm)           \
+    MKLCPU_CHECKED_ROUTINE(trsm_batch)     \
+    MKLCPU_CHECKED_ROUTINE(trsv)
+
+// Declares blas_major for the MKL namespace major, column_major or row_major.
+#define MKLCPU_CHECKED_BLAS_MAJOR(major)              \
+    namespace mkl_major = ::oneapi::mkl::blas::major; \
+    struct blas_major {                               \
+        MKLCPU_CHECKED_ROUTINES                       \
+    };
+
+} // namespace mklcpu
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _MKLCPU_REPRODUCIBILITY_HPP_
@@ -23,6 +23,12 @@
 #include <CL/sycl.hpp>
 #endif
 
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
 #include "oneapi/mkl/blas/detail/mklgpu/onemkl_blas_mklgpu.hpp"
 
 #include "../mkl_common/mkl_blas_backend.hpp"
@@ -23,6 +23,8 @@
 #include <CL/sycl.hpp>
 #endif
 
+#include <algorithm>
+
 #include "oneapi/mkl/blas/detail/mklgpu/onemkl_blas_mklgpu.hpp"
 
 #include "oneapi/mkl/exceptions.hpp"
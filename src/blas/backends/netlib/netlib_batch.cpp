@@ -24,6 +24,7 @@
 #endif
 
 #include "netlib_common.hpp"
+#include "netlib_small_batch.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/blas/detail/netlib/onemkl_blas_netlib.hpp"
 
@@ -34,14 +35,18 @@ namespace netlib {
 namespace column_major {
 
 #define COLUMN_MAJOR
+#define MAJOR CblasColMajor
 #include "netlib_batch.cxx"
+#undef MAJOR
 #undef COLUMN_MAJOR
 
 } // namespace column_major
 namespace row_major {
 
 #define ROW_MAJOR
+#define MAJOR CblasRowMajor
 #include "netlib_batch.cxx"
+#undef MAJOR
 #undef ROW_MAJOR
 
 } // namespace row_major
@@ -217,12 +217,16 @@ void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t
                 int64_t stride_a, sycl::buffer<float, 1> &b, int64_t ldb, int64_t stride_b,
                 float beta, sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgemm_batch>(cgh, [=]() {
+            gemm_batch_host(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                            stride_a, accessor_b.GET_MULTI_PTR, ldb, stride_b, beta,
+                            accessor_c.GET_MULTI_PTR, ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -230,12 +234,16 @@ void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t
                 int64_t stride_a, sycl::buffer<double, 1> &b, int64_t ldb, int64_t stride_b,
                 double beta, sycl::buffer<double, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgemm_batch>(cgh, [=]() {
+            gemm_batch_host(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                            stride_a, accessor_b.GET_MULTI_PTR, ldb, stride_b, beta,
+                            accessor_c.GET_MULTI_PTR, ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -244,12 +252,16 @@ void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t
                 int64_t ldb, int64_t stride_b, std::complex<float> beta,
                 sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgemm_batch>(cgh, [=]() {
+            gemm_batch_host(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                            stride_a, accessor_b.GET_MULTI_PTR, ldb, stride_b, beta,
+                            accessor_c.GET_MULTI_PTR, ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -258,12 +270,16 @@ void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t
                 int64_t ldb, int64_t stride_b, std::complex<double> beta,
                 sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgemm_batch>(cgh, [=]() {
+            gemm_batch_host(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                            stride_a, accessor_b.GET_MULTI_PTR, ldb, stride_b, beta,
+                            accessor_c.GET_MULTI_PTR, ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -283,24 +299,30 @@ void trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower, transpose
                 diag unit_diag, int64_t m, int64_t n, float alpha, sycl::buffer<float, 1> &a,
                 int64_t lda, int64_t stride_a, sycl::buffer<float, 1> &b, int64_t ldb,
                 int64_t stride_b, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_strsm_batch>(cgh, [=]() {
+            trsm_batch_host(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                            accessor_a.GET_MULTI_PTR, lda, stride_a, accessor_b.GET_MULTI_PTR, ldb,
+                            stride_b, batch_size);
+        });
+    });
 }
 
 void trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
                 diag unit_diag, int64_t m, int64_t n, double alpha, sycl::buffer<double, 1> &a,
                 int64_t lda, int64_t stride_a, sycl::buffer<double, 1> &b, int64_t ldb,
                 int64_t stride_b, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dtrsm_batch>(cgh, [=]() {
+            trsm_batch_host(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                            accessor_a.GET_MULTI_PTR, lda, stride_a, accessor_b.GET_MULTI_PTR, ldb,
+                            stride_b, batch_size);
+        });
+    });
 }
 
 void trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
@@ -308,12 +330,15 @@ void trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower, transpose
                 sycl::buffer<std::complex<float>, 1> &a, int64_t lda, int64_t stride_a,
                 sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, int64_t stride_b,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ctrsm_batch>(cgh, [=]() {
+            trsm_batch_host(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                            accessor_a.GET_MULTI_PTR, lda, stride_a, accessor_b.GET_MULTI_PTR, ldb,
+                            stride_b, batch_size);
+        });
+    });
 }
 
 void trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
@@ -321,12 +346,15 @@ void trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower, transpose
                 sycl::buffer<std::complex<double>, 1> &a, int64_t lda, int64_t stride_a,
                 sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, int64_t stride_b,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ztrsm_batch>(cgh, [=]() {
+            trsm_batch_host(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                            accessor_a.GET_MULTI_PTR, lda, stride_a, accessor_b.GET_MULTI_PTR, ldb,
+                            stride_b, batch_size);
+        });
+    });
 }
 
 void syrk_batch(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
@@ -921,12 +949,17 @@ sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb,
                            const float **b, int64_t *ldb, float *beta, float **c, int64_t *ldc,
                            int64_t group_count, int64_t *group_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_batch_group_usm>(cgh, [=]() {
+            gemm_batch_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -934,12 +967,17 @@ sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb,
                            const double **b, int64_t *ldb, double *beta, double **c, int64_t *ldc,
                            int64_t group_count, int64_t *group_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_batch_group_usm>(cgh, [=]() {
+            gemm_batch_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -948,12 +986,17 @@ sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb,
                            const std::complex<float> **b, int64_t *ldb, std::complex<float> *beta,
                            std::complex<float> **c, int64_t *ldc, int64_t group_count,
                            int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm_batch_group_usm>(cgh, [=]() {
+            gemm_batch_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -962,12 +1005,17 @@ sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb,
                            const std::complex<double> **b, int64_t *ldb, std::complex<double> *beta,
                            std::complex<double> **c, int64_t *ldc, int64_t group_count,
                            int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm_batch_group_usm>(cgh, [=]() {
+            gemm_batch_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -988,12 +1036,17 @@ sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, i
                            int64_t stride_a, const float *b, int64_t ldb, int64_t stride_b,
                            float beta, float *c, int64_t ldc, int64_t stride_c, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_batch_usm>(cgh, [=]() {
+            gemm_batch_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -1001,12 +1054,17 @@ sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, i
                            int64_t stride_a, const double *b, int64_t ldb, int64_t stride_b,
                            double beta, double *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_batch_usm>(cgh, [=]() {
+            gemm_batch_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -1016,12 +1074,17 @@ sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, i
                            std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                            int64_t stride_c, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm_batch_usm>(cgh, [=]() {
+            gemm_batch_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -1031,12 +1094,17 @@ sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, i
                            std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                            int64_t stride_c, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm_batch_usm>(cgh, [=]() {
+            gemm_batch_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -1057,12 +1125,17 @@ sycl::event trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower,
                            const float *a, int64_t lda, int64_t stride_a, float *b, int64_t ldb,
                            int64_t stride_b, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_strsm_batch_usm>(cgh, [=]() {
+            trsm_batch_host(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            stride_a, b, ldb, stride_b, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower,
@@ -1070,12 +1143,17 @@ sycl::event trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower,
                            const double *a, int64_t lda, int64_t stride_a, double *b, int64_t ldb,
                            int64_t stride_b, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dtrsm_batch_usm>(cgh, [=]() {
+            trsm_batch_host(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            stride_a, b, ldb, stride_b, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower,
@@ -1083,12 +1161,17 @@ sycl::event trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower,
                            std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
                            int64_t stride_a, std::complex<float> *b, int64_t ldb, int64_t stride_b,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ctrsm_batch_usm>(cgh, [=]() {
+            trsm_batch_host(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            stride_a, b, ldb, stride_b, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower,
@@ -1096,12 +1179,17 @@ sycl::event trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower,
                            std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
                            int64_t stride_a, std::complex<double> *b, int64_t ldb, int64_t stride_b,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ztrsm_batch_usm>(cgh, [=]() {
+            trsm_batch_host(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            stride_a, b, ldb, stride_b, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue &queue, side *left_right, uplo *upper_lower,
@@ -1109,12 +1197,17 @@ sycl::event trsm_batch(sycl::queue &queue, side *left_right, uplo *upper_lower,
                            const float **a, int64_t *lda, float **b, int64_t *ldb,
                            int64_t group_count, int64_t *groupsize,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_strsm_batch_group_usm>(cgh, [=]() {
+            trsm_batch_host(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            b, ldb, group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue &queue, side *left_right, uplo *upper_lower,
@@ -1122,12 +1215,17 @@ sycl::event trsm_batch(sycl::queue &queue, side *left_right, uplo *upper_lower,
                            const double **a, int64_t *lda, double **b, int64_t *ldb,
                            int64_t group_count, int64_t *groupsize,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dtrsm_batch_group_usm>(cgh, [=]() {
+            trsm_batch_host(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            b, ldb, group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue &queue, side *left_right, uplo *upper_lower,
@@ -1135,12 +1233,17 @@ sycl::event trsm_batch(sycl::queue &queue, side *left_right, uplo *upper_lower,
                            std::complex<float> *alpha, const std::complex<float> **a, int64_t *lda,
                            std::complex<float> **b, int64_t *ldb, int64_t group_count,
                            int64_t *groupsize, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ctrsm_batch_group_usm>(cgh, [=]() {
+            trsm_batch_host(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            b, ldb, group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue &queue, side *left_right, uplo *upper_lower,
@@ -1149,12 +1252,17 @@ sycl::event trsm_batch(sycl::queue &queue, side *left_right, uplo *upper_lower,
                            int64_t *lda, std::complex<double> **b, int64_t *ldb,
                            int64_t group_count, int64_t *groupsize,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ztrsm_batch_group_usm>(cgh, [=]() {
+            trsm_batch_host(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                            b, ldb, group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event syrk_batch(sycl::queue &queue, uplo *upper_lower, transpose *trans, int64_t *n,
@@ -1501,3 +1609,74 @@ sycl::event imatcopy_batch(sycl::queue& queue, transpose* trans, int64_t* m, int
     throw unimplemented("blas", "imatcopy_batch", "for row_major layout");
 #endif
 }
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, int64_t *m,
+                        int64_t *n, int64_t *k, float alpha, const float **a, int64_t *lda,
+                        const float **b, int64_t *ldb, float beta, float **c, int64_t *ldc,
+                        int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_vbatch_usm>(cgh, [=]() {
+            gemm_vbatch_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, int64_t *m,
+                        int64_t *n, int64_t *k, double alpha, const double **a, int64_t *lda,
+                        const double **b, int64_t *ldb, double beta, double **c, int64_t *ldc,
+                        int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_vbatch_usm>(cgh, [=]() {
+            gemm_vbatch_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_vbatch(
+    sycl::queue &queue, transpose transa, transpose transb, int64_t *m, int64_t *n, int64_t *k,
+    std::complex<float> alpha, const std::complex<float> **a, int64_t *lda,
+    const std::complex<float> **b, int64_t *ldb, std::complex<float> beta, std::complex<float> **c,
+    int64_t *ldc, int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm_vbatch_usm>(cgh, [=]() {
+            gemm_vbatch_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, int64_t *m,
+                        int64_t *n, int64_t *k, std::complex<double> alpha,
+                        const std::complex<double> **a, int64_t *lda,
+                        const std::complex<double> **b, int64_t *ldb, std::complex<double> beta,
+                        std::complex<double> **c, int64_t *ldc, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm_vbatch_usm>(cgh, [=]() {
+            gemm_vbatch_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             batch_size);
+        });
+    });
+    return done;
+}
@@ -25,11 +25,22 @@
 #else
 #include <CL/sycl.hpp>
 #endif
+#include <algorithm>
+#include <cmath>
 #include <complex>
+#include <cstdlib>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "cblas.h"
 
 #include "oneapi/mkl/blas/detail/netlib/onemkl_blas_netlib.hpp"
+#include "oneapi/mkl/blas/reproducibility.hpp"
 #include "oneapi/mkl/types.hpp"
 
 #define GET_MULTI_PTR template get_multi_ptr<sycl::access::decorated::yes>().get_raw()
@@ -95,6 +106,669 @@ static inline void host_task(H &cgh, F f) {
     (void)host_task_internal<K>(cgh, f, 0);
 }
 
+inline void packed_gemm_kernel(int64_t m, int64_t n, int64_t k, const float *a, const float *b,
+                               float beta, float *c, int64_t ldc) {
+    ::cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, (const int)m, (const int)n,
+                  (const int)k, 1.0f, a, (const int)m, b, (const int)k, beta, c, (const int)ldc);
+}
+
+inline void packed_gemm_kernel(int64_t m, int64_t n, int64_t k, const double *a, const double *b,
+                               double beta, double *c, int64_t ldc) {
+    ::cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, (const int)m, (const int)n,
+                  (const int)k, 1.0, a, (const int)m, b, (const int)k, beta, c, (const int)ldc);
+}
+
+// Cache blocking of the host GEMM engine below. The pre-packed GEMM API
+// stores whole operands as a sequence of these blocks, so they are part of
+// the netlib packed format.
+constexpr int64_t gemm_block_m = 256;
+constexpr int64_t gemm_block_n = 64;
+constexpr int64_t gemm_block_k = 256;
+
+// dst[i + p * mi] = (op(A)(i0 + i, p0 + p) - zero) * scale
+template <typename Tcomp, typename TA>
+void pack_a_block(bool trans, const TA *a, int64_t lda, int64_t i0, int64_t p0, int64_t mi,
+                  int64_t pk, Tcomp zero, Tcomp scale, Tcomp *dst) {
+    if (!trans) {
+        for (int64_t p = 0; p < pk; p++) {
+            for (int64_t i = 0; i < mi; i++)
+                dst[i + p * mi] = (static_cast<Tcomp>(a[(i0 + i) + (p0 + p) * lda]) - zero) * scale;
+        }
+    }
+    else {
+        for (int64_t i = 0; i < mi; i++) {
+            for (int64_t p = 0; p < pk; p++)
+                dst[i + p * mi] = (static_cast<Tcomp>(a[(p0 + p) + (i0 + i) * lda]) - zero) * scale;
+        }
+    }
+}
+
+// dst[p + j * pk] = (op(B)(p0 + p, j0 + j) - zero) * scale
+template <typename Tcomp, typename TB>
+void pack_b_block(bool trans, const TB *b, int64_t ldb, int64_t p0, int64_t j0, int64_t pk,
+                  int64_t nj, Tcomp zero, Tcomp scale, Tcomp *dst) {
+    for (int64_t j = 0; j < nj; j++) {
+        for (int64_t p = 0; p < pk; p++) {
+            const TB x = trans ? b[(j0 + j) + (p0 + p) * ldb] : b[(p0 + p) + (j0 + j) * ldb];
+            dst[p + j * pk] = (static_cast<Tcomp>(x) - zero) * scale;
+        }
+    }
+}
+
+// Host GEMM for element types CBLAS has no kernels for. Panels of op(A) and
+// op(B) are packed into contiguous column major buffers, converting them to
+// the compute type Tcomp and subtracting the zero points ao and bo on the
+// way, and are multiplied with the CBLAS gemm for Tcomp. Each finished block
+// of op(A) * op(B) is handed to store(i0, j0, mi, nj, acc, ld_acc) while it
+// is still in cache; store writes it to C along with any scaling or epilogue.
+// Row major problems are computed as the column major product of the
+// transposes, so store always receives column major coordinates.
+//
+// An operand already packed by gemm_pack_host can be passed as a_packed or
+// b_packed; its blocks are then used in place and a or b is not read.
+template <typename Tcomp, typename TA, typename TB, typename StoreT>
+void packed_gemm_host(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                      int64_t n, int64_t k, const TA *a, int64_t lda, Tcomp ao, const TB *b,
+                      int64_t ldb, Tcomp bo, StoreT store, const Tcomp *a_packed = nullptr,
+                      const Tcomp *b_packed = nullptr) {
+    if (layout == CblasRowMajor) {
+        packed_gemm_host<Tcomp>(CblasColMajor, transb, transa, n, m, k, b, ldb, bo, a, lda, ao,
+                                store, b_packed, a_packed);
+        return;
+    }
+    if (m <= 0 || n <= 0)
+        return;
+
+    constexpr int64_t mc = gemm_block_m, nc = gemm_block_n, kc = gemm_block_k;
+    const bool trans_a = transa != transpose::nontrans;
+    const bool trans_b = transb != transpose::nontrans;
+    const int64_t kb = std::min(std::max<int64_t>(k, 1), kc);
+    std::vector<Tcomp> a_pack(a_packed ? 0 : std::min(m, mc) * kb);
+    std::vector<Tcomp> b_pack(b_packed ? 0 : kb * std::min(n, nc));
+    std::vector<Tcomp> acc(m * std::min(n, nc));
+
+    for (int64_t j0 = 0; j0 < n; j0 += nc) {
+        const int64_t nj = std::min(nc, n - j0);
+        if (k <= 0) {
+            std::fill(acc.begin(), acc.end(), Tcomp(0));
+            for (int64_t i0 = 0; i0 < m; i0 += mc)
+                store(i0, j0, std::min(mc, m - i0), nj, acc.data() + i0, m);
+            continue;
+        }
+        for (int64_t p0 = 0; p0 < k; p0 += kc) {
+            const int64_t pk = std::min(kc, k - p0);
+            const Tcomp *b_blk = b_packed ? b_packed + j0 * k + p0 * nj : b_pack.data();
+            if (!b_packed)
+                pack_b_block(trans_b, b, ldb, p0, j0, pk, nj, bo, Tcomp(1), b_pack.data());
+            for (int64_t i0 = 0; i0 < m; i0 += mc) {
+                const int64_t mi = std::min(mc, m - i0);
+                const Tcomp *a_blk = a_packed ? a_packed + p0 * m + i0 * pk : a_pack.data();
+                if (!a_packed)
+                    pack_a_block(trans_a, a, lda, i0, p0, mi, pk, ao, Tcomp(1), a_pack.data());
+                packed_gemm_kernel(mi, nj, pk, a_blk, b_blk, p0 == 0 ? Tcomp(0) : Tcomp(1),
+                                   acc.data() + i0, m);
+                if (p0 + pk == k)
+                    store(i0, j0, mi, nj, acc.data() + i0, m);
+            }
+        }
+    }
+}
+
+// Netlib packed format for the pre-packed GEMM API: op(X) scaled by alpha,
+// cut into the blocks packed_gemm_host works on and stored block after
+// block. Block (p0, i0) of A starts at p0 * m + i0 * pk and block (j0, p0)
+// of B at j0 * k + p0 * nj, where pk and nj are the extents of the block, so
+// the packed operand has exactly as many elements as op(X). A row major A is
+// the B operand of the transposed column major problem and vice versa.
+inline int64_t gemm_pack_size_host(gemm_pack_matrix identifier, int64_t m, int64_t n,
+                                   int64_t k) {
+    return identifier == gemm_pack_matrix::A ? m * k : k * n;
+}
+
+template <typename T>
+void gemm_pack_host(CBLAS_LAYOUT layout, gemm_pack_matrix identifier, transpose trans, int64_t m,
+                    int64_t n, int64_t k, T alpha, const T *src, int64_t ld, T *dest) {
+    if (layout == CblasRowMajor) {
+        identifier =
+            identifier == gemm_pack_matrix::A ? gemm_pack_matrix::B : gemm_pack_matrix::A;
+        std::swap(m, n);
+    }
+    const bool trans_src = trans != transpose::nontrans;
+    if (identifier == gemm_pack_matrix::A) {
+        for (int64_t p0 = 0; p0 < k; p0 += gemm_block_k) {
+            const int64_t pk = std::min(gemm_block_k, k - p0);
+            for (int64_t i0 = 0; i0 < m; i0 += gemm_block_m) {
+                const int64_t mi = std::min(gemm_block_m, m - i0);
+                pack_a_block(trans_src, src, ld, i0, p0, mi, pk, T(0), alpha,
+                             dest + p0 * m + i0 * pk);
+            }
+        }
+    }
+    else {
+        for (int64_t j0 = 0; j0 < n; j0 += gemm_block_n) {
+            const int64_t nj = std::min(gemm_block_n, n - j0);
+            for (int64_t p0 = 0; p0 < k; p0 += gemm_block_k) {
+                const int64_t pk = std::min(gemm_block_k, k - p0);
+                pack_b_block(trans_src, src, ld, p0, j0, pk, nj, T(0), alpha,
+                             dest + j0 * k + p0 * nj);
+            }
+        }
+    }
+}
+
+// C = op(A) * op(B) + beta * C where the operand named by packed was packed
+// by gemm_pack_host and already carries alpha. The transpose and leading
+// dimension of the packed operand are ignored.
+template <typename T>
+void gemm_compute_host(CBLAS_LAYOUT layout, gemm_pack_matrix packed, transpose transa,
+                       transpose transb, int64_t m, int64_t n, int64_t k, const T *a, int64_t lda,
+                       const T *b, int64_t ldb, T beta, T *c, int64_t ldc) {
+    const bool packed_a = packed == gemm_pack_matrix::A;
+    packed_gemm_host<T>(
+        layout, transa, transb, m, n, k, a, lda, T(0), b, ldb, T(0),
+        [=](int64_t i0, int64_t j0, int64_t mi, int64_t nj, const T *acc, int64_t ld_acc) {
+            for (int64_t j = 0; j < nj; j++) {
+                T *c_col = c + (j0 + j) * ldc + i0;
+                for (int64_t i = 0; i < mi; i++) {
+                    T v = acc[i + j * ld_acc];
+                    if (beta != T(0))
+                        v += beta * c_col[i];
+                    c_col[i] = v;
+                }
+            }
+        },
+        packed_a ? a : nullptr, packed_a ? nullptr : b);
+}
+
+// C = alpha * op(A) * op(B) + beta * C for half and bfloat16 operands,
+// accumulated in float. C may be float or, as a downcast, the input type.
+template <typename TA, typename TC>
+void gemm_host(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+               int64_t k, float alpha, const TA *a, int64_t lda, const TA *b, int64_t ldb,
+               float beta, TC *c, int64_t ldc) {
+    packed_gemm_host<float>(
+        layout, transa, transb, m, n, k, a, lda, 0.0f, b, ldb, 0.0f,
+        [=](int64_t i0, int64_t j0, int64_t mi, int64_t nj, const float *acc, int64_t ld_acc) {
+            for (int64_t j = 0; j < nj; j++) {
+                TC *c_col = c + (j0 + j) * ldc + i0;
+                for (int64_t i = 0; i < mi; i++) {
+                    float v = alpha * acc[i + j * ld_acc];
+                    if (beta != 0.0f)
+                        v += beta * static_cast<float>(c_col[i]);
+                    c_col[i] = static_cast<TC>(v);
+                }
+            }
+        });
+}
+
+// C = alpha * (op(A) - ao) * (op(B) - bo) + beta * C + co for 8-bit integer
+// operands. Products are accumulated in double, which is exact for any
+// practical k, and the result is rounded to nearest and saturated to int32.
+template <typename TA, typename TB>
+void gemm_bias_host(CBLAS_LAYOUT layout, transpose transa, transpose transb, offset offsetc,
+                    int64_t m, int64_t n, int64_t k, float alpha, const TA *a, int64_t lda, TA ao,
+                    const TB *b, int64_t ldb, TB bo, float beta, int32_t *c, int64_t ldc,
+                    const int32_t *co) {
+    if (layout == CblasRowMajor && offsetc != offset::fix)
+        offsetc = offsetc == offset::column ? offset::row : offset::column;
+    packed_gemm_host<double>(
+        layout, transa, transb, m, n, k, a, lda, static_cast<double>(ao), b, ldb,
+        static_cast<double>(bo),
+        [=](int64_t i0, int64_t j0, int64_t mi, int64_t nj, const double *acc, int64_t ld_acc) {
+            for (int64_t j = 0; j < nj; j++) {
+                int32_t *c_col = c + (j0 + j) * ldc + i0;
+                for (int64_t i = 0; i < mi; i++) {
+                    double v = double(alpha) * acc[i + j * ld_acc];
+                    if (beta != 0.0f)
+                        v += double(beta) * c_col[i];
+                    if (offsetc == offset::fix)
+                        v += co[0];
+                    else if (offsetc == offset::column)
+                        v += co[i0 + i];
+                    else
+                        v += co[j0 + j];
+                    v = std::min(std::max(std::nearbyint(v), -2147483648.0), 2147483647.0);
+                    c_col[i] = static_cast<int32_t>(v);
+                }
+            }
+        });
+}
+
+inline void host_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                      int64_t k, float alpha, const float *a, int64_t lda, const float *b,
+                      int64_t ldb, float beta, float *c, int64_t ldc) {
+    ::cblas_sgemm(layout, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                  (const int)m, (const int)n, (const int)k, alpha, a, (const int)lda, b,
+                  (const int)ldb, beta, c, (const int)ldc);
+}
+
+inline void host_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                      int64_t k, double alpha, const double *a, int64_t lda, const double *b,
+                      int64_t ldb, double beta, double *c, int64_t ldc) {
+    ::cblas_dgemm(layout, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                  (const int)m, (const int)n, (const int)k, alpha, a, (const int)lda, b,
+                  (const int)ldb, beta, c, (const int)ldc);
+}
+
+inline void host_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                      int64_t k, std::complex<float> alpha, const std::complex<float> *a,
+                      int64_t lda, const std::complex<float> *b, int64_t ldb,
+                      std::complex<float> beta, std::complex<float> *c, int64_t ldc) {
+    ::cblas_cgemm(layout, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                  (const int)m, (const int)n, (const int)k, (const void *)&alpha, (const void *)a,
+                  (const int)lda, (const void *)b, (const int)ldb, (const void *)&beta, (void *)c,
+                  (const int)ldc);
+}
+
+inline void host_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                      int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                      int64_t lda, const std::complex<double> *b, int64_t ldb,
+                      std::complex<double> beta, std::complex<double> *c, int64_t ldc) {
+    ::cblas_zgemm(layout, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                  (const int)m, (const int)n, (const int)k, (const void *)&alpha, (const void *)a,
+                  (const int)lda, (const void *)b, (const int)ldb, (const void *)&beta, (void *)c,
+                  (const int)ldc);
+}
+
+// Splits a batch of independent tasks into num_bins lists of about equal
+// total cost. Tasks are taken in order of decreasing cost and each goes to
+// the bin with the least work so far (longest processing time first), so
+// the most loaded bin exceeds the average by at most the largest task.
+inline std::vector<std::vector<int64_t>> balance_batch(const std::vector<double> &cost,
+                                                       int64_t num_bins) {
+    std::vector<int64_t> order(cost.size());
+    std::iota(order.begin(), order.end(), int64_t(0));
+    std::stable_sort(order.begin(), order.end(),
+                     [&](int64_t x, int64_t y) { return cost[x] > cost[y]; });
+
+    using load_t = std::pair<double, int64_t>;
+    std::priority_queue<load_t, std::vector<load_t>, std::greater<load_t>> loads;
+    for (int64_t bin = 0; bin < num_bins; bin++)
+        loads.emplace(0.0, bin);
+    std::vector<std::vector<int64_t>> bins(num_bins);
+    for (int64_t i : order) {
+        auto lightest = loads.top();
+        loads.pop();
+        bins[lightest.second].push_back(i);
+        loads.emplace(lightest.first + cost[i], lightest.second);
+    }
+    return bins;
+}
+
+// Runs a variable-size batch of GEMMs on all hardware threads. Entries are
+// distributed by their flop count rather than one per thread in order, so
+// a few large products do not leave the other threads idle.
+template <typename T>
+void gemm_vbatch_host(CBLAS_LAYOUT layout, transpose transa, transpose transb, const int64_t *m,
+                      const int64_t *n, const int64_t *k, T alpha, const T **a,
+                      const int64_t *lda, const T **b, const int64_t *ldb, T beta, T **c,
+                      const int64_t *ldc, int64_t batch_size) {
+    if (batch_size <= 0)
+        return;
+    std::vector<double> cost(batch_size);
+    for (int64_t i = 0; i < batch_size; i++)
+        cost[i] = double(m[i]) * double(n[i]) * (double(k[i]) + 1.0);
+    const int64_t num_threads =
+        std::min<int64_t>(batch_size, std::max(1u, std::thread::hardware_concurrency()));
+    const auto bins = balance_batch(cost, num_threads);
+
+    auto run_bin = [&](int64_t bin) {
+        for (int64_t i : bins[bin])
+            host_gemm(layout, transa, transb, m[i], n[i], k[i], alpha, a[i], lda[i], b[i],
+                      ldb[i], beta, c[i], ldc[i]);
+    };
+    std::vector<std::thread> workers;
+    for (int64_t bin = 1; bin < num_threads; bin++)
+        workers.emplace_back(run_bin, bin);
+    run_bin(0);
+    for (auto &worker : workers)
+        worker.join();
+}
+
+// Split-K GEMM for products with a small C and a long inner dimension, such
+// as 64 x 64 x 1e6 gradient reductions. A single GEMM call works on one
+// thread and only parallelises over C, so here k is cut into parts that are
+// multiplied on separate threads into scratch copies of C, which are then
+// summed in part order. The summation order is fixed, so results do not
+// depend on thread scheduling.
+//
+//   ONEMKL_NETLIB_GEMM_SPLIT_K=off            never split
+//   ONEMKL_NETLIB_GEMM_SPLIT_K=deterministic  choose the number of parts from
+//                                             the shape alone, so results are
+//                                             identical on every machine
+//   otherwise                                 one part per hardware thread,
+//                                             or deterministic in
+//                                             reproducible mode
+enum class gemm_split_k_mode { off, automatic, deterministic };
+
+constexpr int64_t gemm_split_k_min_chunk = 2048;
+constexpr int64_t gemm_split_k_deterministic_chunk = 16384;
+constexpr int64_t gemm_split_k_max_parts = 64;
+// Bound on the scratch space, in elements of C.
+constexpr int64_t gemm_split_k_max_scratch = int64_t(1) << 24;
+
+inline gemm_split_k_mode get_gemm_split_k_mode() {
+    static const gemm_split_k_mode mode = [] {
+        const char *env = std::getenv("ONEMKL_NETLIB_GEMM_SPLIT_K");
+        if (env == nullptr) {
+            return gemm_split_k_mode::automatic;
+        }
+        const std::string value(env);
+        if (value == "off" || value == "0") {
+            return gemm_split_k_mode::off;
+        }
+        if (value == "deterministic") {
+            return gemm_split_k_mode::deterministic;
+        }
+        return gemm_split_k_mode::automatic;
+    }();
+    return mode;
+}
+
+// Number of parts to split k into; 1 means a plain GEMM call. Splitting only
+// pays off when k dominates both m and n, otherwise there is enough work in
+// C to keep the GEMM busy and the scratch traffic is wasted.
+inline int64_t gemm_split_k_parts(int64_t m, int64_t n, int64_t k) {
+    auto mode = get_gemm_split_k_mode();
+    if (mode == gemm_split_k_mode::automatic && oneapi::mkl::blas::is_reproducible()) {
+        mode = gemm_split_k_mode::deterministic;
+    }
+    if (mode == gemm_split_k_mode::off || m <= 0 || n <= 0 || k < 2 * gemm_split_k_min_chunk ||
+        k < 8 * std::max(m, n)) {
+        return 1;
+    }
+    int64_t parts;
+    if (mode == gemm_split_k_mode::deterministic) {
+        parts = k / gemm_split_k_deterministic_chunk;
+    }
+    else {
+        parts = std::min<int64_t>(std::max(1u, std::thread::hardware_concurrency()),
+                                  k / gemm_split_k_min_chunk);
+    }
+    parts = std::min(parts, gemm_split_k_max_parts);
+    parts = std::min(parts, gemm_split_k_max_scratch / (m * n));
+    return std::max<int64_t>(parts, 1);
+}
+
+template <typename T>
+void gemm_split_k_host(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, T alpha, const T *a, int64_t lda, const T *b,
+                       int64_t ldb, T beta, T *c, int64_t ldc) {
+    const int64_t parts = gemm_split_k_parts(m, n, k);
+    if (parts <= 1) {
+        host_gemm(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        return;
+    }
+
+    // Distance between consecutive k indices in A and B.
+    const bool col_major = (layout == CblasColMajor);
+    const int64_t a_step = (col_major == (transa == transpose::nontrans)) ? lda : 1;
+    const int64_t b_step = (col_major == (transb == transpose::nontrans)) ? 1 : ldb;
+    const int64_t ld_part = col_major ? m : n;
+    const int64_t part_size = m * n;
+    std::vector<T> partial(parts * part_size);
+
+    auto part_begin = [&](int64_t p) { return k * p / parts; };
+    auto run_parts = [&](int64_t first, int64_t stride) {
+        for (int64_t p = first; p < parts; p += stride) {
+            const int64_t k0 = part_begin(p);
+            host_gemm(layout, transa, transb, m, n, part_begin(p + 1) - k0, T(1),
+                      a + k0 * a_step, lda, b + k0 * b_step, ldb, T(0),
+                      partial.data() + p * part_size, ld_part);
+        }
+    };
+    const int64_t num_threads =
+        std::min<int64_t>(parts, std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<std::thread> workers;
+    for (int64_t t = 1; t < num_threads; t++)
+        workers.emplace_back(run_parts, t, num_threads);
+    run_parts(0, num_threads);
+    for (auto &worker : workers)
+        worker.join();
+
+    // C is small by construction, so the reduction stays on this thread.
+    const int64_t outer = col_major ? n : m;
+    const int64_t inner = col_major ? m : n;
+    for (int64_t j = 0; j < outer; j++) {
+        for (int64_t i = 0; i < inner; i++) {
+            T sum = partial[i + j * ld_part];
+            for (int64_t p = 1; p < parts; p++)
+                sum += partial[p * part_size + i + j * ld_part];
+            T &c_elem = c[i + j * ldc];
+            c_elem = (beta == T(0)) ? alpha * sum : alpha * sum + beta * c_elem;
+        }
+    }
+}
+
+// C = alpha * op(A) * op(B) + beta * C for complex matrices using three real
+// GEMMs instead of the four of a complex GEMM (the 3M method). With
+// A = Ar + i Ai and B = Br + i Bi:
+//   T1 = Ar * Br, T2 = Ai * Bi, T3 = (Ar + Ai) * (Br + Bi)
+//   A * B = (T1 - T2) + i (T3 - T1 - T2)
+// The parts are split into compact real panels that keep the stored
+// orientation, so the real GEMMs take the transposes of the complex call;
+// conjtrans becomes trans with a negated imaginary part.
+template <typename R>
+void gemm3m_host(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, std::complex<R> alpha, const std::complex<R> *a, int64_t lda,
+                 const std::complex<R> *b, int64_t ldb, std::complex<R> beta, std::complex<R> *c,
+                 int64_t ldc) {
+    if (m <= 0 || n <= 0)
+        return;
+    const bool col_major = (layout == CblasColMajor);
+
+    // A stored matrix is `outer` vectors of `inner` contiguous elements; the
+    // panels hold the real part, the imaginary part and their sum.
+    auto split = [](const std::complex<R> *x, int64_t ld, int64_t inner, int64_t outer, bool conj,
+                    std::vector<R> &panels) {
+        const int64_t size = inner * outer;
+        panels.resize(3 * size);
+        R *re = panels.data(), *im = re + size, *sum = im + size;
+        for (int64_t j = 0; j < outer; j++) {
+            for (int64_t i = 0; i < inner; i++) {
+                const std::complex<R> v = x[i + j * ld];
+                const R v_im = conj ? -v.imag() : v.imag();
+                re[i + j * inner] = v.real();
+                im[i + j * inner] = v_im;
+                sum[i + j * inner] = v.real() + v_im;
+            }
+        }
+    };
+    const bool a_inner_m = col_major == (transa == transpose::nontrans);
+    const bool b_inner_k = col_major == (transb == transpose::nontrans);
+    const int64_t a_inner = a_inner_m ? m : k;
+    const int64_t b_inner = b_inner_k ? k : n;
+    const int64_t a_size = m * k;
+    const int64_t b_size = k * n;
+    std::vector<R> a_panels, b_panels;
+    split(a, lda, a_inner, a_inner_m ? k : m, transa == transpose::conjtrans, a_panels);
+    split(b, ldb, b_inner, b_inner_k ? n : k, transb == transpose::conjtrans, b_panels);
+
+    const transpose ta = (transa == transpose::nontrans) ? transpose::nontrans : transpose::trans;
+    const transpose tb = (transb == transpose::nontrans) ? transpose::nontrans : transpose::trans;
+    const int64_t a_ld = std::max<int64_t>(a_inner, 1);
+    const int64_t b_ld = std::max<int64_t>(b_inner, 1);
+    const int64_t c_inner = col_major ? m : n;
+    const int64_t c_size = m * n;
+    std::vector<R> t(3 * c_size);
+    for (int64_t p = 0; p < 3; p++) {
+        host_gemm(layout, ta, tb, m, n, k, R(1), a_panels.data() + p * a_size, a_ld,
+                  b_panels.data() + p * b_size, b_ld, R(0), t.data() + p * c_size, c_inner);
+    }
+
+    const R *t1 = t.data(), *t2 = t1 + c_size, *t3 = t2 + c_size;
+    const int64_t c_outer = col_major ? n : m;
+    for (int64_t j = 0; j < c_outer; j++) {
+        for (int64_t i = 0; i < c_inner; i++) {
+            const int64_t idx = i + j * c_inner;
+            const std::complex<R> prod(t1[idx] - t2[idx], t3[idx] - t1[idx] - t2[idx]);
+            std::complex<R> &c_elem = c[i + j * ldc];
+            c_elem = (beta == std::complex<R>(0)) ? alpha * prod : alpha * prod + beta * c_elem;
+        }
+    }
+}
+
+// Fused level 1 kernels for Krylov solvers. Each one makes a single pass
+// over its vectors, so the updated y is consumed while still in cache instead
+// of being reloaded by a separate dot or nrm2 call.
+
+// Offset of the first element visited by a level 1 routine: with a negative
+// increment the vector is traversed from its last element backwards.
+inline int64_t vector_offset(int64_t n, int64_t inc) {
+    return inc < 0 ? (1 - n) * inc : 0;
+}
+
+// y = alpha * x + y, returns y . z with the updated y.
+template <typename T>
+T axpy_dot_host(int64_t n, T alpha, const T *x, int64_t incx, T *y, int64_t incy, const T *z,
+                int64_t incz) {
+    if (n <= 0)
+        return T(0);
+    x += vector_offset(n, incx);
+    y += vector_offset(n, incy);
+    z += vector_offset(n, incz);
+    T sum = T(0);
+    for (int64_t i = 0; i < n; i++) {
+        const T y_elem = alpha * x[i * incx] + y[i * incy];
+        y[i * incy] = y_elem;
+        sum += y_elem * z[i * incz];
+    }
+    return sum;
+}
+
+// result[0] = x . y, result[1] = x . z.
+template <typename T>
+void dot2_host(int64_t n, const T *x, int64_t incx, const T *y, int64_t incy, const T *z,
+               int64_t incz, T *result) {
+    T sum_y = T(0), sum_z = T(0);
+    if (n > 0) {
+        x += vector_offset(n, incx);
+        y += vector_offset(n, incy);
+        z += vector_offset(n, incz);
+        for (int64_t i = 0; i < n; i++) {
+            const T x_elem = x[i * incx];
+            sum_y += x_elem * y[i * incy];
+            sum_z += x_elem * z[i * incz];
+        }
+    }
+    result[0] = sum_y;
+    result[1] = sum_z;
+}
+
+// y = alpha * x + beta * y, returns ||y||_2 of the updated y. The norm is
+// accumulated as scale^2 * ssq like the reference nrm2, so it neither
+// overflows nor underflows for representable results.
+template <typename T, typename R>
+R axpby_nrm2_host(int64_t n, T alpha, const T *x, int64_t incx, T beta, T *y, int64_t incy) {
+    if (n <= 0)
+        return R(0);
+    x += vector_offset(n, incx);
+    y += vector_offset(n, incy);
+    R scale = R(0), ssq = R(1);
+    auto accumulate = [&](R v) {
+        if (v != R(0)) {
+            const R abs_v = std::abs(v);
+            if (scale < abs_v) {
+                ssq = R(1) + ssq * (scale / abs_v) * (scale / abs_v);
+                scale = abs_v;
+            }
+            else {
+                ssq += (abs_v / scale) * (abs_v / scale);
+            }
+        }
+    };
+    for (int64_t i = 0; i < n; i++) {
+        const T y_elem = alpha * x[i * incx] + beta * y[i * incy];
+        y[i * incy] = y_elem;
+        accumulate(std::real(y_elem));
+        accumulate(std::imag(y_elem));
+    }
+    return scale * std::sqrt(ssq);
+}
+
+// result[j] = x . y_j for the batch_size vectors y_j = y + j * stridey. x is
+// walked in blocks that stay in cache while every y_j consumes them, so x is
+// loaded from memory once rather than once per vector.
+template <typename T>
+void mdot_host(int64_t n, const T *x, int64_t incx, const T *y, int64_t incy, int64_t stridey,
+               T *result, int64_t batch_size) {
+    constexpr int64_t block = 1024;
+    std::fill(result, result + std::max<int64_t>(batch_size, 0), T(0));
+    if (n <= 0)
+        return;
+    x += vector_offset(n, incx);
+    y += vector_offset(n, incy);
+    for (int64_t i0 = 0; i0 < n; i0 += block) {
+        const int64_t i1 = std::min(n, i0 + block);
+        for (int64_t j = 0; j < batch_size; j++) {
+            const T *y_vec = y + j * stridey;
+            T sum = T(0);
+            for (int64_t i = i0; i < i1; i++)
+                sum += x[i * incx] * y_vec[i * incy];
+            result[j] += sum;
+        }
+    }
+}
+
+// y = alpha * x + beta * y. y is not read when beta is zero.
+template <typename T>
+void axpby_host(int64_t n, T alpha, const T *x, int64_t incx, T beta, T *y, int64_t incy) {
+    if (n <= 0)
+        return;
+    x += vector_offset(n, incx);
+    y += vector_offset(n, incy);
+    for (int64_t i = 0; i < n; i++) {
+        T &y_elem = y[i * incy];
+        y_elem = (beta == T(0)) ? alpha * x[i * incx] : alpha * x[i * incx] + beta * y_elem;
+    }
+}
+
+inline float apply_activation(activation act, float x) {
+    switch (act) {
+        case activation::relu: return x > 0.0f ? x : 0.0f;
+        case activation::gelu: return 0.5f * x * (1.0f + std::erf(x * 0.70710678f));
+        case activation::sigmoid: return 1.0f / (1.0f + std::exp(-x));
+        default: return x;
+    }
+}
+
+// C = clamp(act(alpha * op(A) * op(B) + beta * C + bias)). The epilogue is
+// applied to each block of the product before it is written back, so C is
+// read and written only once.
+template <typename TA, typename TC>
+void gemm_epilogue_host(CBLAS_LAYOUT layout, transpose transa, transpose transb,
+                        offset offset_bias, int64_t m, int64_t n, int64_t k, float alpha,
+                        const TA *a, int64_t lda, const TA *b, int64_t ldb, float beta, TC *c,
+                        int64_t ldc, const float *bias, activation act, float clamp_min,
+                        float clamp_max) {
+    if (layout == CblasRowMajor && offset_bias != offset::fix)
+        offset_bias = offset_bias == offset::column ? offset::row : offset::column;
+    packed_gemm_host<float>(
+        layout, transa, transb, m, n, k, a, lda, 0.0f, b, ldb, 0.0f,
+        [=](int64_t i0, int64_t j0, int64_t mi, int64_t nj, const float *acc, int64_t ld_acc) {
+            for (int64_t j = 0; j < nj; j++) {
+                TC *c_col = c + (j0 + j) * ldc + i0;
+                for (int64_t i = 0; i < mi; i++) {
+                    float v = alpha * acc[i + j * ld_acc];
+                    if (beta != 0.0f)
+                        v += beta * static_cast<float>(c_col[i]);
+                    if (offset_bias == offset::fix)
+                        v += bias[0];
+                    else if (offset_bias == offset::column)
+                        v += bias[i0 + i];
+                    else
+                        v += bias[j0 + j];
+                    v = apply_activation(act, v);
+                    if (v < clamp_min)
+                        v = clamp_min;
+                    if (v > clamp_max)
+                        v = clamp_max;
+                    c_col[i] = static_cast<TC>(v);
+                }
+            }
+        });
+}
+
 } // namespace netlib
 } // namespace blas
 } // namespace mkl
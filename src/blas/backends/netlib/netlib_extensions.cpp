@@ -33,15 +33,19 @@ namespace blas {
 namespace netlib {
 namespace column_major {
 
+#define MAJOR CblasColMajor
 #define COLUMN_MAJOR
 #include "netlib_extensions.cxx"
+#undef MAJOR
 #undef COLUMN_MAJOR
 
 } // namespace column_major
 namespace row_major {
 
+#define MAJOR CblasRowMajor
 #define ROW_MAJOR
 #include "netlib_extensions.cxx"
+#undef MAJOR
 #undef ROW_MAJOR
 
 } // namespace row_major
@@ -24,12 +24,17 @@ void gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset of
                int64_t lda, int8_t ao, sycl::buffer<int8_t, 1> &b, int64_t ldb, int8_t bo,
                float beta, sycl::buffer<int32_t, 1> &c, int64_t ldc,
                sycl::buffer<int32_t, 1> &co) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_co = co.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_gemm_bias_s8s8s32>(cgh, [=]() {
+            gemm_bias_host(MAJOR, transa, transb, offsetc, m, n, k, alpha,
+                           accessor_a.GET_MULTI_PTR, lda, ao, accessor_b.GET_MULTI_PTR, ldb, bo,
+                           beta, accessor_c.GET_MULTI_PTR, ldc, accessor_co.GET_MULTI_PTR);
+        });
+    });
 }
 
 void gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
@@ -37,12 +42,17 @@ void gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset of
                int64_t lda, int8_t ao, sycl::buffer<uint8_t, 1> &b, int64_t ldb, uint8_t bo,
                float beta, sycl::buffer<int32_t, 1> &c, int64_t ldc,
                sycl::buffer<int32_t, 1> &co) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_co = co.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_gemm_bias_s8u8s32>(cgh, [=]() {
+            gemm_bias_host(MAJOR, transa, transb, offsetc, m, n, k, alpha,
+                           accessor_a.GET_MULTI_PTR, lda, ao, accessor_b.GET_MULTI_PTR, ldb, bo,
+                           beta, accessor_c.GET_MULTI_PTR, ldc, accessor_co.GET_MULTI_PTR);
+        });
+    });
 }
 
 void gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
@@ -50,12 +60,17 @@ void gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset of
                int64_t lda, uint8_t ao, sycl::buffer<int8_t, 1> &b, int64_t ldb, int8_t bo,
                float beta, sycl::buffer<int32_t, 1> &c, int64_t ldc,
                sycl::buffer<int32_t, 1> &co) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_co = co.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_gemm_bias_u8s8s32>(cgh, [=]() {
+            gemm_bias_host(MAJOR, transa, transb, offsetc, m, n, k, alpha,
+                           accessor_a.GET_MULTI_PTR, lda, ao, accessor_b.GET_MULTI_PTR, ldb, bo,
+                           beta, accessor_c.GET_MULTI_PTR, ldc, accessor_co.GET_MULTI_PTR);
+        });
+    });
 }
 
 void gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
@@ -63,12 +78,17 @@ void gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset of
                int64_t lda, uint8_t ao, sycl::buffer<uint8_t, 1> &b, int64_t ldb, uint8_t bo,
                float beta, sycl::buffer<int32_t, 1> &c, int64_t ldc,
                sycl::buffer<int32_t, 1> &co) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_co = co.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_gemm_bias_u8u8s32>(cgh, [=]() {
+            gemm_bias_host(MAJOR, transa, transb, offsetc, m, n, k, alpha,
+                           accessor_a.GET_MULTI_PTR, lda, ao, accessor_b.GET_MULTI_PTR, ldb, bo,
+                           beta, accessor_c.GET_MULTI_PTR, ldc, accessor_co.GET_MULTI_PTR);
+        });
+    });
 }
 
 void gemmt(sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb, int64_t n,
@@ -292,6 +312,347 @@ void omatadd(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
 #endif
 }
 
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<float, 1> &a,
+                   int64_t lda, sycl::buffer<float, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_bias = bias.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_sgemm_epilogue>(cgh, [=]() {
+            gemm_epilogue_host(MAJOR, transa, transb, offset_bias, m, n, k, alpha,
+                               accessor_a.GET_MULTI_PTR, lda, accessor_b.GET_MULTI_PTR, ldb, beta,
+                               accessor_c.GET_MULTI_PTR, ldc, accessor_bias.GET_MULTI_PTR, act,
+                               clamp_min, clamp_max);
+        });
+    });
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<sycl::half, 1> &a,
+                   int64_t lda, sycl::buffer<sycl::half, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<sycl::half, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_bias = bias.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_hgemm_epilogue>(cgh, [=]() {
+            gemm_epilogue_host(MAJOR, transa, transb, offset_bias, m, n, k, alpha,
+                               accessor_a.GET_MULTI_PTR, lda, accessor_b.GET_MULTI_PTR, ldb, beta,
+                               accessor_c.GET_MULTI_PTR, ldc, accessor_bias.GET_MULTI_PTR, act,
+                               clamp_min, clamp_max);
+        });
+    });
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<sycl::half, 1> &a,
+                   int64_t lda, sycl::buffer<sycl::half, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_bias = bias.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_gemm_f16f16f32_epilogue>(cgh, [=]() {
+            gemm_epilogue_host(MAJOR, transa, transb, offset_bias, m, n, k, alpha,
+                               accessor_a.GET_MULTI_PTR, lda, accessor_b.GET_MULTI_PTR, ldb, beta,
+                               accessor_c.GET_MULTI_PTR, ldc, accessor_bias.GET_MULTI_PTR, act,
+                               clamp_min, clamp_max);
+        });
+    });
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a,
+                   int64_t lda, sycl::buffer<bfloat16, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<bfloat16, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_bias = bias.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_gemm_bf16bf16bf16_epilogue>(cgh, [=]() {
+            gemm_epilogue_host(MAJOR, transa, transb, offset_bias, m, n, k, alpha,
+                               accessor_a.GET_MULTI_PTR, lda, accessor_b.GET_MULTI_PTR, ldb, beta,
+                               accessor_c.GET_MULTI_PTR, ldc, accessor_bias.GET_MULTI_PTR, act,
+                               clamp_min, clamp_max);
+        });
+    });
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                   int64_t m, int64_t n, int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a,
+                   int64_t lda, sycl::buffer<bfloat16, 1> &b, int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_bias = bias.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_gemm_bf16bf16f32_epilogue>(cgh, [=]() {
+            gemm_epilogue_host(MAJOR, transa, transb, offset_bias, m, n, k, alpha,
+                               accessor_a.GET_MULTI_PTR, lda, accessor_b.GET_MULTI_PTR, ldb, beta,
+                               accessor_c.GET_MULTI_PTR, ldc, accessor_bias.GET_MULTI_PTR, act,
+                               clamp_min, clamp_max);
+        });
+    });
+}
+
+int64_t sgemm_pack_get_size(sycl::queue &queue, gemm_pack_matrix identifier, int64_t m, int64_t n,
+                            int64_t k) {
+    return gemm_pack_size_host(identifier, m, n, k);
+}
+
+int64_t dgemm_pack_get_size(sycl::queue &queue, gemm_pack_matrix identifier, int64_t m, int64_t n,
+                            int64_t k) {
+    return gemm_pack_size_host(identifier, m, n, k);
+}
+
+void gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+               int64_t n, int64_t k, float alpha, sycl::buffer<float, 1> &src, int64_t ld,
+               sycl::buffer<float, 1> &dest) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_src = src.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_dest = dest.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_sgemm_pack>(cgh, [=]() {
+            gemm_pack_host(MAJOR, identifier, trans, m, n, k, alpha, accessor_src.GET_MULTI_PTR, ld,
+                           accessor_dest.GET_MULTI_PTR);
+        });
+    });
+}
+
+void gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+               int64_t n, int64_t k, double alpha, sycl::buffer<double, 1> &src, int64_t ld,
+               sycl::buffer<double, 1> &dest) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_src = src.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_dest = dest.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_dgemm_pack>(cgh, [=]() {
+            gemm_pack_host(MAJOR, identifier, trans, m, n, k, alpha, accessor_src.GET_MULTI_PTR, ld,
+                           accessor_dest.GET_MULTI_PTR);
+        });
+    });
+}
+
+void gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa, transpose transb,
+                  int64_t m, int64_t n, int64_t k, sycl::buffer<float, 1> &a, int64_t lda,
+                  sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+                  int64_t ldc) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgemm_compute>(cgh, [=]() {
+            gemm_compute_host(MAJOR, packed, transa, transb, m, n, k, accessor_a.GET_MULTI_PTR,
+                              lda, accessor_b.GET_MULTI_PTR, ldb, beta,
+                              accessor_c.GET_MULTI_PTR, ldc);
+        });
+    });
+}
+
+void gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa, transpose transb,
+                  int64_t m, int64_t n, int64_t k, sycl::buffer<double, 1> &a, int64_t lda,
+                  sycl::buffer<double, 1> &b, int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+                  int64_t ldc) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgemm_compute>(cgh, [=]() {
+            gemm_compute_host(MAJOR, packed, transa, transb, m, n, k, accessor_a.GET_MULTI_PTR,
+                              lda, accessor_b.GET_MULTI_PTR, ldb, beta,
+                              accessor_c.GET_MULTI_PTR, ldc);
+        });
+    });
+}
+
+void axpy_dot(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+              sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+              sycl::buffer<float, 1> &result) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_saxpy_dot>(cgh, [=]() {
+            accessor_result[0] = axpy_dot_host(n, alpha, accessor_x.GET_MULTI_PTR, incx,
+                                               accessor_y.GET_MULTI_PTR, incy,
+                                               accessor_z.GET_MULTI_PTR, incz);
+        });
+    });
+}
+
+void axpy_dot(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x, int64_t incx,
+              sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+              sycl::buffer<double, 1> &result) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_daxpy_dot>(cgh, [=]() {
+            accessor_result[0] = axpy_dot_host(n, alpha, accessor_x.GET_MULTI_PTR, incx,
+                                               accessor_y.GET_MULTI_PTR, incy,
+                                               accessor_z.GET_MULTI_PTR, incz);
+        });
+    });
+}
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+          sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+          sycl::buffer<float, 1> &result) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_sdot2>(cgh, [=]() {
+            dot2_host(n, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy,
+                      accessor_z.GET_MULTI_PTR, incz, accessor_result.GET_MULTI_PTR);
+        });
+    });
+}
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+          sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+          sycl::buffer<double, 1> &result) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_ddot2>(cgh, [=]() {
+            dot2_host(n, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy,
+                      accessor_z.GET_MULTI_PTR, incz, accessor_result.GET_MULTI_PTR);
+        });
+    });
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+                float beta, sycl::buffer<float, 1> &y, int64_t incy,
+                sycl::buffer<float, 1> &result) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_saxpby_nrm2>(cgh, [=]() {
+            accessor_result[0] = axpby_nrm2_host<float, float>(
+                n, alpha, accessor_x.GET_MULTI_PTR, incx, beta, accessor_y.GET_MULTI_PTR, incy);
+        });
+    });
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x,
+                int64_t incx, double beta, sycl::buffer<double, 1> &y, int64_t incy,
+                sycl::buffer<double, 1> &result) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_daxpby_nrm2>(cgh, [=]() {
+            accessor_result[0] = axpby_nrm2_host<double, double>(
+                n, alpha, accessor_x.GET_MULTI_PTR, incx, beta, accessor_y.GET_MULTI_PTR, incy);
+        });
+    });
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<float> alpha,
+                sycl::buffer<std::complex<float>, 1> &x, int64_t incx, std::complex<float> beta,
+                sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
+                sycl::buffer<float, 1> &result) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_caxpby_nrm2>(cgh, [=]() {
+            accessor_result[0] = axpby_nrm2_host<std::complex<float>, float>(
+                n, alpha, accessor_x.GET_MULTI_PTR, incx, beta, accessor_y.GET_MULTI_PTR, incy);
+        });
+    });
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<double> alpha,
+                sycl::buffer<std::complex<double>, 1> &x, int64_t incx, std::complex<double> beta,
+                sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
+                sycl::buffer<double, 1> &result) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zaxpby_nrm2>(cgh, [=]() {
+            accessor_result[0] = axpby_nrm2_host<std::complex<double>, double>(
+                n, alpha, accessor_x.GET_MULTI_PTR, incx, beta, accessor_y.GET_MULTI_PTR, incy);
+        });
+    });
+}
+
+void mdot(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+          sycl::buffer<float, 1> &y, int64_t incy, int64_t stridey, sycl::buffer<float, 1> &result,
+          int64_t batch_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_smdot>(cgh, [=]() {
+            mdot_host(n, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy, stridey,
+                      accessor_result.GET_MULTI_PTR, batch_size);
+        });
+    });
+}
+
+void mdot(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+          sycl::buffer<double, 1> &y, int64_t incy, int64_t stridey,
+          sycl::buffer<double, 1> &result, int64_t batch_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_dmdot>(cgh, [=]() {
+            mdot_host(n, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy, stridey,
+                      accessor_result.GET_MULTI_PTR, batch_size);
+        });
+    });
+}
+
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+            std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+            sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
+            sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgemm3m>(cgh, [=]() {
+            gemm3m_host(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                        accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
+        });
+    });
+}
+
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+            std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+            sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
+            sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgemm3m>(cgh, [=]() {
+            gemm3m_host(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                        accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
+        });
+    });
+}
+
 // USM APIs
 
 sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb,
@@ -299,12 +660,17 @@ sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb,
                           const int8_t *a, int64_t lda, int8_t ao, const int8_t *b, int64_t ldb,
                           int8_t bo, float beta, int32_t *c, int64_t ldc, const int32_t *co,
                           const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_bias_s8s8s32_usm>(cgh, [=]() {
+            gemm_bias_host(MAJOR, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                           beta, c, ldc, co);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb,
@@ -312,12 +678,17 @@ sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb,
                           const int8_t *a, int64_t lda, int8_t ao, const uint8_t *b, int64_t ldb,
                           uint8_t bo, float beta, int32_t *c, int64_t ldc, const int32_t *co,
                           const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_bias_s8u8s32_usm>(cgh, [=]() {
+            gemm_bias_host(MAJOR, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                           beta, c, ldc, co);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb,
@@ -325,12 +696,17 @@ sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb,
                           const uint8_t *a, int64_t lda, uint8_t ao, const int8_t *b, int64_t ldb,
                           int8_t bo, float beta, int32_t *c, int64_t ldc, const int32_t *co,
                           const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_bias_u8s8s32_usm>(cgh, [=]() {
+            gemm_bias_host(MAJOR, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                           beta, c, ldc, co);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb,
@@ -338,12 +714,17 @@ sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb,
                           const uint8_t *a, int64_t lda, uint8_t ao, const uint8_t *b, int64_t ldb,
                           uint8_t bo, float beta, int32_t *c, int64_t ldc, const int32_t *co,
                           const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_bias_u8u8s32_usm>(cgh, [=]() {
+            gemm_bias_host(MAJOR, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                           beta, c, ldc, co);
+        });
+    });
+    return done;
 }
 
 sycl::event gemmt(sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb,
@@ -582,4 +963,749 @@ sycl::event omatadd(sycl::queue &queue, transpose transa, transpose transb, int6
 #endif
 }
 
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb,
+                          offset offset_bias, int64_t m, int64_t n, int64_t k, float alpha,
+                          const float *a, int64_t lda, const float *b, int64_t ldb, float beta,
+                          float *c, int64_t ldc, const float *bias, activation act, float clamp_min,
+                          float clamp_max, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_epilogue_usm>(cgh, [=]() {
+            gemm_epilogue_host(MAJOR, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb,
+                               beta, c, ldc, bias, act, clamp_min, clamp_max);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const sycl::half *a, int64_t lda, const sycl::half *b,
+    int64_t ldb, float beta, sycl::half *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_hgemm_epilogue_usm>(cgh, [=]() {
+            gemm_epilogue_host(MAJOR, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb,
+                               beta, c, ldc, bias, act, clamp_min, clamp_max);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const sycl::half *a, int64_t lda, const sycl::half *b,
+    int64_t ldb, float beta, float *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_f16f16f32_epilogue_usm>(cgh, [=]() {
+            gemm_epilogue_host(MAJOR, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb,
+                               beta, c, ldc, bias, act, clamp_min, clamp_max);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const bfloat16 *a, int64_t lda, const bfloat16 *b,
+    int64_t ldb, float beta, bfloat16 *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_bf16bf16bf16_epilogue_usm>(cgh, [=]() {
+            gemm_epilogue_host(MAJOR, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb,
+                               beta, c, ldc, bias, act, clamp_min, clamp_max);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, offset offset_bias, int64_t m,
+    int64_t n, int64_t k, float alpha, const bfloat16 *a, int64_t lda, const bfloat16 *b,
+    int64_t ldb, float beta, float *c, int64_t ldc, const float *bias, activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_bf16bf16f32_epilogue_usm>(cgh, [=]() {
+            gemm_epilogue_host(MAJOR, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb,
+                               beta, c, ldc, bias, act, clamp_min, clamp_max);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+                      int64_t n, int64_t k, float alpha, const float *src, int64_t ld, float *dest,
+                      const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_pack_usm>(cgh, [=]() {
+            gemm_pack_host(MAJOR, identifier, trans, m, n, k, alpha, src, ld, dest);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, int64_t m,
+                      int64_t n, int64_t k, double alpha, const double *src, int64_t ld,
+                      double *dest, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_pack_usm>(cgh, [=]() {
+            gemm_pack_host(MAJOR, identifier, trans, m, n, k, alpha, src, ld, dest);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa,
+                         transpose transb, int64_t m, int64_t n, int64_t k, const float *a,
+                         int64_t lda, const float *b, int64_t ldb, float beta, float *c,
+                         int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_compute_usm>(cgh, [=]() {
+            gemm_compute_host(MAJOR, packed, transa, transb, m, n, k, a, lda, b, ldb, beta, c,
+                              ldc);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa,
+                         transpose transb, int64_t m, int64_t n, int64_t k, const double *a,
+                         int64_t lda, const double *b, int64_t ldb, double beta, double *c,
+                         int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_compute_usm>(cgh, [=]() {
+            gemm_compute_host(MAJOR, packed, transa, transb, m, n, k, a, lda, b, ldb, beta, c,
+                              ldc);
+        });
+    });
+    return done;
+}
+
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                     float *y, int64_t incy, const float *z, int64_t incz, float *result,
+                     const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_saxpy_dot_usm>(cgh, [=]() {
+            result[0] = axpy_dot_host(n, alpha, x, incx, y, incy, z, incz);
+        });
+    });
+    return done;
+}
+
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                     double *y, int64_t incy, const double *z, int64_t incz, double *result,
+                     const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_daxpy_dot_usm>(cgh, [=]() {
+            result[0] = axpy_dot_host(n, alpha, x, incx, y, incy, z, incz);
+        });
+    });
+    return done;
+}
 
+sycl::event dot2(sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
+                 int64_t incy, const float *z, int64_t incz, float *result,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sdot2_usm>(cgh, [=]() {
+            dot2_host(n, x, incx, y, incy, z, incz, result);
+        });
+    });
+    return done;
+}
+
+sycl::event dot2(sycl::queue &queue, int64_t n, const double *x, int64_t incx, const double *y,
+                 int64_t incy, const double *z, int64_t incz, double *result,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ddot2_usm>(cgh, [=]() {
+            dot2_host(n, x, incx, y, incy, z, incz, result);
+        });
+    });
+    return done;
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                       float beta, float *y, int64_t incy, float *result,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_saxpby_nrm2_usm>(cgh, [=]() {
+            result[0] = axpby_nrm2_host<float, float>(n, alpha, x, incx, beta, y, incy);
+        });
+    });
+    return done;
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                       double beta, double *y, int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_daxpby_nrm2_usm>(cgh, [=]() {
+            result[0] = axpby_nrm2_host<double, double>(n, alpha, x, incx, beta, y, incy);
+        });
+    });
+    return done;
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<float> alpha,
+                       const std::complex<float> *x, int64_t incx, std::complex<float> beta,
+                       std::complex<float> *y, int64_t incy, float *result,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_caxpby_nrm2_usm>(cgh, [=]() {
+            result[0] = axpby_nrm2_host<std::complex<float>, float>(n, alpha, x, incx, beta, y,
+                                                                    incy);
+        });
+    });
+    return done;
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, std::complex<double> alpha,
+                       const std::complex<double> *x, int64_t incx, std::complex<double> beta,
+                       std::complex<double> *y, int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zaxpby_nrm2_usm>(cgh, [=]() {
+            result[0] = axpby_nrm2_host<std::complex<double>, double>(n, alpha, x, incx, beta, y,
+                                                                      incy);
+        });
+    });
+    return done;
+}
+
+sycl::event mdot(sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
+                 int64_t incy, int64_t stridey, float *result, int64_t batch_size,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_smdot_usm>(cgh, [=]() {
+            mdot_host(n, x, incx, y, incy, stridey, result, batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event mdot(sycl::queue &queue, int64_t n, const double *x, int64_t incx, const double *y,
+                 int64_t incy, int64_t stridey, double *result, int64_t batch_size,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dmdot_usm>(cgh, [=]() {
+            mdot_host(n, x, incx, y, incy, stridey, result, batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                   const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                   std::complex<float> *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm3m_usm>(cgh, [=]() {
+            gemm3m_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                   int64_t lda, const std::complex<double> *b, int64_t ldb,
+                   std::complex<double> beta, std::complex<double> *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm3m_usm>(cgh, [=]() {
+            gemm3m_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        });
+    });
+    return done;
+}
+
+// Overloads taking alpha and beta as USM pointers. The scalars are read in the
+// host task, once the dependencies that produce them have completed.
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const float *alpha, const float *x, int64_t incx,
+                 float *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_saxpy_ptr_usm>(cgh, [=]() {
+            ::cblas_saxpy((const int)n, *alpha, x, (const int)incx, y, (const int)incy);
+        });
+    });
+    return done;
+}
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const double *alpha, const double *x, int64_t incx,
+                 double *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_daxpy_ptr_usm>(cgh, [=]() {
+            ::cblas_daxpy((const int)n, *alpha, x, (const int)incx, y, (const int)incy);
+        });
+    });
+    return done;
+}
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                 const std::complex<float> *x, int64_t incx, std::complex<float> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_caxpy_ptr_usm>(cgh, [=]() {
+            ::cblas_caxpy((const int)n, (const void *)alpha, x, (const int)incx, y,
+                          (const int)incy);
+        });
+    });
+    return done;
+}
+
+sycl::event axpy(sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                 const std::complex<double> *x, int64_t incx, std::complex<double> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zaxpy_ptr_usm>(cgh, [=]() {
+            ::cblas_zaxpy((const int)n, (const void *)alpha, x, (const int)incx, y,
+                          (const int)incy);
+        });
+    });
+    return done;
+}
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const float *alpha, const float *x, int64_t incx,
+                  const float *beta, float *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_saxpby_ptr_usm>(cgh, [=]() {
+            axpby_host(n, *alpha, x, incx, *beta, y, incy);
+        });
+    });
+    return done;
+}
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const double *alpha, const double *x, int64_t incx,
+                  const double *beta, double *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_daxpby_ptr_usm>(cgh, [=]() {
+            axpby_host(n, *alpha, x, incx, *beta, y, incy);
+        });
+    });
+    return done;
+}
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                  const std::complex<float> *x, int64_t incx, const std::complex<float> *beta,
+                  std::complex<float> *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_caxpby_ptr_usm>(cgh, [=]() {
+            axpby_host(n, *alpha, x, incx, *beta, y, incy);
+        });
+    });
+    return done;
+}
+
+sycl::event axpby(sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                  const std::complex<double> *x, int64_t incx, const std::complex<double> *beta,
+                  std::complex<double> *y, int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zaxpby_ptr_usm>(cgh, [=]() {
+            axpby_host(n, *alpha, x, incx, *beta, y, incy);
+        });
+    });
+    return done;
+}
+
+sycl::event scal(sycl::queue &queue, int64_t n, const float *alpha, float *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sscal_ptr_usm>(cgh, [=]() {
+            ::cblas_sscal((const int)n, *alpha, x, (const int)std::abs(incx));
+        });
+    });
+    return done;
+}
+
+sycl::event scal(sycl::queue &queue, int64_t n, const double *alpha, double *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dscal_ptr_usm>(cgh, [=]() {
+            ::cblas_dscal((const int)n, *alpha, x, (const int)std::abs(incx));
+        });
+    });
+    return done;
+}
+
+sycl::event scal(sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                 std::complex<float> *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cscal_ptr_usm>(cgh, [=]() {
+            ::cblas_cscal((const int)n, (const void *)alpha, x, (const int)std::abs(incx));
+        });
+    });
+    return done;
+}
+
+sycl::event scal(sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                 std::complex<double> *x, int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zscal_ptr_usm>(cgh, [=]() {
+            ::cblas_zscal((const int)n, (const void *)alpha, x, (const int)std::abs(incx));
+        });
+    });
+    return done;
+}
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, const float *alpha,
+                 const float *a, int64_t lda, const float *x, int64_t incx, const float *beta,
+                 float *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemv_ptr_usm>(cgh, [=]() {
+            ::cblas_sgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n, *alpha,
+                          a, (const int)lda, x, (const int)incx, *beta, y, (const int)incy);
+        });
+    });
+    return done;
+}
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, const double *alpha,
+                 const double *a, int64_t lda, const double *x, int64_t incx, const double *beta,
+                 double *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemv_ptr_usm>(cgh, [=]() {
+            ::cblas_dgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n, *alpha,
+                          a, (const int)lda, x, (const int)incx, *beta, y, (const int)incy);
+        });
+    });
+    return done;
+}
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                 const std::complex<float> *alpha, const std::complex<float> *a, int64_t lda,
+                 const std::complex<float> *x, int64_t incx, const std::complex<float> *beta,
+                 std::complex<float> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemv_ptr_usm>(cgh, [=]() {
+            ::cblas_cgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
+                          (const void *)alpha, a, (const int)lda, x, (const int)incx,
+                          (const void *)beta, y, (const int)incy);
+        });
+    });
+    return done;
+}
+
+sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                 const std::complex<double> *alpha, const std::complex<double> *a, int64_t lda,
+                 const std::complex<double> *x, int64_t incx, const std::complex<double> *beta,
+                 std::complex<double> *y, int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemv_ptr_usm>(cgh, [=]() {
+            ::cblas_zgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
+                          (const void *)alpha, a, (const int)lda, x, (const int)incx,
+                          (const void *)beta, y, (const int)incy);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const float *alpha, const float *a, int64_t lda, const float *b,
+                 int64_t ldb, const float *beta, float *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_ptr_usm>(cgh, [=]() {
+            gemm_split_k_host(MAJOR, transa, transb, m, n, k, *alpha, a, lda, b, ldb, *beta, c,
+                              ldc);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const double *alpha, const double *a, int64_t lda, const double *b,
+                 int64_t ldb, const double *beta, double *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_ptr_usm>(cgh, [=]() {
+            gemm_split_k_host(MAJOR, transa, transb, m, n, k, *alpha, a, lda, b, ldb, *beta, c,
+                              ldc);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const std::complex<float> *alpha, const std::complex<float> *a,
+                 int64_t lda, const std::complex<float> *b, int64_t ldb,
+                 const std::complex<float> *beta, std::complex<float> *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm_ptr_usm>(cgh, [=]() {
+            gemm_split_k_host(MAJOR, transa, transb, m, n, k, *alpha, a, lda, b, ldb, *beta, c,
+                              ldc);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, const std::complex<double> *alpha, const std::complex<double> *a,
+                 int64_t lda, const std::complex<double> *b, int64_t ldb,
+                 const std::complex<double> *beta, std::complex<double> *c, int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm_ptr_usm>(cgh, [=]() {
+            gemm_split_k_host(MAJOR, transa, transb, m, n, k, *alpha, a, lda, b, ldb, *beta, c,
+                              ldc);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const float *alpha, const float *a, int64_t lda, int64_t stride_a,
+                       const float *b, int64_t ldb, int64_t stride_b, const float *beta, float *c,
+                       int64_t ldc, int64_t stride_c, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_batch_ptr_usm>(cgh, [=]() {
+            for (int64_t i = 0; i < batch_size; i++) {
+                host_gemm(MAJOR, transa, transb, m, n, k, *alpha, a + i * stride_a, lda,
+                          b + i * stride_b, ldb, *beta, c + i * stride_c, ldc);
+            }
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const double *alpha, const double *a, int64_t lda,
+                       int64_t stride_a, const double *b, int64_t ldb, int64_t stride_b,
+                       const double *beta, double *c, int64_t ldc, int64_t stride_c,
+                       int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_batch_ptr_usm>(cgh, [=]() {
+            for (int64_t i = 0; i < batch_size; i++) {
+                host_gemm(MAJOR, transa, transb, m, n, k, *alpha, a + i * stride_a, lda,
+                          b + i * stride_b, ldb, *beta, c + i * stride_c, ldc);
+            }
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const std::complex<float> *alpha, const std::complex<float> *a,
+                       int64_t lda, int64_t stride_a, const std::complex<float> *b, int64_t ldb,
+                       int64_t stride_b, const std::complex<float> *beta, std::complex<float> *c,
+                       int64_t ldc, int64_t stride_c, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm_batch_ptr_usm>(cgh, [=]() {
+            for (int64_t i = 0; i < batch_size; i++) {
+                host_gemm(MAJOR, transa, transb, m, n, k, *alpha, a + i * stride_a, lda,
+                          b + i * stride_b, ldb, *beta, c + i * stride_c, ldc);
+            }
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                       int64_t k, const std::complex<double> *alpha, const std::complex<double> *a,
+                       int64_t lda, int64_t stride_a, const std::complex<double> *b, int64_t ldb,
+                       int64_t stride_b, const std::complex<double> *beta, std::complex<double> *c,
+                       int64_t ldc, int64_t stride_c, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm_batch_ptr_usm>(cgh, [=]() {
+            for (int64_t i = 0; i < batch_size; i++) {
+                host_gemm(MAJOR, transa, transb, m, n, k, *alpha, a + i * stride_a, lda,
+                          b + i * stride_b, ldb, *beta, c + i * stride_c, ldc);
+            }
+        });
+    });
+    return done;
+}
@@ -27,11 +27,8 @@ void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_sgemm>(cgh, [=]() {
-            ::cblas_sgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const float)alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_b.GET_MULTI_PTR,
-                          (const int)ldb, (const float)beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+            gemm_split_k_host(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                              accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
         });
     });
 }
@@ -44,11 +41,8 @@ void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dgemm>(cgh, [=]() {
-            ::cblas_dgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const double)alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_b.GET_MULTI_PTR,
-                          (const int)ldb, (const double)beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+            gemm_split_k_host(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                              accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
         });
     });
 }
@@ -62,11 +56,8 @@ void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_cgemm>(cgh, [=]() {
-            ::cblas_cgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void *)&alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_b.GET_MULTI_PTR,
-                          (const int)ldb, (const void *)&beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+            gemm_split_k_host(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                              accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
         });
     });
 }
@@ -80,11 +71,8 @@ void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zgemm>(cgh, [=]() {
-            ::cblas_zgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void *)&alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_b.GET_MULTI_PTR,
-                          (const int)ldb, (const void *)&beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+            gemm_split_k_host(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                              accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
         });
     });
 }
@@ -93,34 +81,43 @@ void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int
           sycl::half alpha, sycl::buffer<sycl::half, 1> &a, int64_t lda,
           sycl::buffer<sycl::half, 1> &b, int64_t ldb, sycl::half beta,
           sycl::buffer<sycl::half, 1> &c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_hgemm>(cgh, [=]() {
+            gemm_host(MAJOR, transa, transb, m, n, k, (float)alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_b.GET_MULTI_PTR, ldb, (float)beta, accessor_c.GET_MULTI_PTR, ldc);
+        });
+    });
 }
 
 void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
           float alpha, sycl::buffer<sycl::half, 1> &a, int64_t lda, sycl::buffer<sycl::half, 1> &b,
           int64_t ldb, float beta, sycl::buffer<float, 1> &c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_gemm_f16f16f32>(cgh, [=]() {
+            gemm_host(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
+        });
+    });
 }
 
 void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
           float alpha, sycl::buffer<bfloat16, 1> &a, int64_t lda, sycl::buffer<bfloat16, 1> &b,
           int64_t ldb, float beta, sycl::buffer<float, 1> &c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_gemm_bf16bf16f32>(cgh, [=]() {
+            gemm_host(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
+        });
+    });
 }
 
 void hemm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t m, int64_t n,
@@ -565,9 +562,7 @@ sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_sgemm_usm>(cgh, [=]() {
-            ::cblas_sgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const float)alpha, a,
-                          (const int)lda, b, (const int)ldb, (const float)beta, c, (const int)ldc);
+            gemm_split_k_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -583,9 +578,7 @@ sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dgemm_usm>(cgh, [=]() {
-            ::cblas_dgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const double)alpha, a,
-                          (const int)lda, b, (const int)ldb, (const double)beta, c, (const int)ldc);
+            gemm_split_k_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -602,10 +595,7 @@ sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_cgemm_usm>(cgh, [=]() {
-            ::cblas_cgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void *)&alpha, a,
-                          (const int)lda, b, (const int)ldb, (const void *)&beta, c,
-                          (const int)ldc);
+            gemm_split_k_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -622,10 +612,7 @@ sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zgemm_usm>(cgh, [=]() {
-            ::cblas_zgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void *)&alpha, a,
-                          (const int)lda, b, (const int)ldb, (const void *)&beta, c,
-                          (const int)ldc);
+            gemm_split_k_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -635,36 +622,49 @@ sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t
                  int64_t k, sycl::half alpha, const sycl::half *a, int64_t lda, const sycl::half *b,
                  int64_t ldb, sycl::half beta, sycl::half *c, int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_hgemm_usm>(cgh, [=]() {
+            gemm_host(MAJOR, transa, transb, m, n, k, (float)alpha, a, lda, b, ldb, (float)beta, c,
+                      ldc);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
                  int64_t k, float alpha, const sycl::half *a, int64_t lda, const sycl::half *b,
                  int64_t ldb, float beta, float *c, int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_f16f16f32_usm>(cgh, [=]() {
+            gemm_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
                  int64_t k, float alpha, const bfloat16 *a, int64_t lda, const bfloat16 *b,
                  int64_t ldb, float beta, float *c, int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_bf16bf16f32_usm>(cgh, [=]() {
+            gemm_host(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        });
+    });
+    return done;
 }
 
 sycl::event hemm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t m, int64_t n,
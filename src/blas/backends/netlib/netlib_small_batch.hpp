@@ -0,0 +1,441 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_SMALL_BATCH_HPP_
+#define _NETLIB_SMALL_BATCH_HPP_
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "netlib_common.hpp"
+
+// Batched GEMM and TRSM on the host.
+//
+// For matrices of a few rows a reference BLAS call spends more time on
+// argument checks, loop setup and the short inner loops than on arithmetic.
+// When every matrix of a real batch is at most small_batch_max_dim on a side
+// the batch is instead processed small_batch_lanes<T> matrices at a time, in
+// an interleaved layout where element (i, j) of all the matrices of a block
+// is contiguous. Each scalar step of the algorithm then applies to a whole
+// block at once, as an innermost loop over the lanes that the compiler maps
+// onto one vector register. Transposition and the layout are resolved when a
+// block is packed, so the kernels only see column-major, non-transposed
+// operands. Square sizes common in practice have kernels with compile-time
+// dimensions, which the compiler unrolls; other shapes run the same kernels
+// with run-time dimensions. Larger and complex matrices are multiplied one
+// BLAS call at a time. In both cases the batch is shared between threads.
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace netlib {
+
+inline void host_trsm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+                      diag unit_diag, int64_t m, int64_t n, float alpha, const float *a,
+                      int64_t lda, float *b, int64_t ldb) {
+    ::cblas_strsm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  convert_to_cblas_trans(trans), convert_to_cblas_diag(unit_diag), (const int)m,
+                  (const int)n, alpha, a, (const int)lda, b, (const int)ldb);
+}
+
+inline void host_trsm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+                      diag unit_diag, int64_t m, int64_t n, double alpha, const double *a,
+                      int64_t lda, double *b, int64_t ldb) {
+    ::cblas_dtrsm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  convert_to_cblas_trans(trans), convert_to_cblas_diag(unit_diag), (const int)m,
+                  (const int)n, alpha, a, (const int)lda, b, (const int)ldb);
+}
+
+inline void host_trsm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+                      diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
+                      const std::complex<float> *a, int64_t lda, std::complex<float> *b,
+                      int64_t ldb) {
+    ::cblas_ctrsm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  convert_to_cblas_trans(trans), convert_to_cblas_diag(unit_diag), (const int)m,
+                  (const int)n, (const void *)&alpha, (const void *)a, (const int)lda, (void *)b,
+                  (const int)ldb);
+}
+
+inline void host_trsm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+                      diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
+                      const std::complex<double> *a, int64_t lda, std::complex<double> *b,
+                      int64_t ldb) {
+    ::cblas_ztrsm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  convert_to_cblas_trans(trans), convert_to_cblas_diag(unit_diag), (const int)m,
+                  (const int)n, (const void *)&alpha, (const void *)a, (const int)lda, (void *)b,
+                  (const int)ldb);
+}
+
+// Largest dimension handled by the interleaved kernels.
+constexpr int64_t small_batch_max_dim = 32;
+// Matrices per block: one 64-byte vector register of elements.
+template <typename T>
+constexpr int64_t small_batch_lanes = 64 / sizeof(T);
+// Work, in flops, below which a batch is not worth another thread.
+constexpr double small_batch_thread_flops = double(1 << 20);
+
+template <typename T>
+constexpr bool has_small_batch_kernels = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+template <int64_t M, int64_t N, int64_t K>
+struct small_fixed_dims {
+    static constexpr int64_t m = M;
+    static constexpr int64_t n = N;
+    static constexpr int64_t k = K;
+};
+
+struct small_dims {
+    int64_t m, n, k;
+};
+
+// Calls kernel with the dimensions of the problem, as compile-time constants
+// for the square sizes the kernels are instantiated for.
+template <typename Kernel>
+void small_batch_dispatch(int64_t m, int64_t n, int64_t k, Kernel kernel) {
+    if (m == n && n == k) {
+        switch (m) {
+            case 2: kernel(small_fixed_dims<2, 2, 2>{}); return;
+            case 3: kernel(small_fixed_dims<3, 3, 3>{}); return;
+            case 4: kernel(small_fixed_dims<4, 4, 4>{}); return;
+            case 5: kernel(small_fixed_dims<5, 5, 5>{}); return;
+            case 6: kernel(small_fixed_dims<6, 6, 6>{}); return;
+            case 8: kernel(small_fixed_dims<8, 8, 8>{}); return;
+            case 16: kernel(small_fixed_dims<16, 16, 16>{}); return;
+            case 32: kernel(small_fixed_dims<32, 32, 32>{}); return;
+            default: break;
+        }
+    }
+    kernel(small_dims{ m, n, k });
+}
+
+// Runs body(first, last) on consecutive ranges of [0, count) on as many
+// threads as the total cost, in flops, keeps busy.
+template <typename Body>
+void small_batch_parallel_for(int64_t count, double cost_per_item, Body body) {
+    if (count <= 0)
+        return;
+    const int64_t hw_threads = std::max(1u, std::thread::hardware_concurrency());
+    const int64_t useful_threads =
+        std::max<int64_t>(1, int64_t(double(count) * cost_per_item / small_batch_thread_flops));
+    const int64_t num_threads = std::min({ count, hw_threads, useful_threads });
+
+    auto run_range = [&](int64_t t) {
+        body(count * t / num_threads, count * (t + 1) / num_threads);
+    };
+    std::vector<std::thread> workers;
+    for (int64_t t = 1; t < num_threads; t++)
+        workers.emplace_back(run_range, t);
+    run_range(0);
+    for (auto &worker : workers)
+        worker.join();
+}
+
+// Distances between X(i, j) and X(i + 1, j), and between X(i, j) and
+// X(i, j + 1), for op(X) stored with leading dimension ld.
+inline std::pair<int64_t, int64_t> small_steps(bool column_major, transpose trans, int64_t ld) {
+    const bool by_rows = column_major == (trans == transpose::nontrans);
+    return by_rows ? std::make_pair(int64_t(1), ld) : std::make_pair(ld, int64_t(1));
+}
+
+// Copies op(X), rows x cols, of the count matrices x(first), x(first + 1), ...
+// into the interleaved block xp. Lanes past count are left as they are.
+template <typename T, typename XPtr>
+void small_pack(bool column_major, transpose trans, XPtr x, int64_t ld, int64_t first,
+                int64_t count, int64_t rows, int64_t cols, T *xp) {
+    constexpr int64_t L = small_batch_lanes<T>;
+    const auto [row_step, col_step] = small_steps(column_major, trans, ld);
+    const T *x_l[L];
+    for (int64_t l = 0; l < count; l++)
+        x_l[l] = x(first + l);
+    for (int64_t j = 0; j < cols; j++) {
+        for (int64_t i = 0; i < rows; i++) {
+            const int64_t idx = i * row_step + j * col_step;
+            T *xp_ij = xp + (i + j * rows) * L;
+            for (int64_t l = 0; l < count; l++)
+                xp_ij[l] = x_l[l][idx];
+        }
+    }
+}
+
+// Copies the interleaved block xp back to the count matrices x(first), ...,
+// each rows x cols.
+template <typename T, typename XPtr>
+void small_unpack(bool column_major, transpose trans, const T *xp, int64_t first, int64_t count,
+                  int64_t rows, int64_t cols, XPtr x, int64_t ld) {
+    constexpr int64_t L = small_batch_lanes<T>;
+    const auto [row_step, col_step] = small_steps(column_major, trans, ld);
+    T *x_l[L];
+    for (int64_t l = 0; l < count; l++)
+        x_l[l] = x(first + l);
+    for (int64_t j = 0; j < cols; j++) {
+        for (int64_t i = 0; i < rows; i++) {
+            const int64_t idx = i * row_step + j * col_step;
+            const T *xp_ij = xp + (i + j * rows) * L;
+            for (int64_t l = 0; l < count; l++)
+                x_l[l][idx] = xp_ij[l];
+        }
+    }
+}
+
+// C := alpha * A * B + beta * C on interleaved blocks: A is m x k, B is k x n
+// and C is m x n. C is not read when beta is zero. Rows of C are computed
+// small_gemm_rows at a time so each element of B loaded is used several times.
+constexpr int64_t small_gemm_rows = 4;
+
+template <typename T, int64_t R, typename Dims>
+void small_gemm_rows_kernel(Dims d, int64_t i0, int64_t j, T alpha, const T *ap, const T *bp,
+                            T beta, T *cp) {
+    constexpr int64_t L = small_batch_lanes<T>;
+    T acc[R][L] = {};
+    for (int64_t p = 0; p < d.k; p++) {
+        const T *b_pj = bp + (p + j * d.k) * L;
+        for (int64_t r = 0; r < R; r++) {
+            const T *a_ip = ap + (i0 + r + p * d.m) * L;
+            for (int64_t l = 0; l < L; l++)
+                acc[r][l] += a_ip[l] * b_pj[l];
+        }
+    }
+    for (int64_t r = 0; r < R; r++) {
+        T *c_ij = cp + (i0 + r + j * d.m) * L;
+        if (beta == T(0)) {
+            for (int64_t l = 0; l < L; l++)
+                c_ij[l] = alpha * acc[r][l];
+        }
+        else {
+            for (int64_t l = 0; l < L; l++)
+                c_ij[l] = alpha * acc[r][l] + beta * c_ij[l];
+        }
+    }
+}
+
+template <typename T, typename Dims>
+void small_gemm_kernel(Dims d, T alpha, const T *ap, const T *bp, T beta, T *cp) {
+    constexpr int64_t R = small_gemm_rows;
+    for (int64_t j = 0; j < d.n; j++) {
+        int64_t i = 0;
+        for (; i + R <= d.m; i += R)
+            small_gemm_rows_kernel<T, R>(d, i, j, alpha, ap, bp, beta, cp);
+        for (; i < d.m; i++)
+            small_gemm_rows_kernel<T, 1>(d, i, j, alpha, ap, bp, beta, cp);
+    }
+}
+
+// Solves T * X = alpha * X in place on interleaved blocks, for the order m
+// triangular T and the m x n X. The triangle of T not referenced, and its
+// diagonal when unit, are not read.
+template <typename T, typename Dims>
+void small_trsm_kernel(Dims d, bool lower, bool unit, T alpha, const T *tp, T *xp) {
+    constexpr int64_t L = small_batch_lanes<T>;
+    for (int64_t j = 0; j < d.n; j++) {
+        T *x_j = xp + j * d.m * L;
+        for (int64_t s = 0; s < d.m; s++) {
+            const int64_t i = lower ? s : d.m - 1 - s;
+            T x[L];
+            for (int64_t l = 0; l < L; l++)
+                x[l] = alpha * x_j[i * L + l];
+            for (int64_t q = 0; q < s; q++) {
+                const int64_t p = lower ? q : d.m - 1 - q;
+                const T *t_ip = tp + (i + p * d.m) * L;
+                for (int64_t l = 0; l < L; l++)
+                    x[l] -= t_ip[l] * x_j[p * L + l];
+            }
+            if (!unit) {
+                const T *t_ii = tp + (i + i * d.m) * L;
+                for (int64_t l = 0; l < L; l++)
+                    x[l] /= t_ii[l];
+            }
+            for (int64_t l = 0; l < L; l++)
+                x_j[i * L + l] = x[l];
+        }
+    }
+}
+
+// C(i) := alpha * op(A(i)) * op(B(i)) + beta * C(i) for i in [0, batch_size),
+// where a(i), b(i) and c(i) give the matrices of entry i.
+template <typename T, typename APtr, typename BPtr, typename CPtr>
+void gemm_batch_uniform_host(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, T alpha, APtr a, int64_t lda, BPtr b,
+                             int64_t ldb, T beta, CPtr c, int64_t ldc, int64_t batch_size) {
+    if (m <= 0 || n <= 0 || batch_size <= 0)
+        return;
+    const double flops = 2.0 * double(m) * double(n) * double(k);
+    if constexpr (has_small_batch_kernels<T>) {
+        if (std::max({ m, n, k }) <= small_batch_max_dim) {
+            constexpr int64_t L = small_batch_lanes<T>;
+            const bool column_major = layout == CblasColMajor;
+            // With alpha zero A and B are not read.
+            const int64_t k_eff = (alpha == T(0)) ? 0 : k;
+            const int64_t num_blocks = (batch_size + L - 1) / L;
+            small_batch_parallel_for(num_blocks, flops * L, [&](int64_t first, int64_t last) {
+                std::vector<T> ap(m * k_eff * L), bp(k_eff * n * L), cp(m * n * L);
+                for (int64_t block = first; block < last; block++) {
+                    const int64_t first_entry = block * L;
+                    const int64_t count = std::min(L, batch_size - first_entry);
+                    small_pack(column_major, transa, a, lda, first_entry, count, m, k_eff,
+                               ap.data());
+                    small_pack(column_major, transb, b, ldb, first_entry, count, k_eff, n,
+                               bp.data());
+                    if (beta != T(0))
+                        small_pack(column_major, transpose::nontrans, c, ldc, first_entry, count,
+                                   m, n, cp.data());
+                    small_batch_dispatch(m, n, k_eff, [&](auto dims) {
+                        small_gemm_kernel<T>(dims, alpha, ap.data(), bp.data(), beta, cp.data());
+                    });
+                    small_unpack(column_major, transpose::nontrans, cp.data(), first_entry, count,
+                                 m, n, c, ldc);
+                }
+            });
+            return;
+        }
+    }
+    small_batch_parallel_for(batch_size, flops, [&](int64_t first, int64_t last) {
+        for (int64_t i = first; i < last; i++)
+            host_gemm(layout, transa, transb, m, n, k, alpha, a(i), lda, b(i), ldb, beta, c(i),
+                      ldc);
+    });
+}
+
+// Solves op(A(i)) * X = alpha * B(i), or X * op(A(i)) = alpha * B(i), for i
+// in [0, batch_size), overwriting B(i) with X.
+template <typename T, typename APtr, typename BPtr>
+void trsm_batch_uniform_host(CBLAS_LAYOUT layout, side left_right, uplo upper_lower,
+                             transpose trans, diag unit_diag, int64_t m, int64_t n, T alpha,
+                             APtr a, int64_t lda, BPtr b, int64_t ldb, int64_t batch_size) {
+    if (m <= 0 || n <= 0 || batch_size <= 0)
+        return;
+    const bool left = left_right == side::left;
+    // The problem as T * X = alpha * B' with T of order order: T = op(A) and
+    // B' = B on the left, T = op(A)^T and B' = B^T on the right.
+    const int64_t order = left ? m : n;
+    const int64_t rhs = left ? n : m;
+    const double flops = double(order) * double(order) * double(rhs);
+    if constexpr (has_small_batch_kernels<T>) {
+        if (std::max(m, n) <= small_batch_max_dim) {
+            constexpr int64_t L = small_batch_lanes<T>;
+            const bool column_major = layout == CblasColMajor;
+            const bool unit = unit_diag == diag::unit;
+            // Whether T(r, c) is A(c, r) rather than A(r, c).
+            const bool trans_a = (trans != transpose::nontrans) == left;
+            const bool lower = (upper_lower == uplo::lower) != trans_a;
+            const auto [row_step, col_step] =
+                small_steps(column_major, trans_a ? transpose::trans : transpose::nontrans, lda);
+            const transpose trans_b = left ? transpose::nontrans : transpose::trans;
+            const int64_t num_blocks = (batch_size + L - 1) / L;
+            small_batch_parallel_for(num_blocks, flops * L, [&](int64_t first, int64_t last) {
+                std::vector<T> tp(order * order * L), xp(order * rhs * L, T(0));
+                // Unused lanes get a unit diagonal so they divide by one.
+                for (int64_t i = 0; i < order; i++)
+                    std::fill_n(&tp[(i + i * order) * L], L, T(1));
+                for (int64_t block = first; block < last; block++) {
+                    const int64_t first_entry = block * L;
+                    const int64_t count = std::min(L, batch_size - first_entry);
+                    for (int64_t l = 0; l < count; l++) {
+                        const T *a_l = a(first_entry + l);
+                        for (int64_t c = 0; c < order; c++) {
+                            const int64_t r_first = lower ? c + unit : 0;
+                            const int64_t r_last = lower ? order : c + 1 - unit;
+                            for (int64_t r = r_first; r < r_last; r++)
+                                tp[(r + c * order) * L + l] = a_l[r * row_step + c * col_step];
+                        }
+                    }
+                    if (alpha != T(0)) {
+                        small_pack(column_major, trans_b, b, ldb, first_entry, count, order, rhs,
+                                   xp.data());
+                        small_batch_dispatch(order, rhs, order, [&](auto dims) {
+                            small_trsm_kernel<T>(dims, lower, unit, alpha, tp.data(), xp.data());
+                        });
+                    }
+                    small_unpack(column_major, trans_b, xp.data(), first_entry, count, order,
+                                 rhs, b, ldb);
+                }
+            });
+            return;
+        }
+    }
+    small_batch_parallel_for(batch_size, flops, [&](int64_t first, int64_t last) {
+        for (int64_t i = first; i < last; i++)
+            host_trsm(layout, left_right, upper_lower, trans, unit_diag, m, n, alpha, a(i), lda,
+                      b(i), ldb);
+    });
+}
+
+template <typename T>
+void gemm_batch_host(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                     int64_t n, int64_t k, T alpha, const T *a, int64_t lda, int64_t stride_a,
+                     const T *b, int64_t ldb, int64_t stride_b, T beta, T *c, int64_t ldc,
+                     int64_t stride_c, int64_t batch_size) {
+    gemm_batch_uniform_host(
+        layout, transa, transb, m, n, k, alpha, [=](int64_t i) { return a + i * stride_a; }, lda,
+        [=](int64_t i) { return b + i * stride_b; }, ldb, beta,
+        [=](int64_t i) { return c + i * stride_c; }, ldc, batch_size);
+}
+
+template <typename T>
+void gemm_batch_host(CBLAS_LAYOUT layout, const transpose *transa, const transpose *transb,
+                     const int64_t *m, const int64_t *n, const int64_t *k, const T *alpha,
+                     const T **a, const int64_t *lda, const T **b, const int64_t *ldb,
+                     const T *beta, T **c, const int64_t *ldc, int64_t group_count,
+                     const int64_t *group_size) {
+    int64_t offset = 0;
+    for (int64_t g = 0; g < group_count; g++) {
+        gemm_batch_uniform_host(
+            layout, transa[g], transb[g], m[g], n[g], k[g], alpha[g],
+            [=](int64_t i) { return a[offset + i]; }, lda[g],
+            [=](int64_t i) { return b[offset + i]; }, ldb[g], beta[g],
+            [=](int64_t i) { return c[offset + i]; }, ldc[g], group_size[g]);
+        offset += group_size[g];
+    }
+}
+
+template <typename T>
+void trsm_batch_host(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+                     diag unit_diag, int64_t m, int64_t n, T alpha, const T *a, int64_t lda,
+                     int64_t stride_a, T *b, int64_t ldb, int64_t stride_b, int64_t batch_size) {
+    trsm_batch_uniform_host(
+        layout, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+        [=](int64_t i) { return a + i * stride_a; }, lda,
+        [=](int64_t i) { return b + i * stride_b; }, ldb, batch_size);
+}
+
+template <typename T>
+void trsm_batch_host(CBLAS_LAYOUT layout, const side *left_right, const uplo *upper_lower,
+                     const transpose *trans, const diag *unit_diag, const int64_t *m,
+                     const int64_t *n, const T *alpha, const T **a, const int64_t *lda, T **b,
+                     const int64_t *ldb, int64_t group_count, const int64_t *group_size) {
+    int64_t offset = 0;
+    for (int64_t g = 0; g < group_count; g++) {
+        trsm_batch_uniform_host(
+            layout, left_right[g], upper_lower[g], trans[g], unit_diag[g], m[g], n[g], alpha[g],
+            [=](int64_t i) { return a[offset + i]; }, lda[g],
+            [=](int64_t i) { return b[offset + i]; }, ldb[g], group_size[g]);
+        offset += group_size[g];
+    }
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _NETLIB_SMALL_BATCH_HPP_
@@ -24,6 +24,8 @@
 #endif
 
 #include "portblas_common.hpp"
+#include "portblas_gemm_tuning.hpp"
+#include "portblas_extension_kernels.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/blas/detail/portblas/onemkl_blas_portblas.hpp"
 
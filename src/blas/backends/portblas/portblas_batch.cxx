@@ -172,6 +172,14 @@ void gemm_batch(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::
                 sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b, float beta,
                 sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
+    if constexpr (is_column_major()) {
+        if (int config =
+                detail::get_gemm_config<float>(queue, transa, transb, m, n, k, batch_size)) {
+            detail::tuned_gemm(queue, config, transa, transb, m, n, k, alpha, a, lda, stride_a, b,
+                               ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+            return;
+        }
+    }
     CALL_PORTBLAS_FN(::blas::_gemm_strided_batched, queue, transa, transb, m, n, k, alpha, a, lda,
                      stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
 }
@@ -182,6 +190,14 @@ void gemm_batch(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::
                 sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b, double beta,
                 sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
+    if constexpr (is_column_major()) {
+        if (int config =
+                detail::get_gemm_config<double>(queue, transa, transb, m, n, k, batch_size)) {
+            detail::tuned_gemm(queue, config, transa, transb, m, n, k, alpha, a, lda, stride_a, b,
+                               ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+            return;
+        }
+    }
     CALL_PORTBLAS_FN(::blas::_gemm_strided_batched, queue, transa, transb, m, n, k, alpha, a, lda,
                      stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
 }
@@ -707,6 +723,14 @@ sycl::event gemm_batch(sycl::queue &queue, oneapi::mkl::transpose transa,
                        std::int64_t stride_b, float beta, float *c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
+    if constexpr (is_column_major()) {
+        if (int config =
+                detail::get_gemm_config<float>(queue, transa, transb, m, n, k, batch_size)) {
+            return detail::tuned_gemm(queue, config, transa, transb, m, n, k, alpha, a, lda,
+                                      stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                                      batch_size, dependencies);
+        }
+    }
     CALL_PORTBLAS_USM_FN(::blas::_gemm_strided_batched, queue, transa, transb, m, n, k, alpha, a,
                          lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size,
                          dependencies);
@@ -719,6 +743,14 @@ sycl::event gemm_batch(sycl::queue &queue, oneapi::mkl::transpose transa,
                        std::int64_t stride_b, double beta, double *c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
+    if constexpr (is_column_major()) {
+        if (int config =
+                detail::get_gemm_config<double>(queue, transa, transb, m, n, k, batch_size)) {
+            return detail::tuned_gemm(queue, config, transa, transb, m, n, k, alpha, a, lda,
+                                      stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                                      batch_size, dependencies);
+        }
+    }
     CALL_PORTBLAS_USM_FN(::blas::_gemm_strided_batched, queue, transa, transb, m, n, k, alpha, a,
                          lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size,
                          dependencies);
@@ -931,3 +963,41 @@ sycl::event omatadd_batch(sycl::queue &queue, oneapi::mkl::transpose transa,
                           std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
     throw unimplemented("blas", "omatadd_batch", " for USM");
 }
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, std::int64_t *m,
+                        std::int64_t *n, std::int64_t *k, float alpha, const float **a,
+                        std::int64_t *lda, const float **b, std::int64_t *ldb, float beta,
+                        float **c, std::int64_t *ldc, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return detail::gemm_vbatch(queue, is_column_major(), transa, transb, m, n, k, alpha, a, lda, b,
+                               ldb, beta, c, ldc, batch_size, dependencies);
+}
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, std::int64_t *m,
+                        std::int64_t *n, std::int64_t *k, double alpha, const double **a,
+                        std::int64_t *lda, const double **b, std::int64_t *ldb, double beta,
+                        double **c, std::int64_t *ldc, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return detail::gemm_vbatch(queue, is_column_major(), transa, transb, m, n, k, alpha, a, lda, b,
+                               ldb, beta, c, ldc, batch_size, dependencies);
+}
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, std::int64_t *m,
+                        std::int64_t *n, std::int64_t *k, std::complex<float> alpha,
+                        const std::complex<float> **a, std::int64_t *lda,
+                        const std::complex<float> **b, std::int64_t *ldb, std::complex<float> beta,
+                        std::complex<float> **c, std::int64_t *ldc, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return detail::gemm_vbatch(queue, is_column_major(), transa, transb, m, n, k, alpha, a, lda, b,
+                               ldb, beta, c, ldc, batch_size, dependencies);
+}
+
+sycl::event gemm_vbatch(sycl::queue &queue, transpose transa, transpose transb, std::int64_t *m,
+                        std::int64_t *n, std::int64_t *k, std::complex<double> alpha,
+                        const std::complex<double> **a, std::int64_t *lda,
+                        const std::complex<double> **b, std::int64_t *ldb,
+                        std::complex<double> beta, std::complex<double> **c, std::int64_t *ldc,
+                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return detail::gemm_vbatch(queue, is_column_major(), transa, transb, m, n, k, alpha, a, lda, b,
+                               ldb, beta, c, ldc, batch_size, dependencies);
+}
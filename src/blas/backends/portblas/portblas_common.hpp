@@ -23,6 +23,8 @@
 #include "portblas.hpp"
 #include "oneapi/mkl/types.hpp"
 #include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/blas/capture.hpp"
+#include "oneapi/mkl/blas/reproducibility.hpp"
 
 #include <tuple>
 #include <utility>
@@ -187,6 +189,38 @@ struct throw_if_unsupported_by_device {
     }
 };
 
+/** Whether commands submitted to queue are recorded into a command graph
+ *  instead of being run.
+**/
+inline bool is_recording(const sycl::queue& queue) {
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+    return queue.ext_oneapi_get_state() == sycl::ext::oneapi::experimental::queue_state::recording;
+#else
+    return false;
+#endif
+}
+
+/** Frees the USM scratch allocations ptrs once event has completed and returns
+ *  the event of the release. A recorded graph runs again on the same scratch
+ *  each time it is replayed, so while queue is recording the allocations are
+ *  handed to the captured sequence, which frees them when it is destroyed,
+ *  and event is returned unchanged. A graph recorded other than through
+ *  begin_capture has no owner for them and they are kept.
+**/
+template <typename... PtrT>
+sycl::event free_scratch(sycl::queue& queue, sycl::event event, PtrT... ptrs) {
+    if (is_recording(queue)) {
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+        (oneapi::mkl::blas::detail::add_capture_scratch(queue, ptrs), ...);
+#endif
+        return event;
+    }
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(event);
+        cgh.host_task([=]() { (sycl::free(ptrs, queue), ...); });
+    });
+}
+
 } // namespace detail
 
 #define CALL_PORTBLAS_FN(portBLASFunc, ...)                                                     \
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Overloads taking alpha and beta as USM pointers, read when the kernels run.
+
+sycl::event axpy(sycl::queue &queue, std::int64_t n, const real_t *alpha, const real_t *x,
+                 std::int64_t incx, real_t *y, std::int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    return detail::axpby_device_scalars(queue, n, alpha, x, incx, nullptr, y, incy, dependencies);
+}
+
+sycl::event axpy(sycl::queue &queue, std::int64_t n, const std::complex<real_t> *alpha,
+                 const std::complex<real_t> *x, std::int64_t incx, std::complex<real_t> *y,
+                 std::int64_t incy, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", " for complex");
+}
+
+sycl::event axpby(sycl::queue &queue, std::int64_t n, const real_t *alpha, const real_t *x,
+                  std::int64_t incx, const real_t *beta, real_t *y, std::int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    return detail::axpby_device_scalars(queue, n, alpha, x, incx, beta, y, incy, dependencies);
+}
+
+sycl::event axpby(sycl::queue &queue, std::int64_t n, const std::complex<real_t> *alpha,
+                  const std::complex<real_t> *x, std::int64_t incx,
+                  const std::complex<real_t> *beta, std::complex<real_t> *y, std::int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby", " for complex");
+}
+
+sycl::event scal(sycl::queue &queue, std::int64_t n, const real_t *alpha, real_t *x,
+                 std::int64_t incx, const std::vector<sycl::event> &dependencies) {
+    return detail::scal_device_scalars(queue, n, alpha, x, incx, dependencies);
+}
+
+sycl::event scal(sycl::queue &queue, std::int64_t n, const std::complex<real_t> *alpha,
+                 std::complex<real_t> *x, std::int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", " for complex");
+}
+
+sycl::event gemv(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                 const real_t *alpha, const real_t *a, std::int64_t lda, const real_t *x,
+                 std::int64_t incx, const real_t *beta, real_t *y, std::int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    if constexpr (is_column_major()) {
+        return detail::gemv_device_scalars(queue, trans, m, n, alpha, a, lda, x, incx, beta, y,
+                                           incy, dependencies);
+    }
+    else {
+        const oneapi::mkl::transpose trans_col = (trans == oneapi::mkl::transpose::nontrans)
+                                                      ? oneapi::mkl::transpose::trans
+                                                      : oneapi::mkl::transpose::nontrans;
+        return detail::gemv_device_scalars(queue, trans_col, n, m, alpha, a, lda, x, incx, beta, y,
+                                           incy, dependencies);
+    }
+}
+
+sycl::event gemv(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                 const std::complex<real_t> *alpha, const std::complex<real_t> *a, std::int64_t lda,
+                 const std::complex<real_t> *x, std::int64_t incx, const std::complex<real_t> *beta,
+                 std::complex<real_t> *y, std::int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemv", " for complex");
+}
+
+sycl::event gemm(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, const real_t *alpha,
+                 const real_t *a, std::int64_t lda, const real_t *b, std::int64_t ldb,
+                 const real_t *beta, real_t *c, std::int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    return detail::gemm_device_scalars(queue, is_column_major(), transa, transb, m, n, k, alpha, a,
+                                       lda, 0, b, ldb, 0, beta, c, ldc, 0, 1, dependencies);
+}
+
+sycl::event gemm(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<real_t> *alpha,
+                 const std::complex<real_t> *a, std::int64_t lda, const std::complex<real_t> *b,
+                 std::int64_t ldb, const std::complex<real_t> *beta, std::complex<real_t> *c,
+                 std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm", " for complex");
+}
+
+sycl::event gemm_batch(sycl::queue &queue, oneapi::mkl::transpose transa,
+                       oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                       std::int64_t k, const real_t *alpha, const real_t *a, std::int64_t lda,
+                       std::int64_t stride_a, const real_t *b, std::int64_t ldb,
+                       std::int64_t stride_b, const real_t *beta, real_t *c, std::int64_t ldc,
+                       std::int64_t stride_c, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return detail::gemm_device_scalars(queue, is_column_major(), transa, transb, m, n, k, alpha, a,
+                                       lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                                       batch_size, dependencies);
+}
+
+sycl::event gemm_batch(sycl::queue &queue, oneapi::mkl::transpose transa,
+                       oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                       std::int64_t k, const std::complex<real_t> *alpha,
+                       const std::complex<real_t> *a, std::int64_t lda, std::int64_t stride_a,
+                       const std::complex<real_t> *b, std::int64_t ldb, std::int64_t stride_b,
+                       const std::complex<real_t> *beta, std::complex<real_t> *c, std::int64_t ldc,
+                       std::int64_t stride_c, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_batch", " for complex");
+}
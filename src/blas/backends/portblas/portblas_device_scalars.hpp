@@ -0,0 +1,190 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _PORTBLAS_DEVICE_SCALARS_HPP_
+#define _PORTBLAS_DEVICE_SCALARS_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "portblas_fused_level1.hpp"
+#include "portblas_gemm_tuning.hpp"
+
+// Kernels for the overloads that take alpha and beta as USM pointers. portBLAS
+// only accepts scalars by value, so these routines use their own kernels that
+// load the scalars on the device when they run. A scalar produced by a previous
+// kernel (a dot product, a norm) can then be consumed without the host waiting
+// for it. Matrices are column-major; row-major callers transpose the problem.
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace portblas {
+namespace detail {
+
+constexpr std::int64_t device_scalars_wg_size = 256;
+
+inline sycl::range<1> device_scalars_range(std::int64_t n) {
+    return sycl::range<1>(((n + device_scalars_wg_size - 1) / device_scalars_wg_size) *
+                          device_scalars_wg_size);
+}
+
+/** y := alpha * x + beta * y, or y := alpha * x + y when beta is null. y is not
+ *  read when beta is zero.
+**/
+template <typename T>
+sycl::event axpby_device_scalars(sycl::queue &queue, std::int64_t n, const T *alpha, const T *x,
+                                 std::int64_t incx, const T *beta, T *y, std::int64_t incy,
+                                 const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        if (n <= 0) {
+            return;
+        }
+        const std::int64_t x0 = vector_offset(n, incx);
+        const std::int64_t y0 = vector_offset(n, incy);
+        cgh.parallel_for(device_scalars_range(n), [=](sycl::id<1> id) {
+            const std::int64_t i = id[0];
+            if (i < n) {
+                const T b = beta ? *beta : T(1);
+                T &y_elem = y[y0 + i * incy];
+                y_elem = (b == T(0)) ? *alpha * x[x0 + i * incx]
+                                     : *alpha * x[x0 + i * incx] + b * y_elem;
+            }
+        });
+    });
+}
+
+/** x := alpha * x **/
+template <typename T>
+sycl::event scal_device_scalars(sycl::queue &queue, std::int64_t n, const T *alpha, T *x,
+                                std::int64_t incx,
+                                const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        if (n <= 0) {
+            return;
+        }
+        const std::int64_t inc = std::abs(incx);
+        cgh.parallel_for(device_scalars_range(n), [=](sycl::id<1> id) {
+            const std::int64_t i = id[0];
+            if (i < n) {
+                x[i * inc] *= *alpha;
+            }
+        });
+    });
+}
+
+/** y := alpha * op(A) * x + beta * y for a column-major A, one work-item per
+ *  element of y. y is not read when beta is zero.
+**/
+template <typename T>
+sycl::event gemv_device_scalars(sycl::queue &queue, transpose trans, std::int64_t m,
+                                std::int64_t n, const T *alpha, const T *a, std::int64_t lda,
+                                const T *x, std::int64_t incx, const T *beta, T *y,
+                                std::int64_t incy,
+                                const std::vector<sycl::event> &dependencies) {
+    const bool trans_a = trans != transpose::nontrans;
+    const std::int64_t len_y = trans_a ? n : m;
+    const std::int64_t len_x = trans_a ? m : n;
+    // Distance between A(i, j) and A(i + 1, j), and between A(i, j) and
+    // A(i, j + 1), for op(A).
+    const std::int64_t row_step = trans_a ? lda : 1;
+    const std::int64_t col_step = trans_a ? 1 : lda;
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        if (len_y <= 0) {
+            return;
+        }
+        const std::int64_t x0 = vector_offset(len_x, incx);
+        const std::int64_t y0 = vector_offset(len_y, incy);
+        cgh.parallel_for(device_scalars_range(len_y), [=](sycl::id<1> id) {
+            const std::int64_t i = id[0];
+            if (i < len_y) {
+                T sum = T(0);
+                for (std::int64_t j = 0; j < len_x; ++j) {
+                    sum += a[i * row_step + j * col_step] * x[x0 + j * incx];
+                }
+                const T b = *beta;
+                T &y_elem = y[y0 + i * incy];
+                y_elem = (b == T(0)) ? *alpha * sum : *alpha * sum + b * y_elem;
+            }
+        });
+    });
+}
+
+/** C := alpha * acc + beta * C with alpha and beta read from device memory. **/
+template <typename T>
+struct device_scale_epilogue {
+    const T *alpha;
+    const T *beta;
+
+    template <typename CElemT>
+    void operator()(T acc, std::int64_t, std::int64_t, CElemT &c_elem) const {
+        const T b = *beta;
+        c_elem = (b == T(0)) ? *alpha * acc : *alpha * acc + b * c_elem;
+    }
+};
+
+/** Strided batched GEMM on the tuned kernels. portBLAS' own gemm cannot take
+ *  pointer scalars, so when tuning picks it the largest candidate that fits
+ *  the device is used instead. A row-major product is computed as the
+ *  column-major C^T = op(B)^T * op(A)^T.
+**/
+template <typename T>
+sycl::event gemm_device_scalars(sycl::queue &queue, bool column_major, transpose transa,
+                                transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                                const T *alpha, const T *a, std::int64_t lda,
+                                std::int64_t stride_a, const T *b, std::int64_t ldb,
+                                std::int64_t stride_b, const T *beta, T *c, std::int64_t ldc,
+                                std::int64_t stride_c, std::int64_t batch_size,
+                                const std::vector<sycl::event> &dependencies) {
+    if (!column_major) {
+        return gemm_device_scalars(queue, true, transb, transa, n, m, k, alpha, b, ldb, stride_b,
+                                   a, lda, stride_a, beta, c, ldc, stride_c, batch_size,
+                                   dependencies);
+    }
+    int config = get_gemm_config<T>(queue, transa, transb, m, n, k, batch_size);
+    if (config == 0) {
+        config = default_gemm_config<T>(queue.get_device());
+    }
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        if (m > 0 && n > 0 && batch_size > 0) {
+            launch_tuned_gemm<T>(config, cgh, transa, transb, m, n, k, a, lda, stride_a, b, ldb,
+                                 stride_b, c, ldc, stride_c, batch_size,
+                                 device_scale_epilogue<T>{ alpha, beta });
+        }
+    });
+}
+
+} // namespace detail
+} // namespace portblas
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _PORTBLAS_DEVICE_SCALARS_HPP_
@@ -0,0 +1,583 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _PORTBLAS_EXTENSION_KERNELS_HPP_
+#define _PORTBLAS_EXTENSION_KERNELS_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "portblas_common.hpp"
+#include "oneapi/mkl/types.hpp"
+
+// SYCL kernels for the BLAS-like extensions that portBLAS does not provide
+// (complex omatcopy/omatcopy2/omatadd, imatcopy, gemmt and gemm_vbatch).
+//
+// All kernels work on column-major data. Row-major callers swap the matrix
+// dimensions (and, for gemmt, the operands) before calling in, which is
+// equivalent to operating on the transposed column-major view.
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace portblas {
+namespace detail {
+
+// Edge of the square tiles staged through local memory. 16x16 work-groups
+// are supported by every device portBLAS targets.
+constexpr std::int64_t tile_dim = 16;
+// Tiles are stored with one element of padding per column so that reading a
+// tile along its other dimension does not map every work-item to one bank.
+constexpr std::int64_t tile_ld = tile_dim + 1;
+
+inline std::size_t round_up_to_tile(std::int64_t x) {
+    return static_cast<std::size_t>((x + tile_dim - 1) / tile_dim * tile_dim);
+}
+
+// Launch range covering a rows x cols matrix with one work-item per element.
+// Dimension 1 runs along the rows so that neighbouring work-items access
+// contiguous column-major memory.
+inline sycl::nd_range<2> tiled_range(std::int64_t rows, std::int64_t cols) {
+    return sycl::nd_range<2>(sycl::range<2>(round_up_to_tile(cols), round_up_to_tile(rows)),
+                             sycl::range<2>(tile_dim, tile_dim));
+}
+
+inline uplo flip_uplo(uplo upper_lower) {
+    return upper_lower == uplo::upper ? uplo::lower : uplo::upper;
+}
+
+template <typename T>
+inline T conj_if(bool do_conj, T val) {
+    return val;
+}
+
+template <typename T>
+inline std::complex<T> conj_if(bool do_conj, std::complex<T> val) {
+    return do_conj ? std::conj(val) : val;
+}
+
+/** B := alpha * op(A), with A an m x n matrix whose elements are stridea
+ *  apart within a column and lda apart between columns (omatcopy2 layout;
+ *  omatcopy uses unit strides).
+ *
+ *  Transposition reads a tile of A with coalesced loads, parks it in local
+ *  memory and writes it out transposed, again with coalesced stores.
+**/
+template <typename T, typename APtrT, typename BPtrT>
+void omatcopy_kernel(sycl::handler &cgh, transpose trans, std::int64_t m, std::int64_t n, T alpha,
+                     APtrT a, std::int64_t lda, std::int64_t stridea, BPtrT b, std::int64_t ldb,
+                     std::int64_t strideb) {
+    if (trans == transpose::nontrans) {
+        cgh.parallel_for(sycl::range<2>(n, m), [=](sycl::item<2> it) {
+            const std::int64_t col = it.get_id(0);
+            const std::int64_t row = it.get_id(1);
+            b[row * strideb + col * ldb] = alpha * a[row * stridea + col * lda];
+        });
+        return;
+    }
+
+    const bool do_conj = trans == transpose::conjtrans;
+    sycl::local_accessor<T, 1> tile(sycl::range<1>(tile_dim * tile_ld), cgh);
+    cgh.parallel_for(tiled_range(m, n), [=](sycl::nd_item<2> it) {
+        const std::int64_t l0 = it.get_local_id(0);
+        const std::int64_t l1 = it.get_local_id(1);
+        const std::int64_t row0 = it.get_group(1) * tile_dim;
+        const std::int64_t col0 = it.get_group(0) * tile_dim;
+
+        // tile[c * tile_ld + r] holds A(row0 + r, col0 + c).
+        if (row0 + l1 < m && col0 + l0 < n) {
+            tile[l0 * tile_ld + l1] = a[(row0 + l1) * stridea + (col0 + l0) * lda];
+        }
+        sycl::group_barrier(it.get_group());
+
+        // op(A) is n x m: B(col0 + l1, row0 + l0) = A(row0 + l0, col0 + l1).
+        if (col0 + l1 < n && row0 + l0 < m) {
+            b[(col0 + l1) * strideb + (row0 + l0) * ldb] =
+                alpha * conj_if(do_conj, tile[l1 * tile_ld + l0]);
+        }
+    });
+}
+
+/** C := alpha * op(A) + beta * op(B), with C an m x n matrix. Transposed
+ *  operands are staged through padded local-memory tiles.
+**/
+template <typename T, typename APtrT, typename BPtrT, typename CPtrT>
+void omatadd_kernel(sycl::handler &cgh, transpose transa, transpose transb, std::int64_t m,
+                    std::int64_t n, T alpha, APtrT a, std::int64_t lda, T beta, BPtrT b,
+                    std::int64_t ldb, CPtrT c, std::int64_t ldc) {
+    const bool trans_a = transa != transpose::nontrans;
+    const bool trans_b = transb != transpose::nontrans;
+    const bool conj_a = transa == transpose::conjtrans;
+    const bool conj_b = transb == transpose::conjtrans;
+    sycl::local_accessor<T, 1> a_tile(sycl::range<1>(tile_dim * tile_ld), cgh);
+    sycl::local_accessor<T, 1> b_tile(sycl::range<1>(tile_dim * tile_ld), cgh);
+    cgh.parallel_for(tiled_range(m, n), [=](sycl::nd_item<2> it) {
+        const std::int64_t l0 = it.get_local_id(0);
+        const std::int64_t l1 = it.get_local_id(1);
+        const std::int64_t row0 = it.get_group(1) * tile_dim;
+        const std::int64_t col0 = it.get_group(0) * tile_dim;
+
+        // For a transposed operand X (n x m), X(col0 + l1, row0 + l0) is
+        // op(X)(row0 + l0, col0 + l1) and is stored at tile[l1 * tile_ld + l0].
+        if (trans_a && col0 + l1 < n && row0 + l0 < m) {
+            a_tile[l1 * tile_ld + l0] = conj_if(conj_a, a[(col0 + l1) + (row0 + l0) * lda]);
+        }
+        if (trans_b && col0 + l1 < n && row0 + l0 < m) {
+            b_tile[l1 * tile_ld + l0] = conj_if(conj_b, b[(col0 + l1) + (row0 + l0) * ldb]);
+        }
+        sycl::group_barrier(it.get_group());
+
+        const std::int64_t row = row0 + l1;
+        const std::int64_t col = col0 + l0;
+        if (row < m && col < n) {
+            const T a_val = trans_a ? a_tile[l0 * tile_ld + l1] : a[row + col * lda];
+            const T b_val = trans_b ? b_tile[l0 * tile_ld + l1] : b[row + col * ldb];
+            c[row + col * ldc] = alpha * a_val + beta * b_val;
+        }
+    });
+}
+
+/** AB := alpha * AB for an m x n matrix, in place. **/
+template <typename T, typename ABPtrT>
+void imatscale_kernel(sycl::handler &cgh, std::int64_t m, std::int64_t n, T alpha, ABPtrT ab,
+                      std::int64_t ld) {
+    cgh.parallel_for(sycl::range<2>(n, m), [=](sycl::item<2> it) {
+        const std::int64_t col = it.get_id(0);
+        const std::int64_t row = it.get_id(1);
+        ab[row + col * ld] = alpha * ab[row + col * ld];
+    });
+}
+
+/** AB := alpha * op(AB) for a square n x n matrix, in place.
+ *
+ *  Work-group (I, J) with I <= J loads tiles (I, J) and (J, I), and after a
+ *  barrier writes each one back transposed into the other's position, so no
+ *  scratch memory is needed and every element is read and written once.
+**/
+template <typename T, typename ABPtrT>
+void imatcopy_square_kernel(sycl::handler &cgh, transpose trans, std::int64_t n, T alpha, ABPtrT ab,
+                            std::int64_t ld) {
+    const bool do_conj = trans == transpose::conjtrans;
+    sycl::local_accessor<T, 1> upper_tile(sycl::range<1>(tile_dim * tile_ld), cgh);
+    sycl::local_accessor<T, 1> lower_tile(sycl::range<1>(tile_dim * tile_ld), cgh);
+    cgh.parallel_for(tiled_range(n, n), [=](sycl::nd_item<2> it) {
+        const std::int64_t tile_row = it.get_group(1);
+        const std::int64_t tile_col = it.get_group(0);
+        // The strictly lower tiles are handled by their mirror work-group.
+        if (tile_row > tile_col) {
+            return;
+        }
+        const std::int64_t l0 = it.get_local_id(0);
+        const std::int64_t l1 = it.get_local_id(1);
+        const std::int64_t row0 = tile_row * tile_dim;
+        const std::int64_t col0 = tile_col * tile_dim;
+
+        // upper_tile[c * tile_ld + r] = AB(row0 + r, col0 + c)
+        // lower_tile[c * tile_ld + r] = AB(col0 + r, row0 + c)
+        if (row0 + l1 < n && col0 + l0 < n) {
+            upper_tile[l0 * tile_ld + l1] = ab[(row0 + l1) + (col0 + l0) * ld];
+        }
+        if (col0 + l1 < n && row0 + l0 < n) {
+            lower_tile[l0 * tile_ld + l1] = ab[(col0 + l1) + (row0 + l0) * ld];
+        }
+        sycl::group_barrier(it.get_group());
+
+        if (row0 + l1 < n && col0 + l0 < n) {
+            ab[(row0 + l1) + (col0 + l0) * ld] =
+                alpha * conj_if(do_conj, lower_tile[l1 * tile_ld + l0]);
+        }
+        if (tile_row != tile_col && col0 + l1 < n && row0 + l0 < n) {
+            ab[(col0 + l1) + (row0 + l0) * ld] =
+                alpha * conj_if(do_conj, upper_tile[l1 * tile_ld + l0]);
+        }
+    });
+}
+
+/** C := alpha * op(A) * op(B) + beta * C, updating only the upper or lower
+ *  triangle of the n x n matrix C.
+ *
+ *  Each work-group computes one tile of C from tile_dim-wide panels of op(A)
+ *  and op(B) staged in local memory. Work-groups whose tile lies entirely
+ *  outside the referenced triangle exit immediately, so roughly half of the
+ *  flops of the equivalent gemm are performed.
+**/
+template <typename T, typename APtrT, typename BPtrT, typename CPtrT>
+void gemmt_kernel(sycl::handler &cgh, uplo upper_lower, transpose transa, transpose transb,
+                  std::int64_t n, std::int64_t k, T alpha, APtrT a, std::int64_t lda, BPtrT b,
+                  std::int64_t ldb, T beta, CPtrT c, std::int64_t ldc) {
+    const bool upper = upper_lower == uplo::upper;
+    const bool trans_a = transa != transpose::nontrans;
+    const bool trans_b = transb != transpose::nontrans;
+    const bool conj_a = transa == transpose::conjtrans;
+    const bool conj_b = transb == transpose::conjtrans;
+    sycl::local_accessor<T, 1> a_tile(sycl::range<1>(tile_dim * tile_ld), cgh);
+    sycl::local_accessor<T, 1> b_tile(sycl::range<1>(tile_dim * tile_ld), cgh);
+    cgh.parallel_for(tiled_range(n, n), [=](sycl::nd_item<2> it) {
+        const std::int64_t row0 = it.get_group(1) * tile_dim;
+        const std::int64_t col0 = it.get_group(0) * tile_dim;
+        if (upper ? (row0 >= col0 + tile_dim) : (col0 >= row0 + tile_dim)) {
+            return;
+        }
+        const std::int64_t l0 = it.get_local_id(0);
+        const std::int64_t l1 = it.get_local_id(1);
+
+        T sum = T(0);
+        for (std::int64_t k0 = 0; k0 < k; k0 += tile_dim) {
+            // a_tile[kk * tile_ld + r] = op(A)(row0 + r, k0 + kk)
+            if (!trans_a) {
+                a_tile[l0 * tile_ld + l1] = (row0 + l1 < n && k0 + l0 < k)
+                                                ? a[(row0 + l1) + (k0 + l0) * lda]
+                                                : T(0);
+            }
+            else {
+                a_tile[l1 * tile_ld + l0] = (k0 + l1 < k && row0 + l0 < n)
+                                                ? conj_if(conj_a, a[(k0 + l1) + (row0 + l0) * lda])
+                                                : T(0);
+            }
+            // b_tile[c * tile_ld + kk] = op(B)(k0 + kk, col0 + c)
+            if (!trans_b) {
+                b_tile[l0 * tile_ld + l1] = (k0 + l1 < k && col0 + l0 < n)
+                                                ? b[(k0 + l1) + (col0 + l0) * ldb]
+                                                : T(0);
+            }
+            else {
+                b_tile[l1 * tile_ld + l0] = (col0 + l1 < n && k0 + l0 < k)
+                                                ? conj_if(conj_b, b[(col0 + l1) + (k0 + l0) * ldb])
+                                                : T(0);
+            }
+            sycl::group_barrier(it.get_group());
+
+            for (std::int64_t kk = 0; kk < tile_dim; ++kk) {
+                sum += a_tile[kk * tile_ld + l1] * b_tile[l0 * tile_ld + kk];
+            }
+            sycl::group_barrier(it.get_group());
+        }
+
+        const std::int64_t row = row0 + l1;
+        const std::int64_t col = col0 + l0;
+        if (row < n && col < n && (upper ? row <= col : row >= col)) {
+            const T c_old = (beta == T(0)) ? T(0) : beta * c[row + col * ldc];
+            c[row + col * ldc] = alpha * sum + c_old;
+        }
+    });
+}
+
+/** One GEMM of a variable-size batch, in column-major terms. */
+template <typename T>
+struct vbatch_entry {
+    std::int64_t m, n, k, lda, ldb, ldc;
+    const T *a;
+    const T *b;
+    T *c;
+};
+
+// Work-items per work-group of the variable-size batched GEMM.
+constexpr std::int64_t vbatch_wg_size = 64;
+
+/** C_i := alpha * op(A_i) * op(B_i) + beta * C_i for a variable-size batch.
+ *
+ *  Work-group g computes entries[offsets[g]] to entries[offsets[g + 1] - 1]
+ *  one after the other, with its work-items striding over the elements of
+ *  each C_i, so the host decides how the flops are spread over the groups.
+**/
+template <typename T>
+void gemm_vbatch_kernel(sycl::handler &cgh, transpose transa, transpose transb, T alpha, T beta,
+                        const vbatch_entry<T> *entries, const std::int64_t *offsets,
+                        std::int64_t num_groups) {
+    const bool trans_a = transa != transpose::nontrans;
+    const bool trans_b = transb != transpose::nontrans;
+    const bool conj_a = transa == transpose::conjtrans;
+    const bool conj_b = transb == transpose::conjtrans;
+    const sycl::nd_range<1> range(num_groups * vbatch_wg_size, vbatch_wg_size);
+    cgh.parallel_for(range, [=](sycl::nd_item<1> it) {
+        const std::int64_t g = it.get_group(0);
+        const std::int64_t lid = it.get_local_id(0);
+        for (std::int64_t e = offsets[g]; e < offsets[g + 1]; ++e) {
+            const vbatch_entry<T> entry = entries[e];
+            for (std::int64_t idx = lid; idx < entry.m * entry.n; idx += vbatch_wg_size) {
+                const std::int64_t row = idx % entry.m;
+                const std::int64_t col = idx / entry.m;
+                T sum = T(0);
+                for (std::int64_t p = 0; p < entry.k; ++p) {
+                    const T a_val = trans_a ? conj_if(conj_a, entry.a[p + row * entry.lda])
+                                            : entry.a[row + p * entry.lda];
+                    const T b_val = trans_b ? conj_if(conj_b, entry.b[col + p * entry.ldb])
+                                            : entry.b[p + col * entry.ldb];
+                    sum += a_val * b_val;
+                }
+                T &c_val = entry.c[row + col * entry.ldc];
+                c_val = alpha * sum + (beta == T(0) ? T(0) : beta * c_val);
+            }
+        }
+    });
+}
+
+// Host-side launchers. Each one takes column-major arguments; the buffer
+// overloads let the SYCL runtime track dependencies, the USM overloads
+// chain on the given events.
+
+template <typename T>
+void omatcopy2(sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, T alpha,
+               sycl::buffer<T, 1> &a, std::int64_t lda, std::int64_t stridea,
+               sycl::buffer<T, 1> &b, std::int64_t ldb, std::int64_t strideb) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read_write>(cgh);
+        if (m > 0 && n > 0) {
+            omatcopy_kernel(cgh, trans, m, n, alpha, a_acc, lda, stridea, b_acc, ldb, strideb);
+        }
+    });
+}
+
+template <typename T>
+sycl::event omatcopy2(sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, T alpha,
+                      const T *a, std::int64_t lda, std::int64_t stridea, T *b, std::int64_t ldb,
+                      std::int64_t strideb, const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        if (m > 0 && n > 0) {
+            omatcopy_kernel(cgh, trans, m, n, alpha, a, lda, stridea, b, ldb, strideb);
+        }
+    });
+}
+
+template <typename T>
+void omatadd(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+             std::int64_t n, T alpha, sycl::buffer<T, 1> &a, std::int64_t lda, T beta,
+             sycl::buffer<T, 1> &b, std::int64_t ldb, sycl::buffer<T, 1> &c, std::int64_t ldc) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c.template get_access<sycl::access::mode::read_write>(cgh);
+        if (m > 0 && n > 0) {
+            omatadd_kernel(cgh, transa, transb, m, n, alpha, a_acc, lda, beta, b_acc, ldb, c_acc,
+                           ldc);
+        }
+    });
+}
+
+template <typename T>
+sycl::event omatadd(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                    std::int64_t n, T alpha, const T *a, std::int64_t lda, T beta, const T *b,
+                    std::int64_t ldb, T *c, std::int64_t ldc,
+                    const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        if (m > 0 && n > 0) {
+            omatadd_kernel(cgh, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+        }
+    });
+}
+
+// In-place copies that can be done without scratch memory: a plain scaling
+// when the leading dimension is unchanged, or a square transposition.
+inline bool imatcopy_is_in_place(transpose trans, std::int64_t m, std::int64_t n,
+                                 std::int64_t lda, std::int64_t ldb) {
+    return lda == ldb && (trans == transpose::nontrans || m == n);
+}
+
+template <typename T>
+void imatcopy(sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, T alpha,
+              sycl::buffer<T, 1> &ab, std::int64_t lda, std::int64_t ldb) {
+    if (m == 0 || n == 0) {
+        return;
+    }
+    if (imatcopy_is_in_place(trans, m, n, lda, ldb)) {
+        queue.submit([&](sycl::handler &cgh) {
+            auto ab_acc = ab.template get_access<sycl::access::mode::read_write>(cgh);
+            if (trans == transpose::nontrans) {
+                imatscale_kernel(cgh, m, n, alpha, ab_acc, lda);
+            }
+            else {
+                imatcopy_square_kernel(cgh, trans, n, alpha, ab_acc, lda);
+            }
+        });
+        return;
+    }
+    // Rectangular transpositions and leading dimension changes go through a
+    // packed temporary: two bandwidth-bound passes instead of a serial
+    // cycle-following permutation. The temporary is USM freed by a host task,
+    // as a local buffer would block in its destructor until the copies finish.
+    const std::int64_t rows_b = (trans == transpose::nontrans) ? m : n;
+    const std::int64_t cols_b = (trans == transpose::nontrans) ? n : m;
+    auto tmp = sycl::malloc_device<T>(m * n, queue);
+    auto pack_event = queue.submit([&](sycl::handler &cgh) {
+        auto ab_acc = ab.template get_access<sycl::access::mode::read>(cgh);
+        omatcopy_kernel(cgh, trans, m, n, alpha, ab_acc, lda, std::int64_t(1), tmp, rows_b,
+                        std::int64_t(1));
+    });
+    auto unpack_event = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(pack_event);
+        auto ab_acc = ab.template get_access<sycl::access::mode::read_write>(cgh);
+        omatcopy_kernel(cgh, transpose::nontrans, rows_b, cols_b, T(1),
+                        static_cast<const T *>(tmp), rows_b, std::int64_t(1), ab_acc, ldb,
+                        std::int64_t(1));
+    });
+    free_scratch(queue, unpack_event, tmp);
+}
+
+template <typename T>
+sycl::event imatcopy(sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, T alpha,
+                     T *ab, std::int64_t lda, std::int64_t ldb,
+                     const std::vector<sycl::event> &dependencies) {
+    if (m == 0 || n == 0 || imatcopy_is_in_place(trans, m, n, lda, ldb)) {
+        return queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(dependencies);
+            if (m == 0 || n == 0) {
+                return;
+            }
+            if (trans == transpose::nontrans) {
+                imatscale_kernel(cgh, m, n, alpha, ab, lda);
+            }
+            else {
+                imatcopy_square_kernel(cgh, trans, n, alpha, ab, lda);
+            }
+        });
+    }
+    const std::int64_t rows_b = (trans == transpose::nontrans) ? m : n;
+    const std::int64_t cols_b = (trans == transpose::nontrans) ? n : m;
+    auto tmp = sycl::malloc_device<T>(m * n, queue);
+    auto pack_event = omatcopy2(queue, trans, m, n, alpha, static_cast<const T *>(ab), lda,
+                                std::int64_t(1), tmp, rows_b, std::int64_t(1), dependencies);
+    auto unpack_event =
+        omatcopy2(queue, transpose::nontrans, rows_b, cols_b, T(1), static_cast<const T *>(tmp),
+                  rows_b, std::int64_t(1), ab, ldb, std::int64_t(1), { pack_event });
+    return free_scratch(queue, unpack_event, tmp);
+}
+
+template <typename T>
+void gemmt(sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb,
+           std::int64_t n, std::int64_t k, T alpha, sycl::buffer<T, 1> &a, std::int64_t lda,
+           sycl::buffer<T, 1> &b, std::int64_t ldb, T beta, sycl::buffer<T, 1> &c,
+           std::int64_t ldc) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c.template get_access<sycl::access::mode::read_write>(cgh);
+        if (n > 0) {
+            gemmt_kernel(cgh, upper_lower, transa, transb, n, k, alpha, a_acc, lda, b_acc, ldb,
+                         beta, c_acc, ldc);
+        }
+    });
+}
+
+template <typename T>
+sycl::event gemmt(sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb,
+                  std::int64_t n, std::int64_t k, T alpha, const T *a, std::int64_t lda,
+                  const T *b, std::int64_t ldb, T beta, T *c, std::int64_t ldc,
+                  const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        if (n > 0) {
+            gemmt_kernel(cgh, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
+                         ldc);
+        }
+    });
+}
+
+/** Variable-size batched GEMM. The entries are spread over the work-groups
+ *  by estimated flops: taken largest first, each goes to the group with the
+ *  least work so far, so one large product does not hold up a work-group
+ *  while the others have finished. Row-major batches are computed as the
+ *  column-major product of the transposes.
+**/
+template <typename T>
+sycl::event gemm_vbatch(sycl::queue &queue, bool column_major, transpose transa,
+                        transpose transb, const std::int64_t *m, const std::int64_t *n,
+                        const std::int64_t *k, T alpha, const T **a, const std::int64_t *lda,
+                        const T **b, const std::int64_t *ldb, T beta, T **c,
+                        const std::int64_t *ldc, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    if (batch_size <= 0) {
+        return queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(dependencies);
+            cgh.host_task([]() {});
+        });
+    }
+    std::vector<double> cost(batch_size);
+    std::vector<std::int64_t> order(batch_size);
+    for (std::int64_t i = 0; i < batch_size; ++i) {
+        cost[i] = double(m[i]) * double(n[i]) * (double(k[i]) + 1.0);
+    }
+    std::iota(order.begin(), order.end(), std::int64_t(0));
+    std::stable_sort(order.begin(), order.end(),
+                     [&](std::int64_t x, std::int64_t y) { return cost[x] > cost[y]; });
+
+    const std::int64_t compute_units =
+        queue.get_device().template get_info<sycl::info::device::max_compute_units>();
+    const std::int64_t num_groups =
+        std::min(batch_size, 4 * std::max<std::int64_t>(compute_units, 1));
+    using load_t = std::pair<double, std::int64_t>;
+    std::priority_queue<load_t, std::vector<load_t>, std::greater<load_t>> loads;
+    for (std::int64_t g = 0; g < num_groups; ++g) {
+        loads.emplace(0.0, g);
+    }
+    std::vector<std::vector<std::int64_t>> bins(num_groups);
+    for (std::int64_t i : order) {
+        auto lightest = loads.top();
+        loads.pop();
+        bins[lightest.second].push_back(i);
+        loads.emplace(lightest.first + cost[i], lightest.second);
+    }
+
+    // The schedule is written on the host into shared memory and released
+    // once the kernel has completed.
+    auto entries = sycl::malloc_shared<vbatch_entry<T>>(batch_size, queue);
+    auto offsets = sycl::malloc_shared<std::int64_t>(num_groups + 1, queue);
+    std::int64_t pos = 0;
+    for (std::int64_t g = 0; g < num_groups; ++g) {
+        offsets[g] = pos;
+        for (std::int64_t i : bins[g]) {
+            entries[pos++] = column_major ? vbatch_entry<T>{ m[i], n[i], k[i], lda[i],
+                                                             ldb[i], ldc[i], a[i], b[i], c[i] }
+                                          : vbatch_entry<T>{ n[i], m[i], k[i], ldb[i],
+                                                             lda[i], ldc[i], b[i], a[i], c[i] };
+        }
+    }
+    offsets[num_groups] = pos;
+    if (!column_major) {
+        std::swap(transa, transb);
+    }
+
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        gemm_vbatch_kernel(cgh, transa, transb, alpha, beta, entries, offsets, num_groups);
+    });
+    return free_scratch(queue, done, entries, offsets);
+}
+
+} // namespace detail
+} // namespace portblas
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _PORTBLAS_EXTENSION_KERNELS_HPP_
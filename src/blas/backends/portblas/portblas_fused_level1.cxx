@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Buffer APIs
+
+void axpy_dot(sycl::queue &queue, std::int64_t n, real_t alpha, sycl::buffer<real_t, 1> &x,
+              std::int64_t incx, sycl::buffer<real_t, 1> &y, std::int64_t incy,
+              sycl::buffer<real_t, 1> &z, std::int64_t incz, sycl::buffer<real_t, 1> &result) {
+    detail::axpy_dot(queue, n, alpha, x, incx, y, incy, z, incz, result);
+}
+
+void dot2(sycl::queue &queue, std::int64_t n, sycl::buffer<real_t, 1> &x, std::int64_t incx,
+          sycl::buffer<real_t, 1> &y, std::int64_t incy, sycl::buffer<real_t, 1> &z,
+          std::int64_t incz, sycl::buffer<real_t, 1> &result) {
+    detail::dot2(queue, n, x, incx, y, incy, z, incz, result);
+}
+
+void axpby_nrm2(sycl::queue &queue, std::int64_t n, real_t alpha, sycl::buffer<real_t, 1> &x,
+                std::int64_t incx, real_t beta, sycl::buffer<real_t, 1> &y, std::int64_t incy,
+                sycl::buffer<real_t, 1> &result) {
+    detail::axpby_nrm2<real_t, real_t>(queue, n, alpha, x, incx, beta, y, incy, result);
+}
+
+void axpby_nrm2(sycl::queue &queue, std::int64_t n, std::complex<real_t> alpha,
+                sycl::buffer<std::complex<real_t>, 1> &x, std::int64_t incx,
+                std::complex<real_t> beta, sycl::buffer<std::complex<real_t>, 1> &y,
+                std::int64_t incy, sycl::buffer<real_t, 1> &result) {
+    detail::axpby_nrm2<std::complex<real_t>, real_t>(queue, n, alpha, x, incx, beta, y, incy,
+                                                     result);
+}
+
+void mdot(sycl::queue &queue, std::int64_t n, sycl::buffer<real_t, 1> &x, std::int64_t incx,
+          sycl::buffer<real_t, 1> &y, std::int64_t incy, std::int64_t stridey,
+          sycl::buffer<real_t, 1> &result, std::int64_t batch_size) {
+    detail::mdot(queue, n, x, incx, y, incy, stridey, result, batch_size);
+}
+
+// USM APIs
+
+sycl::event axpy_dot(sycl::queue &queue, std::int64_t n, real_t alpha, const real_t *x,
+                     std::int64_t incx, real_t *y, std::int64_t incy, const real_t *z,
+                     std::int64_t incz, real_t *result,
+                     const std::vector<sycl::event> &dependencies) {
+    return detail::axpy_dot(queue, n, alpha, x, incx, y, incy, z, incz, result, dependencies);
+}
+
+sycl::event dot2(sycl::queue &queue, std::int64_t n, const real_t *x, std::int64_t incx,
+                 const real_t *y, std::int64_t incy, const real_t *z, std::int64_t incz,
+                 real_t *result, const std::vector<sycl::event> &dependencies) {
+    return detail::dot2(queue, n, x, incx, y, incy, z, incz, result, dependencies);
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, std::int64_t n, real_t alpha, const real_t *x,
+                       std::int64_t incx, real_t beta, real_t *y, std::int64_t incy, real_t *result,
+                       const std::vector<sycl::event> &dependencies) {
+    return detail::axpby_nrm2<real_t, real_t>(queue, n, alpha, x, incx, beta, y, incy, result,
+                                              dependencies);
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, std::int64_t n, std::complex<real_t> alpha,
+                       const std::complex<real_t> *x, std::int64_t incx, std::complex<real_t> beta,
+                       std::complex<real_t> *y, std::int64_t incy, real_t *result,
+                       const std::vector<sycl::event> &dependencies) {
+    return detail::axpby_nrm2<std::complex<real_t>, real_t>(queue, n, alpha, x, incx, beta, y, incy,
+                                                            result, dependencies);
+}
+
+sycl::event mdot(sycl::queue &queue, std::int64_t n, const real_t *x, std::int64_t incx,
+                 const real_t *y, std::int64_t incy, std::int64_t stridey, real_t *result,
+                 std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return detail::mdot(queue, n, x, incx, y, incy, stridey, result, batch_size, dependencies);
+}
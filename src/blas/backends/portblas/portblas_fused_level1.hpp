@@ -0,0 +1,464 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _PORTBLAS_FUSED_LEVEL1_HPP_
+#define _PORTBLAS_FUSED_LEVEL1_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "portblas_common.hpp"
+
+// Fused level 1 routines for Krylov solvers (axpy_dot, dot2, axpby_nrm2 and
+// mdot). Each routine streams its vectors through memory once: a first
+// kernel applies the vector update and leaves one partial sum per
+// work-group and output in scratch, and a second kernel adds the partial
+// sums in group order. The second kernel only reads a few hundred scalars,
+// and the fixed order makes the results independent of scheduling.
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace portblas {
+namespace detail {
+
+// Work-items per work-group of the streaming kernels, and the bound on the
+// number of work-groups, which is also the number of partial sums per
+// output.
+constexpr std::int64_t fused_wg_size = 256;
+constexpr std::int64_t fused_max_groups = 256;
+
+inline std::int64_t fused_num_groups(sycl::queue &queue, std::int64_t n) {
+    const std::int64_t needed = (n + fused_wg_size - 1) / fused_wg_size;
+    // In reproducible mode the split of the vectors, and so the summation
+    // order, must not depend on the device.
+    if (oneapi::mkl::blas::is_reproducible()) {
+        return std::max<std::int64_t>(1, std::min(needed, fused_max_groups));
+    }
+    const std::int64_t compute_units =
+        queue.get_device().template get_info<sycl::info::device::max_compute_units>();
+    return std::max<std::int64_t>(
+        1, std::min({ needed, 4 * std::max<std::int64_t>(compute_units, 1), fused_max_groups }));
+}
+
+// Offset of the first element visited by a level 1 routine: with a negative
+// increment the vector is traversed from its last element backwards.
+inline std::int64_t vector_offset(std::int64_t n, std::int64_t inc) {
+    return inc < 0 ? (1 - n) * inc : 0;
+}
+
+template <typename T>
+inline T squared_magnitude(T val) {
+    return val * val;
+}
+
+template <typename T>
+inline T squared_magnitude(std::complex<T> val) {
+    return val.real() * val.real() + val.imag() * val.imag();
+}
+
+/** y := alpha * x + y; partial[g] := sum of y_i * z_i over the elements
+ *  handled by work-group g, using the updated y_i.
+**/
+template <typename T, typename XPtrT, typename YPtrT, typename ZPtrT, typename PPtrT>
+void axpy_dot_kernel(sycl::handler &cgh, std::int64_t n, T alpha, XPtrT x, std::int64_t incx,
+                     YPtrT y, std::int64_t incy, ZPtrT z, std::int64_t incz, PPtrT partial,
+                     std::int64_t num_groups) {
+    const std::int64_t x0 = vector_offset(n, incx);
+    const std::int64_t y0 = vector_offset(n, incy);
+    const std::int64_t z0 = vector_offset(n, incz);
+    const sycl::nd_range<1> range(num_groups * fused_wg_size, fused_wg_size);
+    cgh.parallel_for(range, [=](sycl::nd_item<1> it) {
+        T sum = T(0);
+        for (std::int64_t i = it.get_global_id(0); i < n; i += it.get_global_range(0)) {
+            const T y_elem = alpha * x[x0 + i * incx] + y[y0 + i * incy];
+            y[y0 + i * incy] = y_elem;
+            sum += y_elem * z[z0 + i * incz];
+        }
+        sum = sycl::reduce_over_group(it.get_group(), sum, sycl::plus<T>());
+        if (it.get_local_id(0) == 0) {
+            partial[it.get_group(0)] = sum;
+        }
+    });
+}
+
+/** partial[2 * g] and partial[2 * g + 1] := work-group g's share of x . y
+ *  and x . z, with each x_i loaded once for both products.
+**/
+template <typename T, typename XPtrT, typename YPtrT, typename ZPtrT, typename PPtrT>
+void dot2_kernel(sycl::handler &cgh, std::int64_t n, XPtrT x, std::int64_t incx, YPtrT y,
+                 std::int64_t incy, ZPtrT z, std::int64_t incz, PPtrT partial,
+                 std::int64_t num_groups) {
+    const std::int64_t x0 = vector_offset(n, incx);
+    const std::int64_t y0 = vector_offset(n, incy);
+    const std::int64_t z0 = vector_offset(n, incz);
+    const sycl::nd_range<1> range(num_groups * fused_wg_size, fused_wg_size);
+    cgh.parallel_for(range, [=](sycl::nd_item<1> it) {
+        T sum_y = T(0);
+        T sum_z = T(0);
+        for (std::int64_t i = it.get_global_id(0); i < n; i += it.get_global_range(0)) {
+            const T x_elem = x[x0 + i * incx];
+            sum_y += x_elem * y[y0 + i * incy];
+            sum_z += x_elem * z[z0 + i * incz];
+        }
+        sum_y = sycl::reduce_over_group(it.get_group(), sum_y, sycl::plus<T>());
+        sum_z = sycl::reduce_over_group(it.get_group(), sum_z, sycl::plus<T>());
+        if (it.get_local_id(0) == 0) {
+            partial[2 * it.get_group(0)] = sum_y;
+            partial[2 * it.get_group(0) + 1] = sum_z;
+        }
+    });
+}
+
+/** y := alpha * x + beta * y; partial[g] := sum of |y_i|^2 over the elements
+ *  handled by work-group g. Like portBLAS nrm2 the squares are summed
+ *  without scaling.
+**/
+template <typename T, typename R, typename XPtrT, typename YPtrT, typename PPtrT>
+void axpby_nrm2_kernel(sycl::handler &cgh, std::int64_t n, T alpha, XPtrT x, std::int64_t incx,
+                       T beta, YPtrT y, std::int64_t incy, PPtrT partial,
+                       std::int64_t num_groups) {
+    const std::int64_t x0 = vector_offset(n, incx);
+    const std::int64_t y0 = vector_offset(n, incy);
+    const sycl::nd_range<1> range(num_groups * fused_wg_size, fused_wg_size);
+    cgh.parallel_for(range, [=](sycl::nd_item<1> it) {
+        R sum = R(0);
+        for (std::int64_t i = it.get_global_id(0); i < n; i += it.get_global_range(0)) {
+            const T y_elem = alpha * x[x0 + i * incx] + beta * y[y0 + i * incy];
+            y[y0 + i * incy] = y_elem;
+            sum += squared_magnitude(y_elem);
+        }
+        sum = sycl::reduce_over_group(it.get_group(), sum, sycl::plus<R>());
+        if (it.get_local_id(0) == 0) {
+            partial[it.get_group(0)] = sum;
+        }
+    });
+}
+
+/** partial[g * batch_size + j] := work-group g's share of x . y_j, where
+ *  y_j = y + j * stridey. Every work-item visits the same elements of x for
+ *  all the y_j, so x is read from memory once and then served from cache.
+**/
+template <typename T, typename XPtrT, typename YPtrT, typename PPtrT>
+void mdot_kernel(sycl::handler &cgh, std::int64_t n, XPtrT x, std::int64_t incx, YPtrT y,
+                 std::int64_t incy, std::int64_t stridey, PPtrT partial, std::int64_t batch_size,
+                 std::int64_t num_groups) {
+    const std::int64_t x0 = vector_offset(n, incx);
+    const std::int64_t y0 = vector_offset(n, incy);
+    const sycl::nd_range<1> range(num_groups * fused_wg_size, fused_wg_size);
+    cgh.parallel_for(range, [=](sycl::nd_item<1> it) {
+        for (std::int64_t j = 0; j < batch_size; ++j) {
+            T sum = T(0);
+            for (std::int64_t i = it.get_global_id(0); i < n; i += it.get_global_range(0)) {
+                sum += x[x0 + i * incx] * y[y0 + j * stridey + i * incy];
+            }
+            sum = sycl::reduce_over_group(it.get_group(), sum, sycl::plus<T>());
+            if (it.get_local_id(0) == 0) {
+                partial[it.get_group(0) * batch_size + j] = sum;
+            }
+        }
+    });
+}
+
+/** partial[g] := sum of elem(i) over the elements handled by work-group g.
+ *  Runs the level 1 reductions (dot, asum, nrm2) in reproducible mode.
+**/
+template <typename R, typename ElemFn, typename PPtrT>
+void reduce_kernel(sycl::handler &cgh, std::int64_t n, ElemFn elem, PPtrT partial,
+                   std::int64_t num_groups) {
+    const sycl::nd_range<1> range(num_groups * fused_wg_size, fused_wg_size);
+    cgh.parallel_for(range, [=](sycl::nd_item<1> it) {
+        R sum = R(0);
+        for (std::int64_t i = it.get_global_id(0); i < n; i += it.get_global_range(0)) {
+            sum += elem(i);
+        }
+        sum = sycl::reduce_over_group(it.get_group(), sum, sycl::plus<R>());
+        if (it.get_local_id(0) == 0) {
+            partial[it.get_group(0)] = sum;
+        }
+    });
+}
+
+/** result[s] := sum over g of partial[g * num_sums + s], in group order,
+ *  followed by a square root for norms.
+**/
+template <typename R, typename PPtrT, typename ResultPtrT>
+void fused_reduce_kernel(sycl::handler &cgh, PPtrT partial, std::int64_t num_groups,
+                         std::int64_t num_sums, bool take_sqrt, ResultPtrT result) {
+    cgh.parallel_for(sycl::range<1>(num_sums), [=](sycl::id<1> idx) {
+        const std::int64_t s = idx[0];
+        R sum = R(0);
+        for (std::int64_t g = 0; g < num_groups; ++g) {
+            sum += partial[g * num_sums + s];
+        }
+        result[s] = take_sqrt ? sycl::sqrt(sum) : sum;
+    });
+}
+
+// Host-side launchers. launch(cgh, partial) submits the streaming kernel,
+// creating any accessors it needs on cgh; the partial sums are then reduced
+// into result.
+
+template <typename R, typename LaunchFn>
+void fused_level1(sycl::queue &queue, std::int64_t num_groups, std::int64_t num_sums,
+                  bool take_sqrt, sycl::buffer<R, 1> &result, LaunchFn launch) {
+    sycl::buffer<R, 1> partial{ sycl::range<1>(num_groups * num_sums) };
+    queue.submit([&](sycl::handler &cgh) {
+        auto partial_acc = partial.template get_access<sycl::access::mode::discard_write>(cgh);
+        launch(cgh, partial_acc);
+    });
+    queue.submit([&](sycl::handler &cgh) {
+        auto partial_acc = partial.template get_access<sycl::access::mode::read>(cgh);
+        auto result_acc = result.template get_access<sycl::access::mode::write>(cgh);
+        fused_reduce_kernel<R>(cgh, partial_acc, num_groups, num_sums, take_sqrt, result_acc);
+    });
+}
+
+template <typename R, typename LaunchFn>
+sycl::event fused_level1(sycl::queue &queue, std::int64_t num_groups, std::int64_t num_sums,
+                         bool take_sqrt, R *result, const std::vector<sycl::event> &dependencies,
+                         LaunchFn launch) {
+    R *partial = sycl::malloc_device<R>(num_groups * num_sums, queue);
+    auto partial_event = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        launch(cgh, partial);
+    });
+    auto reduce_event = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(partial_event);
+        fused_reduce_kernel<R>(cgh, static_cast<const R *>(partial), num_groups, num_sums,
+                               take_sqrt, result);
+    });
+    return free_scratch(queue, reduce_event, partial);
+}
+
+template <typename T>
+void axpy_dot(sycl::queue &queue, std::int64_t n, T alpha, sycl::buffer<T, 1> &x,
+              std::int64_t incx, sycl::buffer<T, 1> &y, std::int64_t incy, sycl::buffer<T, 1> &z,
+              std::int64_t incz, sycl::buffer<T, 1> &result) {
+    const std::int64_t num_groups = fused_num_groups(queue, n);
+    fused_level1(queue, num_groups, 1, false, result, [&](sycl::handler &cgh, auto partial) {
+        auto x_acc = x.template get_access<sycl::access::mode::read>(cgh);
+        auto y_acc = y.template get_access<sycl::access::mode::read_write>(cgh);
+        auto z_acc = z.template get_access<sycl::access::mode::read>(cgh);
+        axpy_dot_kernel(cgh, n, alpha, x_acc, incx, y_acc, incy, z_acc, incz, partial,
+                        num_groups);
+    });
+}
+
+template <typename T>
+sycl::event axpy_dot(sycl::queue &queue, std::int64_t n, T alpha, const T *x, std::int64_t incx,
+                     T *y, std::int64_t incy, const T *z, std::int64_t incz, T *result,
+                     const std::vector<sycl::event> &dependencies) {
+    const std::int64_t num_groups = fused_num_groups(queue, n);
+    return fused_level1(queue, num_groups, 1, false, result, dependencies,
+                        [&](sycl::handler &cgh, T *partial) {
+                            axpy_dot_kernel(cgh, n, alpha, x, incx, y, incy, z, incz, partial,
+                                            num_groups);
+                        });
+}
+
+template <typename T>
+void dot2(sycl::queue &queue, std::int64_t n, sycl::buffer<T, 1> &x, std::int64_t incx,
+          sycl::buffer<T, 1> &y, std::int64_t incy, sycl::buffer<T, 1> &z, std::int64_t incz,
+          sycl::buffer<T, 1> &result) {
+    const std::int64_t num_groups = fused_num_groups(queue, n);
+    fused_level1(queue, num_groups, 2, false, result, [&](sycl::handler &cgh, auto partial) {
+        auto x_acc = x.template get_access<sycl::access::mode::read>(cgh);
+        auto y_acc = y.template get_access<sycl::access::mode::read>(cgh);
+        auto z_acc = z.template get_access<sycl::access::mode::read>(cgh);
+        dot2_kernel<T>(cgh, n, x_acc, incx, y_acc, incy, z_acc, incz, partial, num_groups);
+    });
+}
+
+template <typename T>
+sycl::event dot2(sycl::queue &queue, std::int64_t n, const T *x, std::int64_t incx, const T *y,
+                 std::int64_t incy, const T *z, std::int64_t incz, T *result,
+                 const std::vector<sycl::event> &dependencies) {
+    const std::int64_t num_groups = fused_num_groups(queue, n);
+    return fused_level1(queue, num_groups, 2, false, result, dependencies,
+                        [&](sycl::handler &cgh, T *partial) {
+                            dot2_kernel<T>(cgh, n, x, incx, y, incy, z, incz, partial,
+                                           num_groups);
+                        });
+}
+
+template <typename T, typename R>
+void axpby_nrm2(sycl::queue &queue, std::int64_t n, T alpha, sycl::buffer<T, 1> &x,
+                std::int64_t incx, T beta, sycl::buffer<T, 1> &y, std::int64_t incy,
+                sycl::buffer<R, 1> &result) {
+    const std::int64_t num_groups = fused_num_groups(queue, n);
+    fused_level1(queue, num_groups, 1, true, result, [&](sycl::handler &cgh, auto partial) {
+        auto x_acc = x.template get_access<sycl::access::mode::read>(cgh);
+        auto y_acc = y.template get_access<sycl::access::mode::read_write>(cgh);
+        axpby_nrm2_kernel<T, R>(cgh, n, alpha, x_acc, incx, beta, y_acc, incy, partial,
+                                num_groups);
+    });
+}
+
+template <typename T, typename R>
+sycl::event axpby_nrm2(sycl::queue &queue, std::int64_t n, T alpha, const T *x, std::int64_t incx,
+                       T beta, T *y, std::int64_t incy, R *result,
+                       const std::vector<sycl::event> &dependencies) {
+    const std::int64_t num_groups = fused_num_groups(queue, n);
+    return fused_level1(queue, num_groups, 1, true, result, dependencies,
+                        [&](sycl::handler &cgh, R *partial) {
+                            axpby_nrm2_kernel<T, R>(cgh, n, alpha, x, incx, beta, y, incy,
+                                                    partial, num_groups);
+                        });
+}
+
+template <typename T>
+void mdot(sycl::queue &queue, std::int64_t n, sycl::buffer<T, 1> &x, std::int64_t incx,
+          sycl::buffer<T, 1> &y, std::int64_t incy, std::int64_t stridey,
+          sycl::buffer<T, 1> &result, std::int64_t batch_size) {
+    if (batch_size <= 0) {
+        return;
+    }
+    const std::int64_t num_groups = fused_num_groups(queue, n);
+    fused_level1(queue, num_groups, batch_size, false, result,
+                 [&](sycl::handler &cgh, auto partial) {
+                     auto x_acc = x.template get_access<sycl::access::mode::read>(cgh);
+                     auto y_acc = y.template get_access<sycl::access::mode::read>(cgh);
+                     mdot_kernel<T>(cgh, n, x_acc, incx, y_acc, incy, stridey, partial,
+                                    batch_size, num_groups);
+                 });
+}
+
+template <typename T>
+sycl::event mdot(sycl::queue &queue, std::int64_t n, const T *x, std::int64_t incx, const T *y,
+                 std::int64_t incy, std::int64_t stridey, T *result, std::int64_t batch_size,
+                 const std::vector<sycl::event> &dependencies) {
+    if (batch_size <= 0) {
+        return queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(dependencies);
+            cgh.host_task([]() {});
+        });
+    }
+    const std::int64_t num_groups = fused_num_groups(queue, n);
+    return fused_level1(queue, num_groups, batch_size, false, result, dependencies,
+                        [&](sycl::handler &cgh, T *partial) {
+                            mdot_kernel<T>(cgh, n, x, incx, y, incy, stridey, partial,
+                                           batch_size, num_groups);
+                        });
+}
+
+// Level 1 reductions with a fixed summation order, used instead of portBLAS'
+// dot, asum and nrm2 in reproducible mode. Like portBLAS nrm2, the squares are
+// summed without scaling.
+
+template <typename T>
+void reproducible_dot(sycl::queue &queue, std::int64_t n, sycl::buffer<T, 1> &x,
+                      std::int64_t incx, sycl::buffer<T, 1> &y, std::int64_t incy,
+                      sycl::buffer<T, 1> &result) {
+    const std::int64_t num_groups = fused_num_groups(queue, n);
+    const std::int64_t x0 = vector_offset(n, incx);
+    const std::int64_t y0 = vector_offset(n, incy);
+    fused_level1(queue, num_groups, 1, false, result, [&](sycl::handler &cgh, auto partial) {
+        auto x_acc = x.template get_access<sycl::access::mode::read>(cgh);
+        auto y_acc = y.template get_access<sycl::access::mode::read>(cgh);
+        reduce_kernel<T>(
+            cgh, n,
+            [=](std::int64_t i) { return x_acc[x0 + i * incx] * y_acc[y0 + i * incy]; },
+            partial, num_groups);
+    });
+}
+
+template <typename T>
+sycl::event reproducible_dot(sycl::queue &queue, std::int64_t n, const T *x, std::int64_t incx,
+                             const T *y, std::int64_t incy, T *result,
+                             const std::vector<sycl::event> &dependencies) {
+    const std::int64_t num_groups = fused_num_groups(queue, n);
+    const std::int64_t x0 = vector_offset(n, incx);
+    const std::int64_t y0 = vector_offset(n, incy);
+    return fused_level1(
+        queue, num_groups, 1, false, result, dependencies, [&](sycl::handler &cgh, T *partial) {
+            reduce_kernel<T>(
+                cgh, n, [=](std::int64_t i) { return x[x0 + i * incx] * y[y0 + i * incy]; },
+                partial, num_groups);
+        });
+}
+
+template <typename T>
+void reproducible_asum(sycl::queue &queue, std::int64_t n, sycl::buffer<T, 1> &x,
+                       std::int64_t incx, sycl::buffer<T, 1> &result) {
+    const std::int64_t num_groups = fused_num_groups(queue, n);
+    const std::int64_t inc = std::abs(incx);
+    fused_level1(queue, num_groups, 1, false, result, [&](sycl::handler &cgh, auto partial) {
+        auto x_acc = x.template get_access<sycl::access::mode::read>(cgh);
+        reduce_kernel<T>(
+            cgh, n, [=](std::int64_t i) { return sycl::fabs(x_acc[i * inc]); }, partial,
+            num_groups);
+    });
+}
+
+template <typename T>
+sycl::event reproducible_asum(sycl::queue &queue, std::int64_t n, const T *x, std::int64_t incx,
+                              T *result, const std::vector<sycl::event> &dependencies) {
+    const std::int64_t num_groups = fused_num_groups(queue, n);
+    const std::int64_t inc = std::abs(incx);
+    return fused_level1(queue, num_groups, 1, false, result, dependencies,
+                        [&](sycl::handler &cgh, T *partial) {
+                            reduce_kernel<T>(
+                                cgh, n, [=](std::int64_t i) { return sycl::fabs(x[i * inc]); },
+                                partial, num_groups);
+                        });
+}
+
+template <typename T>
+void reproducible_nrm2(sycl::queue &queue, std::int64_t n, sycl::buffer<T, 1> &x,
+                       std::int64_t incx, sycl::buffer<T, 1> &result) {
+    const std::int64_t num_groups = fused_num_groups(queue, n);
+    const std::int64_t inc = std::abs(incx);
+    fused_level1(queue, num_groups, 1, true, result, [&](sycl::handler &cgh, auto partial) {
+        auto x_acc = x.template get_access<sycl::access::mode::read>(cgh);
+        reduce_kernel<T>(
+            cgh, n, [=](std::int64_t i) { return squared_magnitude(x_acc[i * inc]); }, partial,
+            num_groups);
+    });
+}
+
+template <typename T>
+sycl::event reproducible_nrm2(sycl::queue &queue, std::int64_t n, const T *x, std::int64_t incx,
+                              T *result, const std::vector<sycl::event> &dependencies) {
+    const std::int64_t num_groups = fused_num_groups(queue, n);
+    const std::int64_t inc = std::abs(incx);
+    return fused_level1(
+        queue, num_groups, 1, true, result, dependencies, [&](sycl::handler &cgh, T *partial) {
+            reduce_kernel<T>(
+                cgh, n, [=](std::int64_t i) { return squared_magnitude(x[i * inc]); }, partial,
+                num_groups);
+        });
+}
+
+} // namespace detail
+} // namespace portblas
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _PORTBLAS_FUSED_LEVEL1_HPP_
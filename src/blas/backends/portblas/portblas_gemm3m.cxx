@@ -0,0 +1,49 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Complex GEMM by the 3M method, see portblas_gemm3m.hpp.
+
+void gemm3m(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<real_t> alpha,
+            sycl::buffer<std::complex<real_t>, 1> &a, std::int64_t lda,
+            sycl::buffer<std::complex<real_t>, 1> &b, std::int64_t ldb, std::complex<real_t> beta,
+            sycl::buffer<std::complex<real_t>, 1> &c, std::int64_t ldc) {
+    if constexpr (is_column_major()) {
+        detail::gemm3m(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+    else {
+        detail::gemm3m(queue, transb, transa, n, m, k, alpha, b, ldb, a, lda, beta, c, ldc);
+    }
+}
+
+sycl::event gemm3m(sycl::queue &queue, oneapi::mkl::transpose transa,
+                   oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                   std::complex<real_t> alpha, const std::complex<real_t> *a, std::int64_t lda,
+                   const std::complex<real_t> *b, std::int64_t ldb, std::complex<real_t> beta,
+                   std::complex<real_t> *c, std::int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    if constexpr (is_column_major()) {
+        return detail::gemm3m(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                              dependencies);
+    }
+    else {
+        return detail::gemm3m(queue, transb, transa, n, m, k, alpha, b, ldb, a, lda, beta, c, ldc,
+                              dependencies);
+    }
+}
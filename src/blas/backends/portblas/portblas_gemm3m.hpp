@@ -0,0 +1,212 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _PORTBLAS_GEMM3M_HPP_
+#define _PORTBLAS_GEMM3M_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#include "portblas_gemm_tuning.hpp"
+#include "oneapi/mkl/types.hpp"
+
+// Complex GEMM with the 3M method for the portBLAS backend.
+//
+// With A = Ar + i*Ai and B = Br + i*Bi,
+//   T1 = Ar * Br,  T2 = Ai * Bi,  T3 = (Ar + Ai) * (Br + Bi)
+//   A * B = (T1 - T2) + i * (T3 - T1 - T2)
+// so the product takes three real GEMMs instead of the four of the direct
+// method. A first kernel splits each operand into consecutive real panels
+// [re, im, re + im], conjugating it on the way for conjtrans. The panels of
+// A and B, and the three products, are then exactly one strided batch of
+// three for the tuned real GEMM kernel. A last kernel combines the products
+// and applies alpha and beta. Matrices are column-major; row-major callers
+// transpose the problem.
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace portblas {
+namespace detail {
+
+/** Splits the rows x cols column-major matrix x into the panels re, im and
+ *  re + im, each rows x cols with leading dimension rows, stored one after
+ *  the other in panels.
+**/
+template <typename R, typename XPtrT, typename PanelPtrT>
+void gemm3m_split_kernel(sycl::handler &cgh, XPtrT x, std::int64_t ldx, std::int64_t rows,
+                         std::int64_t cols, bool conj, PanelPtrT panels) {
+    const std::int64_t panel_size = rows * cols;
+    cgh.parallel_for(sycl::range<2>(cols, rows), [=](sycl::item<2> item) {
+        const std::int64_t i = item[1];
+        const std::int64_t j = item[0];
+        const std::complex<R> value = x[i + j * ldx];
+        const R re = value.real();
+        const R im = conj ? -value.imag() : value.imag();
+        const std::int64_t idx = i + j * rows;
+        panels[idx] = re;
+        panels[panel_size + idx] = im;
+        panels[2 * panel_size + idx] = re + im;
+    });
+}
+
+/** C := alpha * ((T1 - T2) + i * (T3 - T1 - T2)) + beta * C, with the m x n
+ *  products T1, T2 and T3 stored one after the other in t. C is not read when
+ *  beta is zero. With has_product false (k = 0) t is not read either.
+**/
+template <typename R, typename TPtrT, typename CPtrT>
+void gemm3m_combine_kernel(sycl::handler &cgh, std::int64_t m, std::int64_t n,
+                           std::complex<R> alpha, std::complex<R> beta, TPtrT t, bool has_product,
+                           CPtrT c, std::int64_t ldc) {
+    const std::int64_t size = m * n;
+    cgh.parallel_for(sycl::range<2>(n, m), [=](sycl::item<2> item) {
+        const std::int64_t i = item[1];
+        const std::int64_t j = item[0];
+        std::complex<R> prod(0);
+        if (has_product) {
+            const std::int64_t idx = i + j * m;
+            const R t1 = t[idx];
+            const R t2 = t[size + idx];
+            const R t3 = t[2 * size + idx];
+            prod = std::complex<R>(t1 - t2, t3 - t1 - t2);
+        }
+        std::complex<R> &c_elem = c[i + j * ldc];
+        c_elem = (beta == std::complex<R>(0)) ? alpha * prod : alpha * prod + beta * c_elem;
+    });
+}
+
+inline transpose gemm3m_real_trans(transpose trans) {
+    return (trans == transpose::nontrans) ? transpose::nontrans : transpose::trans;
+}
+
+template <typename R>
+int gemm3m_config(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                  std::int64_t n, std::int64_t k) {
+    int config = get_gemm_config<R>(queue, gemm3m_real_trans(transa), gemm3m_real_trans(transb),
+                                    m, n, k, 3);
+    return config ? config : default_gemm_config<R>(queue.get_device());
+}
+
+/** Column-major C := alpha * op(A) * op(B) + beta * C by the 3M method. **/
+template <typename R>
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+            std::int64_t n, std::int64_t k, std::complex<R> alpha,
+            sycl::buffer<std::complex<R>, 1> &a, std::int64_t lda,
+            sycl::buffer<std::complex<R>, 1> &b, std::int64_t ldb, std::complex<R> beta,
+            sycl::buffer<std::complex<R>, 1> &c, std::int64_t ldc) {
+    if (m <= 0 || n <= 0) {
+        return;
+    }
+    const bool has_product = k > 0 && alpha != std::complex<R>(0);
+    const std::int64_t a_rows = (transa == transpose::nontrans) ? m : k;
+    const std::int64_t a_cols = (transa == transpose::nontrans) ? k : m;
+    const std::int64_t b_rows = (transb == transpose::nontrans) ? k : n;
+    const std::int64_t b_cols = (transb == transpose::nontrans) ? n : k;
+    const std::int64_t a_size = m * k;
+    const std::int64_t b_size = k * n;
+    sycl::buffer<R, 1> a_panels{ sycl::range<1>(has_product ? 3 * a_size : 1) };
+    sycl::buffer<R, 1> b_panels{ sycl::range<1>(has_product ? 3 * b_size : 1) };
+    sycl::buffer<R, 1> t{ sycl::range<1>(has_product ? 3 * m * n : 1) };
+    if (has_product) {
+        queue.submit([&](sycl::handler &cgh) {
+            auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+            auto panels_acc = a_panels.template get_access<sycl::access::mode::discard_write>(cgh);
+            gemm3m_split_kernel<R>(cgh, a_acc, lda, a_rows, a_cols,
+                                   transa == transpose::conjtrans, panels_acc);
+        });
+        queue.submit([&](sycl::handler &cgh) {
+            auto b_acc = b.template get_access<sycl::access::mode::read>(cgh);
+            auto panels_acc = b_panels.template get_access<sycl::access::mode::discard_write>(cgh);
+            gemm3m_split_kernel<R>(cgh, b_acc, ldb, b_rows, b_cols,
+                                   transb == transpose::conjtrans, panels_acc);
+        });
+        tuned_gemm(queue, gemm3m_config<R>(queue, transa, transb, m, n, k),
+                   gemm3m_real_trans(transa), gemm3m_real_trans(transb), m, n, k, R(1), a_panels,
+                   a_rows, a_size, b_panels, b_rows, b_size, R(0), t, m, m * n, 3);
+    }
+    queue.submit([&](sycl::handler &cgh) {
+        auto t_acc = t.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c.template get_access<sycl::access::mode::read_write>(cgh);
+        gemm3m_combine_kernel<R>(cgh, m, n, alpha, beta, t_acc, has_product, c_acc, ldc);
+    });
+}
+
+template <typename R>
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                   std::int64_t n, std::int64_t k, std::complex<R> alpha,
+                   const std::complex<R> *a, std::int64_t lda, const std::complex<R> *b,
+                   std::int64_t ldb, std::complex<R> beta, std::complex<R> *c, std::int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    if (m <= 0 || n <= 0) {
+        return queue.submit([&](sycl::handler &cgh) { cgh.depends_on(dependencies); });
+    }
+    if (k <= 0 || alpha == std::complex<R>(0)) {
+        return queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(dependencies);
+            gemm3m_combine_kernel<R>(cgh, m, n, alpha, beta, static_cast<const R *>(nullptr),
+                                     false, c, ldc);
+        });
+    }
+    const std::int64_t a_rows = (transa == transpose::nontrans) ? m : k;
+    const std::int64_t a_cols = (transa == transpose::nontrans) ? k : m;
+    const std::int64_t b_rows = (transb == transpose::nontrans) ? k : n;
+    const std::int64_t b_cols = (transb == transpose::nontrans) ? n : k;
+    const std::int64_t a_size = m * k;
+    const std::int64_t b_size = k * n;
+    // One allocation holds the panels of A, the panels of B and the products.
+    R *scratch = sycl::malloc_device<R>(3 * (a_size + b_size + m * n), queue);
+    R *a_panels = scratch;
+    R *b_panels = a_panels + 3 * a_size;
+    R *t = b_panels + 3 * b_size;
+    auto split_a_event = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        gemm3m_split_kernel<R>(cgh, a, lda, a_rows, a_cols,
+                               transa == transpose::conjtrans, a_panels);
+    });
+    auto split_b_event = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        gemm3m_split_kernel<R>(cgh, b, ldb, b_rows, b_cols,
+                               transb == transpose::conjtrans, b_panels);
+    });
+    auto products_event = tuned_gemm(
+        queue, gemm3m_config<R>(queue, transa, transb, m, n, k), gemm3m_real_trans(transa),
+        gemm3m_real_trans(transb), m, n, k, R(1), static_cast<const R *>(a_panels), a_rows, a_size,
+        static_cast<const R *>(b_panels), b_rows, b_size, R(0), t, m, m * n, 3,
+        { split_a_event, split_b_event });
+    auto combine_event = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(products_event);
+        gemm3m_combine_kernel<R>(cgh, m, n, alpha, beta, static_cast<const R *>(t), true, c, ldc);
+    });
+    return free_scratch(queue, combine_event, scratch);
+}
+
+} // namespace detail
+} // namespace portblas
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _PORTBLAS_GEMM3M_HPP_
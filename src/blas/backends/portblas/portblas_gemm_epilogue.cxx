@@ -0,0 +1,192 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Buffer APIs
+
+void gemm_epilogue(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+                   oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+                   float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
+                   sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+                   oneapi::mkl::activation act, float clamp_min, float clamp_max) {
+    if constexpr (is_column_major()) {
+        detail::fused_gemm(queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb,
+                           beta, c, ldc, bias, act, clamp_min, clamp_max);
+    }
+    else {
+        detail::fused_gemm(queue, transb, transa, detail::transposed_offset(offset_bias), n, m, k,
+                           alpha, b, ldb, a, lda, beta, c, ldc, bias, act, clamp_min, clamp_max);
+    }
+}
+
+void gemm_epilogue(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+                   oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+                   float alpha, sycl::buffer<sycl::half, 1> &a, std::int64_t lda,
+                   sycl::buffer<sycl::half, 1> &b, std::int64_t ldb, float beta,
+                   sycl::buffer<sycl::half, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+                   oneapi::mkl::activation act, float clamp_min, float clamp_max) {
+    if constexpr (is_column_major()) {
+        detail::fused_gemm(queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb,
+                           beta, c, ldc, bias, act, clamp_min, clamp_max);
+    }
+    else {
+        detail::fused_gemm(queue, transb, transa, detail::transposed_offset(offset_bias), n, m, k,
+                           alpha, b, ldb, a, lda, beta, c, ldc, bias, act, clamp_min, clamp_max);
+    }
+}
+
+void gemm_epilogue(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+                   oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+                   float alpha, sycl::buffer<sycl::half, 1> &a, std::int64_t lda,
+                   sycl::buffer<sycl::half, 1> &b, std::int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+                   oneapi::mkl::activation act, float clamp_min, float clamp_max) {
+    if constexpr (is_column_major()) {
+        detail::fused_gemm(queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb,
+                           beta, c, ldc, bias, act, clamp_min, clamp_max);
+    }
+    else {
+        detail::fused_gemm(queue, transb, transa, detail::transposed_offset(offset_bias), n, m, k,
+                           alpha, b, ldb, a, lda, beta, c, ldc, bias, act, clamp_min, clamp_max);
+    }
+}
+
+void gemm_epilogue(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+                   oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+                   float alpha, sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                   sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta,
+                   sycl::buffer<bfloat16, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+                   oneapi::mkl::activation act, float clamp_min, float clamp_max) {
+    if constexpr (is_column_major()) {
+        detail::fused_gemm(queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb,
+                           beta, c, ldc, bias, act, clamp_min, clamp_max);
+    }
+    else {
+        detail::fused_gemm(queue, transb, transa, detail::transposed_offset(offset_bias), n, m, k,
+                           alpha, b, ldb, a, lda, beta, c, ldc, bias, act, clamp_min, clamp_max);
+    }
+}
+
+void gemm_epilogue(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+                   oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+                   float alpha, sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                   sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+                   oneapi::mkl::activation act, float clamp_min, float clamp_max) {
+    if constexpr (is_column_major()) {
+        detail::fused_gemm(queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb,
+                           beta, c, ldc, bias, act, clamp_min, clamp_max);
+    }
+    else {
+        detail::fused_gemm(queue, transb, transa, detail::transposed_offset(offset_bias), n, m, k,
+                           alpha, b, ldb, a, lda, beta, c, ldc, bias, act, clamp_min, clamp_max);
+    }
+}
+
+// USM APIs
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+    const float *a, std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c,
+    std::int64_t ldc, const float *bias, oneapi::mkl::activation act, float clamp_min,
+    float clamp_max, const std::vector<sycl::event> &dependencies) {
+    if constexpr (is_column_major()) {
+        return detail::fused_gemm(queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b,
+                                  ldb, beta, c, ldc, bias, act, clamp_min, clamp_max,
+                                  dependencies);
+    }
+    else {
+        return detail::fused_gemm(queue, transb, transa, detail::transposed_offset(offset_bias),
+                                  n, m, k, alpha, b, ldb, a, lda, beta, c, ldc, bias, act,
+                                  clamp_min, clamp_max, dependencies);
+    }
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+    const sycl::half *a, std::int64_t lda, const sycl::half *b, std::int64_t ldb, float beta,
+    sycl::half *c, std::int64_t ldc, const float *bias, oneapi::mkl::activation act,
+    float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies) {
+    if constexpr (is_column_major()) {
+        return detail::fused_gemm(queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b,
+                                  ldb, beta, c, ldc, bias, act, clamp_min, clamp_max,
+                                  dependencies);
+    }
+    else {
+        return detail::fused_gemm(queue, transb, transa, detail::transposed_offset(offset_bias),
+                                  n, m, k, alpha, b, ldb, a, lda, beta, c, ldc, bias, act,
+                                  clamp_min, clamp_max, dependencies);
+    }
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+    const sycl::half *a, std::int64_t lda, const sycl::half *b, std::int64_t ldb, float beta,
+    float *c, std::int64_t ldc, const float *bias, oneapi::mkl::activation act, float clamp_min,
+    float clamp_max, const std::vector<sycl::event> &dependencies) {
+    if constexpr (is_column_major()) {
+        return detail::fused_gemm(queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b,
+                                  ldb, beta, c, ldc, bias, act, clamp_min, clamp_max,
+                                  dependencies);
+    }
+    else {
+        return detail::fused_gemm(queue, transb, transa, detail::transposed_offset(offset_bias),
+                                  n, m, k, alpha, b, ldb, a, lda, beta, c, ldc, bias, act,
+                                  clamp_min, clamp_max, dependencies);
+    }
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+    const bfloat16 *a, std::int64_t lda, const bfloat16 *b, std::int64_t ldb, float beta,
+    bfloat16 *c, std::int64_t ldc, const float *bias, oneapi::mkl::activation act, float clamp_min,
+    float clamp_max, const std::vector<sycl::event> &dependencies) {
+    if constexpr (is_column_major()) {
+        return detail::fused_gemm(queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b,
+                                  ldb, beta, c, ldc, bias, act, clamp_min, clamp_max,
+                                  dependencies);
+    }
+    else {
+        return detail::fused_gemm(queue, transb, transa, detail::transposed_offset(offset_bias),
+                                  n, m, k, alpha, b, ldb, a, lda, beta, c, ldc, bias, act,
+                                  clamp_min, clamp_max, dependencies);
+    }
+}
+
+sycl::event gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+    const bfloat16 *a, std::int64_t lda, const bfloat16 *b, std::int64_t ldb, float beta, float *c,
+    std::int64_t ldc, const float *bias, oneapi::mkl::activation act, float clamp_min,
+    float clamp_max, const std::vector<sycl::event> &dependencies) {
+    if constexpr (is_column_major()) {
+        return detail::fused_gemm(queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b,
+                                  ldb, beta, c, ldc, bias, act, clamp_min, clamp_max,
+                                  dependencies);
+    }
+    else {
+        return detail::fused_gemm(queue, transb, transa, detail::transposed_offset(offset_bias),
+                                  n, m, k, alpha, b, ldb, a, lda, beta, c, ldc, bias, act,
+                                  clamp_min, clamp_max, dependencies);
+    }
+}
@@ -0,0 +1,151 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _PORTBLAS_GEMM_EPILOGUE_HPP_
+#define _PORTBLAS_GEMM_EPILOGUE_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <cstdint>
+#include <vector>
+
+#include "portblas_gemm_tuning.hpp"
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace portblas {
+namespace detail {
+
+inline float apply_activation(activation act, float x) {
+    switch (act) {
+        case activation::relu: return x > 0.0f ? x : 0.0f;
+        case activation::gelu: return 0.5f * x * (1.0f + sycl::erf(x * 0.70710678f));
+        case activation::sigmoid: return 1.0f / (1.0f + sycl::exp(-x));
+        default: return x;
+    }
+}
+
+/** C := clamp(act(alpha * acc + beta * C + bias)), applied to each result of
+ *  the tiled GEMM kernel before it is stored, so C is read and written once.
+**/
+template <typename BiasPtrT>
+struct activation_epilogue {
+    float alpha;
+    float beta;
+    offset offset_bias;
+    BiasPtrT bias;
+    activation act;
+    float clamp_min;
+    float clamp_max;
+
+    template <typename CElemT>
+    void operator()(float acc, std::int64_t row, std::int64_t col, CElemT &c_elem) const {
+        float v = alpha * acc;
+        if (beta != 0.0f) {
+            v += beta * static_cast<float>(c_elem);
+        }
+        if (offset_bias == offset::fix) {
+            v += bias[0];
+        }
+        else {
+            v += bias[offset_bias == offset::column ? row : col];
+        }
+        v = apply_activation(act, v);
+        // Comparisons rather than fmin/fmax, so that NaNs are propagated.
+        if (v < clamp_min) {
+            v = clamp_min;
+        }
+        if (v > clamp_max) {
+            v = clamp_max;
+        }
+        c_elem = static_cast<CElemT>(v);
+    }
+};
+
+// Per-row bias of a row-major problem is per-column bias of the column-major
+// problem it is computed as, and vice versa.
+inline offset transposed_offset(offset offset_bias) {
+    if (offset_bias == offset::column) {
+        return offset::row;
+    }
+    if (offset_bias == offset::row) {
+        return offset::column;
+    }
+    return offset::fix;
+}
+
+/** Column-major GEMM with a fused bias, activation and clamp epilogue. A and B
+ *  are converted to float as they are loaded and products are accumulated in
+ *  float; the result is converted to the type of C when it is stored.
+**/
+template <typename TA, typename TC>
+void fused_gemm(sycl::queue &queue, transpose transa, transpose transb, offset offset_bias,
+                std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                sycl::buffer<TA, 1> &a, std::int64_t lda, sycl::buffer<TA, 1> &b,
+                std::int64_t ldb, float beta, sycl::buffer<TC, 1> &c, std::int64_t ldc,
+                sycl::buffer<float, 1> &bias, activation act, float clamp_min, float clamp_max) {
+    const int config = default_gemm_config<float>(queue.get_device());
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c.template get_access<sycl::access::mode::read_write>(cgh);
+        auto bias_acc = bias.template get_access<sycl::access::mode::read>(cgh);
+        if (m > 0 && n > 0) {
+            launch_tuned_gemm<float>(
+                config, cgh, transa, transb, m, n, k, a_acc, lda, 0, b_acc, ldb, 0, c_acc, ldc, 0,
+                1,
+                activation_epilogue<decltype(bias_acc)>{ alpha, beta, offset_bias, bias_acc, act,
+                                                         clamp_min, clamp_max });
+        }
+    });
+}
+
+template <typename TA, typename TC>
+sycl::event fused_gemm(sycl::queue &queue, transpose transa, transpose transb,
+                       offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+                       float alpha, const TA *a, std::int64_t lda, const TA *b, std::int64_t ldb,
+                       float beta, TC *c, std::int64_t ldc, const float *bias, activation act,
+                       float clamp_min, float clamp_max,
+                       const std::vector<sycl::event> &dependencies) {
+    const int config = default_gemm_config<float>(queue.get_device());
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        if (m > 0 && n > 0) {
+            launch_tuned_gemm<float>(config, cgh, transa, transb, m, n, k, a, lda, 0, b, ldb, 0,
+                                     c, ldc, 0, 1,
+                                     activation_epilogue<const float *>{
+                                         alpha, beta, offset_bias, bias, act, clamp_min,
+                                         clamp_max });
+        }
+    });
+}
+
+} // namespace detail
+} // namespace portblas
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _PORTBLAS_GEMM_EPILOGUE_HPP_
@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Buffer APIs
+
+std::int64_t sgemm_pack_get_size(sycl::queue &queue, gemm_pack_matrix identifier, std::int64_t m,
+                                 std::int64_t n, std::int64_t k) {
+    throw unimplemented("blas", "sgemm_pack_get_size", "");
+}
+
+std::int64_t dgemm_pack_get_size(sycl::queue &queue, gemm_pack_matrix identifier, std::int64_t m,
+                                 std::int64_t n, std::int64_t k) {
+    throw unimplemented("blas", "dgemm_pack_get_size", "");
+}
+
+void gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, std::int64_t m,
+               std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &src,
+               std::int64_t ld, sycl::buffer<float, 1> &dest) {
+    throw unimplemented("blas", "gemm_pack", "");
+}
+
+void gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans, std::int64_t m,
+               std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &src,
+               std::int64_t ld, sycl::buffer<double, 1> &dest) {
+    throw unimplemented("blas", "gemm_pack", "");
+}
+
+void gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa, transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<float, 1> &a,
+                  std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                  sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    throw unimplemented("blas", "gemm_compute", "");
+}
+
+void gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa, transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<double, 1> &a,
+                  std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+                  sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    throw unimplemented("blas", "gemm_compute", "");
+}
+
+// USM APIs
+
+sycl::event gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans,
+                      std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *src,
+                      std::int64_t ld, float *dest, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_pack", " for USM");
+}
+
+sycl::event gemm_pack(sycl::queue &queue, gemm_pack_matrix identifier, transpose trans,
+                      std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                      const double *src, std::int64_t ld, double *dest,
+                      const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_pack", " for USM");
+}
+
+sycl::event gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa,
+                         transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                         const float *a, std::int64_t lda, const float *b, std::int64_t ldb,
+                         float beta, float *c, std::int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_compute", " for USM");
+}
+
+sycl::event gemm_compute(sycl::queue &queue, gemm_pack_matrix packed, transpose transa,
+                         transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                         const double *a, std::int64_t lda, const double *b, std::int64_t ldb,
+                         double beta, double *c, std::int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_compute", " for USM");
+}
@@ -0,0 +1,226 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _PORTBLAS_GEMM_SPLIT_K_HPP_
+#define _PORTBLAS_GEMM_SPLIT_K_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "portblas_gemm_tuning.hpp"
+#include "oneapi/mkl/types.hpp"
+
+// Split-K GEMM for the portBLAS backend.
+//
+// When m and n are small and k is long, a tiled GEMM has only a few
+// work-groups, each running a long serial loop over k, and most of the
+// device is idle. Split-K cuts k into equal chunks that are multiplied
+// concurrently, as a strided batch of the tuned GEMM kernel, into scratch
+// copies of C. A second kernel sums the copies in chunk order, adds the
+// few trailing k indices that did not fill a chunk and applies alpha and
+// beta. No atomics are involved, so results are reproducible from run to
+// run on a device.
+//
+//   ONEMKL_PORTBLAS_GEMM_SPLIT_K=off            never split
+//   ONEMKL_PORTBLAS_GEMM_SPLIT_K=deterministic  choose the number of chunks
+//                                               from the shape alone, so
+//                                               results do not depend on the
+//                                               device either
+//   otherwise                                   size the split to the number
+//                                               of compute units, or as
+//                                               deterministic in
+//                                               reproducible mode
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace portblas {
+namespace detail {
+
+enum class gemm_split_k_mode { off, automatic, deterministic };
+
+constexpr std::int64_t gemm_split_k_min_chunk = 1024;
+constexpr std::int64_t gemm_split_k_deterministic_chunk = 8192;
+constexpr std::int64_t gemm_split_k_max_parts = 256;
+// Bound on the scratch space, in elements of C.
+constexpr std::int64_t gemm_split_k_max_scratch = std::int64_t(1) << 24;
+
+inline gemm_split_k_mode get_gemm_split_k_mode() {
+    static const gemm_split_k_mode mode = [] {
+        const char *env = std::getenv("ONEMKL_PORTBLAS_GEMM_SPLIT_K");
+        if (env == nullptr) {
+            return gemm_split_k_mode::automatic;
+        }
+        const std::string value(env);
+        if (value == "off" || value == "0") {
+            return gemm_split_k_mode::off;
+        }
+        if (value == "deterministic") {
+            return gemm_split_k_mode::deterministic;
+        }
+        return gemm_split_k_mode::automatic;
+    }();
+    return mode;
+}
+
+/** Returns the number of chunks to split k into, or 1 to run a plain GEMM.
+ *  Only shapes where k dominates both m and n are split; the others have
+ *  enough tiles of C to fill the device.
+**/
+template <typename T>
+std::int64_t gemm_split_k_parts(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t k) {
+    gemm_split_k_mode mode = get_gemm_split_k_mode();
+    if (mode == gemm_split_k_mode::automatic && oneapi::mkl::blas::is_reproducible()) {
+        mode = gemm_split_k_mode::deterministic;
+    }
+    if (mode == gemm_split_k_mode::off || m <= 0 || n <= 0 || k < 2 * gemm_split_k_min_chunk ||
+        k < 8 * std::max(m, n)) {
+        return 1;
+    }
+    const sycl::device device = queue.get_device();
+    if (std::is_same_v<T, double> && !device.has(sycl::aspect::fp64)) {
+        return 1;
+    }
+    std::int64_t parts;
+    if (mode == gemm_split_k_mode::deterministic) {
+        parts = k / gemm_split_k_deterministic_chunk;
+    }
+    else {
+        // Aim for a few work-groups per compute unit.
+        const gemm_config &cfg = gemm_candidates[default_gemm_config<T>(device)];
+        const std::int64_t tile = cfg.wg_dim * cfg.item_dim;
+        const std::int64_t tiles = ((m + tile - 1) / tile) * ((n + tile - 1) / tile);
+        const std::int64_t target =
+            4 * std::int64_t(device.get_info<sycl::info::device::max_compute_units>());
+        parts = std::min((target + tiles - 1) / tiles, k / gemm_split_k_min_chunk);
+    }
+    parts = std::min(parts, gemm_split_k_max_parts);
+    parts = std::min(parts, gemm_split_k_max_scratch / (m * n));
+    return std::max<std::int64_t>(parts, 1);
+}
+
+/** Sums the column-major m x n partial products in scratch, adds
+ *  op(A) * op(B) over k indices [tail_begin, k) and stores
+ *  C := alpha * sum + beta * C. For real types only.
+**/
+template <typename T, typename APtrT, typename BPtrT, typename ScratchPtrT, typename CPtrT>
+void gemm_split_k_reduce_kernel(sycl::handler &cgh, transpose transa, transpose transb,
+                                std::int64_t m, std::int64_t n, std::int64_t k,
+                                std::int64_t parts, std::int64_t tail_begin, T alpha, APtrT a,
+                                std::int64_t lda, BPtrT b, std::int64_t ldb, ScratchPtrT scratch,
+                                T beta, CPtrT c, std::int64_t ldc) {
+    const bool trans_a = transa != transpose::nontrans;
+    const bool trans_b = transb != transpose::nontrans;
+    cgh.parallel_for(sycl::range<2>(n, m), [=](sycl::item<2> it) {
+        const std::int64_t i = it.get_id(1);
+        const std::int64_t j = it.get_id(0);
+        T sum = T(0);
+        for (std::int64_t p = 0; p < parts; ++p) {
+            sum += scratch[p * m * n + i + j * m];
+        }
+        for (std::int64_t kk = tail_begin; kk < k; ++kk) {
+            const T a_ik = trans_a ? a[kk + i * lda] : a[i + kk * lda];
+            const T b_kj = trans_b ? b[j + kk * ldb] : b[kk + j * ldb];
+            sum += a_ik * b_kj;
+        }
+        auto &c_elem = c[i + j * ldc];
+        c_elem = (beta == T(0)) ? alpha * sum : alpha * sum + beta * c_elem;
+    });
+}
+
+// Distance between consecutive k indices of op(A) and op(B), column major.
+inline std::int64_t split_k_step_a(transpose transa, std::int64_t lda) {
+    return (transa == transpose::nontrans) ? lda : 1;
+}
+
+inline std::int64_t split_k_step_b(transpose transb, std::int64_t ldb) {
+    return (transb == transpose::nontrans) ? 1 : ldb;
+}
+
+/** Column-major C := alpha * op(A) * op(B) + beta * C with k split into
+ *  parts chunks, see gemm_split_k_parts.
+**/
+template <typename T>
+void gemm_split_k(sycl::queue &queue, std::int64_t parts, transpose transa, transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, T alpha, sycl::buffer<T, 1> &a,
+                  std::int64_t lda, sycl::buffer<T, 1> &b, std::int64_t ldb, T beta,
+                  sycl::buffer<T, 1> &c, std::int64_t ldc) {
+    const int config = default_gemm_config<T>(queue.get_device());
+    const std::int64_t chunk = k / parts;
+    sycl::buffer<T, 1> scratch{ sycl::range<1>(parts * m * n) };
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read>(cgh);
+        auto scratch_acc = scratch.template get_access<sycl::access::mode::discard_write>(cgh);
+        launch_tuned_gemm<T>(config, cgh, transa, transb, m, n, chunk, a_acc, lda,
+                             chunk * split_k_step_a(transa, lda), b_acc, ldb,
+                             chunk * split_k_step_b(transb, ldb), scratch_acc, m, m * n, parts,
+                             scale_epilogue<T>{ T(1), T(0) });
+    });
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read>(cgh);
+        auto scratch_acc = scratch.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c.template get_access<sycl::access::mode::read_write>(cgh);
+        gemm_split_k_reduce_kernel(cgh, transa, transb, m, n, k, parts, parts * chunk, alpha,
+                                   a_acc, lda, b_acc, ldb, scratch_acc, beta, c_acc, ldc);
+    });
+}
+
+template <typename T>
+sycl::event gemm_split_k(sycl::queue &queue, std::int64_t parts, transpose transa,
+                         transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, T alpha,
+                         const T *a, std::int64_t lda, const T *b, std::int64_t ldb, T beta, T *c,
+                         std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    const int config = default_gemm_config<T>(queue.get_device());
+    const std::int64_t chunk = k / parts;
+    T *scratch = sycl::malloc_device<T>(parts * m * n, queue);
+    auto partials_event = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        launch_tuned_gemm<T>(config, cgh, transa, transb, m, n, chunk, a, lda,
+                             chunk * split_k_step_a(transa, lda), b, ldb,
+                             chunk * split_k_step_b(transb, ldb), scratch, m, m * n, parts,
+                             scale_epilogue<T>{ T(1), T(0) });
+    });
+    auto reduce_event = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(partials_event);
+        gemm_split_k_reduce_kernel(cgh, transa, transb, m, n, k, parts, parts * chunk, alpha, a,
+                                   lda, b, ldb, static_cast<const T *>(scratch), beta, c, ldc);
+    });
+    return free_scratch(queue, reduce_event, scratch);
+}
+
+} // namespace detail
+} // namespace portblas
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _PORTBLAS_GEMM_SPLIT_K_HPP_
@@ -0,0 +1,177 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <random>
+
+#include "portblas_gemm_tuning.hpp"
+#include "portblas_gemm_tuning_cache.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace portblas {
+namespace detail {
+
+namespace {
+
+std::string cache_path() {
+    if (const char *path = std::getenv("ONEMKL_PORTBLAS_GEMM_TUNING_CACHE")) {
+        return path;
+    }
+    if (const char *home = std::getenv("HOME")) {
+        return std::string(home) + "/.onemkl_portblas_gemm_tuning";
+    }
+    return ".onemkl_portblas_gemm_tuning";
+}
+
+// In-memory copy of the cache file, loaded on first use.
+class gemm_tuning_cache {
+public:
+    bool lookup(const std::string &key, int &config) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        load();
+        auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            return false;
+        }
+        config = it->second;
+        return true;
+    }
+
+    void store(const std::string &key, int config) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        load();
+        entries_[key] = config;
+        persist();
+    }
+
+private:
+    // Other processes may write the file at the same time. The entries they
+    // added since it was loaded are merged in, and the result is written to a
+    // temporary file renamed over the cache, so that a reader never sees a
+    // partly written file. Failing to persist the result only costs a
+    // benchmark in the next process, so write errors are not reported.
+    void persist() {
+        std::map<std::string, int> merged;
+        {
+            std::ifstream in(path_);
+            if (in) {
+                read_gemm_tuning_cache(in, num_gemm_candidates, merged);
+            }
+        }
+        for (const auto &entry : entries_) {
+            merged[entry.first] = entry.second;
+        }
+        entries_ = merged;
+
+        const std::string tmp_path = path_ + ".tmp" + std::to_string(std::random_device{}());
+        {
+            std::ofstream out(tmp_path, std::ios::trunc);
+            if (!out) {
+                return;
+            }
+            write_gemm_tuning_cache(out, entries_);
+            out.close();
+            if (!out) {
+                std::remove(tmp_path.c_str());
+                return;
+            }
+        }
+        if (std::rename(tmp_path.c_str(), path_.c_str()) != 0) {
+            std::remove(tmp_path.c_str());
+        }
+    }
+
+    void load() {
+        if (loaded_) {
+            return;
+        }
+        loaded_ = true;
+        path_ = cache_path();
+        std::ifstream in(path_);
+        if (in) {
+            read_gemm_tuning_cache(in, num_gemm_candidates, entries_);
+        }
+    }
+
+    std::mutex mutex_;
+    bool loaded_ = false;
+    std::string path_;
+    std::map<std::string, int> entries_;
+};
+
+gemm_tuning_cache &get_cache() {
+    static gemm_tuning_cache cache;
+    return cache;
+}
+
+} // namespace
+
+gemm_tuning_mode get_gemm_tuning_mode() {
+    static const gemm_tuning_mode mode = [] {
+        const char *env = std::getenv("ONEMKL_PORTBLAS_GEMM_TUNING");
+        if (env == nullptr) {
+            return gemm_tuning_mode::off;
+        }
+        const std::string value(env);
+        if (value == "online" || value == "1") {
+            return gemm_tuning_mode::online;
+        }
+        if (value == "offline") {
+            return gemm_tuning_mode::offline;
+        }
+        return gemm_tuning_mode::off;
+    }();
+    return mode;
+}
+
+std::string gemm_tuning_key(const sycl::device &device, const char *type_name, transpose transa,
+                            transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                            std::int64_t batch_size) {
+    // Whitespace in the device name would break the line format of the cache.
+    std::string device_id = device.get_info<sycl::info::device::name>() + "/" +
+                            device.get_info<sycl::info::device::driver_version>();
+    for (auto &ch : device_id) {
+        if (ch == ' ' || ch == '\t' || ch == '\n') {
+            ch = '_';
+        }
+    }
+    return device_id + '|' +
+           gemm_tuning_shape_key(type_name, transa == transpose::nontrans ? 'n' : 't',
+                                 transb == transpose::nontrans ? 'n' : 't', m, n, k, batch_size);
+}
+
+bool lookup_gemm_config(const std::string &key, int &config) {
+    return get_cache().lookup(key, config);
+}
+
+void store_gemm_config(const std::string &key, int config) {
+    get_cache().store(key, config);
+}
+
+} // namespace detail
+} // namespace portblas
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
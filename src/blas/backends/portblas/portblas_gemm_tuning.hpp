@@ -0,0 +1,490 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _PORTBLAS_GEMM_TUNING_HPP_
+#define _PORTBLAS_GEMM_TUNING_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "portblas_common.hpp"
+#include "portblas_extension_kernels.hpp"
+#include "oneapi/mkl/types.hpp"
+
+// Run-time selection of GEMM kernel configurations for the portBLAS backend.
+//
+// portBLAS fixes its GEMM tile configuration when the backend is built, from
+// PORTBLAS_TUNING_TARGET. Devices without a dedicated target (notably CPU
+// OpenCL devices) get generic configurations. When tuning is enabled with
+// ONEMKL_PORTBLAS_GEMM_TUNING, gemm and strided gemm_batch benchmark a set of
+// candidate kernels for the current device the first time a shape class is
+// seen, and reuse the fastest one afterwards. Results are persisted to an
+// on-disk cache so later processes skip the benchmark.
+//
+//   ONEMKL_PORTBLAS_GEMM_TUNING=online   benchmark unknown shape classes
+//   ONEMKL_PORTBLAS_GEMM_TUNING=offline  only use configurations from the cache
+//   ONEMKL_PORTBLAS_GEMM_TUNING_CACHE    cache file path (default:
+//                                        $HOME/.onemkl_portblas_gemm_tuning)
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace portblas {
+namespace detail {
+
+enum class gemm_tuning_mode { off, offline, online };
+
+/** A tiled GEMM kernel configuration. Each work-group of wg_dim x wg_dim
+ *  work-items computes a (wg_dim * item_dim)^2 tile of C, each work-item a
+ *  strided item_dim x item_dim block of it. With double_buffer the next
+ *  k-slab is loaded into local memory while the current one is consumed.
+**/
+struct gemm_config {
+    int wg_dim;
+    int item_dim;
+    bool double_buffer;
+};
+
+// Candidate 0 stands for portBLAS' own gemm, which is also the answer
+// whenever tuning is disabled. The index of a candidate is what gets stored
+// in the cache, so entries may only be appended to this list; changing
+// existing ones requires bumping the cache version in
+// portblas_gemm_tuning_cache.hpp.
+inline constexpr gemm_config gemm_candidates[] = {
+    { 0, 0, false }, { 8, 2, false }, { 8, 4, false },
+    { 8, 4, true },  { 16, 2, true }, { 16, 4, true },
+};
+inline constexpr int num_gemm_candidates = sizeof(gemm_candidates) / sizeof(gemm_config);
+
+gemm_tuning_mode get_gemm_tuning_mode();
+
+std::string gemm_tuning_key(const sycl::device &device, const char *type_name, transpose transa,
+                            transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                            std::int64_t batch_size);
+
+bool lookup_gemm_config(const std::string &key, int &config);
+
+void store_gemm_config(const std::string &key, int config);
+
+template <typename T>
+constexpr const char *gemm_type_name() {
+    if constexpr (std::is_same_v<T, float>) {
+        return "s";
+    }
+    else {
+        return "d";
+    }
+}
+
+/** Computes op(A) * op(B) for batch_size column-major problems strided by
+ *  stride_a/stride_b/stride_c, using the given tile configuration. Operands
+ *  are converted to T as they are loaded and products are accumulated in T.
+ *  Each result is handed to epilogue(acc, row, col, c_elem) while it is
+ *  still in registers; the epilogue is responsible for updating c_elem.
+**/
+template <int WgDim, int ItemDim, bool DoubleBuffer, typename T, typename APtrT, typename BPtrT,
+          typename CPtrT, typename EpilogueT>
+void tuned_gemm_kernel(sycl::handler &cgh, transpose transa, transpose transb, std::int64_t m,
+                       std::int64_t n, std::int64_t k, APtrT a, std::int64_t lda,
+                       std::int64_t stride_a, BPtrT b, std::int64_t ldb, std::int64_t stride_b,
+                       CPtrT c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+                       EpilogueT epilogue) {
+    constexpr std::int64_t tile = WgDim * ItemDim;
+    constexpr std::int64_t slab = WgDim;
+    // a_local[kk * a_ld + r] = op(A)(row0 + r, k0 + kk)
+    // b_local[c * b_ld + kk] = op(B)(k0 + kk, col0 + c)
+    constexpr std::int64_t a_ld = tile + 1;
+    constexpr std::int64_t b_ld = slab + 1;
+    constexpr std::int64_t a_size = slab * a_ld;
+    constexpr std::int64_t b_size = tile * b_ld;
+    constexpr std::int64_t num_buffers = DoubleBuffer ? 2 : 1;
+
+    const bool trans_a = transa != transpose::nontrans;
+    const bool trans_b = transb != transpose::nontrans;
+    const bool conj_a = transa == transpose::conjtrans;
+    const bool conj_b = transb == transpose::conjtrans;
+    sycl::local_accessor<T, 1> a_local(sycl::range<1>(num_buffers * a_size), cgh);
+    sycl::local_accessor<T, 1> b_local(sycl::range<1>(num_buffers * b_size), cgh);
+
+    const std::size_t groups_m = (m + tile - 1) / tile;
+    const std::size_t groups_n = (n + tile - 1) / tile;
+    const sycl::nd_range<3> range(
+        sycl::range<3>(batch_size, groups_n * WgDim, groups_m * WgDim),
+        sycl::range<3>(1, WgDim, WgDim));
+
+    cgh.parallel_for(range, [=](sycl::nd_item<3> it) {
+        const std::int64_t batch = it.get_global_id(0);
+        const std::int64_t l0 = it.get_local_id(1);
+        const std::int64_t l1 = it.get_local_id(2);
+        const std::int64_t row0 = it.get_group(2) * tile;
+        const std::int64_t col0 = it.get_group(1) * tile;
+        const std::int64_t a_off = batch * stride_a;
+        const std::int64_t b_off = batch * stride_b;
+        const std::int64_t c_off = batch * stride_c;
+
+        // Neighbouring work-items (consecutive l1) always read consecutive
+        // addresses of A and B; the padding keeps the transposed local
+        // stores conflict free.
+        auto load_slab = [&](std::int64_t k0, std::int64_t buf) {
+            for (std::int64_t i = 0; i < ItemDim; ++i) {
+                std::int64_t r, kk;
+                T val = T(0);
+                if (!trans_a) {
+                    r = l1 + i * WgDim;
+                    kk = l0;
+                    if (row0 + r < m && k0 + kk < k) {
+                        val = static_cast<T>(a[a_off + (row0 + r) + (k0 + kk) * lda]);
+                    }
+                }
+                else {
+                    r = l0 + i * WgDim;
+                    kk = l1;
+                    if (row0 + r < m && k0 + kk < k) {
+                        val = conj_if(conj_a,
+                                      static_cast<T>(a[a_off + (k0 + kk) + (row0 + r) * lda]));
+                    }
+                }
+                a_local[buf * a_size + kk * a_ld + r] = val;
+            }
+            for (std::int64_t j = 0; j < ItemDim; ++j) {
+                std::int64_t cc, kk;
+                T val = T(0);
+                if (!trans_b) {
+                    cc = l0 + j * WgDim;
+                    kk = l1;
+                    if (col0 + cc < n && k0 + kk < k) {
+                        val = static_cast<T>(b[b_off + (k0 + kk) + (col0 + cc) * ldb]);
+                    }
+                }
+                else {
+                    cc = l1 + j * WgDim;
+                    kk = l0;
+                    if (col0 + cc < n && k0 + kk < k) {
+                        val = conj_if(conj_b,
+                                      static_cast<T>(b[b_off + (col0 + cc) + (k0 + kk) * ldb]));
+                    }
+                }
+                b_local[buf * b_size + cc * b_ld + kk] = val;
+            }
+        };
+
+        T acc[ItemDim][ItemDim];
+        for (int i = 0; i < ItemDim; ++i) {
+            for (int j = 0; j < ItemDim; ++j) {
+                acc[i][j] = T(0);
+            }
+        }
+        auto compute_slab = [&](std::int64_t buf) {
+            for (std::int64_t kk = 0; kk < slab; ++kk) {
+                T a_reg[ItemDim];
+                T b_reg[ItemDim];
+                for (int i = 0; i < ItemDim; ++i) {
+                    a_reg[i] = a_local[buf * a_size + kk * a_ld + l1 + i * WgDim];
+                }
+                for (int j = 0; j < ItemDim; ++j) {
+                    b_reg[j] = b_local[buf * b_size + (l0 + j * WgDim) * b_ld + kk];
+                }
+                for (int i = 0; i < ItemDim; ++i) {
+                    for (int j = 0; j < ItemDim; ++j) {
+                        acc[i][j] += a_reg[i] * b_reg[j];
+                    }
+                }
+            }
+        };
+
+        const std::int64_t num_slabs = (k + slab - 1) / slab;
+        if (num_slabs > 0) {
+            load_slab(0, 0);
+            sycl::group_barrier(it.get_group());
+        }
+        for (std::int64_t s = 0; s < num_slabs; ++s) {
+            if constexpr (DoubleBuffer) {
+                if (s + 1 < num_slabs) {
+                    load_slab((s + 1) * slab, (s + 1) % 2);
+                }
+                compute_slab(s % 2);
+                sycl::group_barrier(it.get_group());
+            }
+            else {
+                compute_slab(0);
+                sycl::group_barrier(it.get_group());
+                if (s + 1 < num_slabs) {
+                    load_slab((s + 1) * slab, 0);
+                    sycl::group_barrier(it.get_group());
+                }
+            }
+        }
+
+        for (int j = 0; j < ItemDim; ++j) {
+            const std::int64_t col = col0 + l0 + j * WgDim;
+            for (int i = 0; i < ItemDim; ++i) {
+                const std::int64_t row = row0 + l1 + i * WgDim;
+                if (row < m && col < n) {
+                    epilogue(acc[i][j], row, col, c[c_off + row + col * ldc]);
+                }
+            }
+        }
+    });
+}
+
+template <typename T, int Candidate = 1, typename... ArgTs>
+void launch_tuned_gemm(int config, sycl::handler &cgh, ArgTs... args) {
+    if constexpr (Candidate < num_gemm_candidates) {
+        if (config == Candidate) {
+            constexpr gemm_config cfg = gemm_candidates[Candidate];
+            tuned_gemm_kernel<cfg.wg_dim, cfg.item_dim, cfg.double_buffer, T>(cgh, args...);
+        }
+        else {
+            launch_tuned_gemm<T, Candidate + 1>(config, cgh, args...);
+        }
+    }
+}
+
+/** C := alpha * acc + beta * C, the epilogue of a plain GEMM. **/
+template <typename T>
+struct scale_epilogue {
+    T alpha;
+    T beta;
+
+    template <typename CElemT>
+    void operator()(T acc, std::int64_t, std::int64_t, CElemT &c_elem) const {
+        c_elem = (beta == T(0)) ? alpha * acc : alpha * acc + beta * c_elem;
+    }
+};
+
+template <typename T>
+void tuned_gemm(sycl::queue &queue, int config, transpose transa, transpose transb,
+                std::int64_t m, std::int64_t n, std::int64_t k, T alpha, sycl::buffer<T, 1> &a,
+                std::int64_t lda, std::int64_t stride_a, sycl::buffer<T, 1> &b, std::int64_t ldb,
+                std::int64_t stride_b, T beta, sycl::buffer<T, 1> &c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c.template get_access<sycl::access::mode::read_write>(cgh);
+        if (m > 0 && n > 0 && batch_size > 0) {
+            launch_tuned_gemm<T>(config, cgh, transa, transb, m, n, k, a_acc, lda, stride_a,
+                                 b_acc, ldb, stride_b, c_acc, ldc, stride_c, batch_size,
+                                 scale_epilogue<T>{ alpha, beta });
+        }
+    });
+}
+
+template <typename T>
+sycl::event tuned_gemm(sycl::queue &queue, int config, transpose transa, transpose transb,
+                       std::int64_t m, std::int64_t n, std::int64_t k, T alpha, const T *a,
+                       std::int64_t lda, std::int64_t stride_a, const T *b, std::int64_t ldb,
+                       std::int64_t stride_b, T beta, T *c, std::int64_t ldc,
+                       std::int64_t stride_c, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        if (m > 0 && n > 0 && batch_size > 0) {
+            launch_tuned_gemm<T>(config, cgh, transa, transb, m, n, k, a, lda, stride_a, b, ldb,
+                                 stride_b, c, ldc, stride_c, batch_size,
+                                 scale_epilogue<T>{ alpha, beta });
+        }
+    });
+}
+
+template <typename T>
+bool gemm_config_fits_device(const sycl::device &device, int config) {
+    if (config == 0) {
+        return true;
+    }
+    const gemm_config &cfg = gemm_candidates[config];
+    const std::size_t tile = cfg.wg_dim * cfg.item_dim;
+    const std::size_t num_buffers = cfg.double_buffer ? 2 : 1;
+    const std::size_t local_bytes =
+        sizeof(T) * num_buffers * (cfg.wg_dim * (tile + 1) + tile * (cfg.wg_dim + 1));
+    return static_cast<std::size_t>(cfg.wg_dim * cfg.wg_dim) <=
+               device.get_info<sycl::info::device::max_work_group_size>() &&
+           local_bytes <= device.get_info<sycl::info::device::local_mem_size>();
+}
+
+/** Returns the largest candidate that fits the device, for kernels that have
+ *  no portBLAS equivalent to fall back to.
+**/
+template <typename T>
+int default_gemm_config(const sycl::device &device) {
+    for (int config = num_gemm_candidates - 1; config > 0; --config) {
+        if (gemm_config_fits_device<T>(device, config)) {
+            return config;
+        }
+    }
+    return 1;
+}
+
+/** Times every candidate that fits the device on scratch operands of the
+ *  given shape and returns the index of the fastest one, or -1 if the scratch
+ *  operands cannot be allocated.
+ *
+ *  The candidates run on a private queue of the same device and context:
+ *  waiting on the caller's queue would block on all of its pending work,
+ *  and its unrelated asynchronous errors would deselect candidates. This
+ *  also keeps the benchmark out of a graph the caller's queue records.
+**/
+template <typename T>
+int benchmark_gemm_configs(sycl::queue &user_queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::int64_t k,
+                           std::int64_t batch_size) {
+    // Errors of a candidate are rethrown by wait_and_throw, which deselects it.
+    sycl::queue queue(user_queue.get_context(), user_queue.get_device(),
+                      [](sycl::exception_list exceptions) {
+                          for (const std::exception_ptr &e : exceptions) {
+                              std::rethrow_exception(e);
+                          }
+                      });
+    constexpr int num_reps = 3;
+    // Batches share a cache bucket per power of two; a bounded number of
+    // them is enough to rank the candidates.
+    batch_size = std::min<std::int64_t>(batch_size, 64);
+    const std::int64_t lda = (transa == transpose::nontrans) ? m : k;
+    const std::int64_t ldb = (transb == transpose::nontrans) ? k : n;
+    const std::int64_t stride_a = lda * ((transa == transpose::nontrans) ? k : m);
+    const std::int64_t stride_b = ldb * ((transb == transpose::nontrans) ? n : k);
+    const std::int64_t stride_c = m * n;
+    const char ta = (transa == transpose::nontrans) ? 'n' : 't';
+    const char tb = (transb == transpose::nontrans) ? 'n' : 't';
+
+    // A problem that only just fits in device memory leaves no room for the
+    // scratch operands. The benchmark must not make such a call fail.
+    T *a = sycl::malloc_device<T>(stride_a * batch_size, queue);
+    T *b = sycl::malloc_device<T>(stride_b * batch_size, queue);
+    T *c = sycl::malloc_device<T>(stride_c * batch_size, queue);
+    auto free_operands = [&]() {
+        for (T *ptr : { a, b, c }) {
+            if (ptr) {
+                sycl::free(ptr, queue);
+            }
+        }
+    };
+    if (!a || !b || !c) {
+        free_operands();
+        return -1;
+    }
+    try {
+        queue.memset(a, 0, sizeof(T) * stride_a * batch_size);
+        queue.memset(b, 0, sizeof(T) * stride_b * batch_size);
+        queue.memset(c, 0, sizeof(T) * stride_c * batch_size);
+        queue.wait_and_throw();
+    }
+    catch (const sycl::exception &) {
+        free_operands();
+        return -1;
+    }
+
+    handle_t sb_handle(queue);
+    auto run = [&](int config) {
+        if (config == 0) {
+            if (batch_size == 1) {
+                ::blas::_gemm(sb_handle, ta, tb, m, n, k, T(1), a, lda, b, ldb, T(0), c, m);
+            }
+            else {
+                ::blas::_gemm_strided_batched(sb_handle, ta, tb, m, n, k, T(1), a, lda, stride_a,
+                                              b, ldb, stride_b, T(0), c, m, stride_c, batch_size);
+            }
+        }
+        else {
+            tuned_gemm(queue, config, transa, transb, m, n, k, T(1), static_cast<const T *>(a),
+                       lda, stride_a, static_cast<const T *>(b), ldb, stride_b, T(0), c, m,
+                       stride_c, batch_size, {});
+        }
+        queue.wait_and_throw();
+    };
+
+    int best_config = 0;
+    double best_time = std::numeric_limits<double>::max();
+    for (int config = 0; config < num_gemm_candidates; ++config) {
+        if (!gemm_config_fits_device<T>(queue.get_device(), config)) {
+            continue;
+        }
+        try {
+            run(config); // warm-up, includes JIT compilation of the kernel
+            const auto start = std::chrono::steady_clock::now();
+            for (int rep = 0; rep < num_reps; ++rep) {
+                run(config);
+            }
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed.count() < best_time) {
+                best_time = elapsed.count();
+                best_config = config;
+            }
+        }
+        catch (const sycl::exception &) {
+            // A candidate the device cannot run is simply not selected.
+        }
+    }
+
+    free_operands();
+    return best_config;
+}
+
+/** Returns the GEMM configuration to use for this call: 0 for portBLAS' own
+ *  kernel, otherwise an index into gemm_candidates.
+**/
+template <typename T>
+int get_gemm_config(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                    std::int64_t n, std::int64_t k, std::int64_t batch_size) {
+    const gemm_tuning_mode mode = get_gemm_tuning_mode();
+    if (mode == gemm_tuning_mode::off || m <= 0 || n <= 0 || k <= 0 || batch_size <= 0) {
+        return 0;
+    }
+    // A configuration picked by timing, or read from a cache other processes
+    // write to, could change the k-blocking from one run to the next.
+    if (oneapi::mkl::blas::is_reproducible()) {
+        return 0;
+    }
+    if (std::is_same_v<T, double> && !queue.get_device().has(sycl::aspect::fp64)) {
+        return 0;
+    }
+    const std::string key = gemm_tuning_key(queue.get_device(), gemm_type_name<T>(), transa,
+                                            transb, m, n, k, batch_size);
+    int config = 0;
+    if (lookup_gemm_config(key, config) || mode == gemm_tuning_mode::offline) {
+        return config;
+    }
+    config = benchmark_gemm_configs<T>(queue, transa, transb, m, n, k, batch_size);
+    if (config < 0) {
+        // Not cached, so that the shape is benchmarked again once there is
+        // enough memory.
+        return 0;
+    }
+    store_gemm_config(key, config);
+    return config;
+}
+
+} // namespace detail
+} // namespace portblas
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _PORTBLAS_GEMM_TUNING_HPP_
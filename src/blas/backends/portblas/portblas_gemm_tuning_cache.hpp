@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _PORTBLAS_GEMM_TUNING_CACHE_HPP_
+#define _PORTBLAS_GEMM_TUNING_CACHE_HPP_
+
+#include <cstdint>
+#include <cstdlib>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+// Key and file format of the portBLAS GEMM tuning cache. Kept free of SYCL
+// and portBLAS so that it can be tested on its own.
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace portblas {
+namespace detail {
+
+inline constexpr const char *gemm_tuning_cache_header = "# oneMKL portBLAS GEMM tuning cache v1";
+
+// Shapes are bucketed by the ceiling of log2 of each dimension, so one
+// benchmark covers every problem of roughly the same size.
+inline int gemm_tuning_bucket(std::int64_t x) {
+    int bucket = 0;
+    while ((std::int64_t(1) << bucket) < x && bucket < 62) {
+        ++bucket;
+    }
+    return bucket;
+}
+
+/** The part of a cache key that follows the device id, e.g. "s|nt|7,7,4|0"
+ *  for a single precision A * B^T of shape 100 x 128 x 16 and batch 1.
+**/
+inline std::string gemm_tuning_shape_key(const char *type_name, char transa, char transb,
+                                         std::int64_t m, std::int64_t n, std::int64_t k,
+                                         std::int64_t batch_size) {
+    std::ostringstream key;
+    key << type_name << '|' << transa << transb << '|' << gemm_tuning_bucket(m) << ','
+        << gemm_tuning_bucket(n) << ',' << gemm_tuning_bucket(k) << '|'
+        << gemm_tuning_bucket(batch_size);
+    return key.str();
+}
+
+/** Reads cache entries, one per line as "<key> <config>", into entries.
+ *  Nothing is read unless the stream starts with the expected header. Lines
+ *  with a config index outside [0, num_configs) are ignored so that a cache
+ *  written by a newer library is harmless.
+**/
+inline void read_gemm_tuning_cache(std::istream &in, int num_configs,
+                                   std::map<std::string, int> &entries) {
+    std::string line;
+    if (!std::getline(in, line) || line != gemm_tuning_cache_header) {
+        return;
+    }
+    while (std::getline(in, line)) {
+        const auto pos = line.rfind(' ');
+        if (pos == std::string::npos || pos == 0) {
+            continue;
+        }
+        char *end = nullptr;
+        const long config = std::strtol(line.c_str() + pos + 1, &end, 10);
+        if (end == line.c_str() + pos + 1 || *end != '\0') {
+            continue;
+        }
+        if (config >= 0 && config < num_configs) {
+            entries[line.substr(0, pos)] = static_cast<int>(config);
+        }
+    }
+}
+
+inline void write_gemm_tuning_cache(std::ostream &out, const std::map<std::string, int> &entries) {
+    out << gemm_tuning_cache_header << '\n';
+    for (const auto &entry : entries) {
+        out << entry.first << ' ' << entry.second << '\n';
+    }
+}
+
+} // namespace detail
+} // namespace portblas
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _PORTBLAS_GEMM_TUNING_CACHE_HPP_
@@ -58,6 +58,10 @@ void asum(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<real_t>,
 
 void asum(sycl::queue &queue, std::int64_t n, sycl::buffer<real_t, 1> &x, std::int64_t incx,
           sycl::buffer<real_t, 1> &result) {
+    if (oneapi::mkl::blas::is_reproducible()) {
+        detail::reproducible_asum(queue, n, x, incx, result);
+        return;
+    }
     // portBLAS asum implementation requires that result is initialized to zero
     // before performing the computation.
     queue.submit([&](sycl::handler &cgh) {
@@ -101,6 +105,10 @@ void copy(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<real_t>,
 
 void dot(sycl::queue &queue, std::int64_t n, sycl::buffer<real_t, 1> &x, std::int64_t incx,
          sycl::buffer<real_t, 1> &y, std::int64_t incy, sycl::buffer<real_t, 1> &result) {
+    if (oneapi::mkl::blas::is_reproducible()) {
+        detail::reproducible_dot(queue, n, x, incx, y, incy, result);
+        return;
+    }
     // portBLAS dot implementation requires that result is initialized to zero
     // before performing the computation.
     queue.submit([&](sycl::handler &cgh) {
@@ -136,6 +144,10 @@ void nrm2(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<real_t>,
 
 void nrm2(sycl::queue &queue, std::int64_t n, sycl::buffer<real_t, 1> &x, std::int64_t incx,
           sycl::buffer<real_t, 1> &result) {
+    if (oneapi::mkl::blas::is_reproducible()) {
+        detail::reproducible_nrm2(queue, n, x, incx, result);
+        return;
+    }
     // portBLAS nrm2 implementation requires that result is initialized to zero
     // before performing the computation.
     queue.submit([&](sycl::handler &cgh) {
@@ -246,6 +258,9 @@ sycl::event asum(sycl::queue &queue, std::int64_t n, const std::complex<real_t>
 
 sycl::event asum(sycl::queue &queue, std::int64_t n, const real_t *x, std::int64_t incx,
                  real_t *result, const std::vector<sycl::event> &dependencies) {
+    if (oneapi::mkl::blas::is_reproducible()) {
+        return detail::reproducible_asum(queue, n, x, incx, result, dependencies);
+    }
     // portBLAS asum implementation requires result to be initializes to zero
     // before starting the computation.
     auto init_res_val = queue.submit(
@@ -294,6 +309,9 @@ sycl::event copy(sycl::queue &queue, std::int64_t n, const std::complex<real_t>
 sycl::event dot(sycl::queue &queue, std::int64_t n, const real_t *x, std::int64_t incx,
                 const real_t *y, std::int64_t incy, real_t *result,
                 const std::vector<sycl::event> &dependencies) {
+    if (oneapi::mkl::blas::is_reproducible()) {
+        return detail::reproducible_dot(queue, n, x, incx, y, incy, result, dependencies);
+    }
     // portBLAS dot implementation requires result to be initializes to zero
     // before starting the computation.
     auto init_res_val = queue.submit(
@@ -330,6 +348,9 @@ sycl::event nrm2(sycl::queue &queue, std::int64_t n, const std::complex<real_t>
 
 sycl::event nrm2(sycl::queue &queue, std::int64_t n, const real_t *x, std::int64_t incx,
                  real_t *result, const std::vector<sycl::event> &dependencies) {
+    if (oneapi::mkl::blas::is_reproducible()) {
+        return detail::reproducible_nrm2(queue, n, x, incx, result, dependencies);
+    }
     // portBLAS nrm2 implementation requires result to be initializes to zero
     // before starting the computation.
     auto init_res_val = queue.submit(
@@ -370,16 +391,14 @@ sycl::event rotmg(sycl::queue &queue, real_t *d1, real_t *d2, real_t *x1, real_t
                   const std::vector<sycl::event> &dependencies) {
     auto y_d =
         (real_t *)sycl::malloc_device(sizeof(real_t), queue.get_device(), queue.get_context());
-    auto copy_in_event = queue.memcpy(y_d, &y1, sizeof(real_t), dependencies);
+    // fill copies y1 when the command is created, so a recorded graph does
+    // not refer to this stack frame.
+    auto copy_in_event = queue.fill(y_d, y1, 1, dependencies);
     auto rotmg_event = std::invoke([&]() -> sycl::event {
         CALL_PORTBLAS_USM_FN(::blas::_rotmg, queue, d1, d2, x1, y_d, param,
                              std::vector<sycl::event>{ copy_in_event });
     });
-    auto free_event = queue.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(rotmg_event);
-        cgh.host_task([=]() { sycl::free(y_d, queue); });
-    });
-    return free_event;
+    return detail::free_scratch(queue, rotmg_event, y_d);
 }
 
 sycl::event scal(sycl::queue &queue, std::int64_t n, real_t alpha, real_t *x, std::int64_t incx,
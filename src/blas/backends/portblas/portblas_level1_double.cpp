@@ -24,6 +24,7 @@
 #endif
 
 #include "portblas_common.hpp"
+#include "portblas_fused_level1.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/blas/detail/portblas/onemkl_blas_portblas.hpp"
 
@@ -42,6 +43,7 @@ constexpr bool is_column_major() {
     return true;
 }
 #include "portblas_level1.cxx"
+#include "portblas_fused_level1.cxx"
 #undef COLUMN_MAJOR
 
 } // namespace column_major
@@ -52,6 +54,7 @@ constexpr bool is_column_major() {
     return false;
 }
 #include "portblas_level1.cxx"
+#include "portblas_fused_level1.cxx"
 #undef ROW_MAJOR
 
 #undef ENABLE_MIXED_PRECISION_WITH_DOUBLE
@@ -24,6 +24,7 @@
 #endif
 
 #include "portblas_common.hpp"
+#include "portblas_fused_level1.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/blas/detail/portblas/onemkl_blas_portblas.hpp"
 
@@ -41,6 +42,7 @@ constexpr bool is_column_major() {
     return true;
 }
 #include "portblas_level1.cxx"
+#include "portblas_fused_level1.cxx"
 #undef COLUMN_MAJOR
 
 } // namespace column_major
@@ -51,6 +53,7 @@ constexpr bool is_column_major() {
     return false;
 }
 #include "portblas_level1.cxx"
+#include "portblas_fused_level1.cxx"
 #undef ROW_MAJOR
 
 } // namespace row_major
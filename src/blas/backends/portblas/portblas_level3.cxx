@@ -23,6 +23,25 @@ void gemm(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transp
           std::int64_t m, std::int64_t n, std::int64_t k, real_t alpha, sycl::buffer<real_t, 1> &a,
           std::int64_t lda, sycl::buffer<real_t, 1> &b, std::int64_t ldb, real_t beta,
           sycl::buffer<real_t, 1> &c, std::int64_t ldc) {
+    const std::int64_t parts = detail::gemm_split_k_parts<real_t>(queue, m, n, k);
+    if (parts > 1) {
+        if constexpr (is_column_major()) {
+            detail::gemm_split_k(queue, parts, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                 beta, c, ldc);
+        }
+        else {
+            detail::gemm_split_k(queue, parts, transb, transa, n, m, k, alpha, b, ldb, a, lda,
+                                 beta, c, ldc);
+        }
+        return;
+    }
+    if constexpr (is_column_major()) {
+        if (int config = detail::get_gemm_config<real_t>(queue, transa, transb, m, n, k, 1)) {
+            detail::tuned_gemm(queue, config, transa, transb, m, n, k, alpha, a, lda, 0, b, ldb, 0,
+                               beta, c, ldc, 0, 1);
+            return;
+        }
+    }
     CALL_PORTBLAS_FN(::blas::_gemm, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
                      ldc);
 }
@@ -163,7 +182,16 @@ void gemmt(sycl::queue &queue, oneapi::mkl::uplo upper_lower, oneapi::mkl::trans
            oneapi::mkl::transpose transb, std::int64_t n, std::int64_t k, real_t alpha,
            sycl::buffer<real_t, 1> &a, std::int64_t lda, sycl::buffer<real_t, 1> &b,
            std::int64_t ldb, real_t beta, sycl::buffer<real_t, 1> &c, std::int64_t ldc) {
-    throw unimplemented("blas", "gemmt", "");
+    if constexpr (is_column_major()) {
+        detail::gemmt(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
+                      ldc);
+    }
+    else {
+        // Row-major C = op(A) * op(B) is column-major C^T = op(B)^T * op(A)^T,
+        // with the referenced triangle flipped.
+        detail::gemmt(queue, detail::flip_uplo(upper_lower), transb, transa, n, k, alpha, b, ldb,
+                      a, lda, beta, c, ldc);
+    }
 }
 
 void gemmt(sycl::queue &queue, oneapi::mkl::uplo upper_lower, oneapi::mkl::transpose transa,
@@ -171,59 +199,88 @@ void gemmt(sycl::queue &queue, oneapi::mkl::uplo upper_lower, oneapi::mkl::trans
            std::complex<real_t> alpha, sycl::buffer<std::complex<real_t>, 1> &a, std::int64_t lda,
            sycl::buffer<std::complex<real_t>, 1> &b, std::int64_t ldb, std::complex<real_t> beta,
            sycl::buffer<std::complex<real_t>, 1> &c, std::int64_t ldc) {
-    throw unimplemented("blas", "gemmt", "");
+    if constexpr (is_column_major()) {
+        detail::gemmt(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
+                      ldc);
+    }
+    else {
+        detail::gemmt(queue, detail::flip_uplo(upper_lower), transb, transa, n, k, alpha, b, ldb,
+                      a, lda, beta, c, ldc);
+    }
 }
 
 void omatcopy(sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, real_t alpha,
               sycl::buffer<real_t, 1> &a, std::int64_t lda, sycl::buffer<real_t, 1> &b,
               std::int64_t ldb) {
-    CALL_PORTBLAS_FN(::blas::_omatcopy, queue, trans, m, n, alpha, a, lda, b, ldb);
+    if constexpr (is_column_major()) {
+        CALL_PORTBLAS_FN(::blas::_omatcopy, queue, trans, m, n, alpha, a, lda, b, ldb);
+    }
+    else {
+        detail::omatcopy2(queue, trans, n, m, alpha, a, lda, std::int64_t(1), b, ldb,
+                          std::int64_t(1));
+    }
 }
 
 void omatcopy(sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
               std::complex<real_t> alpha, sycl::buffer<std::complex<real_t>, 1> &a,
               std::int64_t lda, sycl::buffer<std::complex<real_t>, 1> &b, std::int64_t ldb) {
-    throw unimplemented("blas", "omatcopy", "");
+    // A row-major m x n matrix is the column-major view of its n x m transpose.
+    detail::omatcopy2(queue, trans, is_column_major() ? m : n, is_column_major() ? n : m, alpha, a,
+                      lda, std::int64_t(1), b, ldb, std::int64_t(1));
 }
 
 void omatcopy2(sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, real_t alpha,
                sycl::buffer<real_t, 1> &a, std::int64_t lda, std::int64_t stridea,
                sycl::buffer<real_t, 1> &b, std::int64_t ldb, std::int64_t strideb) {
-    CALL_PORTBLAS_FN(::blas::_omatcopy2, queue, trans, m, n, alpha, a, lda, stridea, b, ldb,
-                     strideb);
+    if constexpr (is_column_major()) {
+        CALL_PORTBLAS_FN(::blas::_omatcopy2, queue, trans, m, n, alpha, a, lda, stridea, b, ldb,
+                         strideb);
+    }
+    else {
+        detail::omatcopy2(queue, trans, n, m, alpha, a, lda, stridea, b, ldb, strideb);
+    }
 }
 
 void omatcopy2(sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
                std::complex<real_t> alpha, sycl::buffer<std::complex<real_t>, 1> &a,
                std::int64_t lda, std::int64_t stridea, sycl::buffer<std::complex<real_t>, 1> &b,
                std::int64_t ldb, std::int64_t strideb) {
-    throw unimplemented("blas", "omatcopy2", "");
+    detail::omatcopy2(queue, trans, is_column_major() ? m : n, is_column_major() ? n : m, alpha, a,
+                      lda, stridea, b, ldb, strideb);
 }
 
 void imatcopy(sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, real_t alpha,
               sycl::buffer<real_t, 1> &ab, std::int64_t lda, std::int64_t ldb) {
-    throw unimplemented("blas", "imatcopy", "");
+    detail::imatcopy(queue, trans, is_column_major() ? m : n, is_column_major() ? n : m, alpha, ab,
+                     lda, ldb);
 }
 
 void imatcopy(sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
               std::complex<real_t> alpha, sycl::buffer<std::complex<real_t>, 1> &ab,
               std::int64_t lda, std::int64_t ldb) {
-    throw unimplemented("blas", "imatcopy", "");
+    detail::imatcopy(queue, trans, is_column_major() ? m : n, is_column_major() ? n : m, alpha, ab,
+                     lda, ldb);
 }
 
 void omatadd(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
              real_t alpha, sycl::buffer<real_t, 1> &a, std::int64_t lda, real_t beta,
              sycl::buffer<real_t, 1> &b, std::int64_t ldb, sycl::buffer<real_t, 1> &c,
              std::int64_t ldc) {
-    CALL_PORTBLAS_FN(::blas::_omatadd, queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c,
-                     ldc);
+    if constexpr (is_column_major()) {
+        CALL_PORTBLAS_FN(::blas::_omatadd, queue, transa, transb, m, n, alpha, a, lda, beta, b,
+                         ldb, c, ldc);
+    }
+    else {
+        detail::omatadd(queue, transa, transb, n, m, alpha, a, lda, beta, b, ldb, c, ldc);
+    }
 }
 
 void omatadd(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
              std::complex<real_t> alpha, sycl::buffer<std::complex<real_t>, 1> &a, std::int64_t lda,
              std::complex<real_t> beta, sycl::buffer<std::complex<real_t>, 1> &b, std::int64_t ldb,
              sycl::buffer<std::complex<real_t>, 1> &c, std::int64_t ldc) {
-    throw unimplemented("blas", "omatadd", "");
+    detail::omatadd(queue, transa, transb, is_column_major() ? m : n, is_column_major() ? n : m,
+                    alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
 // USM APIs
@@ -232,6 +289,23 @@ sycl::event gemm(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl:
                  std::int64_t m, std::int64_t n, std::int64_t k, real_t alpha, const real_t *a,
                  std::int64_t lda, const real_t *b, std::int64_t ldb, real_t beta, real_t *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    const std::int64_t parts = detail::gemm_split_k_parts<real_t>(queue, m, n, k);
+    if (parts > 1) {
+        if constexpr (is_column_major()) {
+            return detail::gemm_split_k(queue, parts, transa, transb, m, n, k, alpha, a, lda, b,
+                                        ldb, beta, c, ldc, dependencies);
+        }
+        else {
+            return detail::gemm_split_k(queue, parts, transb, transa, n, m, k, alpha, b, ldb, a,
+                                        lda, beta, c, ldc, dependencies);
+        }
+    }
+    if constexpr (is_column_major()) {
+        if (int config = detail::get_gemm_config<real_t>(queue, transa, transb, m, n, k, 1)) {
+            return detail::tuned_gemm(queue, config, transa, transb, m, n, k, alpha, a, lda, 0, b,
+                                      ldb, 0, beta, c, ldc, 0, 1, dependencies);
+        }
+    }
     CALL_PORTBLAS_USM_FN(::blas::_gemm, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
                          c, ldc, dependencies);
 }
@@ -353,7 +427,14 @@ sycl::event gemmt(sycl::queue &queue, oneapi::mkl::uplo upper_lower, oneapi::mkl
                   oneapi::mkl::transpose transb, std::int64_t n, std::int64_t k, real_t alpha,
                   const real_t *a, std::int64_t lda, const real_t *b, std::int64_t ldb, real_t beta,
                   real_t *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    throw unimplemented("blas", "gemmt", " for USM");
+    if constexpr (is_column_major()) {
+        return detail::gemmt(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                             c, ldc, dependencies);
+    }
+    else {
+        return detail::gemmt(queue, detail::flip_uplo(upper_lower), transb, transa, n, k, alpha, b,
+                             ldb, a, lda, beta, c, ldc, dependencies);
+    }
 }
 
 sycl::event gemmt(sycl::queue &queue, oneapi::mkl::uplo upper_lower, oneapi::mkl::transpose transa,
@@ -362,56 +443,86 @@ sycl::event gemmt(sycl::queue &queue, oneapi::mkl::uplo upper_lower, oneapi::mkl
                   const std::complex<real_t> *b, std::int64_t ldb, std::complex<real_t> beta,
                   std::complex<real_t> *c, std::int64_t ldc,
                   const std::vector<sycl::event> &dependencies) {
-    throw unimplemented("blas", "gemmt", " for USM");
+    if constexpr (is_column_major()) {
+        return detail::gemmt(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                             c, ldc, dependencies);
+    }
+    else {
+        return detail::gemmt(queue, detail::flip_uplo(upper_lower), transb, transa, n, k, alpha, b,
+                             ldb, a, lda, beta, c, ldc, dependencies);
+    }
 }
 
 sycl::event omatcopy(sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
                      real_t alpha, const real_t *a, std::int64_t lda, real_t *b, std::int64_t ldb,
                      const std::vector<sycl::event> &dependencies) {
-    CALL_PORTBLAS_USM_FN(::blas::_omatcopy, queue, trans, m, n, alpha, a, lda, b, ldb,
-                         dependencies);
+    if constexpr (is_column_major()) {
+        CALL_PORTBLAS_USM_FN(::blas::_omatcopy, queue, trans, m, n, alpha, a, lda, b, ldb,
+                             dependencies);
+    }
+    else {
+        return detail::omatcopy2(queue, trans, n, m, alpha, a, lda, std::int64_t(1), b, ldb,
+                                 std::int64_t(1), dependencies);
+    }
 }
 
 sycl::event omatcopy(sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
                      std::complex<real_t> alpha, const std::complex<real_t> *a, std::int64_t lda,
                      std::complex<real_t> *b, std::int64_t ldb,
                      const std::vector<sycl::event> &dependencies) {
-    throw unimplemented("blas", "omatcopy", "for USM");
+    return detail::omatcopy2(queue, trans, is_column_major() ? m : n, is_column_major() ? n : m,
+                             alpha, a, lda, std::int64_t(1), b, ldb, std::int64_t(1),
+                             dependencies);
 }
 
 sycl::event omatcopy2(sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
                       real_t alpha, const real_t *a, std::int64_t lda, std::int64_t stridea,
                       real_t *b, std::int64_t ldb, std::int64_t strideb,
                       const std::vector<sycl::event> &dependencies) {
-    CALL_PORTBLAS_USM_FN(::blas::_omatcopy2, queue, trans, m, n, alpha, a, lda, stridea, b, ldb,
-                         strideb, dependencies);
+    if constexpr (is_column_major()) {
+        CALL_PORTBLAS_USM_FN(::blas::_omatcopy2, queue, trans, m, n, alpha, a, lda, stridea, b,
+                             ldb, strideb, dependencies);
+    }
+    else {
+        return detail::omatcopy2(queue, trans, n, m, alpha, a, lda, stridea, b, ldb, strideb,
+                                 dependencies);
+    }
 }
 
 sycl::event omatcopy2(sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
                       std::complex<real_t> alpha, const std::complex<real_t> *a, std::int64_t lda,
                       std::int64_t stridea, std::complex<real_t> *b, std::int64_t ldb,
                       std::int64_t strideb, const std::vector<sycl::event> &dependencies) {
-    throw unimplemented("blas", "omatcopy2", "for USM");
+    return detail::omatcopy2(queue, trans, is_column_major() ? m : n, is_column_major() ? n : m,
+                             alpha, a, lda, stridea, b, ldb, strideb, dependencies);
 }
 
 sycl::event imatcopy(sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
                      real_t alpha, real_t *ab, std::int64_t lda, std::int64_t ldb,
                      const std::vector<sycl::event> &dependencies) {
-    throw unimplemented("blas", "imatcopy", "");
+    return detail::imatcopy(queue, trans, is_column_major() ? m : n, is_column_major() ? n : m,
+                            alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event imatcopy(sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
                      std::complex<real_t> alpha, std::complex<real_t> *ab, std::int64_t lda,
                      std::int64_t ldb, const std::vector<sycl::event> &dependencies) {
-    throw unimplemented("blas", "imatcopy", "");
+    return detail::imatcopy(queue, trans, is_column_major() ? m : n, is_column_major() ? n : m,
+                            alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event omatadd(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
                     std::int64_t n, real_t alpha, const real_t *a, std::int64_t lda, real_t beta,
                     const real_t *b, std::int64_t ldb, real_t *c, std::int64_t ldc,
                     const std::vector<sycl::event> &dependencies) {
-    CALL_PORTBLAS_USM_FN(::blas::_omatadd, queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb,
-                         c, ldc, dependencies);
+    if constexpr (is_column_major()) {
+        CALL_PORTBLAS_USM_FN(::blas::_omatadd, queue, transa, transb, m, n, alpha, a, lda, beta, b,
+                             ldb, c, ldc, dependencies);
+    }
+    else {
+        return detail::omatadd(queue, transa, transb, n, m, alpha, a, lda, beta, b, ldb, c, ldc,
+                               dependencies);
+    }
 }
 
 sycl::event omatadd(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
@@ -419,7 +530,9 @@ sycl::event omatadd(sycl::queue &queue, transpose transa, transpose transb, std:
                     std::int64_t lda, std::complex<real_t> beta, const std::complex<real_t> *b,
                     std::int64_t ldb, std::complex<real_t> *c, std::int64_t ldc,
                     const std::vector<sycl::event> &dependencies) {
-    throw unimplemented("blas", "omatadd", "");
+    return detail::omatadd(queue, transa, transb, is_column_major() ? m : n,
+                           is_column_major() ? n : m, alpha, a, lda, beta, b, ldb, c, ldc,
+                           dependencies);
 }
 sycl::event omatcopy_batch(sycl::queue &queue, transpose *trans, int64_t *m, int64_t *n,
                            real_t *alpha, const real_t **a, int64_t *lda, real_t **b, int64_t *ldb,
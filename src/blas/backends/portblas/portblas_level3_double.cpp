@@ -24,6 +24,11 @@
 #endif
 
 #include "portblas_common.hpp"
+#include "portblas_device_scalars.hpp"
+#include "portblas_gemm3m.hpp"
+#include "portblas_gemm_split_k.hpp"
+#include "portblas_gemm_tuning.hpp"
+#include "portblas_extension_kernels.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/blas/detail/portblas/onemkl_blas_portblas.hpp"
 
@@ -41,6 +46,8 @@ constexpr bool is_column_major() {
     return true;
 }
 #include "portblas_level3.cxx"
+#include "portblas_device_scalars.cxx"
+#include "portblas_gemm3m.cxx"
 #undef COLUMN_MAJOR
 
 } // namespace column_major
@@ -51,6 +58,8 @@ constexpr bool is_column_major() {
     return false;
 }
 #include "portblas_level3.cxx"
+#include "portblas_device_scalars.cxx"
+#include "portblas_gemm3m.cxx"
 #undef ROW_MAJOR
 
 } // namespace row_major
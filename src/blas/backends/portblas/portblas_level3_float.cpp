@@ -24,6 +24,12 @@
 #endif
 
 #include "portblas_common.hpp"
+#include "portblas_device_scalars.hpp"
+#include "portblas_gemm3m.hpp"
+#include "portblas_gemm_epilogue.hpp"
+#include "portblas_gemm_split_k.hpp"
+#include "portblas_gemm_tuning.hpp"
+#include "portblas_extension_kernels.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/blas/detail/portblas/onemkl_blas_portblas.hpp"
 
@@ -42,6 +48,10 @@ constexpr bool is_column_major() {
 }
 #include "portblas_level3.cxx"
 #include "portblas_gemm_bias.cxx"
+#include "portblas_gemm_epilogue.cxx"
+#include "portblas_gemm_pack.cxx"
+#include "portblas_device_scalars.cxx"
+#include "portblas_gemm3m.cxx"
 #undef COLUMN_MAJOR
 
 } // namespace column_major
@@ -53,6 +63,10 @@ constexpr bool is_column_major() {
 }
 #include "portblas_level3.cxx"
 #include "portblas_gemm_bias.cxx"
+#include "portblas_gemm_epilogue.cxx"
+#include "portblas_gemm_pack.cxx"
+#include "portblas_device_scalars.cxx"
+#include "portblas_gemm3m.cxx"
 #undef ROW_MAJOR
 
 } // namespace row_major
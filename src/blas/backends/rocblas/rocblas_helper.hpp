@@ -30,6 +30,7 @@
 #include <rocblas/rocblas.h>
 #include <complex>
 #include "oneapi/mkl/types.hpp"
+#include "oneapi/mkl/blas/reproducibility.hpp"
 #include <hip/hip_runtime.h>
 
 namespace oneapi {
@@ -172,6 +173,15 @@ public:
     hipError_t hip_err;                                                    \
     HIP_ERROR_FUNC(hipStreamSynchronize, hip_err, currentStreamId);
 
+// rocBLAS can let some kernels accumulate with atomics, which makes the order
+// of additions depend on scheduling; reproducible mode turns them off.
+inline void set_atomics_mode(rocblas_handle handle) {
+    if (oneapi::mkl::blas::is_reproducible()) {
+        rocblas_status err;
+        ROCBLAS_ERROR_FUNC(rocblas_set_atomics_mode, err, handle, rocblas_atomics_not_allowed);
+    }
+}
+
 inline rocblas_operation get_rocblas_operation(oneapi::mkl::transpose trn) {
     switch (trn) {
         case oneapi::mkl::transpose::nontrans: return rocblas_operation_none;
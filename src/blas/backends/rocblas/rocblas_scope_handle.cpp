@@ -120,6 +120,7 @@ rocblas_handle RocblasScopedContextHandler::get_handle(const sycl::queue &queue)
                 if (currentStreamId != streamId) {
                     ROCBLAS_ERROR_FUNC(rocblas_set_stream, err, handle, streamId);
                 }
+                set_atomics_mode(handle);
                 return handle;
             }
             else {
@@ -132,6 +133,7 @@ rocblas_handle RocblasScopedContextHandler::get_handle(const sycl::queue &queue)
 
     ROCBLAS_ERROR_FUNC(rocblas_create_handle, err, &handle);
     ROCBLAS_ERROR_FUNC(rocblas_set_stream, err, handle, streamId);
+    set_atomics_mode(handle);
 
     auto insert_iter = handle_helper.rocblas_handle_container_mapper_.insert(
         std::make_pair(piPlacedContext_, new std::atomic<rocblas_handle>(handle)));
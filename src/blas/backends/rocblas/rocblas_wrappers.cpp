@@ -247,6 +247,29 @@ extern "C" blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::rocblas::column_major::omatadd,
     oneapi::mkl::blas::rocblas::column_major::omatadd,
     oneapi::mkl::blas::rocblas::column_major::omatadd,
+    oneapi::mkl::blas::rocblas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::column_major::sgemm_pack_get_size,
+    oneapi::mkl::blas::rocblas::column_major::dgemm_pack_get_size,
+    oneapi::mkl::blas::rocblas::column_major::gemm_pack,
+    oneapi::mkl::blas::rocblas::column_major::gemm_pack,
+    oneapi::mkl::blas::rocblas::column_major::gemm_compute,
+    oneapi::mkl::blas::rocblas::column_major::gemm_compute,
+    oneapi::mkl::blas::rocblas::column_major::axpy_dot,
+    oneapi::mkl::blas::rocblas::column_major::axpy_dot,
+    oneapi::mkl::blas::rocblas::column_major::dot2,
+    oneapi::mkl::blas::rocblas::column_major::dot2,
+    oneapi::mkl::blas::rocblas::column_major::axpby_nrm2,
+    oneapi::mkl::blas::rocblas::column_major::axpby_nrm2,
+    oneapi::mkl::blas::rocblas::column_major::axpby_nrm2,
+    oneapi::mkl::blas::rocblas::column_major::axpby_nrm2,
+    oneapi::mkl::blas::rocblas::column_major::mdot,
+    oneapi::mkl::blas::rocblas::column_major::mdot,
+    oneapi::mkl::blas::rocblas::column_major::gemm3m,
+    oneapi::mkl::blas::rocblas::column_major::gemm3m,
     oneapi::mkl::blas::rocblas::column_major::asum,
     oneapi::mkl::blas::rocblas::column_major::asum,
     oneapi::mkl::blas::rocblas::column_major::asum,
@@ -506,6 +529,55 @@ extern "C" blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::rocblas::column_major::imatcopy_batch,
     oneapi::mkl::blas::rocblas::column_major::imatcopy_batch,
     oneapi::mkl::blas::rocblas::column_major::imatcopy_batch,
+    oneapi::mkl::blas::rocblas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::column_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::column_major::gemm_pack,
+    oneapi::mkl::blas::rocblas::column_major::gemm_pack,
+    oneapi::mkl::blas::rocblas::column_major::gemm_compute,
+    oneapi::mkl::blas::rocblas::column_major::gemm_compute,
+    oneapi::mkl::blas::rocblas::column_major::gemm_vbatch,
+    oneapi::mkl::blas::rocblas::column_major::gemm_vbatch,
+    oneapi::mkl::blas::rocblas::column_major::gemm_vbatch,
+    oneapi::mkl::blas::rocblas::column_major::gemm_vbatch,
+    oneapi::mkl::blas::rocblas::column_major::axpy_dot,
+    oneapi::mkl::blas::rocblas::column_major::axpy_dot,
+    oneapi::mkl::blas::rocblas::column_major::dot2,
+    oneapi::mkl::blas::rocblas::column_major::dot2,
+    oneapi::mkl::blas::rocblas::column_major::axpby_nrm2,
+    oneapi::mkl::blas::rocblas::column_major::axpby_nrm2,
+    oneapi::mkl::blas::rocblas::column_major::axpby_nrm2,
+    oneapi::mkl::blas::rocblas::column_major::axpby_nrm2,
+    oneapi::mkl::blas::rocblas::column_major::mdot,
+    oneapi::mkl::blas::rocblas::column_major::mdot,
+    oneapi::mkl::blas::rocblas::column_major::axpy,
+    oneapi::mkl::blas::rocblas::column_major::axpy,
+    oneapi::mkl::blas::rocblas::column_major::axpy,
+    oneapi::mkl::blas::rocblas::column_major::axpy,
+    oneapi::mkl::blas::rocblas::column_major::axpby,
+    oneapi::mkl::blas::rocblas::column_major::axpby,
+    oneapi::mkl::blas::rocblas::column_major::axpby,
+    oneapi::mkl::blas::rocblas::column_major::axpby,
+    oneapi::mkl::blas::rocblas::column_major::scal,
+    oneapi::mkl::blas::rocblas::column_major::scal,
+    oneapi::mkl::blas::rocblas::column_major::scal,
+    oneapi::mkl::blas::rocblas::column_major::scal,
+    oneapi::mkl::blas::rocblas::column_major::gemv,
+    oneapi::mkl::blas::rocblas::column_major::gemv,
+    oneapi::mkl::blas::rocblas::column_major::gemv,
+    oneapi::mkl::blas::rocblas::column_major::gemv,
+    oneapi::mkl::blas::rocblas::column_major::gemm,
+    oneapi::mkl::blas::rocblas::column_major::gemm,
+    oneapi::mkl::blas::rocblas::column_major::gemm,
+    oneapi::mkl::blas::rocblas::column_major::gemm,
+    oneapi::mkl::blas::rocblas::column_major::gemm_batch,
+    oneapi::mkl::blas::rocblas::column_major::gemm_batch,
+    oneapi::mkl::blas::rocblas::column_major::gemm_batch,
+    oneapi::mkl::blas::rocblas::column_major::gemm_batch,
+    oneapi::mkl::blas::rocblas::column_major::gemm3m,
+    oneapi::mkl::blas::rocblas::column_major::gemm3m,
     oneapi::mkl::blas::rocblas::row_major::asum,
     oneapi::mkl::blas::rocblas::row_major::asum,
     oneapi::mkl::blas::rocblas::row_major::asum,
@@ -728,6 +800,29 @@ extern "C" blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::rocblas::row_major::omatadd,
     oneapi::mkl::blas::rocblas::row_major::omatadd,
     oneapi::mkl::blas::rocblas::row_major::omatadd,
+    oneapi::mkl::blas::rocblas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::row_major::sgemm_pack_get_size,
+    oneapi::mkl::blas::rocblas::row_major::dgemm_pack_get_size,
+    oneapi::mkl::blas::rocblas::row_major::gemm_pack,
+    oneapi::mkl::blas::rocblas::row_major::gemm_pack,
+    oneapi::mkl::blas::rocblas::row_major::gemm_compute,
+    oneapi::mkl::blas::rocblas::row_major::gemm_compute,
+    oneapi::mkl::blas::rocblas::row_major::axpy_dot,
+    oneapi::mkl::blas::rocblas::row_major::axpy_dot,
+    oneapi::mkl::blas::rocblas::row_major::dot2,
+    oneapi::mkl::blas::rocblas::row_major::dot2,
+    oneapi::mkl::blas::rocblas::row_major::axpby_nrm2,
+    oneapi::mkl::blas::rocblas::row_major::axpby_nrm2,
+    oneapi::mkl::blas::rocblas::row_major::axpby_nrm2,
+    oneapi::mkl::blas::rocblas::row_major::axpby_nrm2,
+    oneapi::mkl::blas::rocblas::row_major::mdot,
+    oneapi::mkl::blas::rocblas::row_major::mdot,
+    oneapi::mkl::blas::rocblas::row_major::gemm3m,
+    oneapi::mkl::blas::rocblas::row_major::gemm3m,
     oneapi::mkl::blas::rocblas::row_major::asum,
     oneapi::mkl::blas::rocblas::row_major::asum,
     oneapi::mkl::blas::rocblas::row_major::asum,
@@ -987,4 +1082,53 @@ extern "C" blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::rocblas::row_major::imatcopy_batch,
     oneapi::mkl::blas::rocblas::row_major::imatcopy_batch,
     oneapi::mkl::blas::rocblas::row_major::imatcopy_batch,
+    oneapi::mkl::blas::rocblas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::row_major::gemm_epilogue,
+    oneapi::mkl::blas::rocblas::row_major::gemm_pack,
+    oneapi::mkl::blas::rocblas::row_major::gemm_pack,
+    oneapi::mkl::blas::rocblas::row_major::gemm_compute,
+    oneapi::mkl::blas::rocblas::row_major::gemm_compute,
+    oneapi::mkl::blas::rocblas::row_major::gemm_vbatch,
+    oneapi::mkl::blas::rocblas::row_major::gemm_vbatch,
+    oneapi::mkl::blas::rocblas::row_major::gemm_vbatch,
+    oneapi::mkl::blas::rocblas::row_major::gemm_vbatch,
+    oneapi::mkl::blas::rocblas::row_major::axpy_dot,
+    oneapi::mkl::blas::rocblas::row_major::axpy_dot,
+    oneapi::mkl::blas::rocblas::row_major::dot2,
+    oneapi::mkl::blas::rocblas::row_major::dot2,
+    oneapi::mkl::blas::rocblas::row_major::axpby_nrm2,
+    oneapi::mkl::blas::rocblas::row_major::axpby_nrm2,
+    oneapi::mkl::blas::rocblas::row_major::axpby_nrm2,
+    oneapi::mkl::blas::rocblas::row_major::axpby_nrm2,
+    oneapi::mkl::blas::rocblas::row_major::mdot,
+    oneapi::mkl::blas::rocblas::row_major::mdot,
+    oneapi::mkl::blas::rocblas::row_major::axpy,
+    oneapi::mkl::blas::rocblas::row_major::axpy,
+    oneapi::mkl::blas::rocblas::row_major::axpy,
+    oneapi::mkl::blas::rocblas::row_major::axpy,
+    oneapi::mkl::blas::rocblas::row_major::axpby,
+    oneapi::mkl::blas::rocblas::row_major::axpby,
+    oneapi::mkl::blas::rocblas::row_major::axpby,
+    oneapi::mkl::blas::rocblas::row_major::axpby,
+    oneapi::mkl::blas::rocblas::row_major::scal,
+    oneapi::mkl::blas::rocblas::row_major::scal,
+    oneapi::mkl::blas::rocblas::row_major::scal,
+    oneapi::mkl::blas::rocblas::row_major::scal,
+    oneapi::mkl::blas::rocblas::row_major::gemv,
+    oneapi::mkl::blas::rocblas::row_major::gemv,
+    oneapi::mkl::blas::rocblas::row_major::gemv,
+    oneapi::mkl::blas::rocblas::row_major::gemv,
+    oneapi::mkl::blas::rocblas::row_major::gemm,
+    oneapi::mkl::blas::rocblas::row_major::gemm,
+    oneapi::mkl::blas::rocblas::row_major::gemm,
+    oneapi::mkl::blas::rocblas::row_major::gemm,
+    oneapi::mkl::blas::rocblas::row_major::gemm_batch,
+    oneapi::mkl::blas::rocblas::row_major::gemm_batch,
+    oneapi::mkl::blas::rocblas::row_major::gemm_batch,
+    oneapi::mkl::blas::rocblas::row_major::gemm_batch,
+    oneapi::mkl::blas::rocblas::row_major::gemm3m,
+    oneapi::mkl::blas::rocblas::row_major::gemm3m,
 };
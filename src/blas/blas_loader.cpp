@@ -1675,6 +1675,199 @@ void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, t
                                                        beta, b, ldb, c, ldc);
 }
 
+void gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                   std::int64_t k, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
+                   sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    function_tables[libkey].column_major_sgemm_epilogue_sycl(queue, transa, transb, offset_bias, m,
+                                                             n, k, alpha, a, lda, b, ldb, beta, c,
+                                                             ldc, bias, act, clamp_min, clamp_max);
+}
+
+void gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                   std::int64_t k, float alpha, sycl::buffer<sycl::half, 1> &a, std::int64_t lda,
+                   sycl::buffer<sycl::half, 1> &b, std::int64_t ldb, float beta,
+                   sycl::buffer<sycl::half, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    function_tables[libkey].column_major_hgemm_epilogue_sycl(queue, transa, transb, offset_bias, m,
+                                                             n, k, alpha, a, lda, b, ldb, beta, c,
+                                                             ldc, bias, act, clamp_min, clamp_max);
+}
+
+void gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                   std::int64_t k, float alpha, sycl::buffer<sycl::half, 1> &a, std::int64_t lda,
+                   sycl::buffer<sycl::half, 1> &b, std::int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    function_tables[libkey].column_major_gemm_f16f16f32_epilogue_sycl(
+        queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+        clamp_min, clamp_max);
+}
+
+void gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                   std::int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                   sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta,
+                   sycl::buffer<bfloat16, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    function_tables[libkey].column_major_gemm_bf16bf16bf16_epilogue_sycl(
+        queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+        clamp_min, clamp_max);
+}
+
+void gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                   std::int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                   sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    function_tables[libkey].column_major_gemm_bf16bf16f32_epilogue_sycl(
+        queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+        clamp_min, clamp_max);
+}
+
+std::int64_t sgemm_pack_get_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                 gemm_pack_matrix identifier, std::int64_t m, std::int64_t n,
+                                 std::int64_t k) {
+    return function_tables[libkey].column_major_sgemm_pack_get_size_sycl(queue, identifier, m, n,
+                                                                         k);
+}
+
+std::int64_t dgemm_pack_get_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                 gemm_pack_matrix identifier, std::int64_t m, std::int64_t n,
+                                 std::int64_t k) {
+    return function_tables[libkey].column_major_dgemm_pack_get_size_sycl(queue, identifier, m, n,
+                                                                         k);
+}
+
+void gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, gemm_pack_matrix identifier,
+               transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+               sycl::buffer<float, 1> &src, std::int64_t ld, sycl::buffer<float, 1> &dest) {
+    function_tables[libkey].column_major_sgemm_pack_sycl(queue, identifier, trans, m, n, k, alpha,
+                                                         src, ld, dest);
+}
+
+void gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, gemm_pack_matrix identifier,
+               transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+               sycl::buffer<double, 1> &src, std::int64_t ld, sycl::buffer<double, 1> &dest) {
+    function_tables[libkey].column_major_dgemm_pack_sycl(queue, identifier, trans, m, n, k, alpha,
+                                                         src, ld, dest);
+}
+
+void gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, gemm_pack_matrix packed,
+                  transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                  std::int64_t k, sycl::buffer<float, 1> &a, std::int64_t lda,
+                  sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                  sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].column_major_sgemm_compute_sycl(queue, packed, transa, transb, m, n, k,
+                                                            a, lda, b, ldb, beta, c, ldc);
+}
+
+void gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, gemm_pack_matrix packed,
+                  transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                  std::int64_t k, sycl::buffer<double, 1> &a, std::int64_t lda,
+                  sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+                  sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].column_major_dgemm_compute_sycl(queue, packed, transa, transb, m, n, k,
+                                                            a, lda, b, ldb, beta, c, ldc);
+}
+
+void axpy_dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+              sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
+              std::int64_t incy, sycl::buffer<float, 1> &z, std::int64_t incz,
+              sycl::buffer<float, 1> &result) {
+    function_tables[libkey].column_major_saxpy_dot_sycl(queue, n, alpha, x, incx, y, incy, z, incz,
+                                                        result);
+}
+
+void axpy_dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+              sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
+              std::int64_t incy, sycl::buffer<double, 1> &z, std::int64_t incz,
+              sycl::buffer<double, 1> &result) {
+    function_tables[libkey].column_major_daxpy_dot_sycl(queue, n, alpha, x, incx, y, incy, z, incz,
+                                                        result);
+}
+
+void dot2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+          std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+          sycl::buffer<float, 1> &z, std::int64_t incz, sycl::buffer<float, 1> &result) {
+    function_tables[libkey].column_major_sdot2_sycl(queue, n, x, incx, y, incy, z, incz, result);
+}
+
+void dot2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+          sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
+          std::int64_t incy, sycl::buffer<double, 1> &z, std::int64_t incz,
+          sycl::buffer<double, 1> &result) {
+    function_tables[libkey].column_major_ddot2_sycl(queue, n, x, incx, y, incy, z, incz, result);
+}
+
+void axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+                sycl::buffer<float, 1> &x, std::int64_t incx, float beta, sycl::buffer<float, 1> &y,
+                std::int64_t incy, sycl::buffer<float, 1> &result) {
+    function_tables[libkey].column_major_saxpby_nrm2_sycl(queue, n, alpha, x, incx, beta, y, incy,
+                                                          result);
+}
+
+void axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+                sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                sycl::buffer<double, 1> &y, std::int64_t incy, sycl::buffer<double, 1> &result) {
+    function_tables[libkey].column_major_daxpby_nrm2_sycl(queue, n, alpha, x, incx, beta, y, incy,
+                                                          result);
+}
+
+void axpby_nrm2(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+    sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
+    sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, sycl::buffer<float, 1> &result) {
+    function_tables[libkey].column_major_caxpby_nrm2_sycl(queue, n, alpha, x, incx, beta, y, incy,
+                                                          result);
+}
+
+void axpby_nrm2(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+    sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::complex<double> beta,
+    sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy, sycl::buffer<double, 1> &result) {
+    function_tables[libkey].column_major_zaxpby_nrm2_sycl(queue, n, alpha, x, incx, beta, y, incy,
+                                                          result);
+}
+
+void mdot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+          std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stridey,
+          sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].column_major_smdot_sycl(queue, n, x, incx, y, incy, stridey, result,
+                                                    batch_size);
+}
+
+void mdot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+          sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
+          std::int64_t incy, std::int64_t stridey, sycl::buffer<double, 1> &result,
+          std::int64_t batch_size) {
+    function_tables[libkey].column_major_dmdot_sycl(queue, n, x, incx, y, incy, stridey, result,
+                                                    batch_size);
+}
+
+void gemm3m(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+            sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+            sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].column_major_cgemm3m_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                      b, ldb, beta, c, ldc);
+}
+
+void gemm3m(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+            sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+            sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+            sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].column_major_zgemm3m_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                      b, ldb, beta, c, ldc);
+}
+
 // USM APIs
 
 sycl::event asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
@@ -3862,6 +4055,436 @@ sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, trans
         queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
 }
 
+sycl::event gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                          transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                          std::int64_t k, float alpha, const float *a, std::int64_t lda,
+                          const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+                          const float *bias, activation act, float clamp_min, float clamp_max,
+                          const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sgemm_epilogue_usm_sycl(
+        queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+        clamp_min, clamp_max, dependencies);
+}
+
+sycl::event gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                          transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                          std::int64_t k, float alpha, const sycl::half *a, std::int64_t lda,
+                          const sycl::half *b, std::int64_t ldb, float beta, sycl::half *c,
+                          std::int64_t ldc, const float *bias, activation act, float clamp_min,
+                          float clamp_max, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_hgemm_epilogue_usm_sycl(
+        queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+        clamp_min, clamp_max, dependencies);
+}
+
+sycl::event gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                          transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                          std::int64_t k, float alpha, const sycl::half *a, std::int64_t lda,
+                          const sycl::half *b, std::int64_t ldb, float beta, float *c,
+                          std::int64_t ldc, const float *bias, activation act, float clamp_min,
+                          float clamp_max, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_gemm_f16f16f32_epilogue_usm_sycl(
+        queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+        clamp_min, clamp_max, dependencies);
+}
+
+sycl::event gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                          transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                          std::int64_t k, float alpha, const bfloat16 *a, std::int64_t lda,
+                          const bfloat16 *b, std::int64_t ldb, float beta, bfloat16 *c,
+                          std::int64_t ldc, const float *bias, activation act, float clamp_min,
+                          float clamp_max, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_gemm_bf16bf16bf16_epilogue_usm_sycl(
+        queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+        clamp_min, clamp_max, dependencies);
+}
+
+sycl::event gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                          transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                          std::int64_t k, float alpha, const bfloat16 *a, std::int64_t lda,
+                          const bfloat16 *b, std::int64_t ldb, float beta, float *c,
+                          std::int64_t ldc, const float *bias, activation act, float clamp_min,
+                          float clamp_max, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_gemm_bf16bf16f32_epilogue_usm_sycl(
+        queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+        clamp_min, clamp_max, dependencies);
+}
+
+sycl::event gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, gemm_pack_matrix identifier,
+                      transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                      const float *src, std::int64_t ld, float *dest,
+                      const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sgemm_pack_usm_sycl(
+        queue, identifier, trans, m, n, k, alpha, src, ld, dest, dependencies);
+}
+
+sycl::event gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, gemm_pack_matrix identifier,
+                      transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                      const double *src, std::int64_t ld, double *dest,
+                      const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dgemm_pack_usm_sycl(
+        queue, identifier, trans, m, n, k, alpha, src, ld, dest, dependencies);
+}
+
+sycl::event gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, gemm_pack_matrix packed,
+                         transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                         std::int64_t k, const float *a, std::int64_t lda, const float *b,
+                         std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sgemm_compute_usm_sycl(
+        queue, packed, transa, transb, m, n, k, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, gemm_pack_matrix packed,
+                         transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                         std::int64_t k, const double *a, std::int64_t lda, const double *b,
+                         std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dgemm_compute_usm_sycl(
+        queue, packed, transa, transb, m, n, k, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm_vbatch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+                        float alpha, const float **a, std::int64_t *lda, const float **b,
+                        std::int64_t *ldb, float beta, float **c, std::int64_t *ldc,
+                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sgemm_vbatch_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, batch_size,
+        dependencies);
+}
+
+sycl::event gemm_vbatch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+                        double alpha, const double **a, std::int64_t *lda, const double **b,
+                        std::int64_t *ldb, double beta, double **c, std::int64_t *ldc,
+                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dgemm_vbatch_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, batch_size,
+        dependencies);
+}
+
+sycl::event gemm_vbatch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+                        std::complex<float> alpha, const std::complex<float> **a, std::int64_t *lda,
+                        const std::complex<float> **b, std::int64_t *ldb, std::complex<float> beta,
+                        std::complex<float> **c, std::int64_t *ldc, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_cgemm_vbatch_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, batch_size,
+        dependencies);
+}
+
+sycl::event gemm_vbatch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+                        std::complex<double> alpha, const std::complex<double> **a,
+                        std::int64_t *lda, const std::complex<double> **b, std::int64_t *ldb,
+                        std::complex<double> beta, std::complex<double> **c, std::int64_t *ldc,
+                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_zgemm_vbatch_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, batch_size,
+        dependencies);
+}
+
+sycl::event axpy_dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+                     const float *x, std::int64_t incx, float *y, std::int64_t incy, const float *z,
+                     std::int64_t incz, float *result,
+                     const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_saxpy_dot_usm_sycl(
+        queue, n, alpha, x, incx, y, incy, z, incz, result, dependencies);
+}
+
+sycl::event axpy_dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+                     const double *x, std::int64_t incx, double *y, std::int64_t incy,
+                     const double *z, std::int64_t incz, double *result,
+                     const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_daxpy_dot_usm_sycl(
+        queue, n, alpha, x, incx, y, incy, z, incz, result, dependencies);
+}
+
+sycl::event dot2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
+                 std::int64_t incx, const float *y, std::int64_t incy, const float *z,
+                 std::int64_t incz, float *result, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sdot2_usm_sycl(queue, n, x, incx, y, incy, z, incz,
+                                                               result, dependencies);
+}
+
+sycl::event dot2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
+                 std::int64_t incx, const double *y, std::int64_t incy, const double *z,
+                 std::int64_t incz, double *result, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_ddot2_usm_sycl(queue, n, x, incx, y, incy, z, incz,
+                                                               result, dependencies);
+}
+
+sycl::event axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+                       const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
+                       float *result, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_saxpby_nrm2_usm_sycl(queue, n, alpha, x, incx, beta,
+                                                                     y, incy, result, dependencies);
+}
+
+sycl::event axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+                       const double *x, std::int64_t incx, double beta, double *y,
+                       std::int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_daxpby_nrm2_usm_sycl(queue, n, alpha, x, incx, beta,
+                                                                     y, incy, result, dependencies);
+}
+
+sycl::event axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
+                       std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
+                       float *result, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_caxpby_nrm2_usm_sycl(queue, n, alpha, x, incx, beta,
+                                                                     y, incy, result, dependencies);
+}
+
+sycl::event axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
+                       std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
+                       double *result, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_zaxpby_nrm2_usm_sycl(queue, n, alpha, x, incx, beta,
+                                                                     y, incy, result, dependencies);
+}
+
+sycl::event mdot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
+                 std::int64_t incx, const float *y, std::int64_t incy, std::int64_t stridey,
+                 float *result, std::int64_t batch_size,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_smdot_usm_sycl(queue, n, x, incx, y, incy, stridey,
+                                                               result, batch_size, dependencies);
+}
+
+sycl::event mdot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
+                 std::int64_t incx, const double *y, std::int64_t incy, std::int64_t stridey,
+                 double *result, std::int64_t batch_size,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dmdot_usm_sycl(queue, n, x, incx, y, incy, stridey,
+                                                               result, batch_size, dependencies);
+}
+
+sycl::event axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *alpha,
+                 const float *x, std::int64_t incx, float *y, std::int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_saxpy_ptr_usm_sycl(queue, n, alpha, x, incx, y,
+                                                                   incy, dependencies);
+}
+
+sycl::event axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 const double *alpha, const double *x, std::int64_t incx, double *y,
+                 std::int64_t incy, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_daxpy_ptr_usm_sycl(queue, n, alpha, x, incx, y,
+                                                                   incy, dependencies);
+}
+
+sycl::event axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 const std::complex<float> *alpha, const std::complex<float> *x, std::int64_t incx,
+                 std::complex<float> *y, std::int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_caxpy_ptr_usm_sycl(queue, n, alpha, x, incx, y,
+                                                                   incy, dependencies);
+}
+
+sycl::event axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 const std::complex<double> *alpha, const std::complex<double> *x,
+                 std::int64_t incx, std::complex<double> *y, std::int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_zaxpy_ptr_usm_sycl(queue, n, alpha, x, incx, y,
+                                                                   incy, dependencies);
+}
+
+sycl::event axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                  const float *alpha, const float *x, std::int64_t incx, const float *beta,
+                  float *y, std::int64_t incy, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_saxpby_ptr_usm_sycl(queue, n, alpha, x, incx, beta,
+                                                                    y, incy, dependencies);
+}
+
+sycl::event axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                  const double *alpha, const double *x, std::int64_t incx, const double *beta,
+                  double *y, std::int64_t incy, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_daxpby_ptr_usm_sycl(queue, n, alpha, x, incx, beta,
+                                                                    y, incy, dependencies);
+}
+
+sycl::event axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                  const std::complex<float> *alpha, const std::complex<float> *x, std::int64_t incx,
+                  const std::complex<float> *beta, std::complex<float> *y, std::int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_caxpby_ptr_usm_sycl(queue, n, alpha, x, incx, beta,
+                                                                    y, incy, dependencies);
+}
+
+sycl::event axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                  const std::complex<double> *alpha, const std::complex<double> *x,
+                  std::int64_t incx, const std::complex<double> *beta, std::complex<double> *y,
+                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_zaxpby_ptr_usm_sycl(queue, n, alpha, x, incx, beta,
+                                                                    y, incy, dependencies);
+}
+
+sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *alpha,
+                 float *x, std::int64_t incx, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sscal_ptr_usm_sycl(queue, n, alpha, x, incx,
+                                                                   dependencies);
+}
+
+sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 const double *alpha, double *x, std::int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dscal_ptr_usm_sycl(queue, n, alpha, x, incx,
+                                                                   dependencies);
+}
+
+sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 const std::complex<float> *alpha, std::complex<float> *x, std::int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_cscal_ptr_usm_sycl(queue, n, alpha, x, incx,
+                                                                   dependencies);
+}
+
+sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 const std::complex<double> *alpha, std::complex<double> *x, std::int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_zscal_ptr_usm_sycl(queue, n, alpha, x, incx,
+                                                                   dependencies);
+}
+
+sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+                 std::int64_t n, const float *alpha, const float *a, std::int64_t lda,
+                 const float *x, std::int64_t incx, const float *beta, float *y, std::int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sgemv_ptr_usm_sycl(
+        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+}
+
+sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+                 std::int64_t n, const double *alpha, const double *a, std::int64_t lda,
+                 const double *x, std::int64_t incx, const double *beta, double *y,
+                 std::int64_t incy, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dgemv_ptr_usm_sycl(
+        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+}
+
+sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+                 std::int64_t n, const std::complex<float> *alpha, const std::complex<float> *a,
+                 std::int64_t lda, const std::complex<float> *x, std::int64_t incx,
+                 const std::complex<float> *beta, std::complex<float> *y, std::int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_cgemv_ptr_usm_sycl(
+        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+}
+
+sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+                 std::int64_t n, const std::complex<double> *alpha, const std::complex<double> *a,
+                 std::int64_t lda, const std::complex<double> *x, std::int64_t incx,
+                 const std::complex<double> *beta, std::complex<double> *y, std::int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_zgemv_ptr_usm_sycl(
+        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+}
+
+sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, const float *alpha, const float *a,
+                 std::int64_t lda, const float *b, std::int64_t ldb, const float *beta, float *c,
+                 std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sgemm_ptr_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, const double *alpha,
+                 const double *a, std::int64_t lda, const double *b, std::int64_t ldb,
+                 const double *beta, double *c, std::int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dgemm_ptr_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<float> *alpha,
+                 const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+                 std::int64_t ldb, const std::complex<float> *beta, std::complex<float> *c,
+                 std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_cgemm_ptr_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<double> *alpha,
+                 const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+                 std::int64_t ldb, const std::complex<double> *beta, std::complex<double> *c,
+                 std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_zgemm_ptr_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                       transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                       const float *alpha, const float *a, std::int64_t lda, std::int64_t stride_a,
+                       const float *b, std::int64_t ldb, std::int64_t stride_b, const float *beta,
+                       float *c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sgemm_batch_ptr_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+        stride_c, batch_size, dependencies);
+}
+
+sycl::event gemm_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, const double *alpha, const double *a,
+    std::int64_t lda, std::int64_t stride_a, const double *b, std::int64_t ldb,
+    std::int64_t stride_b, const double *beta, double *c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dgemm_batch_ptr_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+        stride_c, batch_size, dependencies);
+}
+
+sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                       transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                       const std::complex<float> *alpha, const std::complex<float> *a,
+                       std::int64_t lda, std::int64_t stride_a, const std::complex<float> *b,
+                       std::int64_t ldb, std::int64_t stride_b, const std::complex<float> *beta,
+                       std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_cgemm_batch_ptr_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+        stride_c, batch_size, dependencies);
+}
+
+sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                       transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                       const std::complex<double> *alpha, const std::complex<double> *a,
+                       std::int64_t lda, std::int64_t stride_a, const std::complex<double> *b,
+                       std::int64_t ldb, std::int64_t stride_b, const std::complex<double> *beta,
+                       std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_zgemm_batch_ptr_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+        stride_c, batch_size, dependencies);
+}
+
+sycl::event gemm3m(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                   std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+                   const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+                   std::complex<float> *c, std::int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_cgemm3m_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm3m(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                   std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+                   const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+                   std::complex<double> *c, std::int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_zgemm3m_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
 } //namespace detail
 } //namespace column_major
 namespace row_major {
@@ -5510,6 +6133,197 @@ void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, t
                                                     beta, b, ldb, c, ldc);
 }
 
+void gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                   std::int64_t k, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
+                   sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    function_tables[libkey].row_major_sgemm_epilogue_sycl(queue, transa, transb, offset_bias, m, n,
+                                                          k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                                          bias, act, clamp_min, clamp_max);
+}
+
+void gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                   std::int64_t k, float alpha, sycl::buffer<sycl::half, 1> &a, std::int64_t lda,
+                   sycl::buffer<sycl::half, 1> &b, std::int64_t ldb, float beta,
+                   sycl::buffer<sycl::half, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    function_tables[libkey].row_major_hgemm_epilogue_sycl(queue, transa, transb, offset_bias, m, n,
+                                                          k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                                          bias, act, clamp_min, clamp_max);
+}
+
+void gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                   std::int64_t k, float alpha, sycl::buffer<sycl::half, 1> &a, std::int64_t lda,
+                   sycl::buffer<sycl::half, 1> &b, std::int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    function_tables[libkey].row_major_gemm_f16f16f32_epilogue_sycl(
+        queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+        clamp_min, clamp_max);
+}
+
+void gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                   std::int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                   sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta,
+                   sycl::buffer<bfloat16, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    function_tables[libkey].row_major_gemm_bf16bf16bf16_epilogue_sycl(
+        queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+        clamp_min, clamp_max);
+}
+
+void gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                   std::int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+                   sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta,
+                   sycl::buffer<float, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+                   activation act, float clamp_min, float clamp_max) {
+    function_tables[libkey].row_major_gemm_bf16bf16f32_epilogue_sycl(
+        queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+        clamp_min, clamp_max);
+}
+
+std::int64_t sgemm_pack_get_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                 gemm_pack_matrix identifier, std::int64_t m, std::int64_t n,
+                                 std::int64_t k) {
+    return function_tables[libkey].row_major_sgemm_pack_get_size_sycl(queue, identifier, m, n, k);
+}
+
+std::int64_t dgemm_pack_get_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                 gemm_pack_matrix identifier, std::int64_t m, std::int64_t n,
+                                 std::int64_t k) {
+    return function_tables[libkey].row_major_dgemm_pack_get_size_sycl(queue, identifier, m, n, k);
+}
+
+void gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, gemm_pack_matrix identifier,
+               transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+               sycl::buffer<float, 1> &src, std::int64_t ld, sycl::buffer<float, 1> &dest) {
+    function_tables[libkey].row_major_sgemm_pack_sycl(queue, identifier, trans, m, n, k, alpha, src,
+                                                      ld, dest);
+}
+
+void gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, gemm_pack_matrix identifier,
+               transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+               sycl::buffer<double, 1> &src, std::int64_t ld, sycl::buffer<double, 1> &dest) {
+    function_tables[libkey].row_major_dgemm_pack_sycl(queue, identifier, trans, m, n, k, alpha, src,
+                                                      ld, dest);
+}
+
+void gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, gemm_pack_matrix packed,
+                  transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                  std::int64_t k, sycl::buffer<float, 1> &a, std::int64_t lda,
+                  sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                  sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].row_major_sgemm_compute_sycl(queue, packed, transa, transb, m, n, k, a,
+                                                         lda, b, ldb, beta, c, ldc);
+}
+
+void gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, gemm_pack_matrix packed,
+                  transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                  std::int64_t k, sycl::buffer<double, 1> &a, std::int64_t lda,
+                  sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+                  sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].row_major_dgemm_compute_sycl(queue, packed, transa, transb, m, n, k, a,
+                                                         lda, b, ldb, beta, c, ldc);
+}
+
+void axpy_dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+              sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
+              std::int64_t incy, sycl::buffer<float, 1> &z, std::int64_t incz,
+              sycl::buffer<float, 1> &result) {
+    function_tables[libkey].row_major_saxpy_dot_sycl(queue, n, alpha, x, incx, y, incy, z, incz,
+                                                     result);
+}
+
+void axpy_dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+              sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
+              std::int64_t incy, sycl::buffer<double, 1> &z, std::int64_t incz,
+              sycl::buffer<double, 1> &result) {
+    function_tables[libkey].row_major_daxpy_dot_sycl(queue, n, alpha, x, incx, y, incy, z, incz,
+                                                     result);
+}
+
+void dot2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+          std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+          sycl::buffer<float, 1> &z, std::int64_t incz, sycl::buffer<float, 1> &result) {
+    function_tables[libkey].row_major_sdot2_sycl(queue, n, x, incx, y, incy, z, incz, result);
+}
+
+void dot2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+          sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
+          std::int64_t incy, sycl::buffer<double, 1> &z, std::int64_t incz,
+          sycl::buffer<double, 1> &result) {
+    function_tables[libkey].row_major_ddot2_sycl(queue, n, x, incx, y, incy, z, incz, result);
+}
+
+void axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+                sycl::buffer<float, 1> &x, std::int64_t incx, float beta, sycl::buffer<float, 1> &y,
+                std::int64_t incy, sycl::buffer<float, 1> &result) {
+    function_tables[libkey].row_major_saxpby_nrm2_sycl(queue, n, alpha, x, incx, beta, y, incy,
+                                                       result);
+}
+
+void axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+                sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                sycl::buffer<double, 1> &y, std::int64_t incy, sycl::buffer<double, 1> &result) {
+    function_tables[libkey].row_major_daxpby_nrm2_sycl(queue, n, alpha, x, incx, beta, y, incy,
+                                                       result);
+}
+
+void axpby_nrm2(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+    sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
+    sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, sycl::buffer<float, 1> &result) {
+    function_tables[libkey].row_major_caxpby_nrm2_sycl(queue, n, alpha, x, incx, beta, y, incy,
+                                                       result);
+}
+
+void axpby_nrm2(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+    sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::complex<double> beta,
+    sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy, sycl::buffer<double, 1> &result) {
+    function_tables[libkey].row_major_zaxpby_nrm2_sycl(queue, n, alpha, x, incx, beta, y, incy,
+                                                       result);
+}
+
+void mdot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+          std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stridey,
+          sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].row_major_smdot_sycl(queue, n, x, incx, y, incy, stridey, result,
+                                                 batch_size);
+}
+
+void mdot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+          sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
+          std::int64_t incy, std::int64_t stridey, sycl::buffer<double, 1> &result,
+          std::int64_t batch_size) {
+    function_tables[libkey].row_major_dmdot_sycl(queue, n, x, incx, y, incy, stridey, result,
+                                                 batch_size);
+}
+
+void gemm3m(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+            sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+            sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].row_major_cgemm3m_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
+                                                   ldb, beta, c, ldc);
+}
+
+void gemm3m(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+            sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+            sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+            sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].row_major_zgemm3m_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
+                                                   ldb, beta, c, ldc);
+}
+
 // USM APIs
 
 sycl::event asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
@@ -7693,6 +8507,436 @@ sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, trans
         queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
 }
 
+sycl::event gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                          transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                          std::int64_t k, float alpha, const float *a, std::int64_t lda,
+                          const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+                          const float *bias, activation act, float clamp_min, float clamp_max,
+                          const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sgemm_epilogue_usm_sycl(
+        queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+        clamp_min, clamp_max, dependencies);
+}
+
+sycl::event gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                          transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                          std::int64_t k, float alpha, const sycl::half *a, std::int64_t lda,
+                          const sycl::half *b, std::int64_t ldb, float beta, sycl::half *c,
+                          std::int64_t ldc, const float *bias, activation act, float clamp_min,
+                          float clamp_max, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_hgemm_epilogue_usm_sycl(
+        queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+        clamp_min, clamp_max, dependencies);
+}
+
+sycl::event gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                          transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                          std::int64_t k, float alpha, const sycl::half *a, std::int64_t lda,
+                          const sycl::half *b, std::int64_t ldb, float beta, float *c,
+                          std::int64_t ldc, const float *bias, activation act, float clamp_min,
+                          float clamp_max, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_gemm_f16f16f32_epilogue_usm_sycl(
+        queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+        clamp_min, clamp_max, dependencies);
+}
+
+sycl::event gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                          transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                          std::int64_t k, float alpha, const bfloat16 *a, std::int64_t lda,
+                          const bfloat16 *b, std::int64_t ldb, float beta, bfloat16 *c,
+                          std::int64_t ldc, const float *bias, activation act, float clamp_min,
+                          float clamp_max, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_gemm_bf16bf16bf16_epilogue_usm_sycl(
+        queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+        clamp_min, clamp_max, dependencies);
+}
+
+sycl::event gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                          transpose transb, offset offset_bias, std::int64_t m, std::int64_t n,
+                          std::int64_t k, float alpha, const bfloat16 *a, std::int64_t lda,
+                          const bfloat16 *b, std::int64_t ldb, float beta, float *c,
+                          std::int64_t ldc, const float *bias, activation act, float clamp_min,
+                          float clamp_max, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_gemm_bf16bf16f32_epilogue_usm_sycl(
+        queue, transa, transb, offset_bias, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, act,
+        clamp_min, clamp_max, dependencies);
+}
+
+sycl::event gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, gemm_pack_matrix identifier,
+                      transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                      const float *src, std::int64_t ld, float *dest,
+                      const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sgemm_pack_usm_sycl(
+        queue, identifier, trans, m, n, k, alpha, src, ld, dest, dependencies);
+}
+
+sycl::event gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, gemm_pack_matrix identifier,
+                      transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                      const double *src, std::int64_t ld, double *dest,
+                      const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dgemm_pack_usm_sycl(
+        queue, identifier, trans, m, n, k, alpha, src, ld, dest, dependencies);
+}
+
+sycl::event gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, gemm_pack_matrix packed,
+                         transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                         std::int64_t k, const float *a, std::int64_t lda, const float *b,
+                         std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sgemm_compute_usm_sycl(
+        queue, packed, transa, transb, m, n, k, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, gemm_pack_matrix packed,
+                         transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                         std::int64_t k, const double *a, std::int64_t lda, const double *b,
+                         std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dgemm_compute_usm_sycl(
+        queue, packed, transa, transb, m, n, k, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm_vbatch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+                        float alpha, const float **a, std::int64_t *lda, const float **b,
+                        std::int64_t *ldb, float beta, float **c, std::int64_t *ldc,
+                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sgemm_vbatch_usm_sycl(queue, transa, transb, m, n, k,
+                                                                   alpha, a, lda, b, ldb, beta, c,
+                                                                   ldc, batch_size, dependencies);
+}
+
+sycl::event gemm_vbatch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+                        double alpha, const double **a, std::int64_t *lda, const double **b,
+                        std::int64_t *ldb, double beta, double **c, std::int64_t *ldc,
+                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dgemm_vbatch_usm_sycl(queue, transa, transb, m, n, k,
+                                                                   alpha, a, lda, b, ldb, beta, c,
+                                                                   ldc, batch_size, dependencies);
+}
+
+sycl::event gemm_vbatch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+                        std::complex<float> alpha, const std::complex<float> **a, std::int64_t *lda,
+                        const std::complex<float> **b, std::int64_t *ldb, std::complex<float> beta,
+                        std::complex<float> **c, std::int64_t *ldc, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_cgemm_vbatch_usm_sycl(queue, transa, transb, m, n, k,
+                                                                   alpha, a, lda, b, ldb, beta, c,
+                                                                   ldc, batch_size, dependencies);
+}
+
+sycl::event gemm_vbatch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+                        std::complex<double> alpha, const std::complex<double> **a,
+                        std::int64_t *lda, const std::complex<double> **b, std::int64_t *ldb,
+                        std::complex<double> beta, std::complex<double> **c, std::int64_t *ldc,
+                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_zgemm_vbatch_usm_sycl(queue, transa, transb, m, n, k,
+                                                                   alpha, a, lda, b, ldb, beta, c,
+                                                                   ldc, batch_size, dependencies);
+}
+
+sycl::event axpy_dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+                     const float *x, std::int64_t incx, float *y, std::int64_t incy, const float *z,
+                     std::int64_t incz, float *result,
+                     const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_saxpy_dot_usm_sycl(queue, n, alpha, x, incx, y, incy,
+                                                                z, incz, result, dependencies);
+}
+
+sycl::event axpy_dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+                     const double *x, std::int64_t incx, double *y, std::int64_t incy,
+                     const double *z, std::int64_t incz, double *result,
+                     const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_daxpy_dot_usm_sycl(queue, n, alpha, x, incx, y, incy,
+                                                                z, incz, result, dependencies);
+}
+
+sycl::event dot2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
+                 std::int64_t incx, const float *y, std::int64_t incy, const float *z,
+                 std::int64_t incz, float *result, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sdot2_usm_sycl(queue, n, x, incx, y, incy, z, incz,
+                                                            result, dependencies);
+}
+
+sycl::event dot2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
+                 std::int64_t incx, const double *y, std::int64_t incy, const double *z,
+                 std::int64_t incz, double *result, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_ddot2_usm_sycl(queue, n, x, incx, y, incy, z, incz,
+                                                            result, dependencies);
+}
+
+sycl::event axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+                       const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
+                       float *result, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_saxpby_nrm2_usm_sycl(queue, n, alpha, x, incx, beta, y,
+                                                                  incy, result, dependencies);
+}
+
+sycl::event axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+                       const double *x, std::int64_t incx, double beta, double *y,
+                       std::int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_daxpby_nrm2_usm_sycl(queue, n, alpha, x, incx, beta, y,
+                                                                  incy, result, dependencies);
+}
+
+sycl::event axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
+                       std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
+                       float *result, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_caxpby_nrm2_usm_sycl(queue, n, alpha, x, incx, beta, y,
+                                                                  incy, result, dependencies);
+}
+
+sycl::event axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
+                       std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
+                       double *result, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_zaxpby_nrm2_usm_sycl(queue, n, alpha, x, incx, beta, y,
+                                                                  incy, result, dependencies);
+}
+
+sycl::event mdot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
+                 std::int64_t incx, const float *y, std::int64_t incy, std::int64_t stridey,
+                 float *result, std::int64_t batch_size,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_smdot_usm_sycl(queue, n, x, incx, y, incy, stridey,
+                                                            result, batch_size, dependencies);
+}
+
+sycl::event mdot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
+                 std::int64_t incx, const double *y, std::int64_t incy, std::int64_t stridey,
+                 double *result, std::int64_t batch_size,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dmdot_usm_sycl(queue, n, x, incx, y, incy, stridey,
+                                                            result, batch_size, dependencies);
+}
+
+sycl::event axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *alpha,
+                 const float *x, std::int64_t incx, float *y, std::int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_saxpy_ptr_usm_sycl(queue, n, alpha, x, incx, y, incy,
+                                                                dependencies);
+}
+
+sycl::event axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 const double *alpha, const double *x, std::int64_t incx, double *y,
+                 std::int64_t incy, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_daxpy_ptr_usm_sycl(queue, n, alpha, x, incx, y, incy,
+                                                                dependencies);
+}
+
+sycl::event axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 const std::complex<float> *alpha, const std::complex<float> *x, std::int64_t incx,
+                 std::complex<float> *y, std::int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_caxpy_ptr_usm_sycl(queue, n, alpha, x, incx, y, incy,
+                                                                dependencies);
+}
+
+sycl::event axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 const std::complex<double> *alpha, const std::complex<double> *x,
+                 std::int64_t incx, std::complex<double> *y, std::int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_zaxpy_ptr_usm_sycl(queue, n, alpha, x, incx, y, incy,
+                                                                dependencies);
+}
+
+sycl::event axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                  const float *alpha, const float *x, std::int64_t incx, const float *beta,
+                  float *y, std::int64_t incy, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_saxpby_ptr_usm_sycl(queue, n, alpha, x, incx, beta, y,
+                                                                 incy, dependencies);
+}
+
+sycl::event axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                  const double *alpha, const double *x, std::int64_t incx, const double *beta,
+                  double *y, std::int64_t incy, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_daxpby_ptr_usm_sycl(queue, n, alpha, x, incx, beta, y,
+                                                                 incy, dependencies);
+}
+
+sycl::event axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                  const std::complex<float> *alpha, const std::complex<float> *x, std::int64_t incx,
+                  const std::complex<float> *beta, std::complex<float> *y, std::int64_t incy,
+                  const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_caxpby_ptr_usm_sycl(queue, n, alpha, x, incx, beta, y,
+                                                                 incy, dependencies);
+}
+
+sycl::event axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                  const std::complex<double> *alpha, const std::complex<double> *x,
+                  std::int64_t incx, const std::complex<double> *beta, std::complex<double> *y,
+                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_zaxpby_ptr_usm_sycl(queue, n, alpha, x, incx, beta, y,
+                                                                 incy, dependencies);
+}
+
+sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *alpha,
+                 float *x, std::int64_t incx, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sscal_ptr_usm_sycl(queue, n, alpha, x, incx,
+                                                                dependencies);
+}
+
+sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 const double *alpha, double *x, std::int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dscal_ptr_usm_sycl(queue, n, alpha, x, incx,
+                                                                dependencies);
+}
+
+sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 const std::complex<float> *alpha, std::complex<float> *x, std::int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_cscal_ptr_usm_sycl(queue, n, alpha, x, incx,
+                                                                dependencies);
+}
+
+sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 const std::complex<double> *alpha, std::complex<double> *x, std::int64_t incx,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_zscal_ptr_usm_sycl(queue, n, alpha, x, incx,
+                                                                dependencies);
+}
+
+sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+                 std::int64_t n, const float *alpha, const float *a, std::int64_t lda,
+                 const float *x, std::int64_t incx, const float *beta, float *y, std::int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sgemv_ptr_usm_sycl(
+        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+}
+
+sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+                 std::int64_t n, const double *alpha, const double *a, std::int64_t lda,
+                 const double *x, std::int64_t incx, const double *beta, double *y,
+                 std::int64_t incy, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dgemv_ptr_usm_sycl(
+        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+}
+
+sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+                 std::int64_t n, const std::complex<float> *alpha, const std::complex<float> *a,
+                 std::int64_t lda, const std::complex<float> *x, std::int64_t incx,
+                 const std::complex<float> *beta, std::complex<float> *y, std::int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_cgemv_ptr_usm_sycl(
+        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+}
+
+sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+                 std::int64_t n, const std::complex<double> *alpha, const std::complex<double> *a,
+                 std::int64_t lda, const std::complex<double> *x, std::int64_t incx,
+                 const std::complex<double> *beta, std::complex<double> *y, std::int64_t incy,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_zgemv_ptr_usm_sycl(
+        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+}
+
+sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, const float *alpha, const float *a,
+                 std::int64_t lda, const float *b, std::int64_t ldb, const float *beta, float *c,
+                 std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sgemm_ptr_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, const double *alpha,
+                 const double *a, std::int64_t lda, const double *b, std::int64_t ldb,
+                 const double *beta, double *c, std::int64_t ldc,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dgemm_ptr_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<float> *alpha,
+                 const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+                 std::int64_t ldb, const std::complex<float> *beta, std::complex<float> *c,
+                 std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_cgemm_ptr_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<double> *alpha,
+                 const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+                 std::int64_t ldb, const std::complex<double> *beta, std::complex<double> *c,
+                 std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_zgemm_ptr_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                       transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                       const float *alpha, const float *a, std::int64_t lda, std::int64_t stride_a,
+                       const float *b, std::int64_t ldb, std::int64_t stride_b, const float *beta,
+                       float *c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sgemm_batch_ptr_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+        stride_c, batch_size, dependencies);
+}
+
+sycl::event gemm_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, const double *alpha, const double *a,
+    std::int64_t lda, std::int64_t stride_a, const double *b, std::int64_t ldb,
+    std::int64_t stride_b, const double *beta, double *c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dgemm_batch_ptr_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+        stride_c, batch_size, dependencies);
+}
+
+sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                       transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                       const std::complex<float> *alpha, const std::complex<float> *a,
+                       std::int64_t lda, std::int64_t stride_a, const std::complex<float> *b,
+                       std::int64_t ldb, std::int64_t stride_b, const std::complex<float> *beta,
+                       std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_cgemm_batch_ptr_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+        stride_c, batch_size, dependencies);
+}
+
+sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                       transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                       const std::complex<double> *alpha, const std::complex<double> *a,
+                       std::int64_t lda, std::int64_t stride_a, const std::complex<double> *b,
+                       std::int64_t ldb, std::int64_t stride_b, const std::complex<double> *beta,
+                       std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_zgemm_batch_ptr_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+        stride_c, batch_size, dependencies);
+}
+
+sycl::event gemm3m(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                   std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+                   const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+                   std::complex<float> *c, std::int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_cgemm3m_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm3m(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                   std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+                   const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+                   std::complex<double> *c, std::int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_zgemm3m_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
 } //namespace detail
 } //namespace row_major
 } //namespace blas
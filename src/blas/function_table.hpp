@@ -1094,6 +1094,118 @@ typedef struct {
                                        std::complex<double> beta,
                                        sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                                        sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+    void (*column_major_sgemm_epilogue_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b,
+        std::int64_t ldb, float beta, sycl::buffer<float, 1> &c, std::int64_t ldc,
+        sycl::buffer<float, 1> &bias, oneapi::mkl::activation act, float clamp_min,
+        float clamp_max);
+    void (*column_major_hgemm_epilogue_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, sycl::buffer<sycl::half, 1> &a, std::int64_t lda,
+        sycl::buffer<sycl::half, 1> &b, std::int64_t ldb, float beta,
+        sycl::buffer<sycl::half, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+        oneapi::mkl::activation act, float clamp_min, float clamp_max);
+    void (*column_major_gemm_f16f16f32_epilogue_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, sycl::buffer<sycl::half, 1> &a, std::int64_t lda,
+        sycl::buffer<sycl::half, 1> &b, std::int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+        std::int64_t ldc, sycl::buffer<float, 1> &bias, oneapi::mkl::activation act,
+        float clamp_min, float clamp_max);
+    void (*column_major_gemm_bf16bf16bf16_epilogue_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, sycl::buffer<oneapi::mkl::bfloat16, 1> &a, std::int64_t lda,
+        sycl::buffer<oneapi::mkl::bfloat16, 1> &b, std::int64_t ldb, float beta,
+        sycl::buffer<oneapi::mkl::bfloat16, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+        oneapi::mkl::activation act, float clamp_min, float clamp_max);
+    void (*column_major_gemm_bf16bf16f32_epilogue_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, sycl::buffer<oneapi::mkl::bfloat16, 1> &a, std::int64_t lda,
+        sycl::buffer<oneapi::mkl::bfloat16, 1> &b, std::int64_t ldb, float beta,
+        sycl::buffer<float, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+        oneapi::mkl::activation act, float clamp_min, float clamp_max);
+    std::int64_t (*column_major_sgemm_pack_get_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix identifier, std::int64_t m,
+        std::int64_t n, std::int64_t k);
+    std::int64_t (*column_major_dgemm_pack_get_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix identifier, std::int64_t m,
+        std::int64_t n, std::int64_t k);
+    void (*column_major_sgemm_pack_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix identifier, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &src,
+        std::int64_t ld, sycl::buffer<float, 1> &dest);
+    void (*column_major_dgemm_pack_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix identifier, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &src,
+        std::int64_t ld, sycl::buffer<double, 1> &dest);
+    void (*column_major_sgemm_compute_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix packed, oneapi::mkl::transpose transa,
+        oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+        sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb,
+        float beta, sycl::buffer<float, 1> &c, std::int64_t ldc);
+    void (*column_major_dgemm_compute_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix packed, oneapi::mkl::transpose transa,
+        oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+        sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb,
+        double beta, sycl::buffer<double, 1> &c, std::int64_t ldc);
+    void (*column_major_saxpy_dot_sycl)(
+        sycl::queue &queue, std::int64_t n, float alpha, sycl::buffer<float, 1> &x,
+        std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy, sycl::buffer<float, 1> &z,
+        std::int64_t incz, sycl::buffer<float, 1> &result);
+    void (*column_major_daxpy_dot_sycl)(
+        sycl::queue &queue, std::int64_t n, double alpha, sycl::buffer<double, 1> &x,
+        std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy,
+        sycl::buffer<double, 1> &z, std::int64_t incz, sycl::buffer<double, 1> &result);
+    void (*column_major_sdot2_sycl)(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                                    std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+                                    sycl::buffer<float, 1> &z, std::int64_t incz,
+                                    sycl::buffer<float, 1> &result);
+    void (*column_major_ddot2_sycl)(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                                    std::int64_t incx, sycl::buffer<double, 1> &y,
+                                    std::int64_t incy, sycl::buffer<double, 1> &z,
+                                    std::int64_t incz, sycl::buffer<double, 1> &result);
+    void (*column_major_saxpby_nrm2_sycl)(sycl::queue &queue, std::int64_t n, float alpha,
+                                          sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                                          sycl::buffer<float, 1> &y, std::int64_t incy,
+                                          sycl::buffer<float, 1> &result);
+    void (*column_major_daxpby_nrm2_sycl)(sycl::queue &queue, std::int64_t n, double alpha,
+                                          sycl::buffer<double, 1> &x, std::int64_t incx,
+                                          double beta, sycl::buffer<double, 1> &y,
+                                          std::int64_t incy, sycl::buffer<double, 1> &result);
+    void (*column_major_caxpby_nrm2_sycl)(
+        sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+        sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
+        sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, sycl::buffer<float, 1> &result);
+    void (*column_major_zaxpby_nrm2_sycl)(
+        sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+        sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::complex<double> beta,
+        sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+        sycl::buffer<double, 1> &result);
+    void (*column_major_smdot_sycl)(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                                    std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+                                    std::int64_t stridey, sycl::buffer<float, 1> &result,
+                                    std::int64_t batch_size);
+    void (*column_major_dmdot_sycl)(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                                    std::int64_t incx, sycl::buffer<double, 1> &y,
+                                    std::int64_t incy, std::int64_t stridey,
+                                    sycl::buffer<double, 1> &result, std::int64_t batch_size);
+    void (*column_major_cgemm3m_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+        sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+        sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+    void (*column_major_zgemm3m_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+        sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+        sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
 
     // USM APIs
 
@@ -2453,6 +2565,244 @@ typedef struct {
         std::complex<double> *alpha, std::complex<double> **ab, std::int64_t *lda,
         std::int64_t *ldb, std::int64_t group_count, std::int64_t *groupsize,
         const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sgemm_epilogue_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, const float *a, std::int64_t lda, const float *b, std::int64_t ldb, float beta,
+        float *c, std::int64_t ldc, const float *bias, oneapi::mkl::activation act, float clamp_min,
+        float clamp_max, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_hgemm_epilogue_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, const sycl::half *a, std::int64_t lda, const sycl::half *b, std::int64_t ldb,
+        float beta, sycl::half *c, std::int64_t ldc, const float *bias, oneapi::mkl::activation act,
+        float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_gemm_f16f16f32_epilogue_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, const sycl::half *a, std::int64_t lda, const sycl::half *b, std::int64_t ldb,
+        float beta, float *c, std::int64_t ldc, const float *bias, oneapi::mkl::activation act,
+        float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_gemm_bf16bf16bf16_epilogue_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, const oneapi::mkl::bfloat16 *a, std::int64_t lda,
+        const oneapi::mkl::bfloat16 *b, std::int64_t ldb, float beta, oneapi::mkl::bfloat16 *c,
+        std::int64_t ldc, const float *bias, oneapi::mkl::activation act, float clamp_min,
+        float clamp_max, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_gemm_bf16bf16f32_epilogue_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, const oneapi::mkl::bfloat16 *a, std::int64_t lda,
+        const oneapi::mkl::bfloat16 *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+        const float *bias, oneapi::mkl::activation act, float clamp_min, float clamp_max,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sgemm_pack_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix identifier, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *src,
+        std::int64_t ld, float *dest, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dgemm_pack_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix identifier, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *src,
+        std::int64_t ld, double *dest, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sgemm_compute_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix packed, oneapi::mkl::transpose transa,
+        oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+        const float *a, std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c,
+        std::int64_t ldc, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dgemm_compute_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix packed, oneapi::mkl::transpose transa,
+        oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+        const double *a, std::int64_t lda, const double *b, std::int64_t ldb, double beta,
+        double *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sgemm_vbatch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t *m, std::int64_t *n, std::int64_t *k, float alpha, const float **a,
+        std::int64_t *lda, const float **b, std::int64_t *ldb, float beta, float **c,
+        std::int64_t *ldc, std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dgemm_vbatch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t *m, std::int64_t *n, std::int64_t *k, double alpha, const double **a,
+        std::int64_t *lda, const double **b, std::int64_t *ldb, double beta, double **c,
+        std::int64_t *ldc, std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_cgemm_vbatch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t *m, std::int64_t *n, std::int64_t *k, std::complex<float> alpha,
+        const std::complex<float> **a, std::int64_t *lda, const std::complex<float> **b,
+        std::int64_t *ldb, std::complex<float> beta, std::complex<float> **c, std::int64_t *ldc,
+        std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_zgemm_vbatch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t *m, std::int64_t *n, std::int64_t *k, std::complex<double> alpha,
+        const std::complex<double> **a, std::int64_t *lda, const std::complex<double> **b,
+        std::int64_t *ldb, std::complex<double> beta, std::complex<double> **c, std::int64_t *ldc,
+        std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_saxpy_dot_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, float alpha, const float *x, std::int64_t incx,
+        float *y, std::int64_t incy, const float *z, std::int64_t incz, float *result,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_daxpy_dot_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, double alpha, const double *x, std::int64_t incx,
+        double *y, std::int64_t incy, const double *z, std::int64_t incz, double *result,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sdot2_usm_sycl)(sycl::queue &queue, std::int64_t n, const float *x,
+                                               std::int64_t incx, const float *y, std::int64_t incy,
+                                               const float *z, std::int64_t incz, float *result,
+                                               const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_ddot2_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx, const double *y,
+        std::int64_t incy, const double *z, std::int64_t incz, double *result,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_saxpby_nrm2_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, float alpha, const float *x, std::int64_t incx,
+        float beta, float *y, std::int64_t incy, float *result,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_daxpby_nrm2_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, double alpha, const double *x, std::int64_t incx,
+        double beta, double *y, std::int64_t incy, double *result,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_caxpby_nrm2_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, std::complex<float> alpha, const std::complex<float> *x,
+        std::int64_t incx, std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
+        float *result, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_zaxpby_nrm2_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+        const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
+        std::complex<double> *y, std::int64_t incy, double *result,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_smdot_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, const float *y,
+        std::int64_t incy, std::int64_t stridey, float *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dmdot_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx, const double *y,
+        std::int64_t incy, std::int64_t stridey, double *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_saxpy_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const float *alpha, const float *x, std::int64_t incx,
+        float *y, std::int64_t incy, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_daxpy_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const double *alpha, const double *x, std::int64_t incx,
+        double *y, std::int64_t incy, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_caxpy_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+        const std::complex<float> *x, std::int64_t incx, std::complex<float> *y, std::int64_t incy,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_zaxpy_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+        const std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
+        std::int64_t incy, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_saxpby_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const float *alpha, const float *x, std::int64_t incx,
+        const float *beta, float *y, std::int64_t incy,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_daxpby_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const double *alpha, const double *x, std::int64_t incx,
+        const double *beta, double *y, std::int64_t incy,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_caxpby_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+        const std::complex<float> *x, std::int64_t incx, const std::complex<float> *beta,
+        std::complex<float> *y, std::int64_t incy, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_zaxpby_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+        const std::complex<double> *x, std::int64_t incx, const std::complex<double> *beta,
+        std::complex<double> *y, std::int64_t incy, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sscal_ptr_usm_sycl)(sycl::queue &queue, std::int64_t n,
+                                                   const float *alpha, float *x, std::int64_t incx,
+                                                   const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dscal_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const double *alpha, double *x, std::int64_t incx,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_cscal_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+        std::complex<float> *x, std::int64_t incx, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_zscal_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+        std::complex<double> *x, std::int64_t incx, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sgemv_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        const float *alpha, const float *a, std::int64_t lda, const float *x, std::int64_t incx,
+        const float *beta, float *y, std::int64_t incy,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dgemv_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        const double *alpha, const double *a, std::int64_t lda, const double *x, std::int64_t incx,
+        const double *beta, double *y, std::int64_t incy,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_cgemv_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        const std::complex<float> *alpha, const std::complex<float> *a, std::int64_t lda,
+        const std::complex<float> *x, std::int64_t incx, const std::complex<float> *beta,
+        std::complex<float> *y, std::int64_t incy, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_zgemv_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        const std::complex<double> *alpha, const std::complex<double> *a, std::int64_t lda,
+        const std::complex<double> *x, std::int64_t incx, const std::complex<double> *beta,
+        std::complex<double> *y, std::int64_t incy, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sgemm_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const float *alpha, const float *a,
+        std::int64_t lda, const float *b, std::int64_t ldb, const float *beta, float *c,
+        std::int64_t ldc, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dgemm_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const double *alpha, const double *a,
+        std::int64_t lda, const double *b, std::int64_t ldb, const double *beta, double *c,
+        std::int64_t ldc, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_cgemm_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<float> *alpha,
+        const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+        std::int64_t ldb, const std::complex<float> *beta, std::complex<float> *c, std::int64_t ldc,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_zgemm_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<double> *alpha,
+        const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+        std::int64_t ldb, const std::complex<double> *beta, std::complex<double> *c,
+        std::int64_t ldc, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sgemm_batch_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const float *alpha, const float *a,
+        std::int64_t lda, std::int64_t stride_a, const float *b, std::int64_t ldb,
+        std::int64_t stride_b, const float *beta, float *c, std::int64_t ldc, std::int64_t stride_c,
+        std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dgemm_batch_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const double *alpha, const double *a,
+        std::int64_t lda, std::int64_t stride_a, const double *b, std::int64_t ldb,
+        std::int64_t stride_b, const double *beta, double *c, std::int64_t ldc,
+        std::int64_t stride_c, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_cgemm_batch_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<float> *alpha,
+        const std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+        const std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+        const std::complex<float> *beta, std::complex<float> *c, std::int64_t ldc,
+        std::int64_t stride_c, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_zgemm_batch_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<double> *alpha,
+        const std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+        const std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+        const std::complex<double> *beta, std::complex<double> *c, std::int64_t ldc,
+        std::int64_t stride_c, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_cgemm3m_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+        std::int64_t ldb, std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_zgemm3m_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+        std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+        const std::vector<sycl::event> &dependencies);
 
     // Buffer APIs
 
@@ -3491,6 +3841,118 @@ typedef struct {
                                     std::complex<double> beta,
                                     sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                                     sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+    void (*row_major_sgemm_epilogue_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b,
+        std::int64_t ldb, float beta, sycl::buffer<float, 1> &c, std::int64_t ldc,
+        sycl::buffer<float, 1> &bias, oneapi::mkl::activation act, float clamp_min,
+        float clamp_max);
+    void (*row_major_hgemm_epilogue_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, sycl::buffer<sycl::half, 1> &a, std::int64_t lda,
+        sycl::buffer<sycl::half, 1> &b, std::int64_t ldb, float beta,
+        sycl::buffer<sycl::half, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+        oneapi::mkl::activation act, float clamp_min, float clamp_max);
+    void (*row_major_gemm_f16f16f32_epilogue_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, sycl::buffer<sycl::half, 1> &a, std::int64_t lda,
+        sycl::buffer<sycl::half, 1> &b, std::int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+        std::int64_t ldc, sycl::buffer<float, 1> &bias, oneapi::mkl::activation act,
+        float clamp_min, float clamp_max);
+    void (*row_major_gemm_bf16bf16bf16_epilogue_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, sycl::buffer<oneapi::mkl::bfloat16, 1> &a, std::int64_t lda,
+        sycl::buffer<oneapi::mkl::bfloat16, 1> &b, std::int64_t ldb, float beta,
+        sycl::buffer<oneapi::mkl::bfloat16, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+        oneapi::mkl::activation act, float clamp_min, float clamp_max);
+    void (*row_major_gemm_bf16bf16f32_epilogue_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, sycl::buffer<oneapi::mkl::bfloat16, 1> &a, std::int64_t lda,
+        sycl::buffer<oneapi::mkl::bfloat16, 1> &b, std::int64_t ldb, float beta,
+        sycl::buffer<float, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+        oneapi::mkl::activation act, float clamp_min, float clamp_max);
+    std::int64_t (*row_major_sgemm_pack_get_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix identifier, std::int64_t m,
+        std::int64_t n, std::int64_t k);
+    std::int64_t (*row_major_dgemm_pack_get_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix identifier, std::int64_t m,
+        std::int64_t n, std::int64_t k);
+    void (*row_major_sgemm_pack_sycl)(sycl::queue &queue, oneapi::mkl::gemm_pack_matrix identifier,
+                                      oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                      std::int64_t k, float alpha, sycl::buffer<float, 1> &src,
+                                      std::int64_t ld, sycl::buffer<float, 1> &dest);
+    void (*row_major_dgemm_pack_sycl)(sycl::queue &queue, oneapi::mkl::gemm_pack_matrix identifier,
+                                      oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                      std::int64_t k, double alpha, sycl::buffer<double, 1> &src,
+                                      std::int64_t ld, sycl::buffer<double, 1> &dest);
+    void (*row_major_sgemm_compute_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix packed, oneapi::mkl::transpose transa,
+        oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+        sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb,
+        float beta, sycl::buffer<float, 1> &c, std::int64_t ldc);
+    void (*row_major_dgemm_compute_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix packed, oneapi::mkl::transpose transa,
+        oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+        sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb,
+        double beta, sycl::buffer<double, 1> &c, std::int64_t ldc);
+    void (*row_major_saxpy_dot_sycl)(
+        sycl::queue &queue, std::int64_t n, float alpha, sycl::buffer<float, 1> &x,
+        std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy, sycl::buffer<float, 1> &z,
+        std::int64_t incz, sycl::buffer<float, 1> &result);
+    void (*row_major_daxpy_dot_sycl)(
+        sycl::queue &queue, std::int64_t n, double alpha, sycl::buffer<double, 1> &x,
+        std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy,
+        sycl::buffer<double, 1> &z, std::int64_t incz, sycl::buffer<double, 1> &result);
+    void (*row_major_sdot2_sycl)(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                                 std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+                                 sycl::buffer<float, 1> &z, std::int64_t incz,
+                                 sycl::buffer<float, 1> &result);
+    void (*row_major_ddot2_sycl)(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                                 std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy,
+                                 sycl::buffer<double, 1> &z, std::int64_t incz,
+                                 sycl::buffer<double, 1> &result);
+    void (*row_major_saxpby_nrm2_sycl)(sycl::queue &queue, std::int64_t n, float alpha,
+                                       sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                                       sycl::buffer<float, 1> &y, std::int64_t incy,
+                                       sycl::buffer<float, 1> &result);
+    void (*row_major_daxpby_nrm2_sycl)(sycl::queue &queue, std::int64_t n, double alpha,
+                                       sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                                       sycl::buffer<double, 1> &y, std::int64_t incy,
+                                       sycl::buffer<double, 1> &result);
+    void (*row_major_caxpby_nrm2_sycl)(
+        sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+        sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
+        sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, sycl::buffer<float, 1> &result);
+    void (*row_major_zaxpby_nrm2_sycl)(
+        sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+        sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::complex<double> beta,
+        sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+        sycl::buffer<double, 1> &result);
+    void (*row_major_smdot_sycl)(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                                 std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+                                 std::int64_t stridey, sycl::buffer<float, 1> &result,
+                                 std::int64_t batch_size);
+    void (*row_major_dmdot_sycl)(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                                 std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy,
+                                 std::int64_t stridey, sycl::buffer<double, 1> &result,
+                                 std::int64_t batch_size);
+    void (*row_major_cgemm3m_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+        sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+        sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+    void (*row_major_zgemm3m_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+        sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+        sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
 
     // USM APIs
 
@@ -4857,6 +5319,244 @@ typedef struct {
         std::int64_t *ldb, std::int64_t group_count, std::int64_t *groupsize,
         const std::vector<sycl::event> &dependencies);
 
+    sycl::event (*row_major_sgemm_epilogue_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, const float *a, std::int64_t lda, const float *b, std::int64_t ldb, float beta,
+        float *c, std::int64_t ldc, const float *bias, oneapi::mkl::activation act, float clamp_min,
+        float clamp_max, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_hgemm_epilogue_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, const sycl::half *a, std::int64_t lda, const sycl::half *b, std::int64_t ldb,
+        float beta, sycl::half *c, std::int64_t ldc, const float *bias, oneapi::mkl::activation act,
+        float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_gemm_f16f16f32_epilogue_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, const sycl::half *a, std::int64_t lda, const sycl::half *b, std::int64_t ldb,
+        float beta, float *c, std::int64_t ldc, const float *bias, oneapi::mkl::activation act,
+        float clamp_min, float clamp_max, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_gemm_bf16bf16bf16_epilogue_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, const oneapi::mkl::bfloat16 *a, std::int64_t lda,
+        const oneapi::mkl::bfloat16 *b, std::int64_t ldb, float beta, oneapi::mkl::bfloat16 *c,
+        std::int64_t ldc, const float *bias, oneapi::mkl::activation act, float clamp_min,
+        float clamp_max, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_gemm_bf16bf16f32_epilogue_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        oneapi::mkl::offset offset_bias, std::int64_t m, std::int64_t n, std::int64_t k,
+        float alpha, const oneapi::mkl::bfloat16 *a, std::int64_t lda,
+        const oneapi::mkl::bfloat16 *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+        const float *bias, oneapi::mkl::activation act, float clamp_min, float clamp_max,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sgemm_pack_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix identifier, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *src,
+        std::int64_t ld, float *dest, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dgemm_pack_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix identifier, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *src,
+        std::int64_t ld, double *dest, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sgemm_compute_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix packed, oneapi::mkl::transpose transa,
+        oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+        const float *a, std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c,
+        std::int64_t ldc, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dgemm_compute_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::gemm_pack_matrix packed, oneapi::mkl::transpose transa,
+        oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+        const double *a, std::int64_t lda, const double *b, std::int64_t ldb, double beta,
+        double *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sgemm_vbatch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t *m, std::int64_t *n, std::int64_t *k, float alpha, const float **a,
+        std::int64_t *lda, const float **b, std::int64_t *ldb, float beta, float **c,
+        std::int64_t *ldc, std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dgemm_vbatch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t *m, std::int64_t *n, std::int64_t *k, double alpha, const double **a,
+        std::int64_t *lda, const double **b, std::int64_t *ldb, double beta, double **c,
+        std::int64_t *ldc, std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_cgemm_vbatch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t *m, std::int64_t *n, std::int64_t *k, std::complex<float> alpha,
+        const std::complex<float> **a, std::int64_t *lda, const std::complex<float> **b,
+        std::int64_t *ldb, std::complex<float> beta, std::complex<float> **c, std::int64_t *ldc,
+        std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_zgemm_vbatch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t *m, std::int64_t *n, std::int64_t *k, std::complex<double> alpha,
+        const std::complex<double> **a, std::int64_t *lda, const std::complex<double> **b,
+        std::int64_t *ldb, std::complex<double> beta, std::complex<double> **c, std::int64_t *ldc,
+        std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_saxpy_dot_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, float alpha, const float *x, std::int64_t incx,
+        float *y, std::int64_t incy, const float *z, std::int64_t incz, float *result,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_daxpy_dot_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, double alpha, const double *x, std::int64_t incx,
+        double *y, std::int64_t incy, const double *z, std::int64_t incz, double *result,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sdot2_usm_sycl)(sycl::queue &queue, std::int64_t n, const float *x,
+                                            std::int64_t incx, const float *y, std::int64_t incy,
+                                            const float *z, std::int64_t incz, float *result,
+                                            const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_ddot2_usm_sycl)(sycl::queue &queue, std::int64_t n, const double *x,
+                                            std::int64_t incx, const double *y, std::int64_t incy,
+                                            const double *z, std::int64_t incz, double *result,
+                                            const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_saxpby_nrm2_usm_sycl)(sycl::queue &queue, std::int64_t n, float alpha,
+                                                  const float *x, std::int64_t incx, float beta,
+                                                  float *y, std::int64_t incy, float *result,
+                                                  const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_daxpby_nrm2_usm_sycl)(sycl::queue &queue, std::int64_t n, double alpha,
+                                                  const double *x, std::int64_t incx, double beta,
+                                                  double *y, std::int64_t incy, double *result,
+                                                  const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_caxpby_nrm2_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, std::complex<float> alpha, const std::complex<float> *x,
+        std::int64_t incx, std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
+        float *result, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_zaxpby_nrm2_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+        const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
+        std::complex<double> *y, std::int64_t incy, double *result,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_smdot_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, const float *y,
+        std::int64_t incy, std::int64_t stridey, float *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dmdot_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx, const double *y,
+        std::int64_t incy, std::int64_t stridey, double *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_saxpy_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const float *alpha, const float *x, std::int64_t incx,
+        float *y, std::int64_t incy, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_daxpy_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const double *alpha, const double *x, std::int64_t incx,
+        double *y, std::int64_t incy, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_caxpy_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+        const std::complex<float> *x, std::int64_t incx, std::complex<float> *y, std::int64_t incy,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_zaxpy_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+        const std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
+        std::int64_t incy, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_saxpby_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const float *alpha, const float *x, std::int64_t incx,
+        const float *beta, float *y, std::int64_t incy,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_daxpby_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const double *alpha, const double *x, std::int64_t incx,
+        const double *beta, double *y, std::int64_t incy,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_caxpby_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+        const std::complex<float> *x, std::int64_t incx, const std::complex<float> *beta,
+        std::complex<float> *y, std::int64_t incy, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_zaxpby_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+        const std::complex<double> *x, std::int64_t incx, const std::complex<double> *beta,
+        std::complex<double> *y, std::int64_t incy, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sscal_ptr_usm_sycl)(sycl::queue &queue, std::int64_t n,
+                                                const float *alpha, float *x, std::int64_t incx,
+                                                const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dscal_ptr_usm_sycl)(sycl::queue &queue, std::int64_t n,
+                                                const double *alpha, double *x, std::int64_t incx,
+                                                const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_cscal_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+        std::complex<float> *x, std::int64_t incx, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_zscal_ptr_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+        std::complex<double> *x, std::int64_t incx, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sgemv_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        const float *alpha, const float *a, std::int64_t lda, const float *x, std::int64_t incx,
+        const float *beta, float *y, std::int64_t incy,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dgemv_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        const double *alpha, const double *a, std::int64_t lda, const double *x, std::int64_t incx,
+        const double *beta, double *y, std::int64_t incy,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_cgemv_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        const std::complex<float> *alpha, const std::complex<float> *a, std::int64_t lda,
+        const std::complex<float> *x, std::int64_t incx, const std::complex<float> *beta,
+        std::complex<float> *y, std::int64_t incy, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_zgemv_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        const std::complex<double> *alpha, const std::complex<double> *a, std::int64_t lda,
+        const std::complex<double> *x, std::int64_t incx, const std::complex<double> *beta,
+        std::complex<double> *y, std::int64_t incy, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sgemm_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const float *alpha, const float *a,
+        std::int64_t lda, const float *b, std::int64_t ldb, const float *beta, float *c,
+        std::int64_t ldc, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dgemm_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const double *alpha, const double *a,
+        std::int64_t lda, const double *b, std::int64_t ldb, const double *beta, double *c,
+        std::int64_t ldc, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_cgemm_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<float> *alpha,
+        const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+        std::int64_t ldb, const std::complex<float> *beta, std::complex<float> *c, std::int64_t ldc,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_zgemm_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<double> *alpha,
+        const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+        std::int64_t ldb, const std::complex<double> *beta, std::complex<double> *c,
+        std::int64_t ldc, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sgemm_batch_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const float *alpha, const float *a,
+        std::int64_t lda, std::int64_t stride_a, const float *b, std::int64_t ldb,
+        std::int64_t stride_b, const float *beta, float *c, std::int64_t ldc, std::int64_t stride_c,
+        std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dgemm_batch_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const double *alpha, const double *a,
+        std::int64_t lda, std::int64_t stride_a, const double *b, std::int64_t ldb,
+        std::int64_t stride_b, const double *beta, double *c, std::int64_t ldc,
+        std::int64_t stride_c, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_cgemm_batch_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<float> *alpha,
+        const std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+        const std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+        const std::complex<float> *beta, std::complex<float> *c, std::int64_t ldc,
+        std::int64_t stride_c, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_zgemm_batch_ptr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<double> *alpha,
+        const std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+        const std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+        const std::complex<double> *beta, std::complex<double> *c, std::int64_t ldc,
+        std::int64_t stride_c, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_cgemm3m_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+        std::int64_t ldb, std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_zgemm3m_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+        std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+        const std::vector<sycl::event> &dependencies);
 } blas_function_table_t;
 
 #endif //_BLAS_FUNCTION_TABLE_HPP_
@@ -34,6 +34,8 @@
 #include "oneapi/mkl/dft/detail/cufft/onemkl_dft_cufft.hpp"
 #include "oneapi/mkl/dft/types.hpp"
 
+#include "dft/descriptor_config_helper.hpp"
+
 #include <cufft.h>
 #include <cuda.h>
 
@@ -96,6 +98,7 @@ public:
             oneapi::mkl::dft::detail::external_workspace_helper<prec, dom>(
                 config_values.workspace_placement ==
                 oneapi::mkl::dft::detail::config_value::WORKSPACE_EXTERNAL);
+        this->committed_convolution_ = dft::detail::committed_convolution_layout(config_values);
         clean_plans();
 
         if (config_values.fwd_scale != 1.0 || config_values.bwd_scale != 1.0) {
@@ -103,6 +106,10 @@ public:
                 "dft/backends/cufft", __FUNCTION__,
                 "cuFFT does not support values other than 1 for FORWARD/BACKWARD_SCALE");
         }
+        if (dft::detail::is_transposed(config_values)) {
+            throw mkl::unimplemented("dft/backends/cufft", __FUNCTION__,
+                                     "cuFFT does not support transposed output");
+        }
 
         // The cudaStream for the plan is set at execution time so the interop handler can pick the stream.
         constexpr cufftType fwd_type = [] {
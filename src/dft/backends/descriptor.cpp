@@ -28,18 +28,27 @@ namespace dft {
 
 template <precision prec, domain dom>
 void descriptor<prec, dom>::commit(sycl::queue &queue) {
-    if (!pimpl_ || pimpl_->get_queue() != queue) {
-        if (pimpl_) {
-            pimpl_->get_queue().wait();
-        }
-        pimpl_.reset(detail::create_commit(*this, queue));
-    }
-    pimpl_->commit(values_);
+    // The backend is chosen by the loader from the device of the queue, so the
+    // queue alone identifies it in the cache.
+    detail::commit_with_plan_cache(pimpl_, values_, queue, std::nullopt,
+                                   [&]() { return detail::create_commit(*this, queue); });
 }
+
+template <precision prec, domain dom>
+sycl::event descriptor<prec, dom>::commit_async(sycl::queue &queue) {
+    return detail::commit_with_plan_cache(
+        pimpl_, values_, queue, std::nullopt,
+        [&]() { return detail::create_commit(*this, queue); }, true);
+}
+
 template void descriptor<precision::SINGLE, domain::COMPLEX>::commit(sycl::queue &);
 template void descriptor<precision::SINGLE, domain::REAL>::commit(sycl::queue &);
 template void descriptor<precision::DOUBLE, domain::COMPLEX>::commit(sycl::queue &);
 template void descriptor<precision::DOUBLE, domain::REAL>::commit(sycl::queue &);
+template sycl::event descriptor<precision::SINGLE, domain::COMPLEX>::commit_async(sycl::queue &);
+template sycl::event descriptor<precision::SINGLE, domain::REAL>::commit_async(sycl::queue &);
+template sycl::event descriptor<precision::DOUBLE, domain::COMPLEX>::commit_async(sycl::queue &);
+template sycl::event descriptor<precision::DOUBLE, domain::REAL>::commit_async(sycl::queue &);
 
 } //namespace dft
 } //namespace mkl
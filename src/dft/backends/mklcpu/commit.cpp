@@ -33,6 +33,7 @@
 #include "oneapi/mkl/dft/detail/commit_impl.hpp"
 
 #include "dft/backends/mklcpu/commit_derived_impl.hpp"
+#include "dft/descriptor_config_helper.hpp"
 #include "mkl_service.h"
 #include "mkl_dfti.h"
 
@@ -71,6 +72,8 @@ commit_derived_impl<prec, dom>::commit_derived_impl(
 
 template <dft::detail::precision prec, dft::detail::domain dom>
 commit_derived_impl<prec, dom>::~commit_derived_impl() {
+    // The handles must not be freed while an asynchronous commit uses them.
+    this->commit_event_.wait();
     for (auto dir : { DIR::fwd, DIR::bwd }) {
         DftiFreeDescriptor(&bidirection_handle[dir]);
     }
@@ -79,35 +82,58 @@ commit_derived_impl<prec, dom>::~commit_derived_impl() {
 template <dft::detail::precision prec, dft::detail::domain dom>
 void commit_derived_impl<prec, dom>::commit(
     const dft::detail::dft_values<prec, dom>& config_values) {
+    commit_async(config_values).wait();
+}
+
+template <dft::detail::precision prec, dft::detail::domain dom>
+sycl::event commit_derived_impl<prec, dom>::commit_async(
+    const dft::detail::dft_values<prec, dom>& config_values) {
+    // The handles are reconfigured on the host, so a previous commit must have finished.
+    this->commit_event_.wait();
+    for (auto dir : { DIR::fwd, DIR::bwd }) {
+        handle_state[dir].store(state::not_committed, std::memory_order_relaxed);
+    }
     this->external_workspace_helper_ =
         oneapi::mkl::dft::detail::external_workspace_helper<prec, dom>(
             config_values.workspace_placement ==
             oneapi::mkl::dft::detail::config_value::WORKSPACE_EXTERNAL);
     set_value(bidirection_handle.data(), config_values);
+    committed_placement = config_values.placement;
+    committed_complex_storage = config_values.complex_storage;
+    this->committed_convolution_ = dft::detail::committed_convolution_layout(config_values);
+    for (auto dir : { DIR::fwd, DIR::bwd }) {
+        handle_state[dir].store(state::committing, std::memory_order_release);
+    }
+
+    // Compute calls read the handles through bidirection_buffer, so they are ordered after the
+    // commit by the SYCL runtime.
+    this->commit_event_ = this->get_queue().submit([&](sycl::handler& cgh) {
+        auto bidir_handle_obj = bidirection_buffer.get_access<sycl::access::mode::read_write>(cgh);
 
-    this->get_queue()
-        .submit([&](sycl::handler& cgh) {
-            auto bidir_handle_obj =
-                bidirection_buffer.get_access<sycl::access::mode::read_write>(cgh);
-
-            host_task<detail::kernel_name<mklcpu_desc_t>>(cgh, [=]() {
-                DFT_ERROR status[2] = { DFTI_BAD_DESCRIPTOR, DFTI_BAD_DESCRIPTOR };
-
-                for (auto dir : { DIR::fwd, DIR::bwd })
-                    status[dir] = DftiCommitDescriptor(bidir_handle_obj[dir]);
-
-                // this is important for real-batched transforms, as the backward transform would
-                // be inconsistent based on the stride setup, but once recommited before backward
-                // it should work just fine. so we error out only if there is a issue with both.
-                if (status[0] != DFTI_NO_ERROR && status[1] != DFTI_NO_ERROR) {
-                    std::string err = std::string("DftiCommitDescriptor failed with status : ") +
-                                      DftiErrorMessage(status[0]) + std::string(", ") +
-                                      DftiErrorMessage(status[1]);
-                    throw oneapi::mkl::exception("dft/backends/mklcpu", "commit", err);
-                }
-            });
-        })
-        .wait();
+        auto states = handle_state.data();
+
+        host_task<detail::kernel_name<mklcpu_desc_t>>(cgh, [=]() {
+            DFT_ERROR status[2] = { DFTI_BAD_DESCRIPTOR, DFTI_BAD_DESCRIPTOR };
+
+            for (auto dir : { DIR::fwd, DIR::bwd }) {
+                status[dir] = DftiCommitDescriptor(bidir_handle_obj[dir]);
+                states[dir].store(status[dir] == DFTI_NO_ERROR ? state::committed
+                                                               : state::not_committed,
+                                  std::memory_order_release);
+            }
+
+            // this is important for real-batched transforms, as the backward transform would
+            // be inconsistent based on the stride setup, but once recommited before backward
+            // it should work just fine. so we error out only if there is a issue with both.
+            if (status[0] != DFTI_NO_ERROR && status[1] != DFTI_NO_ERROR) {
+                std::string err = std::string("DftiCommitDescriptor failed with status : ") +
+                                  DftiErrorMessage(status[0]) + std::string(", ") +
+                                  DftiErrorMessage(status[1]);
+                throw oneapi::mkl::exception("dft/backends/mklcpu", "commit", err);
+            }
+        });
+    });
+    return this->commit_event_;
 }
 
 template <dft::detail::precision prec, dft::detail::domain dom>
@@ -115,6 +141,83 @@ void* commit_derived_impl<prec, dom>::get_handle() noexcept {
     return reinterpret_cast<void*>(bidirection_handle.data());
 }
 
+// Check that both handles can run a convolution, and get its layout. Everything is checked
+// against the committed configuration, as the descriptor may have been changed since.
+template <dft::detail::precision prec, dft::detail::domain dom>
+dft::detail::convolution_layout checked_convolution_layout(
+    const commit_derived_impl<prec, dom>& commit_handle) {
+    if (!commit_handle.is_usable(DIR::fwd) || !commit_handle.is_usable(DIR::bwd)) {
+        throw mkl::invalid_argument("DFT", "compute_convolution",
+                                    "MKLCPU DFT descriptor was not successfully committed.");
+    }
+    return commit_handle.get_committed_convolution_layout().get("compute_convolution");
+}
+
+// The convolution run by the host task, with the handles of both directions.
+template <typename FwdT, typename BwdT>
+void host_convolution(mklcpu_desc_t fwd_handle, mklcpu_desc_t bwd_handle, FwdT* inout,
+                      const BwdT* filter, const dft::detail::convolution_layout& layout,
+                      bool conjugate_filter) {
+    DFT_ERROR status = DftiComputeForward(fwd_handle, inout);
+    if (status != DFTI_NO_ERROR) {
+        throw oneapi::mkl::exception(
+            "dft/backends/mklcpu", "compute_convolution",
+            std::string("DftiComputeForward failed : ") + DftiErrorMessage(status));
+    }
+    auto* spectrum = reinterpret_cast<BwdT*>(inout);
+    const std::int64_t size = layout.spectrum_size();
+    for (std::int64_t b = 0; b < layout.batch; ++b) {
+        for (std::int64_t i = 0; i < size; ++i) {
+            auto& value = spectrum[layout.data_offset(b, i)];
+            value = dft::detail::apply_filter(value, filter[i], conjugate_filter);
+        }
+    }
+    status = DftiComputeBackward(bwd_handle, inout);
+    if (status != DFTI_NO_ERROR) {
+        throw oneapi::mkl::exception(
+            "dft/backends/mklcpu", "compute_convolution",
+            std::string("DftiComputeBackward failed : ") + DftiErrorMessage(status));
+    }
+}
+
+template <dft::detail::precision prec, dft::detail::domain dom>
+void commit_derived_impl<prec, dom>::convolve_ip_cc(descriptor_type& desc,
+                                                    sycl::buffer<fwd_type, 1>& inout,
+                                                    sycl::buffer<bwd_type, 1>& filter,
+                                                    bool conjugate_filter) {
+    this->template compute_call_throw<sycl::buffer<fwd_type, 1>>("compute_convolution");
+    const auto layout = checked_convolution_layout(*this);
+    dft::detail::check_filter_size(filter.size(), layout, "compute_convolution");
+
+    this->get_queue().submit([&](sycl::handler& cgh) {
+        auto desc_acc = bidirection_buffer.template get_access<sycl::access::mode::read>(cgh);
+        auto inout_acc = inout.template get_access<sycl::access::mode::read_write>(cgh);
+        auto filter_acc = filter.template get_access<sycl::access::mode::read>(cgh);
+        host_task<class host_kernel_convolution>(cgh, [=]() {
+            host_convolution(desc_acc[DIR::fwd], desc_acc[DIR::bwd], acc_to_ptr(inout_acc),
+                             acc_to_ptr(filter_acc), layout, conjugate_filter);
+        });
+    });
+}
+
+template <dft::detail::precision prec, dft::detail::domain dom>
+sycl::event commit_derived_impl<prec, dom>::convolve_ip_cc(
+    descriptor_type& desc, fwd_type* inout, const bwd_type* filter, bool conjugate_filter,
+    const std::vector<sycl::event>& dependencies) {
+    this->template compute_call_throw<fwd_type*>("compute_convolution");
+    const auto layout = checked_convolution_layout(*this);
+
+    return this->get_queue().submit([&](sycl::handler& cgh) {
+        auto desc_acc = bidirection_buffer.template get_access<sycl::access::mode::read>(cgh);
+
+        cgh.depends_on(dependencies);
+        host_task<class host_usm_kernel_convolution>(cgh, [=]() {
+            host_convolution(desc_acc[DIR::fwd], desc_acc[DIR::bwd], inout, filter, layout,
+                             conjugate_filter);
+        });
+    });
+}
+
 template <dft::detail::precision prec, dft::detail::domain dom>
 template <typename... Args>
 void commit_derived_impl<prec, dom>::set_value_item(mklcpu_desc_t hand, enum DFTI_CONFIG_PARAM name,
@@ -129,9 +232,26 @@ void commit_derived_impl<prec, dom>::set_value_item(mklcpu_desc_t hand, enum DFT
 template <dft::detail::precision prec, dft::detail::domain dom>
 void commit_derived_impl<prec, dom>::set_value(mklcpu_desc_t* descHandle,
                                                const dft::detail::dft_values<prec, dom>& config) {
+    // MKL has no transposed output for a single process. The transposed layout is given to it as
+    // the strides of the backward domain instead, which out-of-place transforms can write without
+    // a separate transpose.
+    const bool transposed = dft::detail::is_transposed(config);
+    if (transposed && config.placement != dft::detail::config_value::NOT_INPLACE) {
+        throw mkl::invalid_argument("dft/backends/mklcpu", "commit",
+                                    "MKLCPU only supports transposed output out-of-place.");
+    }
+    std::array<std::vector<std::int64_t>, 2> input_strides{ config.input_strides,
+                                                            config.input_strides };
+    std::array<std::vector<std::int64_t>, 2> output_strides{ config.output_strides,
+                                                             config.output_strides };
+    if (transposed) {
+        output_strides[DIR::fwd] = dft::detail::get_transposed_strides(config);
+        input_strides[DIR::bwd] = output_strides[DIR::fwd];
+        output_strides[DIR::bwd] = config.input_strides;
+    }
     for (auto dir : { DIR::fwd, DIR::bwd }) {
-        set_value_item(descHandle[dir], DFTI_INPUT_STRIDES, config.input_strides.data());
-        set_value_item(descHandle[dir], DFTI_OUTPUT_STRIDES, config.output_strides.data());
+        set_value_item(descHandle[dir], DFTI_INPUT_STRIDES, input_strides[dir].data());
+        set_value_item(descHandle[dir], DFTI_OUTPUT_STRIDES, output_strides[dir].data());
         set_value_item(descHandle[dir], DFTI_BACKWARD_SCALE, config.bwd_scale);
         set_value_item(descHandle[dir], DFTI_FORWARD_SCALE, config.fwd_scale);
         set_value_item(descHandle[dir], DFTI_NUMBER_OF_TRANSFORMS, config.number_of_transforms);
@@ -154,15 +274,17 @@ void commit_derived_impl<prec, dom>::set_value(mklcpu_desc_t* descHandle,
             throw mkl::invalid_argument("dft/backends/mklcpu", "commit",
                                         "MKLCPU only supports workspace set to allow");
         }
-        // Setting the ordering causes an FFT_INVALID_DESCRIPTOR. Check that default is used:
-        if (config.ordering != dft::detail::config_value::ORDERED) {
-            throw mkl::invalid_argument("dft/backends/mklcpu", "commit",
-                                        "MKLCPU only supports ordered ordering.");
+        // MKL supports BACKWARD_SCRAMBLED for one-dimensional complex transforms only, and
+        // setting the ordering of other transforms causes an FFT_INVALID_DESCRIPTOR. The value is
+        // set both ways when supported, so a recommit can return to ORDERED.
+        if (dom == dft::detail::domain::COMPLEX && config.dimensions.size() == 1) {
+            set_value_item(descHandle[dir], DFTI_ORDERING,
+                           to_mklcpu<config_param::ORDERING>(config.ordering));
         }
-        // Setting the transpose causes an FFT_INVALID_DESCRIPTOR. Check that default is used:
-        if (config.transpose != false) {
-            throw mkl::invalid_argument("dft/backends/mklcpu", "commit",
-                                        "MKLCPU only supports non-transposed.");
+        else if (config.ordering != dft::detail::config_value::ORDERED) {
+            throw mkl::invalid_argument(
+                "dft/backends/mklcpu", "commit",
+                "MKLCPU only supports BACKWARD_SCRAMBLED for one-dimensional complex transforms.");
         }
     }
 }
@@ -20,8 +20,12 @@
 #ifndef _ONEMKL_DFT_COMMIT_DERIVED_IMPL_HPP_
 #define _ONEMKL_DFT_COMMIT_DERIVED_IMPL_HPP_
 
+#include <array>
+#include <atomic>
+
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/dft/detail/types_impl.hpp"
+#include "oneapi/mkl/dft/detail/convolution_impl.hpp"
 #include "dft/backends/mklcpu/mklcpu_helpers.hpp"
 
 // MKLCPU header
@@ -49,6 +53,9 @@ public:
 
     virtual void commit(const dft::detail::dft_values<prec, dom>& config_values) override;
 
+    virtual sycl::event commit_async(
+        const dft::detail::dft_values<prec, dom>& config_values) override;
+
     virtual void* get_handle() noexcept override;
 
     virtual ~commit_derived_impl() override;
@@ -57,16 +64,51 @@ public:
         return bidirection_buffer;
     };
 
+    // Whether compute calls can use the handle of dir: it is committed, or a commit the compute
+    // call will be ordered after is running. Saves querying DFTI_COMMIT_STATUS on every call.
+    bool is_usable(DIR dir) const noexcept {
+        return handle_state[dir].load(std::memory_order_acquire) != state::not_committed;
+    }
+
+    // The committed value of a param checked by the compute calls.
+    template <dft::detail::config_param Param>
+    dft::detail::config_value get_committed_value() const noexcept {
+        static_assert(Param == dft::detail::config_param::PLACEMENT ||
+                      Param == dft::detail::config_param::COMPLEX_STORAGE);
+        if constexpr (Param == dft::detail::config_param::PLACEMENT) {
+            return committed_placement;
+        }
+        else {
+            return committed_complex_storage;
+        }
+    }
+
 #define BACKEND mklcpu
 #include "../backend_compute_signature.cxx"
 #undef BACKEND
 
+    // The forward transform, the product with the filter and the backward transform run in a
+    // single host task.
+    virtual void convolve_ip_cc(descriptor_type& desc, sycl::buffer<fwd_type, 1>& inout,
+                                sycl::buffer<bwd_type, 1>& filter, bool conjugate_filter) override;
+    virtual sycl::event convolve_ip_cc(descriptor_type& desc, fwd_type* inout,
+                                       const bwd_type* filter, bool conjugate_filter,
+                                       const std::vector<sycl::event>& dependencies) override;
+
 private:
     // bidirectional_handle[0] is the forward handle, bidirectional_handle[1] is the backward handle
     std::array<mklcpu_desc_t, 2> bidirection_handle{ nullptr, nullptr };
     sycl::buffer<mklcpu_desc_t, 1> bidirection_buffer{ bidirection_handle.data(),
                                                        sycl::range<1>{ 2 } };
 
+    enum class state { not_committed, committing, committed };
+    // Set by commit_async, and by the commit host task once DftiCommitDescriptor has returned.
+    std::array<std::atomic<state>, 2> handle_state{ state::not_committed, state::not_committed };
+    dft::detail::config_value committed_placement{ dft::detail::config_value::INPLACE };
+    dft::detail::config_value committed_complex_storage{
+        dft::detail::config_value::COMPLEX_COMPLEX
+    };
+
     template <typename... Args>
     void set_value_item(mklcpu_desc_t hand, enum DFTI_CONFIG_PARAM name, Args... args);
 
@@ -40,53 +40,40 @@ namespace detail {
 // BUFFER version
 // Forward a MKLCPU DFT call to the backend, checking that the commit impl is valid.
 template <dft::precision prec, dft::domain dom>
-inline void check_fwd_commit(dft::descriptor<prec, dom> &desc) {
+inline commit_derived_t<prec, dom> *checked_fwd_commit(dft::descriptor<prec, dom> &desc) {
     auto commit_handle = dft::detail::get_commit(desc);
     if (commit_handle == nullptr || commit_handle->get_backend() != backend::mklcpu) {
         throw mkl::invalid_argument("DFT", "computer_forward",
                                     "DFT descriptor has not been commited for MKLCPU");
     }
-
-    auto mklcpu_desc = reinterpret_cast<detail::mklcpu_desc_t *>(commit_handle->get_handle());
-    MKL_LONG commit_status{ DFTI_UNCOMMITTED };
-    DftiGetValue(mklcpu_desc[0], DFTI_COMMIT_STATUS, &commit_status);
-    if (commit_status != DFTI_COMMITTED) {
+    auto derived_commit = static_cast<commit_derived_t<prec, dom> *>(commit_handle);
+    if (!derived_commit->is_usable(DIR::fwd)) {
         throw mkl::invalid_argument("DFT", "compute_forward",
                                     "MKLCPU DFT descriptor was not successfully committed.");
     }
+    return derived_commit;
 }
 
-// Throw an mkl::invalid_argument if the runtime param in the descriptor does not match
-// the expected value.
-template <dft::detail::config_param Param, dft::detail::config_value Expected, typename DescT>
-inline auto expect_config(DescT &desc, const char *message) {
-    dft::detail::config_value actual{ 0 };
-    desc.get_value(Param, &actual);
-    if (actual != Expected) {
+// Throw an mkl::invalid_argument if the committed value of the param does not match the
+// expected value.
+template <dft::detail::config_param Param, dft::detail::config_value Expected, typename CommitT>
+inline void expect_config(CommitT *commit_handle, const char *message) {
+    if (commit_handle->template get_committed_value<Param>() != Expected) {
         throw mkl::invalid_argument("DFT", "compute_forward", message);
     }
 }
-
-// convert the base commit class to derived cpu commit class
-template <dft::precision prec, dft::domain dom>
-auto get_buffer(commit_t<prec, dom> *commit_handle) {
-    commit_derived_t<prec, dom> *derived_commit =
-        static_cast<commit_derived_t<prec, dom> *>(commit_handle);
-    return derived_commit->get_handle_buffer();
-}
 } // namespace detail
 
 //In-place transform
 template <typename descriptor_type>
 ONEMKL_EXPORT void compute_forward(descriptor_type &desc,
                                    sycl::buffer<fwd<descriptor_type>, 1> &inout) {
+    auto commit_handle = detail::checked_fwd_commit(desc);
     detail::expect_config<dft::detail::config_param::PLACEMENT, dft::detail::config_value::INPLACE>(
-        desc, "Unexpected value for placement");
-    auto commit_handle = dft::detail::get_commit(desc);
-    detail::check_fwd_commit(desc);
+        commit_handle, "Unexpected value for placement");
     sycl::queue &cpu_queue{ commit_handle->get_queue() };
 
-    auto mklcpu_desc_buffer{ detail::get_buffer(commit_handle) };
+    auto mklcpu_desc_buffer{ commit_handle->get_handle_buffer() };
 
     cpu_queue.submit([&](sycl::handler &cgh) {
         auto desc_acc = mklcpu_desc_buffer.template get_access<sycl::access::mode::read>(cgh);
@@ -108,15 +95,13 @@ template <typename descriptor_type>
 ONEMKL_EXPORT void compute_forward(descriptor_type &desc,
                                    sycl::buffer<scalar<descriptor_type>, 1> &inout_re,
                                    sycl::buffer<scalar<descriptor_type>, 1> &inout_im) {
+    auto commit_handle = detail::checked_fwd_commit(desc);
     detail::expect_config<dft::detail::config_param::COMPLEX_STORAGE,
                           dft::detail::config_value::REAL_REAL>(
-        desc, "Unexpected value for complex storage");
-
-    auto commit_handle = dft::detail::get_commit(desc);
-    detail::check_fwd_commit(desc);
+        commit_handle, "Unexpected value for complex storage");
     sycl::queue &cpu_queue{ commit_handle->get_queue() };
 
-    auto mklcpu_desc_buffer{ detail::get_buffer(commit_handle) };
+    auto mklcpu_desc_buffer{ commit_handle->get_handle_buffer() };
 
     cpu_queue.submit([&](sycl::handler &cgh) {
         auto desc_acc = mklcpu_desc_buffer.template get_access<sycl::access::mode::read>(cgh);
@@ -139,15 +124,13 @@ ONEMKL_EXPORT void compute_forward(descriptor_type &desc,
 template <typename descriptor_type>
 ONEMKL_EXPORT void compute_forward(descriptor_type &desc, sycl::buffer<fwd<descriptor_type>, 1> &in,
                                    sycl::buffer<bwd<descriptor_type>, 1> &out) {
+    auto commit_handle = detail::checked_fwd_commit(desc);
     detail::expect_config<dft::detail::config_param::PLACEMENT,
-                          dft::detail::config_value::NOT_INPLACE>(desc,
-                                                                  "Unexpected value for placement");
-
-    auto commit_handle = dft::detail::get_commit(desc);
-    detail::check_fwd_commit(desc);
+                          dft::detail::config_value::NOT_INPLACE>(
+        commit_handle, "Unexpected value for placement");
     sycl::queue &cpu_queue{ commit_handle->get_queue() };
 
-    auto mklcpu_desc_buffer{ detail::get_buffer(commit_handle) };
+    auto mklcpu_desc_buffer{ commit_handle->get_handle_buffer() };
 
     cpu_queue.submit([&](sycl::handler &cgh) {
         auto desc_acc = mklcpu_desc_buffer.template get_access<sycl::access::mode::read>(cgh);
@@ -174,15 +157,13 @@ ONEMKL_EXPORT void compute_forward(descriptor_type &desc,
                                    sycl::buffer<scalar<descriptor_type>, 1> &in_im,
                                    sycl::buffer<scalar<descriptor_type>, 1> &out_re,
                                    sycl::buffer<scalar<descriptor_type>, 1> &out_im) {
+    auto commit_handle = detail::checked_fwd_commit(desc);
     detail::expect_config<dft::detail::config_param::COMPLEX_STORAGE,
                           dft::detail::config_value::REAL_REAL>(
-        desc, "Unexpected value for complex storage");
-
-    auto commit_handle = dft::detail::get_commit(desc);
-    detail::check_fwd_commit(desc);
+        commit_handle, "Unexpected value for complex storage");
     sycl::queue &cpu_queue{ commit_handle->get_queue() };
 
-    auto mklcpu_desc_buffer{ detail::get_buffer(commit_handle) };
+    auto mklcpu_desc_buffer{ commit_handle->get_handle_buffer() };
 
     cpu_queue.submit([&](sycl::handler &cgh) {
         auto desc_acc = mklcpu_desc_buffer.template get_access<sycl::access::mode::read>(cgh);
@@ -212,14 +193,12 @@ ONEMKL_EXPORT void compute_forward(descriptor_type &desc,
 template <typename descriptor_type>
 ONEMKL_EXPORT sycl::event compute_forward(descriptor_type &desc, fwd<descriptor_type> *inout,
                                           const std::vector<sycl::event> &dependencies) {
+    auto commit_handle = detail::checked_fwd_commit(desc);
     detail::expect_config<dft::detail::config_param::PLACEMENT, dft::detail::config_value::INPLACE>(
-        desc, "Unexpected value for placement");
-
-    auto commit_handle = dft::detail::get_commit(desc);
-    detail::check_fwd_commit(desc);
+        commit_handle, "Unexpected value for placement");
     sycl::queue &cpu_queue{ commit_handle->get_queue() };
 
-    auto mklcpu_desc_buffer{ detail::get_buffer(commit_handle) };
+    auto mklcpu_desc_buffer{ commit_handle->get_handle_buffer() };
 
     return cpu_queue.submit([&](sycl::handler &cgh) {
         auto desc_acc = mklcpu_desc_buffer.template get_access<sycl::access::mode::read>(cgh);
@@ -241,15 +220,13 @@ template <typename descriptor_type>
 ONEMKL_EXPORT sycl::event compute_forward(descriptor_type &desc, scalar<descriptor_type> *inout_re,
                                           scalar<descriptor_type> *inout_im,
                                           const std::vector<sycl::event> &dependencies) {
+    auto commit_handle = detail::checked_fwd_commit(desc);
     detail::expect_config<dft::detail::config_param::COMPLEX_STORAGE,
                           dft::detail::config_value::REAL_REAL>(
-        desc, "Unexpected value for complex storage");
-
-    auto commit_handle = dft::detail::get_commit(desc);
-    detail::check_fwd_commit(desc);
+        commit_handle, "Unexpected value for complex storage");
     sycl::queue &cpu_queue{ commit_handle->get_queue() };
 
-    auto mklcpu_desc_buffer{ detail::get_buffer(commit_handle) };
+    auto mklcpu_desc_buffer{ commit_handle->get_handle_buffer() };
 
     return cpu_queue.submit([&](sycl::handler &cgh) {
         auto desc_acc = mklcpu_desc_buffer.template get_access<sycl::access::mode::read>(cgh);
@@ -272,15 +249,13 @@ ONEMKL_EXPORT sycl::event compute_forward(descriptor_type &desc, fwd<descriptor_
                                           bwd<descriptor_type> *out,
                                           const std::vector<sycl::event> &dependencies) {
     // Check: inplace
+    auto commit_handle = detail::checked_fwd_commit(desc);
     detail::expect_config<dft::detail::config_param::PLACEMENT,
-                          dft::detail::config_value::NOT_INPLACE>(desc,
-                                                                  "Unexpected value for placement");
-
-    auto commit_handle = dft::detail::get_commit(desc);
-    detail::check_fwd_commit(desc);
+                          dft::detail::config_value::NOT_INPLACE>(
+        commit_handle, "Unexpected value for placement");
     sycl::queue &cpu_queue{ commit_handle->get_queue() };
 
-    auto mklcpu_desc_buffer{ detail::get_buffer(commit_handle) };
+    auto mklcpu_desc_buffer{ commit_handle->get_handle_buffer() };
 
     return cpu_queue.submit([&](sycl::handler &cgh) {
         auto desc_acc = mklcpu_desc_buffer.template get_access<sycl::access::mode::read>(cgh);
@@ -304,15 +279,13 @@ ONEMKL_EXPORT sycl::event compute_forward(descriptor_type &desc, scalar<descript
                                           scalar<descriptor_type> *out_re,
                                           scalar<descriptor_type> *out_im,
                                           const std::vector<sycl::event> &dependencies) {
+    auto commit_handle = detail::checked_fwd_commit(desc);
     detail::expect_config<dft::detail::config_param::COMPLEX_STORAGE,
                           dft::detail::config_value::REAL_REAL>(
-        desc, "Unexpected value for complex storage");
-
-    auto commit_handle = dft::detail::get_commit(desc);
-    detail::check_fwd_commit(desc);
+        commit_handle, "Unexpected value for complex storage");
     sycl::queue &cpu_queue{ commit_handle->get_queue() };
 
-    auto mklcpu_desc_buffer{ detail::get_buffer(commit_handle) };
+    auto mklcpu_desc_buffer{ commit_handle->get_handle_buffer() };
 
     return cpu_queue.submit([&](sycl::handler &cgh) {
         auto desc_acc = mklcpu_desc_buffer.template get_access<sycl::access::mode::read>(cgh);
@@ -75,6 +75,7 @@ public:
             oneapi::mkl::dft::detail::external_workspace_helper<prec, dom>(
                 config_values.workspace_placement ==
                 oneapi::mkl::dft::detail::config_value::WORKSPACE_EXTERNAL);
+        this->committed_convolution_ = dft::detail::committed_convolution_layout(config_values);
         set_value(handle, config_values);
         try {
             handle.commit(this->get_queue());
@@ -24,7 +24,11 @@
 #endif
 
 #include <array>
+#include <future>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <utility>
 
 #include <portfft/portfft.hpp>
 
@@ -35,7 +39,10 @@
 #include "oneapi/mkl/dft/detail/portfft/onemkl_dft_portfft.hpp"
 #include "oneapi/mkl/dft/types.hpp"
 
+#include "dft/descriptor_config_helper.hpp"
+#include "portfft_bluestein.hpp"
 #include "portfft_helper.hpp"
+#include "portfft_real.hpp"
 
 // alias to avoid ambiguity
 namespace pfft = portfft;
@@ -51,24 +58,85 @@ private:
     using bwd_type = typename dft::detail::commit_impl<prec, dom>::bwd_type;
     using descriptor_type = typename dft::detail::descriptor<prec, dom>;
 
-    static constexpr pfft::domain domain =
-        dom == dft::domain::REAL ? pfft::domain::REAL : pfft::domain::COMPLEX;
-    // since only complex-to-complex transforms are supported, we expect both directions to be valid or neither.
+    // Complex transforms commit one descriptor per direction, and we expect both directions to
+    // be valid or neither. Real transforms commit a single in-place complex descriptor of half
+    // the length, used by both directions.
     std::array<storage_type<descriptor_type>, 2> committed_descriptors = { std::nullopt,
                                                                            std::nullopt };
-
-public:
-    portfft_commit(sycl::queue& queue, const dft::detail::dft_values<prec, dom>& config_values)
-            : oneapi::mkl::dft::detail::commit_impl<prec, dom>(queue, backend::portfft,
-                                                               config_values) {
-        if constexpr (prec == dft::detail::precision::DOUBLE) {
-            if (!queue.get_device().has(sycl::aspect::fp64)) {
-                throw mkl::exception("DFT", "commit", "Device does not support double precision.");
-            }
+    // Set while the kernel bundles are built by commit_async.
+    std::shared_future<void> pending_commit;
+    // Set by make_descriptors for real transforms.
+    real_transform_config<scalar_type> real_config{};
+    // The packed data of a real transform, in device memory. Allocated by build.
+    std::shared_ptr<bwd_type> real_scratch_memory;
+    // The last kernel of the last call that used the scratch memory, see with_scratch.
+    sycl::event scratch_event;
+    std::mutex scratch_mutex;
+    // Set by make_descriptors for the one-dimensional complex transforms Bluestein's algorithm
+    // can compute. It is used when portFFT has no kernels for the length.
+    std::optional<bluestein_config<scalar_type>> bluestein;
+    // Whether the last build fell back to Bluestein's algorithm.
+    bool uses_bluestein = false;
+    // The chirp and kernel spectra of a Bluestein transform, in device memory.
+    std::shared_ptr<bwd_type> bluestein_tables_memory;
+    // The padded batch of a Bluestein transform, in device memory. Used through with_scratch.
+    std::shared_ptr<bwd_type> bluestein_scratch_memory;
+
+    using pfft_descriptor_type = pfft::descriptor<scalar_type, pfft::domain::COMPLEX>;
+
+    // Real transforms are computed through a complex transform of half the length, see
+    // portfft_real.hpp. Only one-dimensional transforms of even length are supported.
+    std::pair<pfft_descriptor_type, pfft_descriptor_type> make_real_descriptors(
+        const dft::detail::dft_values<prec, dom>& config_values) {
+        // The packing kernels read and write interleaved complex data only.
+        if (config_values.complex_storage != config_value::COMPLEX_COMPLEX) {
+            throw mkl::unimplemented(
+                "dft/backends/portfft", __FUNCTION__,
+                "portFFT only supports COMPLEX_COMPLEX storage for real transforms");
         }
+        if (config_values.dimensions.size() != 1) {
+            throw mkl::unimplemented("dft/backends/portfft", __FUNCTION__,
+                                     "portFFT only supports one-dimensional real transforms");
+        }
+        const std::int64_t length = config_values.dimensions[0];
+        if (length % 2 != 0) {
+            throw mkl::unimplemented("dft/backends/portfft", __FUNCTION__,
+                                     "portFFT only supports real transforms of even length");
+        }
+        const auto& in = config_values.input_strides;
+        const auto& out = config_values.output_strides;
+        real_config.half_length = length / 2;
+        real_config.batch = config_values.number_of_transforms;
+        real_config.fwd_scale = config_values.fwd_scale;
+        real_config.bwd_scale = config_values.bwd_scale;
+        real_config.fwd_in = { in[0], in[1], config_values.fwd_dist };
+        real_config.fwd_out = { out[0], out[1], config_values.bwd_dist };
+        real_config.bwd_in = { in[0], in[1], config_values.bwd_dist };
+        real_config.bwd_out = { out[0], out[1], config_values.fwd_dist };
+
+        // The complex transform of half the length is contiguous and in place.
+        const transform_layout packed{ 0, 1, real_config.half_length };
+        bluestein = bluestein_config<scalar_type>{ real_config.half_length,
+                                                   bluestein_padded_length(real_config.half_length),
+                                                   real_config.batch,
+                                                   scalar_type(1),
+                                                   scalar_type(1),
+                                                   packed,
+                                                   packed,
+                                                   packed,
+                                                   packed };
+
+        pfft_descriptor_type half_desc({ static_cast<std::size_t>(real_config.half_length) });
+        half_desc.number_of_transforms = static_cast<std::size_t>(real_config.batch);
+        half_desc.placement = pfft::placement::IN_PLACE;
+        return { half_desc, half_desc };
     }
 
-    void commit(const dft::detail::dft_values<prec, dom>& config_values) override {
+    // Checks the configuration and converts it to the forward and backward portFFT descriptors.
+    std::pair<pfft_descriptor_type, pfft_descriptor_type> make_descriptors(
+        const dft::detail::dft_values<prec, dom>& config_values) {
+        bluestein.reset();
+        this->committed_convolution_ = dft::detail::committed_convolution_layout(config_values);
         // not available in portFFT:
         this->external_workspace_helper_ =
             oneapi::mkl::dft::detail::external_workspace_helper<prec, dom>(
@@ -78,17 +146,36 @@ public:
             throw mkl::unimplemented("dft/backends/portfft", __FUNCTION__,
                                      "portFFT only supports ALLOW for the WORKSPACE parameter");
         }
-        if (config_values.ordering != config_value::ORDERED) {
-            throw mkl::unimplemented("dft/backends/portfft", __FUNCTION__,
-                                     "portFFT only supports ORDERED for the ORDERING parameter");
+        // The backward domain order of BACKWARD_SCRAMBLED is left to the implementation. portFFT
+        // has no scrambled output mode, so the natural order is used and both orderings share
+        // the same kernels.
+        if (config_values.ordering != config_value::ORDERED &&
+            config_values.ordering != config_value::BACKWARD_SCRAMBLED) {
+            throw mkl::unimplemented(
+                "dft/backends/portfft", __FUNCTION__,
+                "portFFT only supports ORDERED and BACKWARD_SCRAMBLED for the ORDERING parameter");
         }
-        if (config_values.transpose) {
+        if constexpr (dom == dft::domain::REAL) {
+            return make_real_descriptors(config_values);
+        }
+
+        // Transposed output is described to portFFT as the strides of the backward domain.
+        // portFFT rejects strides it has no kernels for when the descriptors are committed.
+        const bool transposed = dft::detail::is_transposed(config_values);
+        if (transposed && config_values.placement != config_value::NOT_INPLACE) {
             throw mkl::unimplemented("dft/backends/portfft", __FUNCTION__,
-                                     "portFFT does not supported transposed output");
+                                     "portFFT only supports transposed output out-of-place");
         }
+        const auto bwd_domain_strides = transposed
+                                            ? dft::detail::get_transposed_strides(config_values)
+                                            : config_values.output_strides;
+        const auto& bwd_output_strides =
+            transposed ? config_values.input_strides : config_values.output_strides;
+        const auto& bwd_input_strides =
+            transposed ? bwd_domain_strides : config_values.input_strides;
 
         // forward descriptor
-        pfft::descriptor<scalar_type, domain> fwd_desc(
+        pfft_descriptor_type fwd_desc(
             { config_values.dimensions.cbegin(), config_values.dimensions.cend() });
         fwd_desc.forward_scale = config_values.fwd_scale;
         fwd_desc.backward_scale = config_values.bwd_scale;
@@ -101,16 +188,15 @@ public:
                                  ? pfft::placement::IN_PLACE
                                  : pfft::placement::OUT_OF_PLACE;
         fwd_desc.forward_offset = static_cast<std::size_t>(config_values.input_strides[0]);
-        fwd_desc.backward_offset = static_cast<std::size_t>(config_values.output_strides[0]);
+        fwd_desc.backward_offset = static_cast<std::size_t>(bwd_domain_strides[0]);
         fwd_desc.forward_strides = { config_values.input_strides.cbegin() + 1,
                                      config_values.input_strides.cend() };
-        fwd_desc.backward_strides = { config_values.output_strides.cbegin() + 1,
-                                      config_values.output_strides.cend() };
+        fwd_desc.backward_strides = { bwd_domain_strides.cbegin() + 1, bwd_domain_strides.cend() };
         fwd_desc.forward_distance = static_cast<std::size_t>(config_values.fwd_dist);
         fwd_desc.backward_distance = static_cast<std::size_t>(config_values.bwd_dist);
 
         // backward descriptor
-        pfft::descriptor<scalar_type, domain> bwd_desc(
+        pfft_descriptor_type bwd_desc(
             { config_values.dimensions.cbegin(), config_values.dimensions.cend() });
         bwd_desc.forward_scale = config_values.fwd_scale;
         bwd_desc.backward_scale = config_values.bwd_scale;
@@ -122,28 +208,380 @@ public:
         bwd_desc.placement = config_values.placement == config_value::INPLACE
                                  ? pfft::placement::IN_PLACE
                                  : pfft::placement::OUT_OF_PLACE;
-        bwd_desc.forward_offset = static_cast<std::size_t>(config_values.output_strides[0]);
-        bwd_desc.backward_offset = static_cast<std::size_t>(config_values.input_strides[0]);
-        bwd_desc.forward_strides = { config_values.output_strides.cbegin() + 1,
-                                     config_values.output_strides.cend() };
-        bwd_desc.backward_strides = { config_values.input_strides.cbegin() + 1,
-                                      config_values.input_strides.cend() };
+        bwd_desc.forward_offset = static_cast<std::size_t>(bwd_output_strides[0]);
+        bwd_desc.backward_offset = static_cast<std::size_t>(bwd_input_strides[0]);
+        bwd_desc.forward_strides = { bwd_output_strides.cbegin() + 1, bwd_output_strides.cend() };
+        bwd_desc.backward_strides = { bwd_input_strides.cbegin() + 1, bwd_input_strides.cend() };
         bwd_desc.forward_distance = static_cast<std::size_t>(config_values.fwd_dist);
         bwd_desc.backward_distance = static_cast<std::size_t>(config_values.bwd_dist);
 
+        if (config_values.dimensions.size() == 1 &&
+            config_values.complex_storage == config_value::COMPLEX_COMPLEX) {
+            const auto& in = config_values.input_strides;
+            const auto& out = config_values.placement == config_value::INPLACE
+                                  ? config_values.input_strides
+                                  : config_values.output_strides;
+            const std::int64_t length = config_values.dimensions[0];
+            bluestein = bluestein_config<scalar_type>{
+                length,
+                bluestein_padded_length(length),
+                config_values.number_of_transforms,
+                config_values.fwd_scale,
+                config_values.bwd_scale,
+                { in[0], in[1], config_values.fwd_dist },
+                { out[0], out[1], config_values.bwd_dist },
+                { in[0], in[1], config_values.bwd_dist },
+                { out[0], out[1], config_values.fwd_dist }
+            };
+        }
+
+        return { fwd_desc, bwd_desc };
+    }
+
+    // Device memory of count elements, freed when the last reference is released.
+    static std::shared_ptr<bwd_type> make_device_memory(sycl::queue& q, std::size_t count) {
+        auto context = q.get_context();
+        return std::shared_ptr<bwd_type>(sycl::malloc_device<bwd_type>(count, q),
+                                         [context](bwd_type* ptr) { sycl::free(ptr, context); });
+    }
+
+    void build(pfft_descriptor_type& fwd_desc, pfft_descriptor_type& bwd_desc) {
+        auto q = this->get_queue();
+        uses_bluestein = false;
+        if constexpr (dom == dft::domain::REAL) {
+            real_scratch_memory = make_device_memory(q, real_scratch_size());
+        }
         try {
-            auto q = this->get_queue();
             committed_descriptors[0] = fwd_desc.commit(q);
-            committed_descriptors[1] = bwd_desc.commit(q);
+            if constexpr (dom == dft::domain::COMPLEX) {
+                committed_descriptors[1] = bwd_desc.commit(q);
+            }
+        }
+        catch (const pfft::unsupported_configuration& e) {
+            if (!bluestein) {
+                throw oneapi::mkl::unimplemented("dft/backends/portfft", __FUNCTION__, e.what());
+            }
+            build_bluestein(q);
+        }
+    }
+
+    // Computes the Bluestein tables and commits the power-of-two transform they are used with.
+    // It transforms the whole batch in place, in both directions.
+    void build_bluestein(sycl::queue& q) {
+        const auto& config = *bluestein;
+        const auto tables = bluestein_tables<scalar_type>(config.length, config.padded_length);
+        bluestein_tables_memory = make_device_memory(q, tables.size());
+        q.copy(tables.data(), bluestein_tables_memory.get(), tables.size()).wait();
+        bluestein_scratch_memory =
+            make_device_memory(q, static_cast<std::size_t>(config.padded_length * config.batch));
+
+        pfft_descriptor_type padded_desc({ static_cast<std::size_t>(config.padded_length) });
+        padded_desc.number_of_transforms = static_cast<std::size_t>(config.batch);
+        padded_desc.placement = pfft::placement::IN_PLACE;
+        try {
+            committed_descriptors[0] = padded_desc.commit(q);
+            committed_descriptors[1].reset();
         }
         catch (const pfft::unsupported_configuration& e) {
             throw oneapi::mkl::unimplemented("dft/backends/portfft", __FUNCTION__, e.what());
         }
+        uses_bluestein = true;
+    }
+
+    // Waits for a build started by commit_async. Its errors are reported through the event.
+    void wait_for_build() const noexcept {
+        if (pending_commit.valid()) {
+            pending_commit.wait();
+        }
+    }
+
+    // Waits for the build, and for the calls using the memory a new build replaces.
+    void finish_commit() noexcept {
+        wait_for_build();
+        scratch_event.wait();
+        pending_commit = {};
     }
 
-    ~portfft_commit() override = default;
+    // The committed descriptors. Compute calls wait here for a build started by commit_async, as
+    // the kernels portFFT submits must be built first.
+    std::array<storage_type<descriptor_type>, 2>& built_descriptors(const char* function_name) {
+        wait_for_build();
+        if (!committed_descriptors[0]) {
+            throw mkl::exception("dft/backends/portfft", function_name,
+                                 "the asynchronous commit failed");
+        }
+        return committed_descriptors;
+    }
+
+    // Whether the committed transform uses Bluestein's algorithm. Waits for the build.
+    bool bluestein_committed() const noexcept {
+        wait_for_build();
+        return uses_bluestein;
+    }
+
+    // Give the Bluestein kernels their data, either a USM pointer or an accessor to a buffer.
+    template <typename T>
+    static auto bind_usm(T* ptr) {
+        return [ptr](sycl::handler&) { return ptr; };
+    }
+    template <sycl::access::mode Mode, typename T>
+    static auto bind_buffer(sycl::buffer<T, 1>& buffer) {
+        return [&buffer](sycl::handler& cgh) { return buffer.template get_access<Mode>(cgh); };
+    }
+
+    // Convolves the packed batch z with the chirp kernel of the direction, in place, through two
+    // power-of-two DFTs.
+    sycl::event bluestein_chirp_convolution(bool forward, bwd_type* z, sycl::event dependency) {
+        auto& padded_dft = *committed_descriptors[0];
+        const auto config = *bluestein;
+        const std::int64_t padded_length = config.padded_length;
+        const std::int64_t batch = config.batch;
+        const bwd_type* spectrum =
+            bluestein_tables_memory.get() + config.length + (forward ? 0 : padded_length);
+        auto dft_event = padded_dft.compute_forward(z, { dependency });
+        auto multiply_event = this->get_queue().submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dft_event);
+            bluestein_multiply_kernel<scalar_type>(cgh, z, padded_length, batch, spectrum);
+        });
+        return padded_dft.compute_backward(z, { multiply_event });
+    }
+
+    // Bluestein transform of the committed batch: pack with the chirp, convolve through two
+    // power-of-two DFTs, unpack with the chirp. See portfft_bluestein.hpp. The caller must hold
+    // the scratch memory, see with_scratch and bluestein_transform.
+    template <typename BindInT, typename BindOutT>
+    sycl::event bluestein_compute(bool forward, BindInT bind_in, BindOutT bind_out,
+                                  const std::vector<sycl::event>& dependencies) {
+        auto& queue = this->get_queue();
+        const auto config = *bluestein;
+        const std::int64_t length = config.length;
+        const std::int64_t padded_length = config.padded_length;
+        const std::int64_t batch = config.batch;
+        const bwd_type* chirp = bluestein_tables_memory.get();
+        const bool conj_chirp = !forward;
+        auto* z = bluestein_scratch_memory.get();
+        auto pack_event = queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            bluestein_pack_kernel<scalar_type>(cgh, bind_in(cgh),
+                                               forward ? config.fwd_in : config.bwd_in, length,
+                                               padded_length, batch, chirp, conj_chirp, z);
+        });
+        auto chirp_event = bluestein_chirp_convolution(forward, z, pack_event);
+        return queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(chirp_event);
+            bluestein_unpack_kernel<scalar_type>(
+                cgh, static_cast<const bwd_type*>(z), length, padded_length, batch, chirp,
+                conj_chirp, forward ? config.fwd_scale : config.bwd_scale, bind_out(cgh),
+                forward ? config.fwd_out : config.bwd_out);
+        });
+    }
+
+    std::size_t real_scratch_size() const {
+        return static_cast<std::size_t>(real_config.half_length * real_config.batch);
+    }
+
+    // Calls using the scratch memory run one after the other. submit takes the dependencies of
+    // the first kernel of a call and returns the event of its last kernel. The memory and the
+    // Bluestein tables are only replaced by a recommit, which waits for the last call.
+    template <typename SubmitT>
+    sycl::event with_scratch(const std::vector<sycl::event>& dependencies, SubmitT submit) {
+        std::lock_guard<std::mutex> lock(scratch_mutex);
+        auto scratch_dependencies = dependencies;
+        scratch_dependencies.push_back(scratch_event);
+        scratch_event = submit(scratch_dependencies);
+        return scratch_event;
+    }
+
+    // A complex transform computed with Bluestein's algorithm.
+    template <typename BindInT, typename BindOutT>
+    sycl::event bluestein_transform(bool forward, BindInT bind_in, BindOutT bind_out,
+                                    const std::vector<sycl::event>& dependencies) {
+        return with_scratch(dependencies, [&](const std::vector<sycl::event>& deps) {
+            return bluestein_compute(forward, bind_in, bind_out, deps);
+        });
+    }
+
+    // Real forward transform: pack, complex DFT of half the length, unpack. in and out may be
+    // views of the same buffer.
+    template <typename BindInT, typename BindOutT>
+    sycl::event real_forward(BindInT bind_in, BindOutT bind_out,
+                             const std::vector<sycl::event>& dependencies) {
+        return with_scratch(dependencies, [&](const std::vector<sycl::event>& deps) {
+            auto& queue = this->get_queue();
+            const auto config = real_config;
+            auto* z = real_scratch_memory.get();
+            auto pack_event = queue.submit([&](sycl::handler& cgh) {
+                cgh.depends_on(deps);
+                r2c_pack_kernel<scalar_type>(cgh, bind_in(cgh), config.fwd_in, config.half_length,
+                                             config.batch, z);
+            });
+            auto dft_event = bluestein_committed()
+                                 ? bluestein_compute(true, bind_usm(z), bind_usm(z), { pack_event })
+                                 : committed_descriptors[0]->compute_forward(z, { pack_event });
+            return queue.submit([&](sycl::handler& cgh) {
+                cgh.depends_on(dft_event);
+                r2c_unpack_kernel<scalar_type>(cgh, static_cast<const bwd_type*>(z),
+                                               config.half_length, config.batch, config.fwd_scale,
+                                               bind_out(cgh), config.fwd_out);
+            });
+        });
+    }
+
+    // Real backward transform: pack, complex DFT of half the length, unpack. in and out may be
+    // views of the same buffer.
+    template <typename BindInT, typename BindOutT>
+    sycl::event real_backward(BindInT bind_in, BindOutT bind_out,
+                              const std::vector<sycl::event>& dependencies) {
+        return with_scratch(dependencies, [&](const std::vector<sycl::event>& deps) {
+            auto& queue = this->get_queue();
+            const auto config = real_config;
+            auto* z = real_scratch_memory.get();
+            auto pack_event = queue.submit([&](sycl::handler& cgh) {
+                cgh.depends_on(deps);
+                c2r_pack_kernel<scalar_type>(cgh, bind_in(cgh), config.bwd_in, config.half_length,
+                                             config.batch, z);
+            });
+            auto dft_event =
+                bluestein_committed()
+                    ? bluestein_compute(false, bind_usm(z), bind_usm(z), { pack_event })
+                    : committed_descriptors[0]->compute_backward(z, { pack_event });
+            return queue.submit([&](sycl::handler& cgh) {
+                cgh.depends_on(dft_event);
+                c2r_unpack_kernel<scalar_type>(cgh, static_cast<const bwd_type*>(z),
+                                               config.half_length, config.batch, config.bwd_scale,
+                                               bind_out(cgh), config.bwd_out);
+            });
+        });
+    }
+
+    // Real convolution: the forward transform up to the DFT of its packed samples, one kernel for
+    // the unpacking, the product with the filter and the repacking, then the backward transform
+    // from its DFT on. The spectrum is never written to the data. The result is written where the
+    // input was read.
+    template <typename BindInT, typename BindOutT, typename BindFilterT>
+    sycl::event real_convolve(BindInT bind_in, BindOutT bind_out, BindFilterT bind_filter,
+                              bool conjugate_filter, const std::vector<sycl::event>& dependencies) {
+        return with_scratch(dependencies, [&](const std::vector<sycl::event>& deps) {
+            auto& queue = this->get_queue();
+            const auto config = real_config;
+            const bool use_bluestein = bluestein_committed();
+            auto& half_dft = *committed_descriptors[0];
+            auto* z = real_scratch_memory.get();
+            auto pack_event = queue.submit([&](sycl::handler& cgh) {
+                cgh.depends_on(deps);
+                r2c_pack_kernel<scalar_type>(cgh, bind_in(cgh), config.fwd_in, config.half_length,
+                                             config.batch, z);
+            });
+            auto dft_event = use_bluestein
+                                 ? bluestein_compute(true, bind_usm(z), bind_usm(z), { pack_event })
+                                 : half_dft.compute_forward(z, { pack_event });
+            auto filter_event = queue.submit([&](sycl::handler& cgh) {
+                cgh.depends_on(dft_event);
+                real_filter_kernel<scalar_type>(cgh, z, config.half_length, config.batch,
+                                                config.fwd_scale, bind_filter(cgh),
+                                                conjugate_filter);
+            });
+            auto inverse_event =
+                use_bluestein ? bluestein_compute(false, bind_usm(z), bind_usm(z), { filter_event })
+                              : half_dft.compute_backward(z, { filter_event });
+            return queue.submit([&](sycl::handler& cgh) {
+                cgh.depends_on(inverse_event);
+                c2r_unpack_kernel<scalar_type>(cgh, static_cast<const bwd_type*>(z),
+                                               config.half_length, config.batch, config.bwd_scale,
+                                               bind_out(cgh), config.fwd_in);
+            });
+        });
+    }
+
+    // Bluestein convolution: the unpacking of the forward transform, the product with the filter
+    // and the packing of the backward transform are one kernel, and the data is only read by the
+    // first kernel and written by the last.
+    template <typename BindInT, typename BindOutT, typename BindFilterT>
+    sycl::event bluestein_convolve(BindInT bind_in, BindOutT bind_out, BindFilterT bind_filter,
+                                   bool conjugate_filter,
+                                   const std::vector<sycl::event>& dependencies) {
+        return with_scratch(dependencies, [&](const std::vector<sycl::event>& deps) {
+            auto& queue = this->get_queue();
+            const auto config = *bluestein;
+            const std::int64_t length = config.length;
+            const std::int64_t padded_length = config.padded_length;
+            const std::int64_t batch = config.batch;
+            const bwd_type* chirp = bluestein_tables_memory.get();
+            auto* z = bluestein_scratch_memory.get();
+            auto pack_event = queue.submit([&](sycl::handler& cgh) {
+                cgh.depends_on(deps);
+                bluestein_pack_kernel<scalar_type>(cgh, bind_in(cgh), config.fwd_in, length,
+                                                   padded_length, batch, chirp, false, z);
+            });
+            auto forward_event = bluestein_chirp_convolution(true, z, pack_event);
+            auto filter_event = queue.submit([&](sycl::handler& cgh) {
+                cgh.depends_on(forward_event);
+                bluestein_filter_kernel<scalar_type>(cgh, z, length, padded_length, batch,
+                                                     config.fwd_scale, bind_filter(cgh),
+                                                     conjugate_filter);
+            });
+            auto backward_event = bluestein_chirp_convolution(false, z, filter_event);
+            return queue.submit([&](sycl::handler& cgh) {
+                cgh.depends_on(backward_event);
+                bluestein_unpack_kernel<scalar_type>(cgh, static_cast<const bwd_type*>(z), length,
+                                                     padded_length, batch, chirp, true,
+                                                     config.bwd_scale, bind_out(cgh),
+                                                     config.fwd_in);
+            });
+        });
+    }
+
+    // The complex view of an in-place real buffer.
+    static sycl::buffer<bwd_type, 1> complex_view(sycl::buffer<scalar_type, 1>& buffer) {
+        return buffer.template reinterpret<bwd_type, 1>(sycl::range<1>(buffer.size() / 2));
+    }
+
+public:
+    portfft_commit(sycl::queue& queue, const dft::detail::dft_values<prec, dom>& config_values)
+            : oneapi::mkl::dft::detail::commit_impl<prec, dom>(queue, backend::portfft,
+                                                               config_values) {
+        if constexpr (prec == dft::detail::precision::DOUBLE) {
+            if (!queue.get_device().has(sycl::aspect::fp64)) {
+                throw mkl::exception("DFT", "commit", "Device does not support double precision.");
+            }
+        }
+    }
+
+    void commit(const dft::detail::dft_values<prec, dom>& config_values) override {
+        finish_commit();
+        auto descriptors = make_descriptors(config_values);
+        build(descriptors.first, descriptors.second);
+        this->commit_event_ = sycl::event{};
+    }
+
+    // The kernel bundles are built on a separate thread. The returned event comes from a host
+    // task waiting for the build, and reports a failed build to the queue's asynchronous handler.
+    // Compute calls wait for the build on the calling thread, see built_descriptors, so their
+    // kernels are submitted in order with the commands that follow.
+    sycl::event commit_async(const dft::detail::dft_values<prec, dom>& config_values) override {
+        finish_commit();
+        auto descriptors = make_descriptors(config_values);
+        pending_commit = std::async(std::launch::async, [this, descriptors]() mutable {
+                             try {
+                                 build(descriptors.first, descriptors.second);
+                             }
+                             catch (...) {
+                                 committed_descriptors = { std::nullopt, std::nullopt };
+                                 throw;
+                             }
+                         }).share();
+        this->commit_event_ = this->get_queue().submit([&](sycl::handler& cgh) {
+            cgh.host_task([pending = pending_commit]() { pending.get(); });
+        });
+        return this->commit_event_;
+    }
+
+    ~portfft_commit() override {
+        finish_commit();
+    }
 
     void* get_handle() noexcept override {
+        wait_for_build();
         return committed_descriptors.data();
     }
 
@@ -155,38 +593,71 @@ public:
         constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
         dft::detail::get_commit(desc)->template compute_call_throw<sycl::buffer<fwd_type, 1>>(
             "compute_forward");
+        auto& descriptors = built_descriptors("compute_forward");
 
         if constexpr (pfft_domain == pfft::domain::COMPLEX) {
-            detail::get_descriptors(desc)[0]->compute_forward(inout);
+            if (bluestein_committed()) {
+                bluestein_transform(true, bind_buffer<sycl::access::mode::read>(inout),
+                                    bind_buffer<sycl::access::mode::write>(inout), {});
+            }
+            else {
+                descriptors[0]->compute_forward(inout);
+            }
+        }
+        else {
+            auto out = complex_view(inout);
+            real_forward(bind_buffer<sycl::access::mode::read>(inout),
+                         bind_buffer<sycl::access::mode::write>(out), {});
         }
     }
     sycl::event forward_ip_cc(descriptor_type& desc, fwd_type* inout,
                               const std::vector<sycl::event>& dependencies) override {
         constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
         dft::detail::get_commit(desc)->template compute_call_throw<fwd_type*>("compute_forward");
+        auto& descriptors = built_descriptors("compute_forward");
 
         if constexpr (pfft_domain == pfft::domain::COMPLEX) {
-            return detail::get_descriptors(desc)[0]->compute_forward(inout, dependencies);
+            if (bluestein_committed()) {
+                return bluestein_transform(true, bind_usm(inout), bind_usm(inout), dependencies);
+            }
+            return descriptors[0]->compute_forward(inout, dependencies);
         }
         else {
-            return {};
+            return real_forward(bind_usm(inout), bind_usm(reinterpret_cast<bwd_type*>(inout)),
+                                dependencies);
         }
     }
 
     // forward inplace REAL_REAL
-    void forward_ip_rr(descriptor_type& desc, sycl::buffer<scalar_type, 1>&,
-                       sycl::buffer<scalar_type, 1>&) override {
+    void forward_ip_rr(descriptor_type& desc, sycl::buffer<scalar_type, 1>& inout_re,
+                       sycl::buffer<scalar_type, 1>& inout_im) override {
+        constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
         dft::detail::get_commit(desc)->template compute_call_throw<sycl::buffer<scalar_type, 1>>(
             "compute_forward");
-        throw oneapi::mkl::unimplemented("DFT", "compute_forward(desc, inout_re, inout_im)",
-                                         "portFFT does not support real-real complex storage.");
+
+        if constexpr (pfft_domain == pfft::domain::COMPLEX) {
+            built_descriptors("compute_forward")[0]->compute_forward(inout_re, inout_im);
+        }
+        else {
+            throw oneapi::mkl::unimplemented(
+                "DFT", "compute_forward(desc, inout_re, inout_im)",
+                "portFFT does not commit real transforms with real-real storage.");
+        }
     }
-    sycl::event forward_ip_rr(descriptor_type& desc, scalar_type*, scalar_type*,
-                              const std::vector<sycl::event>&) override {
+    sycl::event forward_ip_rr(descriptor_type& desc, scalar_type* inout_re, scalar_type* inout_im,
+                              const std::vector<sycl::event>& dependencies) override {
+        constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
         dft::detail::get_commit(desc)->template compute_call_throw<scalar_type*>("compute_forward");
-        throw oneapi::mkl::unimplemented("DFT",
-                                         "compute_forward(desc, inout_re, inout_im, dependencies)",
-                                         "portFFT does not support real-real complex storage.");
+
+        if constexpr (pfft_domain == pfft::domain::COMPLEX) {
+            return built_descriptors("compute_forward")[0]->compute_forward(inout_re, inout_im,
+                                                                            dependencies);
+        }
+        else {
+            throw oneapi::mkl::unimplemented(
+                "DFT", "compute_forward(desc, inout_re, inout_im, dependencies)",
+                "portFFT does not commit real transforms with real-real storage.");
+        }
     }
 
     // forward out-of-place COMPLEX_COMPLEX
@@ -195,40 +666,71 @@ public:
         constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
         dft::detail::get_commit(desc)->template compute_call_throw<sycl::buffer<fwd_type, 1>>(
             "compute_forward");
+        auto& descriptors = built_descriptors("compute_forward");
 
         if constexpr (pfft_domain == pfft::domain::COMPLEX) {
-            detail::get_descriptors(desc)[0]->compute_forward(in, out);
+            if (bluestein_committed()) {
+                bluestein_transform(true, bind_buffer<sycl::access::mode::read>(in),
+                                    bind_buffer<sycl::access::mode::write>(out), {});
+            }
+            else {
+                descriptors[0]->compute_forward(in, out);
+            }
+        }
+        else {
+            real_forward(bind_buffer<sycl::access::mode::read>(in),
+                         bind_buffer<sycl::access::mode::write>(out), {});
         }
     }
     sycl::event forward_op_cc(descriptor_type& desc, fwd_type* in, bwd_type* out,
                               const std::vector<sycl::event>& dependencies) override {
         constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
         dft::detail::get_commit(desc)->template compute_call_throw<fwd_type*>("compute_forward");
+        auto& descriptors = built_descriptors("compute_forward");
 
         if constexpr (pfft_domain == pfft::domain::COMPLEX) {
-            return detail::get_descriptors(desc)[0]->compute_forward(in, out, dependencies);
+            if (bluestein_committed()) {
+                return bluestein_transform(true, bind_usm(in), bind_usm(out), dependencies);
+            }
+            return descriptors[0]->compute_forward(in, out, dependencies);
         }
         else {
-            return {};
+            return real_forward(bind_usm(in), bind_usm(out), dependencies);
         }
     }
 
     // forward out-of-place REAL_REAL
-    void forward_op_rr(descriptor_type& desc, sycl::buffer<scalar_type, 1>&,
-                       sycl::buffer<scalar_type, 1>&, sycl::buffer<scalar_type, 1>&,
-                       sycl::buffer<scalar_type, 1>&) override {
+    void forward_op_rr(descriptor_type& desc, sycl::buffer<scalar_type, 1>& in_re,
+                       sycl::buffer<scalar_type, 1>& in_im, sycl::buffer<scalar_type, 1>& out_re,
+                       sycl::buffer<scalar_type, 1>& out_im) override {
+        constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
         dft::detail::get_commit(desc)->template compute_call_throw<sycl::buffer<scalar_type, 1>>(
             "compute_forward");
-        throw oneapi::mkl::unimplemented("DFT",
-                                         "compute_forward(desc, in_re, in_im, out_re, out_im)",
-                                         "portFFT does not support real-real complex storage.");
+
+        if constexpr (pfft_domain == pfft::domain::COMPLEX) {
+            built_descriptors("compute_forward")[0]->compute_forward(in_re, in_im, out_re, out_im);
+        }
+        else {
+            throw oneapi::mkl::unimplemented(
+                "DFT", "compute_forward(desc, in_re, in_im, out_re, out_im)",
+                "portFFT does not commit real transforms with real-real storage.");
+        }
     }
-    sycl::event forward_op_rr(descriptor_type& desc, scalar_type*, scalar_type*, scalar_type*,
-                              scalar_type*, const std::vector<sycl::event>&) override {
+    sycl::event forward_op_rr(descriptor_type& desc, scalar_type* in_re, scalar_type* in_im,
+                              scalar_type* out_re, scalar_type* out_im,
+                              const std::vector<sycl::event>& dependencies) override {
+        constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
         dft::detail::get_commit(desc)->template compute_call_throw<scalar_type*>("compute_forward");
-        throw oneapi::mkl::unimplemented(
-            "DFT", "compute_forward(desc, in_re, in_im, out_re, out_im, dependencies)",
-            "portFFT does not support real-real complex storage.");
+
+        if constexpr (pfft_domain == pfft::domain::COMPLEX) {
+            return built_descriptors("compute_forward")[0]->compute_forward(
+                in_re, in_im, out_re, out_im, dependencies);
+        }
+        else {
+            throw oneapi::mkl::unimplemented(
+                "DFT", "compute_forward(desc, in_re, in_im, out_re, out_im, dependencies)",
+                "portFFT does not commit real transforms with real-real storage.");
+        }
     }
 
     // backward inplace COMPLEX_COMPLEX
@@ -236,39 +738,72 @@ public:
         constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
         dft::detail::get_commit(desc)->template compute_call_throw<sycl::buffer<fwd_type, 1>>(
             "compute_backward");
+        auto& descriptors = built_descriptors("compute_backward");
 
         if constexpr (pfft_domain == pfft::domain::COMPLEX) {
-            detail::get_descriptors(desc)[1]->compute_backward(inout);
+            if (bluestein_committed()) {
+                bluestein_transform(false, bind_buffer<sycl::access::mode::read>(inout),
+                                    bind_buffer<sycl::access::mode::write>(inout), {});
+            }
+            else {
+                descriptors[1]->compute_backward(inout);
+            }
+        }
+        else {
+            auto in = complex_view(inout);
+            real_backward(bind_buffer<sycl::access::mode::read>(in),
+                          bind_buffer<sycl::access::mode::write>(inout), {});
         }
     }
     sycl::event backward_ip_cc(descriptor_type& desc, fwd_type* inout,
                                const std::vector<sycl::event>& dependencies) override {
         constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
         dft::detail::get_commit(desc)->template compute_call_throw<fwd_type*>("compute_backward");
+        auto& descriptors = built_descriptors("compute_backward");
 
         if constexpr (pfft_domain == pfft::domain::COMPLEX) {
-            return detail::get_descriptors(desc)[1]->compute_backward(inout, dependencies);
+            if (bluestein_committed()) {
+                return bluestein_transform(false, bind_usm(inout), bind_usm(inout), dependencies);
+            }
+            return descriptors[1]->compute_backward(inout, dependencies);
         }
         else {
-            return {};
+            return real_backward(bind_usm(reinterpret_cast<bwd_type*>(inout)), bind_usm(inout),
+                                 dependencies);
         }
     }
 
     // backward inplace REAL_REAL
-    void backward_ip_rr(descriptor_type& desc, sycl::buffer<scalar_type, 1>&,
-                        sycl::buffer<scalar_type, 1>&) override {
+    void backward_ip_rr(descriptor_type& desc, sycl::buffer<scalar_type, 1>& inout_re,
+                        sycl::buffer<scalar_type, 1>& inout_im) override {
+        constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
         dft::detail::get_commit(desc)->template compute_call_throw<sycl::buffer<scalar_type, 1>>(
             "compute_backward");
-        throw oneapi::mkl::unimplemented("DFT", "compute_backward(desc, inout_re, inout_im)",
-                                         "portFFT does not support real-real complex storage.");
+
+        if constexpr (pfft_domain == pfft::domain::COMPLEX) {
+            built_descriptors("compute_backward")[1]->compute_backward(inout_re, inout_im);
+        }
+        else {
+            throw oneapi::mkl::unimplemented(
+                "DFT", "compute_backward(desc, inout_re, inout_im)",
+                "portFFT does not commit real transforms with real-real storage.");
+        }
     }
-    sycl::event backward_ip_rr(descriptor_type& desc, scalar_type*, scalar_type*,
-                               const std::vector<sycl::event>&) override {
+    sycl::event backward_ip_rr(descriptor_type& desc, scalar_type* inout_re, scalar_type* inout_im,
+                               const std::vector<sycl::event>& dependencies) override {
+        constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
         dft::detail::get_commit(desc)->template compute_call_throw<scalar_type*>(
             "compute_backward");
-        throw oneapi::mkl::unimplemented("DFT",
-                                         "compute_backward(desc, inout_re, inout_im, dependencies)",
-                                         "portFFT does not support real-real complex storage.");
+
+        if constexpr (pfft_domain == pfft::domain::COMPLEX) {
+            return built_descriptors("compute_backward")[1]->compute_backward(inout_re, inout_im,
+                                                                              dependencies);
+        }
+        else {
+            throw oneapi::mkl::unimplemented(
+                "DFT", "compute_backward(desc, inout_re, inout_im, dependencies)",
+                "portFFT does not commit real transforms with real-real storage.");
+        }
     }
 
     // backward out-of-place COMPLEX_COMPLEX
@@ -277,41 +812,127 @@ public:
         constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
         dft::detail::get_commit(desc)->template compute_call_throw<sycl::buffer<bwd_type, 1>>(
             "compute_backward");
+        auto& descriptors = built_descriptors("compute_backward");
 
         if constexpr (pfft_domain == pfft::domain::COMPLEX) {
-            detail::get_descriptors(desc)[1]->compute_backward(in, out);
+            if (bluestein_committed()) {
+                bluestein_transform(false, bind_buffer<sycl::access::mode::read>(in),
+                                    bind_buffer<sycl::access::mode::write>(out), {});
+            }
+            else {
+                descriptors[1]->compute_backward(in, out);
+            }
+        }
+        else {
+            real_backward(bind_buffer<sycl::access::mode::read>(in),
+                          bind_buffer<sycl::access::mode::write>(out), {});
         }
     }
     sycl::event backward_op_cc(descriptor_type& desc, bwd_type* in, fwd_type* out,
                                const std::vector<sycl::event>& dependencies) override {
         constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
         dft::detail::get_commit(desc)->template compute_call_throw<bwd_type*>("compute_backward");
+        auto& descriptors = built_descriptors("compute_backward");
 
         if constexpr (pfft_domain == pfft::domain::COMPLEX) {
-            return detail::get_descriptors(desc)[1]->compute_backward(in, out, dependencies);
+            if (bluestein_committed()) {
+                return bluestein_transform(false, bind_usm(in), bind_usm(out), dependencies);
+            }
+            return descriptors[1]->compute_backward(in, out, dependencies);
         }
         else {
-            return {};
+            return real_backward(bind_usm(in), bind_usm(out), dependencies);
         }
     }
 
     // backward out-of-place REAL_REAL
-    void backward_op_rr(descriptor_type& desc, sycl::buffer<scalar_type, 1>&,
-                        sycl::buffer<scalar_type, 1>&, sycl::buffer<scalar_type, 1>&,
-                        sycl::buffer<scalar_type, 1>&) override {
+    void backward_op_rr(descriptor_type& desc, sycl::buffer<scalar_type, 1>& in_re,
+                        sycl::buffer<scalar_type, 1>& in_im, sycl::buffer<scalar_type, 1>& out_re,
+                        sycl::buffer<scalar_type, 1>& out_im) override {
+        constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
         dft::detail::get_commit(desc)->template compute_call_throw<sycl::buffer<scalar_type, 1>>(
             "compute_backward");
-        throw oneapi::mkl::unimplemented("DFT",
-                                         "compute_backward(desc, in_re, in_im, out_re, out_im)",
-                                         "portFFT does not support real-real complex storage.");
+
+        if constexpr (pfft_domain == pfft::domain::COMPLEX) {
+            built_descriptors("compute_backward")[1]->compute_backward(in_re, in_im, out_re,
+                                                                       out_im);
+        }
+        else {
+            throw oneapi::mkl::unimplemented(
+                "DFT", "compute_backward(desc, in_re, in_im, out_re, out_im)",
+                "portFFT does not commit real transforms with real-real storage.");
+        }
     }
-    sycl::event backward_op_rr(descriptor_type& desc, scalar_type*, scalar_type*, scalar_type*,
-                               scalar_type*, const std::vector<sycl::event>&) override {
+    sycl::event backward_op_rr(descriptor_type& desc, scalar_type* in_re, scalar_type* in_im,
+                               scalar_type* out_re, scalar_type* out_im,
+                               const std::vector<sycl::event>& dependencies) override {
+        constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
         dft::detail::get_commit(desc)->template compute_call_throw<scalar_type*>(
             "compute_backward");
-        throw oneapi::mkl::unimplemented(
-            "DFT", "compute_backward(desc, in_re, in_im, out_re, out_im, deps)",
-            "portFFT does not support real-real complex storage.");
+
+        if constexpr (pfft_domain == pfft::domain::COMPLEX) {
+            return built_descriptors("compute_backward")[1]->compute_backward(
+                in_re, in_im, out_re, out_im, dependencies);
+        }
+        else {
+            throw oneapi::mkl::unimplemented(
+                "DFT", "compute_backward(desc, in_re, in_im, out_re, out_im, dependencies)",
+                "portFFT does not commit real transforms with real-real storage.");
+        }
+    }
+
+    // Real transforms and transforms computed with Bluestein's algorithm fuse the product with
+    // the filter into their own kernels. The other transforms use the unfused default, as the
+    // portFFT kernels cannot apply the filter.
+    void convolve_ip_cc(descriptor_type& desc, sycl::buffer<fwd_type, 1>& inout,
+                        sycl::buffer<bwd_type, 1>& filter, bool conjugate_filter) override {
+        constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
+        built_descriptors("compute_convolution");
+        if constexpr (pfft_domain == pfft::domain::COMPLEX) {
+            if (!bluestein_committed()) {
+                dft::detail::commit_impl<prec, dom>::convolve_ip_cc(desc, inout, filter,
+                                                                    conjugate_filter);
+                return;
+            }
+        }
+        dft::detail::get_commit(desc)->template compute_call_throw<sycl::buffer<fwd_type, 1>>(
+            "compute_convolution");
+        const auto layout = this->committed_convolution_.get("compute_convolution");
+        dft::detail::check_filter_size(filter.size(), layout, "compute_convolution");
+
+        auto bind_in = bind_buffer<sycl::access::mode::read>(inout);
+        auto bind_out = bind_buffer<sycl::access::mode::write>(inout);
+        auto bind_filter = bind_buffer<sycl::access::mode::read>(filter);
+        if constexpr (pfft_domain == pfft::domain::COMPLEX) {
+            bluestein_convolve(bind_in, bind_out, bind_filter, conjugate_filter, {});
+        }
+        else {
+            real_convolve(bind_in, bind_out, bind_filter, conjugate_filter, {});
+        }
+    }
+    sycl::event convolve_ip_cc(descriptor_type& desc, fwd_type* inout, const bwd_type* filter,
+                               bool conjugate_filter,
+                               const std::vector<sycl::event>& dependencies) override {
+        constexpr auto pfft_domain = detail::to_pfft_domain<descriptor_type>::type::value;
+        built_descriptors("compute_convolution");
+        if constexpr (pfft_domain == pfft::domain::COMPLEX) {
+            if (!bluestein_committed()) {
+                return dft::detail::commit_impl<prec, dom>::convolve_ip_cc(
+                    desc, inout, filter, conjugate_filter, dependencies);
+            }
+        }
+        dft::detail::get_commit(desc)->template compute_call_throw<fwd_type*>(
+            "compute_convolution");
+        this->committed_convolution_.get("compute_convolution");
+
+        if constexpr (pfft_domain == pfft::domain::COMPLEX) {
+            return bluestein_convolve(bind_usm(inout), bind_usm(inout), bind_usm(filter),
+                                      conjugate_filter, dependencies);
+        }
+        else {
+            return real_convolve(bind_usm(inout), bind_usm(inout), bind_usm(filter),
+                                 conjugate_filter, dependencies);
+        }
     }
 };
 } // namespace detail
@@ -26,13 +26,16 @@ namespace oneapi::mkl::dft {
 
 template <precision prec, domain dom>
 void descriptor<prec, dom>::commit(backend_selector<backend::portfft> selector) {
-    if (!pimpl_ || pimpl_->get_queue() != selector.get_queue()) {
-        if (pimpl_) {
-            pimpl_->get_queue().wait();
-        }
-        pimpl_.reset(portfft::create_commit(*this, selector.get_queue()));
-    }
-    pimpl_->commit(values_);
+    detail::commit_with_plan_cache(pimpl_, values_, selector.get_queue(), backend::portfft, [&]() {
+        return portfft::create_commit(*this, selector.get_queue());
+    });
+}
+
+template <precision prec, domain dom>
+sycl::event descriptor<prec, dom>::commit_async(backend_selector<backend::portfft> selector) {
+    return detail::commit_with_plan_cache(
+        pimpl_, values_, selector.get_queue(), backend::portfft,
+        [&]() { return portfft::create_commit(*this, selector.get_queue()); }, true);
 }
 
 template void descriptor<precision::SINGLE, domain::COMPLEX>::commit(
@@ -43,5 +46,13 @@ template void descriptor<precision::DOUBLE, domain::COMPLEX>::commit(
     backend_selector<backend::portfft>);
 template void descriptor<precision::DOUBLE, domain::REAL>::commit(
     backend_selector<backend::portfft>);
+template sycl::event descriptor<precision::SINGLE, domain::COMPLEX>::commit_async(
+    backend_selector<backend::portfft>);
+template sycl::event descriptor<precision::SINGLE, domain::REAL>::commit_async(
+    backend_selector<backend::portfft>);
+template sycl::event descriptor<precision::DOUBLE, domain::COMPLEX>::commit_async(
+    backend_selector<backend::portfft>);
+template sycl::event descriptor<precision::DOUBLE, domain::REAL>::commit_async(
+    backend_selector<backend::portfft>);
 
 } // namespace oneapi::mkl::dft
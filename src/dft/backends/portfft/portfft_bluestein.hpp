@@ -0,0 +1,220 @@
+/*******************************************************************************
+* Copyright Codeplay Software Ltd
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_DFT_SRC_PORTFFT_BLUESTEIN_HPP_
+#define _ONEMKL_DFT_SRC_PORTFFT_BLUESTEIN_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "portfft_helper.hpp"
+
+// Bluestein's chirp-z algorithm for the complex lengths portFFT has no kernels for.
+//
+// With the chirp w[n] = exp(-pi*i*n^2/N) and nk = (n^2 + k^2 - (k-n)^2) / 2, the forward DFT is
+//   X[k] = w[k] * sum_n (x[n] * w[n]) * conj(w[k-n])
+// a convolution of x*w with conj(w). It is computed as a circular convolution of length
+// M >= 2N - 1, a power of two: the M-point DFT of the zero-padded x*w is multiplied by the DFT of
+// the convolution kernel, then transformed back. The backward DFT uses conj(w) in place of w.
+//
+// The chirp and the DFTs of both kernels, scaled by 1/M, are computed at commit time. Each
+// transform then costs two DFTs of length M, which portFFT supports, plus three passes over the
+// data. The pack kernel also gathers strided and batched data into a contiguous batch.
+
+namespace oneapi::mkl::dft::portfft::detail {
+
+/** The sizes, scales and layouts of a committed Bluestein transform. The forward transform reads
+ *  fwd_in and writes fwd_out, the backward transform reads bwd_in and writes bwd_out.
+**/
+template <typename R>
+struct bluestein_config {
+    std::int64_t length;
+    std::int64_t padded_length;
+    std::int64_t batch;
+    R fwd_scale;
+    R bwd_scale;
+    transform_layout fwd_in;
+    transform_layout fwd_out;
+    transform_layout bwd_in;
+    transform_layout bwd_out;
+};
+
+/** The smallest power of two that can hold the circular convolution for length. **/
+inline std::int64_t bluestein_padded_length(std::int64_t length) {
+    std::int64_t padded_length = 1;
+    while (padded_length < 2 * length - 1) {
+        padded_length *= 2;
+    }
+    return padded_length;
+}
+
+/** In-place radix-2 DFT on the host, used once per commit for the kernel spectra. **/
+inline void bluestein_host_dft(std::vector<std::complex<double>> &data) {
+    const std::size_t n = data.size();
+    for (std::size_t i = 1, j = 0; i < n; ++i) {
+        std::size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap(data[i], data[j]);
+        }
+    }
+    const double pi = std::acos(-1.0);
+    for (std::size_t len = 2; len <= n; len <<= 1) {
+        const std::complex<double> step = std::polar(1.0, -2.0 * pi / static_cast<double>(len));
+        for (std::size_t i = 0; i < n; i += len) {
+            std::complex<double> w(1.0);
+            for (std::size_t j = 0; j < len / 2; ++j) {
+                const std::complex<double> u = data[i + j];
+                const std::complex<double> v = data[i + j + len / 2] * w;
+                data[i + j] = u + v;
+                data[i + j + len / 2] = u - v;
+                w *= step;
+            }
+        }
+    }
+}
+
+/** Computes the chirp followed by the forward and backward kernel spectra, the layout the
+ *  kernels below expect. The chirp angles are reduced modulo 2*pi exactly before rounding.
+**/
+template <typename R>
+std::vector<std::complex<R>> bluestein_tables(std::int64_t length, std::int64_t padded_length) {
+    const auto n = static_cast<std::size_t>(length);
+    const auto m = static_cast<std::size_t>(padded_length);
+    const double pi = std::acos(-1.0);
+    std::vector<std::complex<double>> chirp(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto phase = static_cast<double>((i * i) % (2 * n));
+        chirp[i] = std::polar(1.0, -pi * phase / static_cast<double>(n));
+    }
+    std::vector<std::complex<double>> fwd_kernel(m), bwd_kernel(m);
+    const double scale = 1.0 / static_cast<double>(m);
+    for (std::size_t i = 0; i < n; ++i) {
+        fwd_kernel[i] = std::conj(chirp[i]) * scale;
+        bwd_kernel[i] = chirp[i] * scale;
+        if (i > 0) {
+            fwd_kernel[m - i] = fwd_kernel[i];
+            bwd_kernel[m - i] = bwd_kernel[i];
+        }
+    }
+    bluestein_host_dft(fwd_kernel);
+    bluestein_host_dft(bwd_kernel);
+
+    std::vector<std::complex<R>> tables;
+    tables.reserve(n + 2 * m);
+    for (const auto *table : { &chirp, &fwd_kernel, &bwd_kernel }) {
+        for (const auto &value : *table) {
+            tables.emplace_back(static_cast<R>(value.real()), static_cast<R>(value.imag()));
+        }
+    }
+    return tables;
+}
+
+/** z[b * padded_length + n] := x[n] * w[n] for n < length and 0 up to padded_length, with w the
+ *  chirp, or its conjugate for the backward transform.
+**/
+template <typename R, typename InPtrT, typename ZPtrT>
+void bluestein_pack_kernel(sycl::handler &cgh, InPtrT in, transform_layout layout,
+                           std::int64_t length, std::int64_t padded_length, std::int64_t batch,
+                           const std::complex<R> *chirp, bool conj_chirp, ZPtrT z) {
+    const sycl::range<2> range(static_cast<std::size_t>(batch),
+                               static_cast<std::size_t>(padded_length));
+    cgh.parallel_for(range, [=](sycl::item<2> item) {
+        const auto b = static_cast<std::int64_t>(item[0]);
+        const auto n = static_cast<std::int64_t>(item[1]);
+        std::complex<R> value(0);
+        if (n < length) {
+            const std::complex<R> w = conj_chirp ? std::conj(chirp[n]) : chirp[n];
+            const std::int64_t idx = layout.offset + b * layout.distance + n * layout.stride;
+            value = std::complex<R>(in[idx]) * w;
+        }
+        z[b * padded_length + n] = value;
+    });
+}
+
+/** z[b * padded_length + k] *= spectrum[k]. **/
+template <typename R>
+void bluestein_multiply_kernel(sycl::handler &cgh, std::complex<R> *z, std::int64_t padded_length,
+                               std::int64_t batch, const std::complex<R> *spectrum) {
+    const sycl::range<2> range(static_cast<std::size_t>(batch),
+                               static_cast<std::size_t>(padded_length));
+    cgh.parallel_for(range, [=](sycl::item<2> item) {
+        const auto b = static_cast<std::int64_t>(item[0]);
+        const auto k = static_cast<std::int64_t>(item[1]);
+        z[b * padded_length + k] *= spectrum[k];
+    });
+}
+
+/** For a convolution, goes from the forward transform in z to the input of the backward transform
+ *  in place: bluestein_unpack_kernel scaled by scale, the product with the filter and
+ *  bluestein_pack_kernel with the conjugate chirp. The chirps cancel, which leaves
+ *  z[b * padded_length + k] := scale * z[b * padded_length + k] * filter[k] for k < length and 0
+ *  up to padded_length.
+**/
+template <typename R, typename FilterPtrT>
+void bluestein_filter_kernel(sycl::handler &cgh, std::complex<R> *z, std::int64_t length,
+                             std::int64_t padded_length, std::int64_t batch, R scale,
+                             FilterPtrT filter, bool conjugate_filter) {
+    const sycl::range<2> range(static_cast<std::size_t>(batch),
+                               static_cast<std::size_t>(padded_length));
+    cgh.parallel_for(range, [=](sycl::item<2> item) {
+        const auto b = static_cast<std::int64_t>(item[0]);
+        const auto k = static_cast<std::int64_t>(item[1]);
+        std::complex<R> value(0);
+        if (k < length) {
+            const std::complex<R> f = filter[k];
+            value = scale * z[b * padded_length + k] * (conjugate_filter ? std::conj(f) : f);
+        }
+        z[b * padded_length + k] = value;
+    });
+}
+
+/** Writes X[k] = scale * w[k] * z[b * padded_length + k] for k < length, with w as in
+ *  bluestein_pack_kernel.
+**/
+template <typename R, typename OutPtrT>
+void bluestein_unpack_kernel(sycl::handler &cgh, const std::complex<R> *z, std::int64_t length,
+                             std::int64_t padded_length, std::int64_t batch,
+                             const std::complex<R> *chirp, bool conj_chirp, R scale, OutPtrT out,
+                             transform_layout layout) {
+    const sycl::range<2> range(static_cast<std::size_t>(batch), static_cast<std::size_t>(length));
+    cgh.parallel_for(range, [=](sycl::item<2> item) {
+        const auto b = static_cast<std::int64_t>(item[0]);
+        const auto k = static_cast<std::int64_t>(item[1]);
+        const std::complex<R> w = conj_chirp ? std::conj(chirp[k]) : chirp[k];
+        out[layout.offset + b * layout.distance + k * layout.stride] =
+            scale * w * z[b * padded_length + k];
+    });
+}
+
+} // namespace oneapi::mkl::dft::portfft::detail
+
+#endif
@@ -20,6 +20,7 @@
 #ifndef _ONEMKL_DFT_SRC_PORTFFT_HELPERS_HPP_
 #define _ONEMKL_DFT_SRC_PORTFFT_HELPERS_HPP_
 
+#include <cstdint>
 #include <type_traits>
 
 #include <portfft/portfft.hpp>
@@ -41,16 +42,24 @@ inline dft::detail::commit_impl<prec, dom> *checked_get_commit(
     return commit_handle;
 }
 
+/** Layout of the data of a batch of one-dimensional transforms, in elements of that data. **/
+struct transform_layout {
+    std::int64_t offset;
+    std::int64_t stride;
+    std::int64_t distance;
+};
+
 template <typename descriptor_type>
 using to_pfft_domain =
     std::conditional<std::is_floating_point_v<fwd<descriptor_type>>,
                      std::integral_constant<pfft::domain, pfft::domain::REAL>,
                      std::integral_constant<pfft::domain, pfft::domain::COMPLEX>>;
 
+// Real transforms are computed with complex transforms of half the length, so every committed
+// portFFT descriptor is a complex one.
 template <typename descriptor_type>
 using storage_type =
-    std::optional<pfft::committed_descriptor<scalar<descriptor_type>,
-                                             detail::to_pfft_domain<descriptor_type>::type::value>>;
+    std::optional<pfft::committed_descriptor<scalar<descriptor_type>, pfft::domain::COMPLEX>>;
 
 template <typename descriptor_type>
 auto get_descriptors(descriptor_type &desc) {
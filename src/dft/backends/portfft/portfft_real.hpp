@@ -0,0 +1,186 @@
+/*******************************************************************************
+* Copyright Codeplay Software Ltd
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_DFT_SRC_PORTFFT_REAL_HPP_
+#define _ONEMKL_DFT_SRC_PORTFFT_REAL_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <complex>
+#include <cstdint>
+
+#include "portfft_helper.hpp"
+
+// Real transforms of even length N for the portFFT backend.
+//
+// The N real samples x are packed into the N/2 complex samples z[m] = x[2m] + i*x[2m+1], and
+// Z is the complex DFT of z. With Z[N/2] = Z[0] and W = exp(-2*pi*i/N), the conjugate-even
+// spectrum is
+//   X[k] = (Z[k] + conj(Z[N/2-k])) / 2 - i * W^k * (Z[k] - conj(Z[N/2-k])) / 2
+// for k = 0 ... N/2. The backward transform runs the same steps in reverse:
+//   Z[k] = (X[k] + conj(X[N/2-k])) + i * W^-k * (X[k] - conj(X[N/2-k]))
+// for k < N/2, then the unscaled backward DFT of Z holds x[2m] + i*x[2m+1].
+//
+// Each transform therefore costs one complex DFT of half the length plus a pass over the data.
+// The pack kernels also gather strided and batched data into a contiguous batch of N/2, which
+// the complex DFT transforms in place.
+
+namespace oneapi::mkl::dft::portfft::detail {
+
+/** The sizes, scales and layouts of a committed real transform. The forward transform reads
+ *  real fwd_in and writes complex fwd_out, the backward transform reads complex bwd_in and
+ *  writes real bwd_out.
+**/
+template <typename R>
+struct real_transform_config {
+    std::int64_t half_length;
+    std::int64_t batch;
+    R fwd_scale;
+    R bwd_scale;
+    transform_layout fwd_in;
+    transform_layout fwd_out;
+    transform_layout bwd_in;
+    transform_layout bwd_out;
+};
+
+template <typename R>
+std::complex<R> real_transform_twiddle(std::int64_t k, std::int64_t half_length, bool inverse) {
+    constexpr R pi = static_cast<R>(3.14159265358979323846);
+    const R angle = (inverse ? pi : -pi) * static_cast<R>(k) / static_cast<R>(half_length);
+    return { sycl::cos(angle), sycl::sin(angle) };
+}
+
+/** z[b * half_length + m] := x[2m] + i * x[2m + 1] for the real input x of batch b. **/
+template <typename R, typename InPtrT, typename ZPtrT>
+void r2c_pack_kernel(sycl::handler &cgh, InPtrT in, transform_layout layout,
+                     std::int64_t half_length, std::int64_t batch, ZPtrT z) {
+    const sycl::range<2> range(static_cast<std::size_t>(batch),
+                               static_cast<std::size_t>(half_length));
+    cgh.parallel_for(range, [=](sycl::item<2> item) {
+        const auto b = static_cast<std::int64_t>(item[0]);
+        const auto m = static_cast<std::int64_t>(item[1]);
+        const std::int64_t base = layout.offset + b * layout.distance;
+        z[b * half_length + m] = std::complex<R>(in[base + 2 * m * layout.stride],
+                                                 in[base + (2 * m + 1) * layout.stride]);
+    });
+}
+
+/** Writes the conjugate-even spectrum X[0 ... half_length] of batch b from the DFT of its
+ *  packed samples, scaled by scale.
+**/
+template <typename R, typename ZPtrT, typename OutPtrT>
+void r2c_unpack_kernel(sycl::handler &cgh, ZPtrT z, std::int64_t half_length, std::int64_t batch,
+                       R scale, OutPtrT out, transform_layout layout) {
+    const sycl::range<2> range(static_cast<std::size_t>(batch),
+                               static_cast<std::size_t>(half_length + 1));
+    cgh.parallel_for(range, [=](sycl::item<2> item) {
+        const auto b = static_cast<std::int64_t>(item[0]);
+        const auto k = static_cast<std::int64_t>(item[1]);
+        const std::int64_t zb = b * half_length;
+        const std::complex<R> zk = z[zb + k % half_length];
+        const std::complex<R> zc = std::conj(z[zb + (half_length - k) % half_length]);
+        const std::complex<R> even = (zk + zc) * R(0.5);
+        const std::complex<R> odd = (zk - zc) * std::complex<R>(0, R(-0.5));
+        const std::complex<R> w = real_transform_twiddle<R>(k, half_length, false);
+        out[layout.offset + b * layout.distance + k * layout.stride] = scale * (even + w * odd);
+    });
+}
+
+/** z[b * half_length + k] := the packed spectrum of batch b, read from its conjugate-even
+ *  spectrum X[0 ... half_length].
+**/
+template <typename R, typename InPtrT, typename ZPtrT>
+void c2r_pack_kernel(sycl::handler &cgh, InPtrT in, transform_layout layout,
+                     std::int64_t half_length, std::int64_t batch, ZPtrT z) {
+    const sycl::range<2> range(static_cast<std::size_t>(batch),
+                               static_cast<std::size_t>(half_length));
+    cgh.parallel_for(range, [=](sycl::item<2> item) {
+        const auto b = static_cast<std::int64_t>(item[0]);
+        const auto k = static_cast<std::int64_t>(item[1]);
+        const std::int64_t base = layout.offset + b * layout.distance;
+        const std::complex<R> xk = in[base + k * layout.stride];
+        const std::complex<R> xc =
+            std::conj(std::complex<R>(in[base + (half_length - k) * layout.stride]));
+        const std::complex<R> w = real_transform_twiddle<R>(k, half_length, true);
+        z[b * half_length + k] = (xk + xc) + std::complex<R>(0, 1) * w * (xk - xc);
+    });
+}
+
+/** Writes the real output x[2m] = scale * Re(z[m]), x[2m + 1] = scale * Im(z[m]) of batch b. **/
+template <typename R, typename ZPtrT, typename OutPtrT>
+void c2r_unpack_kernel(sycl::handler &cgh, ZPtrT z, std::int64_t half_length, std::int64_t batch,
+                       R scale, OutPtrT out, transform_layout layout) {
+    const sycl::range<2> range(static_cast<std::size_t>(batch),
+                               static_cast<std::size_t>(half_length));
+    cgh.parallel_for(range, [=](sycl::item<2> item) {
+        const auto b = static_cast<std::int64_t>(item[0]);
+        const auto m = static_cast<std::int64_t>(item[1]);
+        const std::int64_t base = layout.offset + b * layout.distance;
+        const std::complex<R> zm = z[b * half_length + m];
+        out[base + 2 * m * layout.stride] = scale * zm.real();
+        out[base + (2 * m + 1) * layout.stride] = scale * zm.imag();
+    });
+}
+
+/** For a convolution, goes from the DFT of the packed samples of batch b to the packed spectrum
+ *  of the filtered spectrum: r2c_unpack_kernel scaled by scale, the product with the filter and
+ *  c2r_pack_kernel, in place. Packed elements k and half_length - k depend on each other, so one
+ *  work-item computes both.
+**/
+template <typename R, typename ZPtrT, typename FilterPtrT>
+void real_filter_kernel(sycl::handler &cgh, ZPtrT z, std::int64_t half_length, std::int64_t batch,
+                        R scale, FilterPtrT filter, bool conjugate_filter) {
+    const sycl::range<2> range(static_cast<std::size_t>(batch),
+                               static_cast<std::size_t>(half_length / 2 + 1));
+    cgh.parallel_for(range, [=](sycl::item<2> item) {
+        const auto b = static_cast<std::int64_t>(item[0]);
+        const auto j = static_cast<std::int64_t>(item[1]);
+        const std::int64_t zb = b * half_length;
+        const std::int64_t mirror = (half_length - j) % half_length;
+        const std::complex<R> zj = z[zb + j];
+        const std::complex<R> zm = z[zb + mirror];
+        // The filtered spectrum at k, from z[k] = a and z[half_length - k] = c.
+        auto filtered = [&](std::int64_t k, std::complex<R> a, std::complex<R> c) {
+            const std::complex<R> even = (a + std::conj(c)) * R(0.5);
+            const std::complex<R> odd = (a - std::conj(c)) * std::complex<R>(0, R(-0.5));
+            const std::complex<R> w = real_transform_twiddle<R>(k, half_length, false);
+            const std::complex<R> f = filter[k];
+            return scale * (even + w * odd) * (conjugate_filter ? std::conj(f) : f);
+        };
+        const std::complex<R> yj = filtered(j, zj, zm);
+        const std::complex<R> ym = filtered(half_length - j, zm, zj);
+        // The packed spectrum at k, from the filtered spectrum at k and half_length - k.
+        auto packed = [&](std::int64_t k, std::complex<R> xk, std::complex<R> xc) {
+            const std::complex<R> w = real_transform_twiddle<R>(k, half_length, true);
+            return (xk + std::conj(xc)) + std::complex<R>(0, 1) * w * (xk - std::conj(xc));
+        };
+        z[zb + j] = packed(j, yj, ym);
+        if (mirror != j) {
+            z[zb + mirror] = packed(half_length - j, ym, yj);
+        }
+    });
+}
+
+} // namespace oneapi::mkl::dft::portfft::detail
+
+#endif
@@ -34,6 +34,8 @@
 #include "oneapi/mkl/dft/detail/rocfft/onemkl_dft_rocfft.hpp"
 #include "oneapi/mkl/dft/types.hpp"
 
+#include "dft/descriptor_config_helper.hpp"
+
 #include "rocfft_handle.hpp"
 
 #include <rocfft.h>
@@ -141,8 +143,14 @@ public:
             oneapi::mkl::dft::detail::external_workspace_helper<prec, dom>(
                 config_values.workspace_placement ==
                 oneapi::mkl::dft::detail::config_value::WORKSPACE_EXTERNAL);
+        this->committed_convolution_ = dft::detail::committed_convolution_layout(config_values);
         clean_plans();
 
+        if (dft::detail::is_transposed(config_values)) {
+            throw mkl::unimplemented("dft/backends/rocfft", __FUNCTION__,
+                                     "rocFFT does not support transposed output");
+        }
+
         const rocfft_result_placement placement =
             (config_values.placement == dft::config_value::INPLACE) ? rocfft_placement_inplace
                                                                     : rocfft_placement_notinplace;
@@ -165,9 +165,33 @@ template <precision prec, domain dom>
 descriptor<prec, dom>::descriptor(std::int64_t length)
         : descriptor<prec, dom>(std::vector<std::int64_t>{ length }) {}
 
+// A committed plan is only shared between descriptors that do not set their own
+// workspace on it.
+template <precision prec, domain dom>
+std::shared_ptr<commit_impl<prec, dom>> shared_commit(
+    const std::shared_ptr<commit_impl<prec, dom>>& pimpl, const dft_values<prec, dom>& values) {
+    if (values.workspace_placement == config_value::WORKSPACE_EXTERNAL) {
+        return nullptr;
+    }
+    return pimpl;
+}
+
+template <precision prec, domain dom>
+descriptor<prec, dom>::descriptor(const descriptor<prec, dom>& other)
+        : pimpl_(shared_commit(other.pimpl_, other.values_)), values_(other.values_) {}
+
 template <precision prec, domain dom>
 descriptor<prec, dom>::descriptor(descriptor<prec, dom>&& other) = default;
 
+template <precision prec, domain dom>
+descriptor<prec, dom>& descriptor<prec, dom>::operator=(const descriptor<prec, dom>& other) {
+    if (this != &other) {
+        pimpl_ = shared_commit(other.pimpl_, other.values_);
+        values_ = other.values_;
+    }
+    return *this;
+}
+
 template <precision prec, domain dom>
 descriptor<prec, dom>& descriptor<prec, dom>::operator=(descriptor<prec, dom>&&) = default;
 
@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <type_traits>
+#include <vector>
 
 #include "oneapi/mkl/dft/descriptor.hpp"
 
@@ -220,6 +221,58 @@ void set_value(dft_values<prec, dom>& vals,
     }
 }
 
+/** Whether TRANSPOSE changes the layout of the backward domain. A one-dimensional transform
+ *  has nothing to transpose.
+ * @param vals The configuration of the DFT.
+**/
+template <precision prec, domain dom>
+bool is_transposed(const dft_values<prec, dom>& vals) {
+    return vals.transpose && vals.dimensions.size() > 1;
+}
+
+/** Get the strides of the backward domain when TRANSPOSE is set. The dimensions are stored in
+ * reverse order, so the last transformed dimension leads and the first dimension is contiguous.
+ * The offset is taken from the output strides. The forward transform writes this layout and the
+ * backward transform reads it, with INPUT_STRIDES describing the forward domain both ways.
+ * The length of the last dimension never enters the strides, so the same layout holds for the
+ * conjugate-even backward domain of real transforms.
+ * @param vals The configuration of the DFT.
+ * @return The offset followed by one stride per dimension.
+ * @throws invalid_argument if OUTPUT_STRIDES other than the offset were changed from their
+ * default, or if the BWD_DISTANCE of a batch is less than the size of one transposed transform.
+**/
+template <precision prec, domain dom>
+std::vector<std::int64_t> get_transposed_strides(const dft_values<prec, dom>& vals) {
+    const auto rank = vals.dimensions.size();
+    // The default strides set by the descriptor constructor. Any other value would be ignored.
+    std::int64_t default_stride = 1;
+    for (std::size_t i = rank; i > 0; --i) {
+        if (vals.output_strides[i] != default_stride) {
+            throw mkl::invalid_argument(
+                "DFT", "commit",
+                "Only the offset of OUTPUT_STRIDES can be set when TRANSPOSE is set.");
+        }
+        default_stride *= vals.dimensions[i - 1];
+    }
+
+    std::vector<std::int64_t> strides(rank + 1);
+    strides[0] = vals.output_strides[0];
+    std::int64_t stride = 1;
+    for (std::size_t i = 0; i < rank; ++i) {
+        strides[i + 1] = stride;
+        stride *= vals.dimensions[i];
+    }
+
+    const std::int64_t last_length =
+        dom == domain::REAL ? vals.dimensions.back() / 2 + 1 : vals.dimensions.back();
+    if (vals.number_of_transforms > 1 && vals.bwd_dist < strides[rank] * last_length) {
+        throw mkl::invalid_argument(
+            "DFT", "commit",
+            "BWD_DISTANCE is less than the size of one transform with TRANSPOSE set.");
+    }
+    return strides;
+}
+
 } // namespace detail
 } // namespace dft
 } // namespace mkl
@@ -0,0 +1,281 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "cblas.h"
+#include "oneapi/mkl.hpp"
+#include "oneapi/mkl/detail/config.hpp"
+#include "allocator_helper.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device *> devices;
+
+namespace {
+
+template <typename fp>
+int test(device *dev, oneapi::mkl::layout layout, oneapi::mkl::transpose transa,
+         oneapi::mkl::transpose transb, int64_t batch_size) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM_VBATCH:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data. Every entry of the batch gets its own shape; a few large
+    // entries are mixed with many small ones so that the scheduling matters.
+    auto uaint = usm_allocator<int64_t, usm::alloc::shared, 64>(cxt, *dev);
+    vector<int64_t, decltype(uaint)> m(uaint), n(uaint), k(uaint), lda(uaint), ldb(uaint),
+        ldc(uaint);
+
+    m.resize(batch_size);
+    n.resize(batch_size);
+    k.resize(batch_size);
+    lda.resize(batch_size);
+    ldb.resize(batch_size);
+    ldc.resize(batch_size);
+
+    fp alpha = rand_scalar<fp>();
+    fp beta = rand_scalar<fp>();
+
+    int64_t i;
+    int64_t size_a = 0, size_b = 0, size_c = 0;
+
+    for (i = 0; i < batch_size; i++) {
+        const int64_t max_dim = (i % 8 == 0) ? 300 : 40;
+        m[i] = 1 + std::rand() % max_dim;
+        n[i] = 1 + std::rand() % max_dim;
+        k[i] = 1 + std::rand() % max_dim;
+        lda[i] = std::max(m[i], k[i]);
+        ldb[i] = std::max(n[i], k[i]);
+        ldc[i] = std::max(m[i], n[i]);
+    }
+
+    auto uafpp = usm_allocator<fp *, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp *, decltype(uafpp)> a_array(uafpp), b_array(uafpp), c_array(uafpp),
+        c_ref_array(uafpp);
+    a_array.resize(batch_size);
+    b_array.resize(batch_size);
+    c_array.resize(batch_size);
+    c_ref_array.resize(batch_size);
+
+    for (i = 0; i < batch_size; i++) {
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                size_a = lda[i] * ((transa == oneapi::mkl::transpose::nontrans) ? k[i] : m[i]);
+                size_b = ldb[i] * ((transb == oneapi::mkl::transpose::nontrans) ? n[i] : k[i]);
+                size_c = ldc[i] * n[i];
+                break;
+            case oneapi::mkl::layout::row_major:
+                size_a = lda[i] * ((transa == oneapi::mkl::transpose::nontrans) ? m[i] : k[i]);
+                size_b = ldb[i] * ((transb == oneapi::mkl::transpose::nontrans) ? k[i] : n[i]);
+                size_c = ldc[i] * m[i];
+                break;
+            default: break;
+        }
+        a_array[i] = (fp *)oneapi::mkl::malloc_shared(64, sizeof(fp) * size_a, *dev, cxt);
+        b_array[i] = (fp *)oneapi::mkl::malloc_shared(64, sizeof(fp) * size_b, *dev, cxt);
+        c_array[i] = (fp *)oneapi::mkl::malloc_shared(64, sizeof(fp) * size_c, *dev, cxt);
+        c_ref_array[i] = (fp *)oneapi::mkl::malloc_shared(64, sizeof(fp) * size_c, *dev, cxt);
+        rand_matrix(a_array[i], layout, transa, m[i], k[i], lda[i]);
+        rand_matrix(b_array[i], layout, transb, k[i], n[i], ldb[i]);
+        rand_matrix(c_array[i], layout, oneapi::mkl::transpose::nontrans, m[i], n[i], ldc[i]);
+        copy_matrix(c_array[i], layout, oneapi::mkl::transpose::nontrans, m[i], n[i], ldc[i],
+                    c_ref_array[i]);
+    }
+
+    auto free_matrices = [&]() {
+        for (int64_t j = 0; j < batch_size; j++) {
+            oneapi::mkl::free_shared(a_array[j], cxt);
+            oneapi::mkl::free_shared(b_array[j], cxt);
+            oneapi::mkl::free_shared(c_array[j], cxt);
+            oneapi::mkl::free_shared(c_ref_array[j], cxt);
+        }
+    };
+
+    // Call reference GEMM for each entry.
+    using fp_ref = typename ref_type_info<fp>::type;
+    CBLAS_TRANSPOSE transa_ref = convert_to_cblas_trans(transa);
+    CBLAS_TRANSPOSE transb_ref = convert_to_cblas_trans(transb);
+
+    for (i = 0; i < batch_size; i++) {
+        int m_ref = (int)m[i];
+        int n_ref = (int)n[i];
+        int k_ref = (int)k[i];
+        int lda_ref = (int)lda[i];
+        int ldb_ref = (int)ldb[i];
+        int ldc_ref = (int)ldc[i];
+        ::gemm(convert_to_cblas_layout(layout), transa_ref, transb_ref, (const int *)&m_ref,
+               (const int *)&n_ref, (const int *)&k_ref, (const fp_ref *)&alpha,
+               (const fp_ref *)a_array[i], (const int *)&lda_ref, (const fp_ref *)b_array[i],
+               (const int *)&ldb_ref, (const fp_ref *)&beta, (fp_ref *)c_ref_array[i],
+               (const int *)&ldc_ref);
+    }
+
+    // Call DPC++ GEMM_VBATCH.
+
+    try {
+#ifdef CALL_RT_API
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                done = oneapi::mkl::blas::column_major::gemm_vbatch(
+                    main_queue, transa, transb, &m[0], &n[0], &k[0], alpha,
+                    (const fp **)&a_array[0], &lda[0], (const fp **)&b_array[0], &ldb[0], beta,
+                    &c_array[0], &ldc[0], batch_size, dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                done = oneapi::mkl::blas::row_major::gemm_vbatch(
+                    main_queue, transa, transb, &m[0], &n[0], &k[0], alpha,
+                    (const fp **)&a_array[0], &lda[0], (const fp **)&b_array[0], &ldb[0], beta,
+                    &c_array[0], &ldc[0], batch_size, dependencies);
+                break;
+            default: break;
+        }
+        done.wait();
+#else
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::gemm_vbatch,
+                                        transa, transb, &m[0], &n[0], &k[0], alpha,
+                                        (const fp **)&a_array[0], &lda[0], (const fp **)&b_array[0],
+                                        &ldb[0], beta, &c_array[0], &ldc[0], batch_size,
+                                        dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::gemm_vbatch,
+                                        transa, transb, &m[0], &n[0], &k[0], alpha,
+                                        (const fp **)&a_array[0], &lda[0], (const fp **)&b_array[0],
+                                        &ldb[0], beta, &c_array[0], &ldc[0], batch_size,
+                                        dependencies);
+                break;
+            default: break;
+        }
+        main_queue.wait();
+#endif
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_VBATCH:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented &e) {
+        free_matrices();
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of GEMM_VBATCH:\n" << error.what() << std::endl;
+    }
+
+    bool good = true;
+    // Compare the results of reference implementation and DPC++ implementation.
+    for (i = 0; i < batch_size; i++) {
+        good = good && check_equal_matrix(c_array[i], c_ref_array[i], layout, m[i], n[i], ldc[i],
+                                          10 * k[i], std::cout);
+    }
+    free_matrices();
+
+    return (int)good;
+}
+
+class GemmVbatchUsmTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device *, oneapi::mkl::layout>> {};
+
+TEST_P(GemmVbatchUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                  oneapi::mkl::transpose::nontrans,
+                                  oneapi::mkl::transpose::nontrans, 37));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                  oneapi::mkl::transpose::trans, oneapi::mkl::transpose::nontrans,
+                                  37));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                  oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::trans,
+                                  37));
+}
+
+TEST_P(GemmVbatchUsmTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                   oneapi::mkl::transpose::nontrans,
+                                   oneapi::mkl::transpose::nontrans, 37));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                   oneapi::mkl::transpose::trans, oneapi::mkl::transpose::trans,
+                                   37));
+}
+
+TEST_P(GemmVbatchUsmTests, ComplexSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::nontrans, 37));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::conjtrans,
+        oneapi::mkl::transpose::trans, 37));
+}
+
+TEST_P(GemmVbatchUsmTests, ComplexDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::nontrans, 37));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::conjtrans, 37));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmVbatchUsmTestSuite, GemmVbatchUsmTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,345 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device *> devices;
+
+namespace {
+
+// Batches of tiny matrices, which CPU backends may run on dedicated kernels.
+// The batch size is not a multiple of a vector length so partly filled blocks
+// are exercised too.
+const int64_t small_batch_size = 37;
+const std::vector<int64_t> small_sizes = { 2, 3, 4, 7, 8, 16, 32 };
+
+template <typename fp>
+int test_gemm(device *dev, oneapi::mkl::layout layout, int64_t size) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during small GEMM_BATCH:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data. One side differs from the others for the non-square case.
+    int64_t m = size, n = size, k = (size % 2) ? size + 1 : size;
+    int64_t batch_size = small_batch_size;
+    int64_t lda = std::max(m, k) + 1;
+    int64_t ldb = std::max(n, k) + 1;
+    int64_t ldc = std::max(m, n) + 1;
+    fp alpha = rand_scalar<fp>();
+    fp beta = rand_scalar<fp>();
+    oneapi::mkl::transpose transa = (oneapi::mkl::transpose)(std::rand() % 2);
+    oneapi::mkl::transpose transb = (oneapi::mkl::transpose)(std::rand() % 2);
+
+    int64_t stride_a = lda * std::max(m, k);
+    int64_t stride_b = ldb * std::max(n, k);
+    int64_t stride_c = ldc * std::max(m, n);
+
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), C(ua), C_ref(ua);
+
+    A.resize(stride_a * batch_size);
+    B.resize(stride_b * batch_size);
+    C.resize(stride_c * batch_size);
+    C_ref.resize(stride_c * batch_size);
+
+    rand_matrix(A, oneapi::mkl::layout::col_major, oneapi::mkl::transpose::nontrans,
+                stride_a * batch_size, 1, stride_a * batch_size);
+    rand_matrix(B, oneapi::mkl::layout::col_major, oneapi::mkl::transpose::nontrans,
+                stride_b * batch_size, 1, stride_b * batch_size);
+    rand_matrix(C, oneapi::mkl::layout::col_major, oneapi::mkl::transpose::nontrans,
+                stride_c * batch_size, 1, stride_c * batch_size);
+    copy_matrix(C, oneapi::mkl::layout::col_major, oneapi::mkl::transpose::nontrans,
+                stride_c * batch_size, 1, stride_c * batch_size, C_ref);
+
+    // Call reference GEMM on each matrix.
+    using fp_ref = typename ref_type_info<fp>::type;
+    int m_ref = (int)m;
+    int n_ref = (int)n;
+    int k_ref = (int)k;
+    int lda_ref = (int)lda;
+    int ldb_ref = (int)ldb;
+    int ldc_ref = (int)ldc;
+    for (int64_t i = 0; i < batch_size; i++) {
+        ::gemm(
+            convert_to_cblas_layout(layout), convert_to_cblas_trans(transa),
+            convert_to_cblas_trans(transb), (const int *)&m_ref, (const int *)&n_ref,
+            (const int *)&k_ref, (const fp_ref *)&alpha, (const fp_ref *)(A.data() + stride_a * i),
+            (const int *)&lda_ref, (const fp_ref *)(B.data() + stride_b * i), (const int *)&ldb_ref,
+            (const fp_ref *)&beta, (fp_ref *)(C_ref.data() + stride_c * i), (const int *)&ldc_ref);
+    }
+
+    // Call DPC++ GEMM_BATCH_STRIDE.
+
+    try {
+#ifdef CALL_RT_API
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                done = oneapi::mkl::blas::column_major::gemm_batch(
+                    main_queue, transa, transb, m, n, k, alpha, &A[0], lda, stride_a, &B[0], ldb,
+                    stride_b, beta, &C[0], ldc, stride_c, batch_size, dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                done = oneapi::mkl::blas::row_major::gemm_batch(
+                    main_queue, transa, transb, m, n, k, alpha, &A[0], lda, stride_a, &B[0], ldb,
+                    stride_b, beta, &C[0], ldc, stride_c, batch_size, dependencies);
+                break;
+            default: break;
+        }
+        done.wait();
+#else
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::gemm_batch,
+                                        transa, transb, m, n, k, alpha, &A[0], lda, stride_a, &B[0],
+                                        ldb, stride_b, beta, &C[0], ldc, stride_c, batch_size,
+                                        dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::gemm_batch,
+                                        transa, transb, m, n, k, alpha, &A[0], lda, stride_a, &B[0],
+                                        ldb, stride_b, beta, &C[0], ldc, stride_c, batch_size,
+                                        dependencies);
+                break;
+            default: break;
+        }
+        main_queue.wait();
+#endif
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during small GEMM_BATCH:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented &e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of small GEMM_BATCH:\n"
+                  << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = check_equal_matrix(C, C_ref, oneapi::mkl::layout::col_major, stride_c * batch_size,
+                                   1, stride_c * batch_size, 10 * k, std::cout);
+
+    return (int)good;
+}
+
+template <typename fp>
+int test_trsm(device *dev, oneapi::mkl::layout layout, int64_t size) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during small TRSM_BATCH:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    int64_t m = size, n = (size % 2) ? size + 1 : size;
+    int64_t batch_size = small_batch_size;
+    int64_t lda = std::max(m, n) + 1;
+    int64_t ldb = std::max(m, n) + 1;
+    fp alpha = rand_scalar<fp>();
+    oneapi::mkl::transpose trans = (oneapi::mkl::transpose)(std::rand() % 2);
+    oneapi::mkl::side left_right = (oneapi::mkl::side)(std::rand() % 2);
+    oneapi::mkl::uplo upper_lower = (oneapi::mkl::uplo)(std::rand() % 2);
+    oneapi::mkl::diag unit_nonunit = (oneapi::mkl::diag)(std::rand() % 2);
+
+    int64_t stride_a = (left_right == oneapi::mkl::side::left) ? lda * m : lda * n;
+    int64_t stride_b = (layout == oneapi::mkl::layout::col_major) ? ldb * n : ldb * m;
+    int64_t total_size_b = batch_size * stride_b;
+
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), B_ref(ua);
+
+    A.resize(stride_a * batch_size);
+    B.resize(total_size_b);
+    B_ref.resize(total_size_b);
+
+    for (int64_t i = 0; i < batch_size; i++) {
+        if (left_right == oneapi::mkl::side::left)
+            rand_trsm_matrix(&A[stride_a * i], layout, trans, m, m, lda);
+        else
+            rand_trsm_matrix(&A[stride_a * i], layout, trans, n, n, lda);
+        rand_matrix(&B[stride_b * i], layout, oneapi::mkl::transpose::nontrans, m, n, ldb);
+    }
+
+    copy_matrix(B, oneapi::mkl::layout::col_major, oneapi::mkl::transpose::nontrans, total_size_b,
+                1, total_size_b, B_ref);
+
+    // Call reference TRSM on each matrix.
+    using fp_ref = typename ref_type_info<fp>::type;
+    int m_ref = (int)m;
+    int n_ref = (int)n;
+    int lda_ref = (int)lda;
+    int ldb_ref = (int)ldb;
+    for (int64_t i = 0; i < batch_size; i++) {
+        ::trsm(convert_to_cblas_layout(layout), convert_to_cblas_side(left_right),
+               convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+               convert_to_cblas_diag(unit_nonunit), (const int *)&m_ref, (const int *)&n_ref,
+               (const fp_ref *)&alpha, (const fp_ref *)(A.data() + stride_a * i),
+               (const int *)&lda_ref, (fp_ref *)(B_ref.data() + stride_b * i),
+               (const int *)&ldb_ref);
+    }
+
+    // Call DPC++ TRSM_BATCH_STRIDE.
+
+    try {
+#ifdef CALL_RT_API
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                done = oneapi::mkl::blas::column_major::trsm_batch(
+                    main_queue, left_right, upper_lower, trans, unit_nonunit, m, n, alpha, &A[0],
+                    lda, stride_a, &B[0], ldb, stride_b, batch_size, dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                done = oneapi::mkl::blas::row_major::trsm_batch(
+                    main_queue, left_right, upper_lower, trans, unit_nonunit, m, n, alpha, &A[0],
+                    lda, stride_a, &B[0], ldb, stride_b, batch_size, dependencies);
+                break;
+            default: break;
+        }
+        done.wait();
+#else
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::trsm_batch,
+                                        left_right, upper_lower, trans, unit_nonunit, m, n, alpha,
+                                        &A[0], lda, stride_a, &B[0], ldb, stride_b, batch_size,
+                                        dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::trsm_batch,
+                                        left_right, upper_lower, trans, unit_nonunit, m, n, alpha,
+                                        &A[0], lda, stride_a, &B[0], ldb, stride_b, batch_size,
+                                        dependencies);
+                break;
+            default: break;
+        }
+        main_queue.wait();
+#endif
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during small TRSM_BATCH:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented &e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of small TRSM_BATCH:\n"
+                  << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = check_equal_trsm_matrix(B, B_ref, oneapi::mkl::layout::col_major, total_size_b, 1,
+                                        total_size_b, 10 * std::max(m, n), std::cout);
+
+    return (int)good;
+}
+
+template <typename fp>
+int test(device *dev, oneapi::mkl::layout layout) {
+    for (int64_t size : small_sizes) {
+        int result = test_gemm<fp>(dev, layout, size);
+        if (result != 1)
+            return result;
+        result = test_trsm<fp>(dev, layout, size);
+        if (result != 1)
+            return result;
+    }
+    return 1;
+}
+
+class SmallBatchUsmTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device *, oneapi::mkl::layout>> {};
+
+TEST_P(SmallBatchUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam())));
+}
+
+TEST_P(SmallBatchUsmTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(SmallBatchUsmTestSuite, SmallBatchUsmTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
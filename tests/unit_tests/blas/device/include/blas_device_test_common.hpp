@@ -0,0 +1,80 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _BLAS_DEVICE_TEST_COMMON_HPP__
+#define _BLAS_DEVICE_TEST_COMMON_HPP__
+
+#include <iostream>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl/blas/device.hpp"
+
+#include "test_helper.hpp"
+
+// Work-group size used for the sub-group tests; only the first sub-group of
+// the work-group calls the routine under test.
+#define SUB_GROUP_TEST_WG_SIZE 32
+
+inline sycl::queue make_device_test_queue(sycl::device *dev) {
+    auto exception_handler = [](sycl::exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (sycl::exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during BLAS device test:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+    return sycl::queue(*dev, exception_handler);
+}
+
+// Runs kernel(sg, use_sub_group) either on a single work-item or on the first
+// sub-group of a work-group, and waits for it.
+template <typename Kernel>
+bool run_device_kernel(sycl::queue &queue, bool use_sub_group, Kernel kernel) {
+    const std::size_t wg_size = use_sub_group ? SUB_GROUP_TEST_WG_SIZE : 1;
+    try {
+        queue
+            .parallel_for(sycl::nd_range<1>(wg_size, wg_size),
+                          [=](sycl::nd_item<1> item) {
+                              auto sg = item.get_sub_group();
+                              if (sg.get_group_linear_id() == 0) {
+                                  kernel(sg, use_sub_group);
+                              }
+                          })
+            .wait_and_throw();
+    }
+    catch (sycl::exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during BLAS device test:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+        return false;
+    }
+    return true;
+}
+
+#endif // _BLAS_DEVICE_TEST_COMMON_HPP__
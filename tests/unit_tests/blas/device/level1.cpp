@@ -0,0 +1,210 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "blas_device_test_common.hpp"
+#include "cblas.h"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device *> devices;
+
+namespace {
+constexpr std::int64_t N = 13;
+
+template <typename fp>
+int test_axpy(device *dev, bool use_sub_group, int incx, int incy) {
+    queue main_queue = make_device_test_queue(dev);
+    context cxt = main_queue.get_context();
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> x(ua), y(ua);
+    rand_vector(x, N, incx);
+    rand_vector(y, N, incy);
+    vector<fp> y_ref(y.begin(), y.end());
+    fp alpha = rand_scalar<fp>();
+
+    // Call reference AXPY.
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int n_ref = N, incx_ref = incx, incy_ref = incy;
+
+    ::axpy(&n_ref, (fp_ref *)&alpha, (fp_ref *)x.data(), &incx_ref, (fp_ref *)y_ref.data(),
+           &incy_ref);
+
+    // Call device AXPY.
+    const fp *x_ptr = x.data();
+    fp *y_ptr = y.data();
+    bool ran = run_device_kernel(main_queue, use_sub_group, [=](sub_group sg, bool cooperative) {
+        if (cooperative)
+            oneapi::mkl::blas::device::column_major::axpy<N>(sg, alpha, x_ptr, incx, y_ptr, incy);
+        else
+            oneapi::mkl::blas::device::column_major::axpy<N>(alpha, x_ptr, incx, y_ptr, incy);
+    });
+    if (!ran) {
+        return false;
+    }
+
+    // Compare the results of reference implementation and device implementation.
+    return (int)check_equal_vector(y, y_ref, N, incy, N, std::cout);
+}
+
+// Computes dot, dotc or dotu on the device, depending on the type and conj.
+template <typename fp, bool conj>
+int test_dot(device *dev, bool use_sub_group, int incx, int incy) {
+    queue main_queue = make_device_test_queue(dev);
+    context cxt = main_queue.get_context();
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> x(ua), y(ua), result(1, ua);
+    rand_vector(x, N, incx);
+    rand_vector(y, N, incy);
+
+    // Call reference DOT.
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int n_ref = N, incx_ref = incx, incy_ref = incy;
+    fp result_ref;
+
+    if constexpr (!std::is_same_v<fp, std::complex<float>> &&
+                  !std::is_same_v<fp, std::complex<double>>)
+        result_ref = ::dot(&n_ref, (fp_ref *)x.data(), &incx_ref, (fp_ref *)y.data(), &incy_ref);
+    else if constexpr (conj)
+        ::dotc((fp_ref *)&result_ref, &n_ref, (fp_ref *)x.data(), &incx_ref, (fp_ref *)y.data(),
+               &incy_ref);
+    else
+        ::dotu((fp_ref *)&result_ref, &n_ref, (fp_ref *)x.data(), &incx_ref, (fp_ref *)y.data(),
+               &incy_ref);
+
+    // Call device DOT.
+    const fp *x_ptr = x.data();
+    const fp *y_ptr = y.data();
+    fp *result_ptr = result.data();
+    bool ran = run_device_kernel(main_queue, use_sub_group, [=](sub_group sg, bool cooperative) {
+        namespace col = oneapi::mkl::blas::device::column_major;
+        fp res;
+        if constexpr (!std::is_same_v<fp, std::complex<float>> &&
+                      !std::is_same_v<fp, std::complex<double>>)
+            res = cooperative ? col::dot<N>(sg, x_ptr, incx, y_ptr, incy)
+                              : col::dot<N>(x_ptr, incx, y_ptr, incy);
+        else if constexpr (conj)
+            res = cooperative ? col::dotc<N>(sg, x_ptr, incx, y_ptr, incy)
+                              : col::dotc<N>(x_ptr, incx, y_ptr, incy);
+        else
+            res = cooperative ? col::dotu<N>(sg, x_ptr, incx, y_ptr, incy)
+                              : col::dotu<N>(x_ptr, incx, y_ptr, incy);
+        // Every work-item of the sub-group receives the result.
+        if (sg.get_local_linear_id() == sg.get_local_linear_range() - 1)
+            result_ptr[0] = res;
+    });
+    if (!ran) {
+        return false;
+    }
+
+    // Compare the results of reference implementation and device implementation.
+    return (int)check_equal(result[0], result_ref, N, std::cout);
+}
+
+class AxpyDeviceTests : public ::testing::TestWithParam<sycl::device *> {};
+
+class DotDeviceTests : public ::testing::TestWithParam<sycl::device *> {};
+
+TEST_P(AxpyDeviceTests, RealSinglePrecision) {
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP(test_axpy<float>(GetParam(), use_sub_group, 1, 1));
+        EXPECT_TRUEORSKIP(test_axpy<float>(GetParam(), use_sub_group, 2, 3));
+    }
+}
+
+TEST_P(AxpyDeviceTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP(test_axpy<double>(GetParam(), use_sub_group, 1, 1));
+        EXPECT_TRUEORSKIP(test_axpy<double>(GetParam(), use_sub_group, 2, 3));
+    }
+}
+
+TEST_P(AxpyDeviceTests, ComplexSinglePrecision) {
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP(test_axpy<std::complex<float>>(GetParam(), use_sub_group, 1, 1));
+        EXPECT_TRUEORSKIP(test_axpy<std::complex<float>>(GetParam(), use_sub_group, 2, 3));
+    }
+}
+
+TEST_P(AxpyDeviceTests, ComplexDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP(test_axpy<std::complex<double>>(GetParam(), use_sub_group, 1, 1));
+        EXPECT_TRUEORSKIP(test_axpy<std::complex<double>>(GetParam(), use_sub_group, 2, 3));
+    }
+}
+
+TEST_P(DotDeviceTests, RealSinglePrecision) {
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP((test_dot<float, false>(GetParam(), use_sub_group, 1, 1)));
+        EXPECT_TRUEORSKIP((test_dot<float, false>(GetParam(), use_sub_group, 2, 3)));
+    }
+}
+
+TEST_P(DotDeviceTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP((test_dot<double, false>(GetParam(), use_sub_group, 1, 1)));
+        EXPECT_TRUEORSKIP((test_dot<double, false>(GetParam(), use_sub_group, 2, 3)));
+    }
+}
+
+TEST_P(DotDeviceTests, ComplexSinglePrecision) {
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP((test_dot<std::complex<float>, true>(GetParam(), use_sub_group, 1, 1)));
+        EXPECT_TRUEORSKIP((test_dot<std::complex<float>, false>(GetParam(), use_sub_group, 2, 3)));
+    }
+}
+
+TEST_P(DotDeviceTests, ComplexDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP((test_dot<std::complex<double>, true>(GetParam(), use_sub_group, 1, 1)));
+        EXPECT_TRUEORSKIP(
+            (test_dot<std::complex<double>, false>(GetParam(), use_sub_group, 2, 3)));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(AxpyDeviceTestSuite, AxpyDeviceTests, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+INSTANTIATE_TEST_SUITE_P(DotDeviceTestSuite, DotDeviceTests, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
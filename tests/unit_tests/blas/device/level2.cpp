@@ -0,0 +1,272 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "blas_device_test_common.hpp"
+#include "cblas.h"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device *> devices;
+
+namespace {
+constexpr std::int64_t M = 6, N = 5;
+// Large enough for A and op(A) in either layout.
+constexpr std::int64_t LD = std::max(M, N);
+
+template <typename fp, oneapi::mkl::transpose trans>
+int test_gemv(device *dev, oneapi::mkl::layout layout, bool use_sub_group) {
+    queue main_queue = make_device_test_queue(dev);
+    context cxt = main_queue.get_context();
+
+    constexpr std::int64_t x_len = (trans == oneapi::mkl::transpose::nontrans) ? N : M;
+    constexpr std::int64_t y_len = (trans == oneapi::mkl::transpose::nontrans) ? M : N;
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(LD * LD, ua), x(ua), y(ua);
+    rand_matrix(A, layout, oneapi::mkl::transpose::nontrans, M, N, LD);
+    rand_vector(x, x_len, 1);
+    rand_vector(y, y_len, 1);
+    vector<fp> y_ref(y.begin(), y.end());
+    fp alpha = rand_scalar<fp>();
+    fp beta = rand_scalar<fp>();
+
+    // Call reference GEMV.
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int m_ref = M, n_ref = N, ld_ref = LD, inc_ref = 1;
+
+    ::gemv(convert_to_cblas_layout(layout), convert_to_cblas_trans(trans), &m_ref, &n_ref,
+           (fp_ref *)&alpha, (fp_ref *)A.data(), &ld_ref, (fp_ref *)x.data(), &inc_ref,
+           (fp_ref *)&beta, (fp_ref *)y_ref.data(), &inc_ref);
+
+    // Call device GEMV.
+    const fp *a = A.data();
+    const fp *x_ptr = x.data();
+    fp *y_ptr = y.data();
+    const bool column_major = (layout == oneapi::mkl::layout::col_major);
+
+    bool ran = run_device_kernel(main_queue, use_sub_group, [=](sub_group sg, bool cooperative) {
+        namespace col = oneapi::mkl::blas::device::column_major;
+        namespace row = oneapi::mkl::blas::device::row_major;
+        if (cooperative) {
+            if (column_major)
+                col::gemv<M, N, trans>(sg, alpha, a, LD, x_ptr, 1, beta, y_ptr, 1);
+            else
+                row::gemv<M, N, trans>(sg, alpha, a, LD, x_ptr, 1, beta, y_ptr, 1);
+        }
+        else {
+            if (column_major)
+                col::gemv<M, N, trans>(alpha, a, LD, x_ptr, 1, beta, y_ptr, 1);
+            else
+                row::gemv<M, N, trans>(alpha, a, LD, x_ptr, 1, beta, y_ptr, 1);
+        }
+    });
+    if (!ran) {
+        return false;
+    }
+
+    // Compare the results of reference implementation and device implementation.
+    return (int)check_equal_vector(y, y_ref, y_len, 1, std::max(M, N), std::cout);
+}
+
+template <typename fp, oneapi::mkl::uplo upper_lower, oneapi::mkl::transpose trans,
+          oneapi::mkl::diag unit_nonunit>
+int test_trsv(device *dev, oneapi::mkl::layout layout, bool use_sub_group, int incx) {
+    queue main_queue = make_device_test_queue(dev);
+    context cxt = main_queue.get_context();
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(ua), x(ua);
+    rand_trsm_matrix(A, layout, oneapi::mkl::transpose::nontrans, N, N, LD);
+    rand_vector(x, N, incx);
+    vector<fp> x_ref(x.begin(), x.end());
+
+    // Call reference TRSV.
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int n_ref = N, ld_ref = LD, incx_ref = incx;
+
+    ::trsv(convert_to_cblas_layout(layout), convert_to_cblas_uplo(upper_lower),
+           convert_to_cblas_trans(trans), convert_to_cblas_diag(unit_nonunit), &n_ref,
+           (fp_ref *)A.data(), &ld_ref, (fp_ref *)x_ref.data(), &incx_ref);
+
+    // Call device TRSV.
+    const fp *a = A.data();
+    fp *x_ptr = x.data();
+    const bool column_major = (layout == oneapi::mkl::layout::col_major);
+
+    bool ran = run_device_kernel(main_queue, use_sub_group, [=](sub_group sg, bool cooperative) {
+        namespace col = oneapi::mkl::blas::device::column_major;
+        namespace row = oneapi::mkl::blas::device::row_major;
+        if (cooperative) {
+            if (column_major)
+                col::trsv<N, upper_lower, trans, unit_nonunit>(sg, a, LD, x_ptr, incx);
+            else
+                row::trsv<N, upper_lower, trans, unit_nonunit>(sg, a, LD, x_ptr, incx);
+        }
+        else {
+            if (column_major)
+                col::trsv<N, upper_lower, trans, unit_nonunit>(a, LD, x_ptr, incx);
+            else
+                row::trsv<N, upper_lower, trans, unit_nonunit>(a, LD, x_ptr, incx);
+        }
+    });
+    if (!ran) {
+        return false;
+    }
+
+    // Compare the results of reference implementation and device implementation.
+    return (int)check_equal_trsv_vector(x, x_ref, N, incx, N, std::cout);
+}
+
+class GemvDeviceTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device *, oneapi::mkl::layout>> {};
+
+class TrsvDeviceTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device *, oneapi::mkl::layout>> {};
+
+TEST_P(GemvDeviceTests, RealSinglePrecision) {
+    using oneapi::mkl::transpose;
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP((test_gemv<float, transpose::nontrans>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group)));
+        EXPECT_TRUEORSKIP((test_gemv<float, transpose::trans>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group)));
+    }
+}
+
+TEST_P(GemvDeviceTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    using oneapi::mkl::transpose;
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP((test_gemv<double, transpose::nontrans>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group)));
+        EXPECT_TRUEORSKIP((test_gemv<double, transpose::trans>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group)));
+    }
+}
+
+TEST_P(GemvDeviceTests, ComplexSinglePrecision) {
+    using oneapi::mkl::transpose;
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP((test_gemv<std::complex<float>, transpose::nontrans>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group)));
+        EXPECT_TRUEORSKIP((test_gemv<std::complex<float>, transpose::conjtrans>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group)));
+    }
+}
+
+TEST_P(GemvDeviceTests, ComplexDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    using oneapi::mkl::transpose;
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP((test_gemv<std::complex<double>, transpose::nontrans>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group)));
+        EXPECT_TRUEORSKIP((test_gemv<std::complex<double>, transpose::conjtrans>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group)));
+    }
+}
+
+TEST_P(TrsvDeviceTests, RealSinglePrecision) {
+    using oneapi::mkl::diag;
+    using oneapi::mkl::transpose;
+    using oneapi::mkl::uplo;
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP((test_trsv<float, uplo::lower, transpose::nontrans, diag::nonunit>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group, 1)));
+        EXPECT_TRUEORSKIP((test_trsv<float, uplo::upper, transpose::nontrans, diag::unit>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group, 2)));
+        EXPECT_TRUEORSKIP((test_trsv<float, uplo::lower, transpose::trans, diag::nonunit>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group, 1)));
+        EXPECT_TRUEORSKIP((test_trsv<float, uplo::upper, transpose::trans, diag::nonunit>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group, 3)));
+    }
+}
+
+TEST_P(TrsvDeviceTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    using oneapi::mkl::diag;
+    using oneapi::mkl::transpose;
+    using oneapi::mkl::uplo;
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP((test_trsv<double, uplo::lower, transpose::nontrans, diag::nonunit>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group, 1)));
+        EXPECT_TRUEORSKIP((test_trsv<double, uplo::upper, transpose::trans, diag::unit>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group, 2)));
+    }
+}
+
+TEST_P(TrsvDeviceTests, ComplexSinglePrecision) {
+    using oneapi::mkl::diag;
+    using oneapi::mkl::transpose;
+    using oneapi::mkl::uplo;
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP(
+            (test_trsv<std::complex<float>, uplo::lower, transpose::conjtrans, diag::nonunit>(
+                std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group, 1)));
+        EXPECT_TRUEORSKIP(
+            (test_trsv<std::complex<float>, uplo::upper, transpose::nontrans, diag::nonunit>(
+                std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group, 2)));
+    }
+}
+
+TEST_P(TrsvDeviceTests, ComplexDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    using oneapi::mkl::diag;
+    using oneapi::mkl::transpose;
+    using oneapi::mkl::uplo;
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP(
+            (test_trsv<std::complex<double>, uplo::upper, transpose::conjtrans, diag::nonunit>(
+                std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group, 1)));
+        EXPECT_TRUEORSKIP(
+            (test_trsv<std::complex<double>, uplo::lower, transpose::nontrans, diag::unit>(
+                std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group, 2)));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(GemvDeviceTestSuite, GemvDeviceTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+INSTANTIATE_TEST_SUITE_P(TrsvDeviceTestSuite, TrsvDeviceTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
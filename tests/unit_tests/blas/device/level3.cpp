@@ -0,0 +1,165 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "blas_device_test_common.hpp"
+#include "cblas.h"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device *> devices;
+
+namespace {
+
+constexpr std::int64_t M = 5, N = 4, K = 3;
+// One leading dimension that is valid for every operand, layout and
+// transposition, so that private copies can have a compile-time size.
+constexpr std::int64_t LD = std::max({ M, N, K });
+constexpr std::int64_t SIZE = LD * LD;
+
+template <typename fp, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb>
+int test(device *dev, oneapi::mkl::layout layout, bool use_sub_group) {
+    queue main_queue = make_device_test_queue(dev);
+    context cxt = main_queue.get_context();
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(SIZE, ua), B(SIZE, ua), C(SIZE, ua);
+    fp alpha = rand_scalar<fp>();
+    fp beta = rand_scalar<fp>();
+    rand_matrix(A.data(), layout, transa, M, K, LD);
+    rand_matrix(B.data(), layout, transb, K, N, LD);
+    rand_matrix(C.data(), layout, oneapi::mkl::transpose::nontrans, M, N, LD);
+    vector<fp> C_ref(C.begin(), C.end());
+
+    // Call reference GEMM.
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int m_ref = M, n_ref = N, k_ref = K, ld_ref = LD;
+
+    ::gemm(convert_to_cblas_layout(layout), convert_to_cblas_trans(transa),
+           convert_to_cblas_trans(transb), &m_ref, &n_ref, &k_ref, (fp_ref *)&alpha,
+           (fp_ref *)A.data(), &ld_ref, (fp_ref *)B.data(), &ld_ref, (fp_ref *)&beta,
+           (fp_ref *)C_ref.data(), &ld_ref);
+
+    // Call device GEMM.
+    const fp *a = A.data();
+    const fp *b = B.data();
+    fp *c = C.data();
+    const bool column_major = (layout == oneapi::mkl::layout::col_major);
+
+    bool ran = run_device_kernel(main_queue, use_sub_group, [=](sub_group sg, bool cooperative) {
+        namespace col = oneapi::mkl::blas::device::column_major;
+        namespace row = oneapi::mkl::blas::device::row_major;
+        if (cooperative) {
+            if (column_major)
+                col::gemm<M, N, K, transa, transb>(sg, alpha, a, LD, b, LD, beta, c, LD);
+            else
+                row::gemm<M, N, K, transa, transb>(sg, alpha, a, LD, b, LD, beta, c, LD);
+            return;
+        }
+        // Work on private copies, which the unrolled routine keeps in registers.
+        fp a_priv[SIZE], b_priv[SIZE], c_priv[SIZE];
+        for (std::int64_t i = 0; i < SIZE; i++) {
+            a_priv[i] = a[i];
+            b_priv[i] = b[i];
+            c_priv[i] = c[i];
+        }
+        if (column_major)
+            col::gemm<M, N, K, transa, transb>(alpha, a_priv, LD, b_priv, LD, beta, c_priv, LD);
+        else
+            row::gemm<M, N, K, transa, transb>(alpha, a_priv, LD, b_priv, LD, beta, c_priv, LD);
+        for (std::int64_t i = 0; i < SIZE; i++) {
+            c[i] = c_priv[i];
+        }
+    });
+    if (!ran) {
+        return false;
+    }
+
+    // Compare the results of reference implementation and device implementation.
+    return (int)check_equal_matrix(C, C_ref, layout, M, N, LD, 10 * K, std::cout);
+}
+
+class GemmDeviceTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device *, oneapi::mkl::layout>> {};
+
+TEST_P(GemmDeviceTests, RealSinglePrecision) {
+    using oneapi::mkl::transpose;
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP((test<float, transpose::nontrans, transpose::nontrans>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group)));
+        EXPECT_TRUEORSKIP((test<float, transpose::trans, transpose::nontrans>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group)));
+        EXPECT_TRUEORSKIP((test<float, transpose::nontrans, transpose::trans>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group)));
+    }
+}
+
+TEST_P(GemmDeviceTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    using oneapi::mkl::transpose;
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP((test<double, transpose::nontrans, transpose::nontrans>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group)));
+        EXPECT_TRUEORSKIP((test<double, transpose::trans, transpose::trans>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group)));
+    }
+}
+
+TEST_P(GemmDeviceTests, ComplexSinglePrecision) {
+    using oneapi::mkl::transpose;
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP((test<std::complex<float>, transpose::nontrans, transpose::nontrans>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group)));
+        EXPECT_TRUEORSKIP((test<std::complex<float>, transpose::conjtrans, transpose::trans>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group)));
+    }
+}
+
+TEST_P(GemmDeviceTests, ComplexDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    using oneapi::mkl::transpose;
+    for (bool use_sub_group : { false, true }) {
+        EXPECT_TRUEORSKIP((test<std::complex<double>, transpose::nontrans, transpose::nontrans>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group)));
+        EXPECT_TRUEORSKIP((test<std::complex<double>, transpose::trans, transpose::conjtrans>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), use_sub_group)));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmDeviceTestSuite, GemmDeviceTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
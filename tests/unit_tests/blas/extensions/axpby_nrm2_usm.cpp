@@ -0,0 +1,228 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+template <typename fp, typename fp_res, usm::alloc alloc_type = usm::alloc::shared>
+int test(device* dev, oneapi::mkl::layout layout, int N, int incx, int incy, fp alpha, fp beta) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during AXPBY_NRM2:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> x(ua), y(ua);
+
+    rand_vector(x, N, incx);
+    rand_vector(y, N, incy);
+
+    auto y_ref = y;
+
+    // Call Reference AXPBY and NRM2.
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int N_ref = N, incx_ref = incx, incy_ref = incy, abs_incy_ref = std::abs(incy);
+
+    ::axpby(&N_ref, (fp_ref*)&alpha, (fp_ref*)x.data(), &incx_ref, (fp_ref*)&beta,
+            (fp_ref*)y_ref.data(), &incy_ref);
+    fp_res result_ref = ::nrm2<fp_ref, fp_res>(&N_ref, (fp_ref*)y_ref.data(), &abs_incy_ref);
+
+    fp_res* result_p;
+    if constexpr (alloc_type == usm::alloc::shared) {
+        result_p = (fp_res*)oneapi::mkl::malloc_shared(64, sizeof(fp_res), *dev, cxt);
+    }
+    else if constexpr (alloc_type == usm::alloc::device) {
+        result_p = (fp_res*)oneapi::mkl::malloc_device(64, sizeof(fp_res), *dev, cxt);
+    }
+    else {
+        throw std::runtime_error("Bad alloc_type");
+    }
+
+    // Call DPC++ AXPBY_NRM2.
+
+    try {
+#ifdef CALL_RT_API
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                done = oneapi::mkl::blas::column_major::axpby_nrm2(main_queue, N, alpha, x.data(),
+                                                                   incx, beta, y.data(), incy,
+                                                                   result_p, dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                done = oneapi::mkl::blas::row_major::axpby_nrm2(main_queue, N, alpha, x.data(),
+                                                                incx, beta, y.data(), incy,
+                                                                result_p, dependencies);
+                break;
+            default: break;
+        }
+        done.wait();
+#else
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::axpby_nrm2, N,
+                                        alpha, x.data(), incx, beta, y.data(), incy, result_p,
+                                        dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::axpby_nrm2, N,
+                                        alpha, x.data(), incx, beta, y.data(), incy, result_p,
+                                        dependencies);
+                break;
+            default: break;
+        }
+        main_queue.wait();
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during AXPBY_NRM2:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of AXPBY_NRM2:\n" << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = check_equal_vector(y, y_ref, N, incy, N, std::cout);
+    good = check_equal_ptr(main_queue, result_p, result_ref, N, std::cout) && good;
+
+    oneapi::mkl::free_usm(result_p, cxt);
+
+    return (int)good;
+}
+
+class AxpbyNrm2UsmTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device*, oneapi::mkl::layout>> {};
+
+TEST_P(AxpbyNrm2UsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP((test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2,
+                                          3, float(2.0), float(-1.5))));
+    EXPECT_TRUEORSKIP((test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 1,
+                                          1, float(2.0), float(-1.5))));
+    EXPECT_TRUEORSKIP((test<float, float, usm::alloc::device>(std::get<0>(GetParam()),
+                                                              std::get<1>(GetParam()), 101, 1, 1,
+                                                              float(2.0), float(-1.5))));
+    EXPECT_TRUEORSKIP((test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357,
+                                          -3, -2, float(2.0), float(-1.5))));
+}
+
+TEST_P(AxpbyNrm2UsmTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    EXPECT_TRUEORSKIP((test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357,
+                                            2, 3, double(2.0), double(-1.5))));
+    EXPECT_TRUEORSKIP((test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357,
+                                            1, 1, double(2.0), double(-1.5))));
+    EXPECT_TRUEORSKIP((test<double, double, usm::alloc::device>(std::get<0>(GetParam()),
+                                                                std::get<1>(GetParam()), 101, 1, 1,
+                                                                double(2.0), double(-1.5))));
+    EXPECT_TRUEORSKIP((test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357,
+                                            -3, -2, double(2.0), double(-1.5))));
+}
+
+TEST_P(AxpbyNrm2UsmTests, ComplexSinglePrecision) {
+    EXPECT_TRUEORSKIP((test<std::complex<float>, float>(std::get<0>(GetParam()),
+                                                        std::get<1>(GetParam()), 1357, 2, 3,
+                                                        std::complex<float>(2.0, -0.5),
+                                                        std::complex<float>(-1.5, 1.0))));
+    EXPECT_TRUEORSKIP((test<std::complex<float>, float>(std::get<0>(GetParam()),
+                                                        std::get<1>(GetParam()), 1357, 1, 1,
+                                                        std::complex<float>(2.0, -0.5),
+                                                        std::complex<float>(-1.5, 1.0))));
+    EXPECT_TRUEORSKIP((test<std::complex<float>, float, usm::alloc::device>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), 101, 1, 1, std::complex<float>(2.0, -0.5),
+        std::complex<float>(-1.5, 1.0))));
+    EXPECT_TRUEORSKIP((test<std::complex<float>, float>(std::get<0>(GetParam()),
+                                                        std::get<1>(GetParam()), 1357, -3, -2,
+                                                        std::complex<float>(2.0, -0.5),
+                                                        std::complex<float>(-1.5, 1.0))));
+}
+
+TEST_P(AxpbyNrm2UsmTests, ComplexDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    EXPECT_TRUEORSKIP((test<std::complex<double>, double>(std::get<0>(GetParam()),
+                                                          std::get<1>(GetParam()), 1357, 2, 3,
+                                                          std::complex<double>(2.0, -0.5),
+                                                          std::complex<double>(-1.5, 1.0))));
+    EXPECT_TRUEORSKIP((test<std::complex<double>, double>(std::get<0>(GetParam()),
+                                                          std::get<1>(GetParam()), 1357, 1, 1,
+                                                          std::complex<double>(2.0, -0.5),
+                                                          std::complex<double>(-1.5, 1.0))));
+    EXPECT_TRUEORSKIP((test<std::complex<double>, double, usm::alloc::device>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), 101, 1, 1,
+        std::complex<double>(2.0, -0.5), std::complex<double>(-1.5, 1.0))));
+    EXPECT_TRUEORSKIP((test<std::complex<double>, double>(std::get<0>(GetParam()),
+                                                          std::get<1>(GetParam()), 1357, -3, -2,
+                                                          std::complex<double>(2.0, -0.5),
+                                                          std::complex<double>(-1.5, 1.0))));
+}
+
+INSTANTIATE_TEST_SUITE_P(AxpbyNrm2UsmTestSuite, AxpbyNrm2UsmTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
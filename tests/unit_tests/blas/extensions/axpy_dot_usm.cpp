@@ -0,0 +1,189 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+template <typename fp, usm::alloc alloc_type = usm::alloc::shared>
+int test(device* dev, oneapi::mkl::layout layout, int N, int incx, int incy, int incz, fp alpha) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during AXPY_DOT:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> x(ua), y(ua), z(ua);
+
+    rand_vector(x, N, incx);
+    rand_vector(y, N, incy);
+    rand_vector(z, N, incz);
+
+    auto y_ref = y;
+
+    // Call Reference AXPY and DOT.
+    const int N_ref = N, incx_ref = incx, incy_ref = incy, incz_ref = incz;
+
+    ::axpy(&N_ref, &alpha, x.data(), &incx_ref, y_ref.data(), &incy_ref);
+    fp result_ref = ::dot<fp, fp>(&N_ref, y_ref.data(), &incy_ref, z.data(), &incz_ref);
+
+    fp* result_p;
+    if constexpr (alloc_type == usm::alloc::shared) {
+        result_p = (fp*)oneapi::mkl::malloc_shared(64, sizeof(fp), *dev, cxt);
+    }
+    else if constexpr (alloc_type == usm::alloc::device) {
+        result_p = (fp*)oneapi::mkl::malloc_device(64, sizeof(fp), *dev, cxt);
+    }
+    else {
+        throw std::runtime_error("Bad alloc_type");
+    }
+
+    // Call DPC++ AXPY_DOT.
+
+    try {
+#ifdef CALL_RT_API
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                done = oneapi::mkl::blas::column_major::axpy_dot(main_queue, N, alpha, x.data(),
+                                                                 incx, y.data(), incy, z.data(),
+                                                                 incz, result_p, dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                done = oneapi::mkl::blas::row_major::axpy_dot(main_queue, N, alpha, x.data(), incx,
+                                                              y.data(), incy, z.data(), incz,
+                                                              result_p, dependencies);
+                break;
+            default: break;
+        }
+        done.wait();
+#else
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::axpy_dot, N,
+                                        alpha, x.data(), incx, y.data(), incy, z.data(), incz,
+                                        result_p, dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::axpy_dot, N,
+                                        alpha, x.data(), incx, y.data(), incy, z.data(), incz,
+                                        result_p, dependencies);
+                break;
+            default: break;
+        }
+        main_queue.wait();
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during AXPY_DOT:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of AXPY_DOT:\n" << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = check_equal_vector(y, y_ref, N, incy, N, std::cout);
+    good = check_equal_ptr(main_queue, result_p, result_ref, N, std::cout) && good;
+
+    oneapi::mkl::free_usm(result_p, cxt);
+
+    return (int)good;
+}
+
+class AxpyDotUsmTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device*, oneapi::mkl::layout>> {};
+
+TEST_P(AxpyDotUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP((test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3, 1,
+                                   2.0f)));
+    EXPECT_TRUEORSKIP((test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 1, 1, 1,
+                                   -1.5f)));
+    EXPECT_TRUEORSKIP((test<float, usm::alloc::device>(std::get<0>(GetParam()),
+                                                       std::get<1>(GetParam()), 101, 1, 1, 1,
+                                                       2.0f)));
+    EXPECT_TRUEORSKIP((test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3, -2,
+                                   2, 0.5f)));
+}
+
+TEST_P(AxpyDotUsmTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    EXPECT_TRUEORSKIP((test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3, 1,
+                                    2.0)));
+    EXPECT_TRUEORSKIP((test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 1, 1, 1,
+                                    -1.5)));
+    EXPECT_TRUEORSKIP((test<double, usm::alloc::device>(std::get<0>(GetParam()),
+                                                        std::get<1>(GetParam()), 101, 1, 1, 1,
+                                                        2.0)));
+    EXPECT_TRUEORSKIP((test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3, -2,
+                                    2, 0.5)));
+}
+
+INSTANTIATE_TEST_SUITE_P(AxpyDotUsmTestSuite, AxpyDotUsmTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,165 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+template <typename fp>
+int test(device* dev, oneapi::mkl::layout layout, int N, int incx, int incy, int incz) {
+    // Prepare data.
+    vector<fp> x, y, z;
+    fp result[2] = { fp(-1), fp(-1) };
+
+    rand_vector(x, N, incx);
+    rand_vector(y, N, incy);
+    rand_vector(z, N, incz);
+
+    // Call Reference DOT twice.
+    const int N_ref = N, incx_ref = incx, incy_ref = incy, incz_ref = incz;
+
+    fp result_ref[2] = { ::dot<fp, fp>(&N_ref, x.data(), &incx_ref, y.data(), &incy_ref),
+                         ::dot<fp, fp>(&N_ref, x.data(), &incx_ref, z.data(), &incz_ref) };
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during DOT2:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+
+    buffer<fp, 1> x_buffer = make_buffer(x);
+    buffer<fp, 1> y_buffer = make_buffer(y);
+    buffer<fp, 1> z_buffer = make_buffer(z);
+    buffer<fp, 1> result_buffer(result, range<1>(2));
+
+    // Call DPC++ DOT2.
+
+    try {
+#ifdef CALL_RT_API
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                oneapi::mkl::blas::column_major::dot2(main_queue, N, x_buffer, incx, y_buffer, incy,
+                                                      z_buffer, incz, result_buffer);
+                break;
+            case oneapi::mkl::layout::row_major:
+                oneapi::mkl::blas::row_major::dot2(main_queue, N, x_buffer, incx, y_buffer, incy,
+                                                   z_buffer, incz, result_buffer);
+                break;
+            default: break;
+        }
+#else
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::dot2, N,
+                                        x_buffer, incx, y_buffer, incy, z_buffer, incz,
+                                        result_buffer);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::dot2, N, x_buffer,
+                                        incx, y_buffer, incy, z_buffer, incz, result_buffer);
+                break;
+            default: break;
+        }
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during DOT2:\n" << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of DOT2:\n" << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto result_accessor = result_buffer.template get_host_access(read_only);
+    bool good = check_equal(result_accessor[0], result_ref[0], N, std::cout);
+    good = check_equal(result_accessor[1], result_ref[1], N, std::cout) && good;
+
+    return (int)good;
+}
+
+class Dot2Tests
+        : public ::testing::TestWithParam<std::tuple<sycl::device*, oneapi::mkl::layout>> {};
+
+TEST_P(Dot2Tests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP((test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3,
+                                   1)));
+    EXPECT_TRUEORSKIP((test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 1, 1,
+                                   1)));
+    EXPECT_TRUEORSKIP((test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3, -2,
+                                   2)));
+}
+
+TEST_P(Dot2Tests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    EXPECT_TRUEORSKIP((test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3,
+                                    1)));
+    EXPECT_TRUEORSKIP((test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 1, 1,
+                                    1)));
+    EXPECT_TRUEORSKIP((test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3, -2,
+                                    2)));
+}
+
+INSTANTIATE_TEST_SUITE_P(Dot2TestSuite, Dot2Tests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,286 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "allocator_helper.hpp"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device*> devices;
+
+// gemm_bias of the netlib backend runs on its own host engine rather than on
+// CBLAS, so it is checked directly here against the definition: products
+// accumulated exactly, rounded to nearest and saturated to int32. The
+// general gemm_bias tests use a reference that does not saturate.
+
+namespace {
+
+constexpr std::int32_t int32_max = std::numeric_limits<std::int32_t>::max();
+constexpr std::int32_t int32_min = std::numeric_limits<std::int32_t>::min();
+
+int element_index(oneapi::mkl::layout layout, int i, int j, int ld) {
+    return (layout == oneapi::mkl::layout::col_major) ? i + j * ld : j + i * ld;
+}
+
+template <typename Ta, typename Tb>
+void reference_gemm_bias(oneapi::mkl::layout layout, oneapi::mkl::transpose transa,
+                         oneapi::mkl::transpose transb, oneapi::mkl::offset offsetc, int m, int n,
+                         int k, float alpha, const Ta* a, int lda, Ta ao, const Tb* b, int ldb,
+                         Tb bo, float beta, std::int32_t* c, int ldc, const std::int32_t* co) {
+    const bool trans_a = transa != oneapi::mkl::transpose::nontrans;
+    const bool trans_b = transb != oneapi::mkl::transpose::nontrans;
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) {
+            double acc = 0.0;
+            for (int p = 0; p < k; p++) {
+                const Ta a_ip = trans_a ? a[element_index(layout, p, i, lda)]
+                                        : a[element_index(layout, i, p, lda)];
+                const Tb b_pj = trans_b ? b[element_index(layout, j, p, ldb)]
+                                        : b[element_index(layout, p, j, ldb)];
+                acc += (double(a_ip) - double(ao)) * (double(b_pj) - double(bo));
+            }
+            std::int32_t& c_ij = c[element_index(layout, i, j, ldc)];
+            double v = double(alpha) * acc;
+            if (beta != 0.0f)
+                v += double(beta) * c_ij;
+            if (offsetc == oneapi::mkl::offset::fix)
+                v += co[0];
+            else if (offsetc == oneapi::mkl::offset::column)
+                v += co[i];
+            else
+                v += co[j];
+            v = std::min(std::max(std::nearbyint(v), double(int32_min)), double(int32_max));
+            c_ij = static_cast<std::int32_t>(v);
+        }
+    }
+}
+
+template <typename Ta, typename Tb, typename VecA, typename VecB, typename VecC>
+int run_netlib_gemm_bias(queue& main_queue, oneapi::mkl::layout layout,
+                         oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+                         oneapi::mkl::offset offsetc, int m, int n, int k, float alpha, VecA& A,
+                         int lda, Ta ao, VecB& B, int ldb, Tb bo, float beta, VecC& C, int ldc,
+                         VecC& co) {
+    if (!main_queue.get_device().is_cpu()) {
+        return test_skipped;
+    }
+    VecC C_ref(C.get_allocator());
+    C_ref.resize(C.size());
+    for (int i = 0; i < C.size(); i++)
+        C_ref[i] = C[i];
+    reference_gemm_bias(layout, transa, transb, offsetc, m, n, k, alpha, A.data(), lda, ao,
+                        B.data(), ldb, bo, beta, C_ref.data(), ldc, co.data());
+
+    try {
+#if defined(ENABLE_NETLIB_BACKEND) && !defined(CALL_RT_API)
+        auto selector = oneapi::mkl::backend_selector<oneapi::mkl::backend::netlib>{ main_queue };
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                oneapi::mkl::blas::column_major::gemm_bias(selector, transa, transb, offsetc, m, n,
+                                                           k, alpha, A.data(), lda, ao, B.data(),
+                                                           ldb, bo, beta, C.data(), ldc, co.data(),
+                                                           {});
+                break;
+            case oneapi::mkl::layout::row_major:
+                oneapi::mkl::blas::row_major::gemm_bias(selector, transa, transb, offsetc, m, n, k,
+                                                        alpha, A.data(), lda, ao, B.data(), ldb, bo,
+                                                        beta, C.data(), ldc, co.data(), {});
+                break;
+            default: break;
+        }
+        main_queue.wait();
+#else
+        return test_skipped;
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_BIAS:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of GEMM_BIAS:\n" << error.what() << std::endl;
+    }
+
+    return (int)check_equal_matrix(C, C_ref, layout, m, n, ldc, 1, std::cout);
+}
+
+// Random operands with a large alpha, so that entries saturate at both ends.
+template <typename Ta, typename Tb>
+int test_saturation(device* dev, oneapi::mkl::layout layout, oneapi::mkl::transpose transa,
+                    oneapi::mkl::transpose transb, oneapi::mkl::offset offsetc) {
+    queue main_queue(*dev);
+    context cxt = main_queue.get_context();
+    const int m = 37, n = 29, k = 61;
+    const int lda = 71, ldb = 73, ldc = 79;
+    const float alpha = 65536.0f, beta = 0.5f;
+
+    auto ua = usm_allocator<Ta, usm::alloc::shared, 64>(cxt, *dev);
+    auto ub = usm_allocator<Tb, usm::alloc::shared, 64>(cxt, *dev);
+    auto uc = usm_allocator<std::int32_t, usm::alloc::shared, 64>(cxt, *dev);
+    vector<Ta, decltype(ua)> A(ua);
+    vector<Tb, decltype(ub)> B(ub);
+    vector<std::int32_t, decltype(uc)> C(uc), co(uc);
+
+    rand_matrix(A, layout, transa, m, k, lda);
+    rand_matrix(B, layout, transb, k, n, ldb);
+    rand_matrix(C, layout, oneapi::mkl::transpose::nontrans, m, n, ldc);
+    rand_matrix(co, oneapi::mkl::layout::col_major, oneapi::mkl::transpose::nontrans,
+                std::max(m, n), 1, std::max(m, n));
+
+    return run_netlib_gemm_bias(main_queue, layout, transa, transb, offsetc, m, n, k, alpha, A, lda,
+                                rand_scalar<Ta>(), B, ldb, rand_scalar<Tb>(), beta, C, ldc, co);
+}
+
+// Results one step inside and one step outside the int32 range.
+int test_saturation_edge(device* dev, oneapi::mkl::layout layout) {
+    queue main_queue(*dev);
+    context cxt = main_queue.get_context();
+    const int m = 4, n = 1, k = 1;
+    const int lda = (layout == oneapi::mkl::layout::col_major) ? m : k;
+    const int ldb = 1;
+    const int ldc = (layout == oneapi::mkl::layout::col_major) ? m : n;
+
+    auto ua = usm_allocator<std::int8_t, usm::alloc::shared, 64>(cxt, *dev);
+    auto uc = usm_allocator<std::int32_t, usm::alloc::shared, 64>(cxt, *dev);
+    vector<std::int8_t, decltype(ua)> A(ua), B(ua);
+    vector<std::int32_t, decltype(uc)> C(uc), co(uc);
+    A.assign({ 1, 1, -1, -1 });
+    B.assign({ 1 });
+    C.assign({ 0, 0, 0, 0 });
+    co.assign({ int32_max - 1, int32_max, int32_min + 1, int32_min });
+
+    int result = run_netlib_gemm_bias(main_queue, layout, oneapi::mkl::transpose::nontrans,
+                                      oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::column,
+                                      m, n, k, 1.0f, A, lda, std::int8_t(0), B, ldb, std::int8_t(0),
+                                      0.0f, C, ldc, co);
+    if (result == test_passed) {
+        const std::vector<std::int32_t> expected{ int32_max, int32_max, int32_min, int32_min };
+        for (int i = 0; i < m; i++) {
+            if (C[element_index(layout, i, 0, ldc)] != expected[i]) {
+                std::cout << "Difference in entry (" << i << ",0): DPC++ "
+                          << C[element_index(layout, i, 0, ldc)] << " vs. expected " << expected[i]
+                          << std::endl;
+                result = test_failed;
+            }
+        }
+    }
+    return result;
+}
+
+// Non-square problems with distinct zero points of different types. A row
+// major problem is computed as the transposed column major one, with the
+// operands and their zero points swapped.
+template <typename Ta, typename Tb>
+int test_offsets(device* dev, oneapi::mkl::layout layout, oneapi::mkl::transpose transa,
+                 oneapi::mkl::transpose transb, oneapi::mkl::offset offsetc) {
+    queue main_queue(*dev);
+    context cxt = main_queue.get_context();
+    const int m = 19, n = 53, k = 300;
+    const int lda = 311, ldb = 307, ldc = 61;
+
+    auto ua = usm_allocator<Ta, usm::alloc::shared, 64>(cxt, *dev);
+    auto ub = usm_allocator<Tb, usm::alloc::shared, 64>(cxt, *dev);
+    auto uc = usm_allocator<std::int32_t, usm::alloc::shared, 64>(cxt, *dev);
+    vector<Ta, decltype(ua)> A(ua);
+    vector<Tb, decltype(ub)> B(ub);
+    vector<std::int32_t, decltype(uc)> C(uc), co(uc);
+
+    rand_matrix(A, layout, transa, m, k, lda);
+    rand_matrix(B, layout, transb, k, n, ldb);
+    rand_matrix(C, layout, oneapi::mkl::transpose::nontrans, m, n, ldc);
+    rand_matrix(co, oneapi::mkl::layout::col_major, oneapi::mkl::transpose::nontrans,
+                std::max(m, n), 1, std::max(m, n));
+
+    return run_netlib_gemm_bias(main_queue, layout, transa, transb, offsetc, m, n, k, 1.0f, A, lda,
+                                Ta(3), B, ldb, Tb(100), 1.0f, C, ldc, co);
+}
+
+class GemmBiasNetlibUsmTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device*, oneapi::mkl::layout>> {};
+
+TEST_P(GemmBiasNetlibUsmTests, Int32Saturation) {
+    EXPECT_TRUEORSKIP((test_saturation<int8_t, int8_t>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::fix)));
+    EXPECT_TRUEORSKIP((test_saturation<int8_t, uint8_t>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::column)));
+    EXPECT_TRUEORSKIP((test_saturation<uint8_t, int8_t>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, oneapi::mkl::offset::row)));
+    EXPECT_TRUEORSKIP(test_saturation_edge(std::get<0>(GetParam()), std::get<1>(GetParam())));
+}
+
+TEST_P(GemmBiasNetlibUsmTests, Int8Uint8ZeroPoints) {
+    for (auto transa : { oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::trans }) {
+        for (auto transb : { oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::trans }) {
+            for (auto offsetc : { oneapi::mkl::offset::column, oneapi::mkl::offset::row }) {
+                EXPECT_TRUEORSKIP((test_offsets<int8_t, uint8_t>(std::get<0>(GetParam()),
+                                                                 std::get<1>(GetParam()), transa,
+                                                                 transb, offsetc)));
+            }
+        }
+    }
+}
+
+TEST_P(GemmBiasNetlibUsmTests, Uint8Int8ZeroPoints) {
+    for (auto transa : { oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::trans }) {
+        for (auto transb : { oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::trans }) {
+            for (auto offsetc : { oneapi::mkl::offset::column, oneapi::mkl::offset::row }) {
+                EXPECT_TRUEORSKIP((test_offsets<uint8_t, int8_t>(std::get<0>(GetParam()),
+                                                                 std::get<1>(GetParam()), transa,
+                                                                 transb, offsetc)));
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmBiasNetlibUsmTestSuite, GemmBiasNetlibUsmTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,347 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+// Results are compared in float. Half and bfloat16 outputs are allowed a few
+// rounding errors of their own precision on top of the accumulation error.
+template <typename Tc, typename acc1, typename acc2>
+bool check_equal_output(acc1& M, acc2& M_ref, oneapi::mkl::layout layout, int m, int n, int ld,
+                        int k) {
+    int error_mag = 10 * k;
+    if (std::is_same<Tc, sycl::half>::value)
+        error_mag = 4 << 13;
+    if (std::is_same<Tc, oneapi::mkl::bfloat16>::value)
+        error_mag = 4 << 16;
+    vector<float> M_float(M_ref.size()), M_ref_float(M_ref.size());
+    for (int i = 0; i < M_ref.size(); i++) {
+        M_float[i] = (float)M[i];
+        M_ref_float[i] = (float)M_ref[i];
+    }
+    return check_equal_matrix(M_float, M_ref_float, layout, m, n, ld, error_mag, std::cout);
+}
+
+template <typename Ta, typename Tc>
+int test(device* dev, oneapi::mkl::layout layout, oneapi::mkl::transpose transa,
+         oneapi::mkl::transpose transb, oneapi::mkl::offset offset_bias,
+         oneapi::mkl::activation act, float clamp_min, float clamp_max, int m, int n, int k,
+         int lda, int ldb, int ldc, float alpha, float beta) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM_EPILOGUE:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    auto ua = usm_allocator<Ta, usm::alloc::shared, 64>(cxt, *dev);
+    auto uc = usm_allocator<Tc, usm::alloc::shared, 64>(cxt, *dev);
+    auto uf = usm_allocator<float, usm::alloc::shared, 64>(cxt, *dev);
+    vector<Ta, decltype(ua)> A(ua), B(ua);
+    vector<Tc, decltype(uc)> C(uc), C_ref(uc);
+    vector<float, decltype(uf)> bias(uf);
+
+    rand_matrix(A, layout, transa, m, k, lda);
+    rand_matrix(B, layout, transb, k, n, ldb);
+    rand_matrix(C, layout, oneapi::mkl::transpose::nontrans, m, n, ldc);
+    if (offset_bias == oneapi::mkl::offset::fix)
+        rand_vector(bias, 1, 1);
+    if (offset_bias == oneapi::mkl::offset::column)
+        rand_vector(bias, m, 1);
+    if (offset_bias == oneapi::mkl::offset::row)
+        rand_vector(bias, n, 1);
+
+    C_ref.resize(C.size());
+    for (int i = 0; i < C.size(); i++)
+        C_ref[i] = C[i];
+
+    // Call Reference GEMM_EPILOGUE.
+    const int m_ref = m, n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+
+    using Ta_ref = typename ref_type_info<Ta>::type;
+    using Tc_ref = typename ref_type_info<Tc>::type;
+
+    ::gemm_epilogue(convert_to_cblas_layout(layout), convert_to_cblas_trans(transa),
+                    convert_to_cblas_trans(transb), convert_to_cblas_offset(offset_bias), &m_ref,
+                    &n_ref, &k_ref, &alpha, (Ta_ref*)A.data(), &lda_ref, (Ta_ref*)B.data(),
+                    &ldb_ref, &beta, (Tc_ref*)C_ref.data(), &ldc_ref, bias.data(), act,
+                    clamp_min, clamp_max);
+
+    // Call DPC++ GEMM_EPILOGUE.
+
+    try {
+#ifdef CALL_RT_API
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                done = oneapi::mkl::blas::column_major::gemm_epilogue(
+                    main_queue, transa, transb, offset_bias, m, n, k, alpha, A.data(), lda,
+                    B.data(), ldb, beta, C.data(), ldc, bias.data(), act, clamp_min, clamp_max,
+                    dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                done = oneapi::mkl::blas::row_major::gemm_epilogue(
+                    main_queue, transa, transb, offset_bias, m, n, k, alpha, A.data(), lda,
+                    B.data(), ldb, beta, C.data(), ldc, bias.data(), act, clamp_min, clamp_max,
+                    dependencies);
+                break;
+            default: break;
+        }
+        done.wait();
+#else
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::gemm_epilogue,
+                                        transa, transb, offset_bias, m, n, k, alpha, A.data(), lda,
+                                        B.data(), ldb, beta, C.data(), ldc, bias.data(), act,
+                                        clamp_min, clamp_max, dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::gemm_epilogue,
+                                        transa, transb, offset_bias, m, n, k, alpha, A.data(), lda,
+                                        B.data(), ldb, beta, C.data(), ldc, bias.data(), act,
+                                        clamp_min, clamp_max, dependencies);
+                break;
+            default: break;
+        }
+        main_queue.wait();
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_EPILOGUE:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of GEMM_EPILOGUE:\n"
+                  << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = check_equal_output<Tc>(C, C_ref, layout, m, n, ldc, k);
+
+    return (int)good;
+}
+
+class GemmEpilogueUsmTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device*, oneapi::mkl::layout>> {};
+
+TEST_P(GemmEpilogueUsmTests, RealSinglePrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    float inf = std::numeric_limits<float>::infinity();
+    EXPECT_TRUEORSKIP((test<float, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::fix, oneapi::mkl::activation::none,
+        -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<float, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, oneapi::mkl::offset::column, oneapi::mkl::activation::relu,
+        -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<float, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::row, oneapi::mkl::activation::gelu,
+        -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<float, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::trans, oneapi::mkl::offset::column,
+        oneapi::mkl::activation::sigmoid, -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<float, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::row, oneapi::mkl::activation::relu,
+        -inf, 1.0f, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<float, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::fix, oneapi::mkl::activation::gelu,
+        -0.5f, 0.5f, 79, 83, 91, 103, 105, 106, alpha, beta)));
+}
+
+TEST_P(GemmEpilogueUsmTests, RealHalfPrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    float inf = std::numeric_limits<float>::infinity();
+    EXPECT_TRUEORSKIP((test<sycl::half, sycl::half>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::fix, oneapi::mkl::activation::none,
+        -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<sycl::half, sycl::half>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, oneapi::mkl::offset::column, oneapi::mkl::activation::relu,
+        -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<sycl::half, sycl::half>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::row, oneapi::mkl::activation::gelu,
+        -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<sycl::half, sycl::half>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::trans, oneapi::mkl::offset::column,
+        oneapi::mkl::activation::sigmoid, -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<sycl::half, sycl::half>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::row, oneapi::mkl::activation::relu,
+        -inf, 1.0f, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<sycl::half, sycl::half>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::fix, oneapi::mkl::activation::gelu,
+        -0.5f, 0.5f, 79, 83, 91, 103, 105, 106, alpha, beta)));
+}
+
+TEST_P(GemmEpilogueUsmTests, HalfHalfFloatPrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    float inf = std::numeric_limits<float>::infinity();
+    EXPECT_TRUEORSKIP((test<sycl::half, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::fix, oneapi::mkl::activation::none,
+        -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<sycl::half, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, oneapi::mkl::offset::column, oneapi::mkl::activation::relu,
+        -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<sycl::half, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::row, oneapi::mkl::activation::gelu,
+        -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<sycl::half, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::trans, oneapi::mkl::offset::column,
+        oneapi::mkl::activation::sigmoid, -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<sycl::half, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::row, oneapi::mkl::activation::relu,
+        -inf, 1.0f, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<sycl::half, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::fix, oneapi::mkl::activation::gelu,
+        -0.5f, 0.5f, 79, 83, 91, 103, 105, 106, alpha, beta)));
+}
+
+TEST_P(GemmEpilogueUsmTests, RealBfloat16Precision) {
+    float alpha(2.0);
+    float beta(3.0);
+    float inf = std::numeric_limits<float>::infinity();
+    EXPECT_TRUEORSKIP((test<oneapi::mkl::bfloat16, oneapi::mkl::bfloat16>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::fix, oneapi::mkl::activation::none,
+        -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<oneapi::mkl::bfloat16, oneapi::mkl::bfloat16>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, oneapi::mkl::offset::column, oneapi::mkl::activation::relu,
+        -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<oneapi::mkl::bfloat16, oneapi::mkl::bfloat16>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::row, oneapi::mkl::activation::gelu,
+        -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<oneapi::mkl::bfloat16, oneapi::mkl::bfloat16>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::trans, oneapi::mkl::offset::column,
+        oneapi::mkl::activation::sigmoid, -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<oneapi::mkl::bfloat16, oneapi::mkl::bfloat16>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::row, oneapi::mkl::activation::relu,
+        -inf, 1.0f, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<oneapi::mkl::bfloat16, oneapi::mkl::bfloat16>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::fix, oneapi::mkl::activation::gelu,
+        -0.5f, 0.5f, 79, 83, 91, 103, 105, 106, alpha, beta)));
+}
+
+TEST_P(GemmEpilogueUsmTests, Bfloat16Bfloat16FloatPrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    float inf = std::numeric_limits<float>::infinity();
+    EXPECT_TRUEORSKIP((test<oneapi::mkl::bfloat16, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::fix, oneapi::mkl::activation::none,
+        -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<oneapi::mkl::bfloat16, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, oneapi::mkl::offset::column, oneapi::mkl::activation::relu,
+        -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<oneapi::mkl::bfloat16, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::row, oneapi::mkl::activation::gelu,
+        -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<oneapi::mkl::bfloat16, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::trans, oneapi::mkl::offset::column,
+        oneapi::mkl::activation::sigmoid, -inf, inf, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<oneapi::mkl::bfloat16, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::row, oneapi::mkl::activation::relu,
+        -inf, 1.0f, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<oneapi::mkl::bfloat16, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::fix, oneapi::mkl::activation::gelu,
+        -0.5f, 0.5f, 79, 83, 91, 103, 105, 106, alpha, beta)));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmEpilogueUsmTestSuite, GemmEpilogueUsmTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
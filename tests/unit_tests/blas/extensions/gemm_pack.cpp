@@ -0,0 +1,278 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+// The packed size query has no typed arguments, so it exists once per
+// precision; this picks the right one for the queue and selector APIs alike.
+template <typename fp, typename QueueOrSelector>
+std::int64_t pack_get_size(QueueOrSelector q, oneapi::mkl::gemm_pack_matrix identifier,
+                           std::int64_t m, std::int64_t n, std::int64_t k) {
+    if constexpr (std::is_same<fp, float>::value)
+        return oneapi::mkl::blas::column_major::sgemm_pack_get_size(q, identifier, m, n, k);
+    else
+        return oneapi::mkl::blas::column_major::dgemm_pack_get_size(q, identifier, m, n, k);
+}
+
+template <typename fp>
+int test(device* dev, oneapi::mkl::layout layout, oneapi::mkl::gemm_pack_matrix identifier,
+         oneapi::mkl::transpose transa, oneapi::mkl::transpose transb, int m, int n, int k,
+         int lda, int ldb, int ldc, fp alpha, fp beta) {
+    // Prepare data.
+    vector<fp, allocator_helper<fp, 64>> A, B, C, P;
+    rand_matrix(A, layout, transa, m, k, lda);
+    rand_matrix(B, layout, transb, k, n, ldb);
+    rand_matrix(C, layout, oneapi::mkl::transpose::nontrans, m, n, ldc);
+
+    auto C_ref = C;
+
+    // Call Reference GEMM.
+    const int m_ref = m, n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    ::gemm(convert_to_cblas_layout(layout), convert_to_cblas_trans(transa),
+           convert_to_cblas_trans(transb), &m_ref, &n_ref, &k_ref, (fp_ref*)&alpha,
+           (fp_ref*)A.data(), &lda_ref, (fp_ref*)B.data(), &ldb_ref, (fp_ref*)&beta,
+           (fp_ref*)C_ref.data(), &ldc_ref);
+
+    // Call DPC++ GEMM_PACK on the constant operand, then GEMM_COMPUTE with the
+    // packed copy in its place.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM_PACK:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+
+    const bool pack_a = identifier == oneapi::mkl::gemm_pack_matrix::A;
+    const auto trans_packed = pack_a ? transa : transb;
+    const int ld_packed = pack_a ? lda : ldb;
+    std::int64_t pack_size = 0;
+
+    try {
+#ifdef CALL_RT_API
+        pack_size = pack_get_size<fp>(main_queue, identifier, m, n, k);
+#else
+        auto get_size = [&](auto q, auto... args) {
+            pack_size = pack_get_size<fp>(q, args...);
+        };
+        TEST_RUN_BLAS_CT_SELECT(main_queue, get_size, identifier, m, n, k);
+#endif
+    }
+    catch (const oneapi::mkl::unimplemented& e) {
+        return test_skipped;
+    }
+    P.resize(pack_size);
+
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> B_buffer(B.data(), range<1>(B.size()));
+    buffer<fp, 1> C_buffer(C.data(), range<1>(C.size()));
+    buffer<fp, 1> P_buffer(P.data(), range<1>(P.size()));
+    auto& packed_src = pack_a ? A_buffer : B_buffer;
+    auto& a_operand = pack_a ? P_buffer : A_buffer;
+    auto& b_operand = pack_a ? B_buffer : P_buffer;
+
+    try {
+#ifdef CALL_RT_API
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                oneapi::mkl::blas::column_major::gemm_pack(main_queue, identifier, trans_packed, m,
+                                                           n, k, alpha, packed_src, ld_packed,
+                                                           P_buffer);
+                oneapi::mkl::blas::column_major::gemm_compute(
+                    main_queue, identifier, transa, transb, m, n, k, a_operand, lda, b_operand,
+                    ldb, beta, C_buffer, ldc);
+                break;
+            case oneapi::mkl::layout::row_major:
+                oneapi::mkl::blas::row_major::gemm_pack(main_queue, identifier, trans_packed, m, n,
+                                                        k, alpha, packed_src, ld_packed, P_buffer);
+                oneapi::mkl::blas::row_major::gemm_compute(
+                    main_queue, identifier, transa, transb, m, n, k, a_operand, lda, b_operand,
+                    ldb, beta, C_buffer, ldc);
+                break;
+            default: break;
+        }
+#else
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::gemm_pack,
+                                        identifier, trans_packed, m, n, k, alpha, packed_src,
+                                        ld_packed, P_buffer);
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::gemm_compute,
+                                        identifier, transa, transb, m, n, k, a_operand, lda,
+                                        b_operand, ldb, beta, C_buffer, ldc);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::gemm_pack,
+                                        identifier, trans_packed, m, n, k, alpha, packed_src,
+                                        ld_packed, P_buffer);
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::gemm_compute,
+                                        identifier, transa, transb, m, n, k, a_operand, lda,
+                                        b_operand, ldb, beta, C_buffer, ldc);
+                break;
+            default: break;
+        }
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_PACK:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of GEMM_PACK:\n" << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto C_accessor = C_buffer.template get_host_access(read_only);
+    bool good = check_equal_matrix(C_accessor, C_ref, layout, m, n, ldc, 10 * k, std::cout);
+
+    return (int)good;
+}
+
+class GemmPackTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device*, oneapi::mkl::layout>> {};
+
+TEST_P(GemmPackTests, RealSinglePrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    EXPECT_TRUEORSKIP(test<float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::gemm_pack_matrix::A,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::nontrans, 79, 83, 91, 103, 105,
+        106, alpha, beta));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                  oneapi::mkl::gemm_pack_matrix::A,
+                                  oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::trans,
+                                  79, 83, 91, 103, 105, 106, alpha, beta));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                  oneapi::mkl::gemm_pack_matrix::A, oneapi::mkl::transpose::trans,
+                                  oneapi::mkl::transpose::nontrans, 79, 83, 91, 103, 105, 106,
+                                  alpha, beta));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                  oneapi::mkl::gemm_pack_matrix::A, oneapi::mkl::transpose::trans,
+                                  oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha,
+                                  beta));
+    EXPECT_TRUEORSKIP(test<float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::gemm_pack_matrix::B,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::nontrans, 79, 83, 91, 103, 105,
+        106, alpha, beta));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                  oneapi::mkl::gemm_pack_matrix::B,
+                                  oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::trans,
+                                  79, 83, 91, 103, 105, 106, alpha, beta));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                  oneapi::mkl::gemm_pack_matrix::B, oneapi::mkl::transpose::trans,
+                                  oneapi::mkl::transpose::nontrans, 79, 83, 91, 103, 105, 106,
+                                  alpha, beta));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                  oneapi::mkl::gemm_pack_matrix::B, oneapi::mkl::transpose::trans,
+                                  oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha,
+                                  beta));
+}
+
+TEST_P(GemmPackTests, RealDoublePrecision) {
+    double alpha(2.0);
+    double beta(3.0);
+    EXPECT_TRUEORSKIP(test<double>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::gemm_pack_matrix::A,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::nontrans, 79, 83, 91, 103, 105,
+        106, alpha, beta));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                   oneapi::mkl::gemm_pack_matrix::A,
+                                   oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::trans,
+                                   79, 83, 91, 103, 105, 106, alpha, beta));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                   oneapi::mkl::gemm_pack_matrix::A, oneapi::mkl::transpose::trans,
+                                   oneapi::mkl::transpose::nontrans, 79, 83, 91, 103, 105, 106,
+                                   alpha, beta));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                   oneapi::mkl::gemm_pack_matrix::A, oneapi::mkl::transpose::trans,
+                                   oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha,
+                                   beta));
+    EXPECT_TRUEORSKIP(test<double>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::gemm_pack_matrix::B,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::nontrans, 79, 83, 91, 103, 105,
+        106, alpha, beta));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                   oneapi::mkl::gemm_pack_matrix::B,
+                                   oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::trans,
+                                   79, 83, 91, 103, 105, 106, alpha, beta));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                   oneapi::mkl::gemm_pack_matrix::B, oneapi::mkl::transpose::trans,
+                                   oneapi::mkl::transpose::nontrans, 79, 83, 91, 103, 105, 106,
+                                   alpha, beta));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                   oneapi::mkl::gemm_pack_matrix::B, oneapi::mkl::transpose::trans,
+                                   oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha,
+                                   beta));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmPackTestSuite, GemmPackTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,119 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+
+#include "blas/backends/portblas/portblas_gemm_tuning_cache.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace oneapi::mkl::blas::portblas::detail;
+
+namespace {
+
+constexpr int num_configs = 6;
+
+TEST(GemmTuningCacheTests, BucketIsCeilLog2) {
+    EXPECT_EQ(gemm_tuning_bucket(0), 0);
+    EXPECT_EQ(gemm_tuning_bucket(1), 0);
+    EXPECT_EQ(gemm_tuning_bucket(2), 1);
+    EXPECT_EQ(gemm_tuning_bucket(3), 2);
+    EXPECT_EQ(gemm_tuning_bucket(4), 2);
+    EXPECT_EQ(gemm_tuning_bucket(5), 3);
+    EXPECT_EQ(gemm_tuning_bucket(1024), 10);
+    EXPECT_EQ(gemm_tuning_bucket(1025), 11);
+    EXPECT_EQ(gemm_tuning_bucket(std::int64_t(1) << 40), 40);
+    EXPECT_EQ(gemm_tuning_bucket(std::numeric_limits<std::int64_t>::max()), 62);
+}
+
+TEST(GemmTuningCacheTests, ShapeKeySharesBuckets) {
+    EXPECT_EQ(gemm_tuning_shape_key("s", 'n', 't', 100, 128, 16, 1), "s|nt|7,7,4|0");
+    // Every shape of the same power-of-two class maps to the same entry.
+    EXPECT_EQ(gemm_tuning_shape_key("d", 'n', 'n', 65, 65, 65, 3),
+              gemm_tuning_shape_key("d", 'n', 'n', 128, 100, 127, 4));
+    EXPECT_NE(gemm_tuning_shape_key("d", 'n', 'n', 64, 64, 64, 1),
+              gemm_tuning_shape_key("d", 'n', 'n', 65, 64, 64, 1));
+    EXPECT_NE(gemm_tuning_shape_key("s", 'n', 'n', 64, 64, 64, 1),
+              gemm_tuning_shape_key("d", 'n', 'n', 64, 64, 64, 1));
+    EXPECT_NE(gemm_tuning_shape_key("s", 'n', 't', 64, 64, 64, 1),
+              gemm_tuning_shape_key("s", 't', 'n', 64, 64, 64, 1));
+    EXPECT_NE(gemm_tuning_shape_key("s", 'n', 'n', 64, 64, 64, 2),
+              gemm_tuning_shape_key("s", 'n', 'n', 64, 64, 64, 3));
+}
+
+TEST(GemmTuningCacheTests, ReadAcceptsValidEntries) {
+    std::istringstream in(std::string(gemm_tuning_cache_header) +
+                          "\n"
+                          "Device_A/1.0|s|nn|7,7,7|0 3\n"
+                          "Device_A/1.0|d|nt|4,5,6|2 0\n"
+                          "Device_B/2.0|s|nn|7,7,7|0 5\n");
+    std::map<std::string, int> entries;
+    read_gemm_tuning_cache(in, num_configs, entries);
+    const std::map<std::string, int> expected{ { "Device_A/1.0|s|nn|7,7,7|0", 3 },
+                                               { "Device_A/1.0|d|nt|4,5,6|2", 0 },
+                                               { "Device_B/2.0|s|nn|7,7,7|0", 5 } };
+    EXPECT_EQ(entries, expected);
+}
+
+TEST(GemmTuningCacheTests, ReadSkipsInvalidEntries) {
+    std::istringstream in(std::string(gemm_tuning_cache_header) +
+                          "\n"
+                          "\n"
+                          "no_config\n"
+                          " 2\n"
+                          "key_negative -1\n"
+                          "key_too_large 6\n"
+                          "key_not_a_number x\n"
+                          "key_trailing 2x\n"
+                          "key_empty \n"
+                          "key_valid 1\n");
+    std::map<std::string, int> entries;
+    read_gemm_tuning_cache(in, num_configs, entries);
+    const std::map<std::string, int> expected{ { "key_valid", 1 } };
+    EXPECT_EQ(entries, expected);
+}
+
+TEST(GemmTuningCacheTests, ReadRejectsUnknownHeader) {
+    std::map<std::string, int> entries;
+    std::istringstream other_version("# oneMKL portBLAS GEMM tuning cache v0\nkey 1\n");
+    read_gemm_tuning_cache(other_version, num_configs, entries);
+    EXPECT_TRUE(entries.empty());
+    std::istringstream no_header("key 1\n");
+    read_gemm_tuning_cache(no_header, num_configs, entries);
+    EXPECT_TRUE(entries.empty());
+    std::istringstream empty("");
+    read_gemm_tuning_cache(empty, num_configs, entries);
+    EXPECT_TRUE(entries.empty());
+}
+
+TEST(GemmTuningCacheTests, WriteThenReadRoundTrips) {
+    const std::map<std::string, int> entries{ { "Device_A/1.0|s|nn|7,7,7|0", 3 },
+                                              { "Device_A/1.0|s|tt|1,2,3|6", 1 } };
+    std::stringstream file;
+    write_gemm_tuning_cache(file, entries);
+    std::map<std::string, int> read;
+    read_gemm_tuning_cache(file, num_configs, read);
+    EXPECT_EQ(read, entries);
+}
+
+} // anonymous namespace
@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+template <typename fp>
+int test(device* dev, oneapi::mkl::layout layout, int N, int incx, int incy, int batch_size) {
+    // Prepare data.
+    vector<fp> x, y, result;
+    const int stride_y = N * std::abs(incy) + 3;
+
+    rand_vector(x, N, incx);
+    rand_vector(y, stride_y * batch_size, 1);
+    result.resize(batch_size, fp(-1));
+
+    // Call Reference DOT for each vector of the batch.
+    const int N_ref = N, incx_ref = incx, incy_ref = incy;
+
+    vector<fp> result_ref(batch_size);
+    for (int i = 0; i < batch_size; i++) {
+        result_ref[i] = ::dot<fp, fp>(&N_ref, x.data(), &incx_ref, y.data() + i * stride_y,
+                                      &incy_ref);
+    }
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during MDOT:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+
+    buffer<fp, 1> x_buffer = make_buffer(x);
+    buffer<fp, 1> y_buffer = make_buffer(y);
+    buffer<fp, 1> result_buffer = make_buffer(result);
+
+    // Call DPC++ MDOT.
+
+    try {
+#ifdef CALL_RT_API
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                oneapi::mkl::blas::column_major::mdot(main_queue, N, x_buffer, incx, y_buffer, incy,
+                                                      stride_y, result_buffer, batch_size);
+                break;
+            case oneapi::mkl::layout::row_major:
+                oneapi::mkl::blas::row_major::mdot(main_queue, N, x_buffer, incx, y_buffer, incy,
+                                                   stride_y, result_buffer, batch_size);
+                break;
+            default: break;
+        }
+#else
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::mdot, N,
+                                        x_buffer, incx, y_buffer, incy, stride_y, result_buffer,
+                                        batch_size);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::mdot, N, x_buffer,
+                                        incx, y_buffer, incy, stride_y, result_buffer, batch_size);
+                break;
+            default: break;
+        }
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during MDOT:\n" << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of MDOT:\n" << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto result_accessor = result_buffer.template get_host_access(read_only);
+    bool good = check_equal_vector(result_accessor, result_ref, batch_size, 1, N, std::cout);
+
+    return (int)good;
+}
+
+class MdotTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device*, oneapi::mkl::layout>> {};
+
+TEST_P(MdotTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP((test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3,
+                                   5)));
+    EXPECT_TRUEORSKIP((test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 1, 1,
+                                   1)));
+    EXPECT_TRUEORSKIP((test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3, -2,
+                                   8)));
+}
+
+TEST_P(MdotTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    EXPECT_TRUEORSKIP((test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3,
+                                    5)));
+    EXPECT_TRUEORSKIP((test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 1, 1,
+                                    1)));
+    EXPECT_TRUEORSKIP((test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3, -2,
+                                    8)));
+}
+
+INSTANTIATE_TEST_SUITE_P(MdotTestSuite, MdotTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,214 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "cblas.h"
+#include "oneapi/mkl.hpp"
+#include "oneapi/mkl/detail/config.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+// Restores the default mode when a test returns.
+struct reproducible_scope {
+    reproducible_scope() {
+        oneapi::mkl::blas::set_reproducible(true);
+    }
+    ~reproducible_scope() {
+        oneapi::mkl::blas::set_reproducible(false);
+    }
+};
+
+template <typename fp>
+int test(device* dev, oneapi::mkl::layout layout, int N, int incx, int m, int n, int k) {
+#ifndef CALL_RT_API
+    // The mode is checked through the run-time API only.
+    return test_skipped;
+#else
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception in reproducible mode:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    reproducible_scope scope;
+
+    // Prepare data.
+    const bool column_major = layout == oneapi::mkl::layout::col_major;
+    const int lda = column_major ? m : k;
+    const int ldb = column_major ? k : n;
+    const int ldc = column_major ? m : n;
+    const oneapi::mkl::transpose nontrans = oneapi::mkl::transpose::nontrans;
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> x(ua), y(ua), A(ua), B(ua), C(ua);
+    rand_vector(x, N, incx);
+    rand_vector(y, N, incx);
+    rand_matrix(A, layout, nontrans, m, k, lda);
+    rand_matrix(B, layout, nontrans, k, n, ldb);
+    rand_matrix(C, layout, nontrans, m, n, ldc);
+    auto C_first = C;
+    auto C_second = C;
+    fp alpha(1.5), beta(0.5);
+
+    // Call Reference DOT, ASUM, NRM2 and GEMM.
+    const int N_ref = N, incx_ref = incx;
+    const int m_ref = m, n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+    auto C_ref = C;
+
+    const fp dot_ref = ::dot<fp, fp>(&N_ref, x.data(), &incx_ref, y.data(), &incx_ref);
+    const fp asum_ref = ::asum<fp, fp>(&N_ref, x.data(), &incx_ref);
+    const fp nrm2_ref = ::nrm2<fp, fp>(&N_ref, x.data(), &incx_ref);
+    ::gemm(convert_to_cblas_layout(layout), convert_to_cblas_trans(nontrans),
+           convert_to_cblas_trans(nontrans), &m_ref, &n_ref, &k_ref, &alpha, A.data(), &lda_ref,
+           B.data(), &ldb_ref, &beta, C_ref.data(), &ldc_ref);
+
+    // Call every DPC++ routine twice on the same data.
+    vector<fp, decltype(ua)> results(6, fp(0), ua);
+
+    try {
+        for (int run = 0; run < 2; ++run) {
+            fp* result = results.data() + 3 * run;
+            fp* c = (run == 0) ? C_first.data() : C_second.data();
+            switch (layout) {
+                case oneapi::mkl::layout::col_major:
+                    oneapi::mkl::blas::column_major::dot(main_queue, N, x.data(), incx, y.data(),
+                                                         incx, result)
+                        .wait();
+                    oneapi::mkl::blas::column_major::asum(main_queue, N, x.data(), incx,
+                                                          result + 1)
+                        .wait();
+                    oneapi::mkl::blas::column_major::nrm2(main_queue, N, x.data(), incx,
+                                                          result + 2)
+                        .wait();
+                    oneapi::mkl::blas::column_major::gemm(main_queue, nontrans, nontrans, m, n, k,
+                                                          alpha, A.data(), lda, B.data(), ldb,
+                                                          beta, c, ldc)
+                        .wait();
+                    break;
+                case oneapi::mkl::layout::row_major:
+                    oneapi::mkl::blas::row_major::dot(main_queue, N, x.data(), incx, y.data(),
+                                                      incx, result)
+                        .wait();
+                    oneapi::mkl::blas::row_major::asum(main_queue, N, x.data(), incx, result + 1)
+                        .wait();
+                    oneapi::mkl::blas::row_major::nrm2(main_queue, N, x.data(), incx, result + 2)
+                        .wait();
+                    oneapi::mkl::blas::row_major::gemm(main_queue, nontrans, nontrans, m, n, k,
+                                                       alpha, A.data(), lda, B.data(), ldb, beta,
+                                                       c, ldc)
+                        .wait();
+                    break;
+                default: break;
+            }
+        }
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception in reproducible mode:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented& e) {
+        return test_skipped;
+    }
+
+    catch (const oneapi::mkl::exception& e) {
+        // MKL was already used in this process, so CNR can no longer be enabled.
+        std::cout << "Skipping reproducible mode test:\n" << e.what() << std::endl;
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised in reproducible mode:\n" << error.what() << std::endl;
+    }
+
+    // Both runs must agree bit for bit, and with the reference to rounding.
+
+    bool good = std::memcmp(results.data(), results.data() + 3, 3 * sizeof(fp)) == 0 &&
+                std::memcmp(C_first.data(), C_second.data(), C.size() * sizeof(fp)) == 0;
+    if (!good) {
+        std::cout << "Results differ between two runs in reproducible mode" << std::endl;
+    }
+    good = good && check_equal(results[0], dot_ref, N, std::cout);
+    good = good && check_equal(results[1], asum_ref, N, std::cout);
+    good = good && check_equal(results[2], nrm2_ref, N, std::cout);
+    good = good && check_equal_matrix(C_first, C_ref, layout, m, n, ldc, 10 * k, std::cout);
+
+    return (int)good;
+#endif
+}
+
+class ReproducibleUsmTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device*, oneapi::mkl::layout>> {};
+
+TEST_P(ReproducibleUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(
+        test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 79, 83, 91));
+    EXPECT_TRUEORSKIP(
+        test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 100003, 1, 8, 8, 40000));
+}
+
+TEST_P(ReproducibleUsmTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    EXPECT_TRUEORSKIP(
+        test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 79, 83, 91));
+    EXPECT_TRUEORSKIP(
+        test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 100003, 1, 8, 8, 40000));
+}
+
+INSTANTIATE_TEST_SUITE_P(ReproducibleUsmTestSuite, ReproducibleUsmTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
@@ -21,6 +21,8 @@
 #define _REFERENCE_BLAS_TEMPLATES_HPP__
 
 #include <stdlib.h>
+#include <algorithm>
+#include <cmath>
 #include <complex>
 #include <cstdint>
 #include "cblas.h"
@@ -1716,6 +1718,60 @@ void gemm_bias(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE tran
     oneapi::mkl::aligned_free(cd);
 }
 
+template <typename fpa, typename fpc>
+static void gemm_epilogue(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb,
+                          CBLAS_OFFSET offset_bias, const int *m, const int *n, const int *k,
+                          const float *alpha, const fpa *a, const int *lda, const fpa *b,
+                          const int *ldb, const float *beta, fpc *c, const int *ldc,
+                          const float *bias, oneapi::mkl::activation act, float clamp_min,
+                          float clamp_max) {
+    // Not supported in NETLIB. SGEMM followed by a separate epilogue pass is used as reference.
+    int sizea, sizeb, sizec, Iend, Jend;
+    if (layout == CblasColMajor) {
+        sizea = (transa == CblasNoTrans) ? *lda * *k : *lda * *m;
+        sizeb = (transb == CblasNoTrans) ? *ldb * *n : *ldb * *k;
+        sizec = *ldc * *n;
+        Iend = *m;
+        Jend = *n;
+    }
+    else {
+        sizea = (transa == CblasNoTrans) ? *lda * *m : *lda * *k;
+        sizeb = (transb == CblasNoTrans) ? *ldb * *k : *ldb * *n;
+        sizec = *ldc * *m;
+        Iend = *n;
+        Jend = *m;
+    }
+    float *af = (float *)oneapi::mkl::aligned_alloc(64, sizeof(float) * sizea);
+    float *bf = (float *)oneapi::mkl::aligned_alloc(64, sizeof(float) * sizeb);
+    float *cf = (float *)oneapi::mkl::aligned_alloc(64, sizeof(float) * sizec);
+    float *df = (float *)oneapi::mkl::aligned_alloc(64, sizeof(float) * sizec);
+    copy_mat(a, layout, transa, *m, *k, *lda, af);
+    copy_mat(b, layout, transb, *k, *n, *ldb, bf);
+    copy_mat(c, layout, CblasNoTrans, *m, *n, *ldc, cf);
+    cblas_sgemm_wrapper(layout, transa, transb, *m, *n, *k, *alpha, af, *lda, bf, *ldb, *beta, cf,
+                        *ldc);
+    copy_mat(cf, layout, *m, *n, *ldc, offset_bias, bias, df);
+    for (int j = 0; j < Jend; j++) {
+        for (int i = 0; i < Iend; i++) {
+            float x = df[i + *ldc * j];
+            switch (act) {
+                case oneapi::mkl::activation::relu: x = std::max(x, 0.0f); break;
+                case oneapi::mkl::activation::gelu:
+                    x = 0.5f * x * (1.0f + std::erf(x / std::sqrt(2.0f)));
+                    break;
+                case oneapi::mkl::activation::sigmoid: x = 1.0f / (1.0f + std::exp(-x)); break;
+                default: break;
+            }
+            x = std::min(std::max(x, clamp_min), clamp_max);
+            c[i + *ldc * j] = (fpc)x;
+        }
+    }
+    oneapi::mkl::aligned_free(af);
+    oneapi::mkl::aligned_free(bf);
+    oneapi::mkl::aligned_free(cf);
+    oneapi::mkl::aligned_free(df);
+}
+
 template <typename fp>
 static void gemmt(CBLAS_LAYOUT layout, CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE transa,
                   CBLAS_TRANSPOSE transb, const int *n, const int *k, const fp *alpha, const fp *a,
@@ -216,6 +216,13 @@ TEST_P(GemmUsmTests, RealSinglePrecision) {
     EXPECT_TRUEORSKIP((test<float, float>(
         std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
         oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    // Small C with a long reduction dimension exercises the split-K path; the
+    // leading dimensions keep the stored operands k-by-m and k-by-n.
+    const bool col_major = std::get<1>(GetParam()) == oneapi::mkl::layout::col_major;
+    EXPECT_TRUEORSKIP((test<float, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::nontrans, 13, 11, 9000, col_major ? 9000 : 13,
+        col_major ? 9000 : 11, 14, alpha, beta)));
 }
 
 TEST_P(GemmUsmTests, RealDoublePrecision) {
@@ -235,6 +242,13 @@ TEST_P(GemmUsmTests, RealDoublePrecision) {
     EXPECT_TRUEORSKIP((test<double, double>(
         std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
         oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    // Small C with a long reduction dimension exercises the split-K path; the
+    // leading dimensions keep the stored operands k-by-m and k-by-n.
+    const bool col_major = std::get<1>(GetParam()) == oneapi::mkl::layout::col_major;
+    EXPECT_TRUEORSKIP((test<double, double>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::nontrans, 13, 11, 9000, col_major ? 9000 : 13,
+        col_major ? 9000 : 11, 14, alpha, beta)));
 }
 
 TEST_P(GemmUsmTests, ComplexSinglePrecision) {
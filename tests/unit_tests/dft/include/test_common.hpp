@@ -162,6 +162,18 @@ void commit_descriptor(oneapi::mkl::dft::descriptor<precision, domain> &descript
 #endif
 }
 
+template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
+sycl::event commit_descriptor_async(oneapi::mkl::dft::descriptor<precision, domain> &descriptor,
+                                    sycl::queue queue) {
+    sycl::event commit_event;
+#ifdef CALL_RT_API
+    commit_event = descriptor.commit_async(queue);
+#else
+    TEST_RUN_CT_SELECT_NO_ARGS(queue, commit_event = descriptor.commit_async);
+#endif
+    return commit_event;
+}
+
 // is it assumed that the unused elements of the array are ignored
 inline std::array<std::int64_t, 4> get_conjugate_even_complex_strides(
     const std::vector<std::int64_t> &sizes) {
@@ -108,6 +108,14 @@ std::vector<DFTParams> test_params{
     { shape{ 8 }, i64{ 27 } },
     { shape{ 22 }, i64{ 1 } },
     { shape{ 128 }, i64{ 1 } },
+    { shape{ 211 }, i64{ 3 } },
+    { shape{ 1021 }, i64{ 1 } },
+    { shape{ 16 }, i64{ 5 } },
+    { shape{ 30 }, i64{ 3 } },
+    { shape{ 16 }, shape{ 3, 2 }, shape{ 1, 3 }, i64{ 3 } },
+    { shape{ 30 }, shape{ 0, 3 }, shape{ 2, 1 }, i64{ 7 } },
+    { shape{ 422 }, i64{ 3 } },
+    { shape{ 211 }, shape{ 2, 3 }, shape{ 1, 2 }, i64{ 4 } },
 
     { shape{ 4, 4 }, i64{ 1 } },
     { shape{ 4, 4 }, i64{ 2 } },
@@ -144,6 +152,11 @@ std::vector<DFTParams> test_params_real_in_place{
     { shape{ 8 }, i64{ 27 } },
     { shape{ 22 }, i64{ 1 } },
     { shape{ 128 }, i64{ 1 } },
+    { shape{ 16 }, i64{ 5 } },
+    { shape{ 30 }, i64{ 3 } },
+    { shape{ 16 }, shape{ 2, 1 }, shape{ 1, 1 }, i64{ 3 } },
+    { shape{ 30 }, shape{ 4, 1 }, shape{ 2, 1 }, i64{ 5 } },
+    { shape{ 422 }, i64{ 3 } },
 
     { shape{ 4, 4 }, i64{ 1 } },
     { shape{ 4, 4 }, i64{ 2 } },
@@ -0,0 +1,433 @@
+/***************************************************************************
+*  Copyright (C) Codeplay Software Limited
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  For your convenience, a copy of the License has been included in this
+*  repository.
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**************************************************************************/
+
+#include <cmath>
+#include <complex>
+#include <iostream>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "test_helper.hpp"
+#include "test_common.hpp"
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+const std::vector<std::int64_t> convolution_lengths{ 8, 64, 256 };
+
+// Circular convolution of x and h over the dimensions dims, or their correlation, accumulated in
+// long double.
+template <typename T>
+std::vector<T> reference_filter(const T* x, const std::vector<T>& h,
+                                const std::vector<std::int64_t>& dims, bool correlation) {
+    const std::size_t rank = dims.size();
+    const auto size = static_cast<std::int64_t>(h.size());
+    auto unflatten = [&](std::int64_t linear, std::vector<std::int64_t>& idx) {
+        for (std::size_t d = rank; d-- > 0;) {
+            idx[d] = linear % dims[d];
+            linear /= dims[d];
+        }
+    };
+    std::vector<T> y(h.size());
+    std::vector<std::int64_t> i_idx(rank), j_idx(rank);
+    for (std::int64_t i = 0; i < size; ++i) {
+        unflatten(i, i_idx);
+        std::complex<long double> sum{ 0 };
+        for (std::int64_t j = 0; j < size; ++j) {
+            unflatten(j, j_idx);
+            std::int64_t k = 0;
+            for (std::size_t d = 0; d < rank; ++d) {
+                const std::int64_t diff = correlation ? j_idx[d] - i_idx[d] : i_idx[d] - j_idx[d];
+                k = k * dims[d] + (diff + dims[d]) % dims[d];
+            }
+            const std::complex<long double> hk(h[static_cast<std::size_t>(k)]);
+            sum += std::complex<long double>(x[j]) * (correlation ? std::conj(hk) : hk);
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            y[static_cast<std::size_t>(i)] = static_cast<T>(sum.real());
+        }
+        else {
+            y[static_cast<std::size_t>(i)] = T(sum);
+        }
+    }
+    return y;
+}
+
+// Convolution through the spectra: forward transforms, pointwise product, backward transform.
+// With BACKWARD_SCRAMBLED the spectra are in the backend's own order, which the pointwise product
+// does not depend on.
+template <oneapi::mkl::dft::precision precision>
+int test_scrambled_convolution(sycl::device* dev) {
+    using real_t = std::conditional_t<precision == oneapi::mkl::dft::precision::SINGLE, float,
+                                      double>;
+    using complex_t = std::complex<real_t>;
+    using config_param = oneapi::mkl::dft::config_param;
+    using config_value = oneapi::mkl::dft::config_value;
+
+    if constexpr (precision == oneapi::mkl::dft::precision::DOUBLE) {
+        if (!dev->has(sycl::aspect::fp64)) {
+            std::cout << "Device does not support double precision." << std::endl;
+            return test_skipped;
+        }
+    }
+    sycl::queue sycl_queue(*dev, exception_handler);
+
+    for (std::int64_t n : convolution_lengths) {
+        const auto size = static_cast<std::size_t>(n);
+        std::vector<complex_t> x, h;
+        rand_vector(x, size);
+        rand_vector(h, size);
+        const auto reference = reference_filter(x.data(), h, { n }, false);
+
+        oneapi::mkl::dft::descriptor<precision, oneapi::mkl::dft::domain::COMPLEX> descriptor{ n };
+        descriptor.set_value(config_param::ORDERING, config_value::BACKWARD_SCRAMBLED);
+        descriptor.set_value(config_param::BACKWARD_SCALE, 1.0 / static_cast<double>(n));
+        // Backends without BACKWARD_SCRAMBLED either report it as unimplemented or reject the
+        // configuration.
+        try {
+            commit_descriptor(descriptor, sycl_queue);
+        }
+        catch (oneapi::mkl::unimplemented& e) {
+            std::cout << "Skipping because BACKWARD_SCRAMBLED is not supported. Reason: \""
+                      << e.what() << "\"\n";
+            return test_skipped;
+        }
+        catch (oneapi::mkl::invalid_argument& e) {
+            std::cout << "Skipping because BACKWARD_SCRAMBLED is not supported. Reason: \""
+                      << e.what() << "\"\n";
+            return test_skipped;
+        }
+
+        auto* x_dev = sycl::malloc_shared<complex_t>(size, sycl_queue);
+        auto* h_dev = sycl::malloc_shared<complex_t>(size, sycl_queue);
+        std::copy(x.begin(), x.end(), x_dev);
+        std::copy(h.begin(), h.end(), h_dev);
+
+        auto x_event = oneapi::mkl::dft::compute_forward<decltype(descriptor), complex_t>(
+            descriptor, x_dev);
+        auto h_event = oneapi::mkl::dft::compute_forward<decltype(descriptor), complex_t>(
+            descriptor, h_dev);
+        auto product_event = sycl_queue.parallel_for(
+            sycl::range<1>(size), { x_event, h_event },
+            [=](sycl::id<1> i) { x_dev[i] = x_dev[i] * h_dev[i]; });
+        oneapi::mkl::dft::compute_backward<decltype(descriptor), complex_t>(descriptor, x_dev,
+                                                                            { product_event })
+            .wait_and_throw();
+
+        EXPECT_TRUE(check_equal_vector(x_dev, reference, size, 10.0 * std::log2(n),
+                                       10.0 * std::log2(n), std::cout));
+        sycl::free(x_dev, sycl_queue);
+        sycl::free(h_dev, sycl_queue);
+    }
+
+    return !::testing::Test::HasFailure();
+}
+
+const std::vector<std::vector<std::int64_t>> complex_filter_shapes{ { 64 },
+                                                                     { 211 },
+                                                                     { 8, 6 },
+                                                                     { 4, 4, 4 } };
+const std::vector<std::int64_t> real_filter_lengths{ 64, 422 };
+constexpr std::size_t filter_batch = 3;
+
+// compute_convolution and compute_correlation of a batch of complex data with USM. The filter is
+// the spectrum of one transform.
+template <oneapi::mkl::dft::precision precision>
+int test_complex_filter(sycl::device* dev, bool correlation) {
+    using real_t = std::conditional_t<precision == oneapi::mkl::dft::precision::SINGLE, float,
+                                      double>;
+    using complex_t = std::complex<real_t>;
+    using config_param = oneapi::mkl::dft::config_param;
+    using descriptor_t = oneapi::mkl::dft::descriptor<precision, oneapi::mkl::dft::domain::COMPLEX>;
+
+    if constexpr (precision == oneapi::mkl::dft::precision::DOUBLE) {
+        if (!dev->has(sycl::aspect::fp64)) {
+            std::cout << "Device does not support double precision." << std::endl;
+            return test_skipped;
+        }
+    }
+    sycl::queue sycl_queue(*dev, exception_handler);
+
+    for (const auto& dims : complex_filter_shapes) {
+        std::int64_t size = 1;
+        for (auto d : dims) {
+            size *= d;
+        }
+        const auto usize = static_cast<std::size_t>(size);
+        std::vector<complex_t> x, h;
+        rand_vector(x, usize * filter_batch);
+        rand_vector(h, usize);
+
+        descriptor_t descriptor{ dims };
+        descriptor.set_value(config_param::NUMBER_OF_TRANSFORMS,
+                             static_cast<std::int64_t>(filter_batch));
+        descriptor.set_value(config_param::FWD_DISTANCE, size);
+        descriptor.set_value(config_param::BWD_DISTANCE, size);
+        descriptor.set_value(config_param::BACKWARD_SCALE, 1.0 / static_cast<double>(size));
+        descriptor_t filter_descriptor{ dims };
+        try {
+            commit_descriptor(descriptor, sycl_queue);
+            commit_descriptor(filter_descriptor, sycl_queue);
+        }
+        catch (oneapi::mkl::unimplemented& e) {
+            std::cout << "Skipping because the configuration is not supported. Reason: \""
+                      << e.what() << "\"\n";
+            return test_skipped;
+        }
+
+        auto* x_dev = sycl::malloc_shared<complex_t>(x.size(), sycl_queue);
+        auto* h_dev = sycl::malloc_shared<complex_t>(usize, sycl_queue);
+        std::copy(x.begin(), x.end(), x_dev);
+        std::copy(h.begin(), h.end(), h_dev);
+
+        auto filter_event =
+            oneapi::mkl::dft::compute_forward<descriptor_t, complex_t>(filter_descriptor, h_dev);
+        if (correlation) {
+            oneapi::mkl::dft::compute_correlation(descriptor, x_dev, h_dev, { filter_event })
+                .wait_and_throw();
+        }
+        else {
+            oneapi::mkl::dft::compute_convolution(descriptor, x_dev, h_dev, { filter_event })
+                .wait_and_throw();
+        }
+
+        for (std::size_t b = 0; b < filter_batch; ++b) {
+            const auto reference = reference_filter(x.data() + b * usize, h, dims, correlation);
+            EXPECT_TRUE(check_equal_vector(x_dev + b * usize, reference, usize,
+                                           10.0 * std::log2(size), 10.0 * std::log2(size),
+                                           std::cout));
+        }
+        sycl::free(x_dev, sycl_queue);
+        sycl::free(h_dev, sycl_queue);
+    }
+
+    return !::testing::Test::HasFailure();
+}
+
+// compute_convolution and compute_correlation of a batch of real data with buffers, in the padded
+// in-place layout. The filter is the in-place forward transform of one transform.
+template <oneapi::mkl::dft::precision precision>
+int test_real_filter(sycl::device* dev, bool correlation) {
+    using real_t = std::conditional_t<precision == oneapi::mkl::dft::precision::SINGLE, float,
+                                      double>;
+    using config_param = oneapi::mkl::dft::config_param;
+    using descriptor_t = oneapi::mkl::dft::descriptor<precision, oneapi::mkl::dft::domain::REAL>;
+
+    if constexpr (precision == oneapi::mkl::dft::precision::DOUBLE) {
+        if (!dev->has(sycl::aspect::fp64)) {
+            std::cout << "Device does not support double precision." << std::endl;
+            return test_skipped;
+        }
+    }
+    sycl::queue sycl_queue(*dev, exception_handler);
+
+    for (std::int64_t n : real_filter_lengths) {
+        const auto size = static_cast<std::size_t>(n);
+        const std::int64_t bwd_dist = n / 2 + 1;
+        const std::int64_t fwd_dist = 2 * bwd_dist;
+        const auto padded_size = static_cast<std::size_t>(fwd_dist);
+        std::vector<real_t> x(padded_size * filter_batch, real_t(0)), h;
+        rand_vector(h, size);
+        std::vector<std::vector<real_t>> references;
+        for (std::size_t b = 0; b < filter_batch; ++b) {
+            std::vector<real_t> signal;
+            rand_vector(signal, size);
+            std::copy(signal.begin(), signal.end(), x.begin() + b * padded_size);
+            references.push_back(reference_filter(signal.data(), h, { n }, correlation));
+        }
+        std::vector<real_t> h_padded(h);
+        h_padded.resize(padded_size);
+
+        descriptor_t descriptor{ n };
+        descriptor.set_value(config_param::NUMBER_OF_TRANSFORMS,
+                             static_cast<std::int64_t>(filter_batch));
+        descriptor.set_value(config_param::FWD_DISTANCE, fwd_dist);
+        descriptor.set_value(config_param::BWD_DISTANCE, bwd_dist);
+        descriptor.set_value(config_param::BACKWARD_SCALE, 1.0 / static_cast<double>(n));
+        descriptor_t filter_descriptor{ n };
+        try {
+            commit_descriptor(descriptor, sycl_queue);
+            commit_descriptor(filter_descriptor, sycl_queue);
+        }
+        catch (oneapi::mkl::unimplemented& e) {
+            std::cout << "Skipping because the configuration is not supported. Reason: \""
+                      << e.what() << "\"\n";
+            return test_skipped;
+        }
+
+        {
+            sycl::buffer<real_t, 1> x_buf{ x.data(), sycl::range<1>(x.size()) };
+            sycl::buffer<real_t, 1> h_buf{ h_padded.data(), sycl::range<1>(h_padded.size()) };
+            oneapi::mkl::dft::compute_forward<descriptor_t, real_t>(filter_descriptor, h_buf);
+            if (correlation) {
+                oneapi::mkl::dft::compute_correlation(descriptor, x_buf, h_buf);
+            }
+            else {
+                oneapi::mkl::dft::compute_convolution(descriptor, x_buf, h_buf);
+            }
+        }
+
+        for (std::size_t b = 0; b < filter_batch; ++b) {
+            EXPECT_TRUE(check_equal_vector(x.data() + b * padded_size, references[b], size,
+                                           10.0 * std::log2(n), 10.0 * std::log2(n), std::cout));
+        }
+    }
+
+    return !::testing::Test::HasFailure();
+}
+
+// Real convolutions are only computed in one dimension.
+int test_real_filter_rank(sycl::device* dev) {
+    using descriptor_t = oneapi::mkl::dft::descriptor<oneapi::mkl::dft::precision::SINGLE,
+                                                      oneapi::mkl::dft::domain::REAL>;
+    sycl::queue sycl_queue(*dev, exception_handler);
+    const std::vector<std::int64_t> dims{ 4, 6 };
+
+    descriptor_t descriptor{ dims };
+    try {
+        commit_descriptor(descriptor, sycl_queue);
+    }
+    catch (oneapi::mkl::unimplemented& e) {
+        std::cout << "Skipping because the configuration is not supported. Reason: \"" << e.what()
+                  << "\"\n";
+        return test_skipped;
+    }
+    catch (oneapi::mkl::invalid_argument& e) {
+        std::cout << "Skipping because the configuration is not supported. Reason: \"" << e.what()
+                  << "\"\n";
+        return test_skipped;
+    }
+
+    auto* x_dev = sycl::malloc_shared<float>(32, sycl_queue);
+    auto* h_dev = sycl::malloc_shared<std::complex<float>>(16, sycl_queue);
+    EXPECT_THROW(oneapi::mkl::dft::compute_convolution(descriptor, x_dev, h_dev),
+                 oneapi::mkl::unimplemented);
+    sycl::free(x_dev, sycl_queue);
+    sycl::free(h_dev, sycl_queue);
+
+    return !::testing::Test::HasFailure();
+}
+
+// The convolution uses the configuration that was committed: setting NOT_INPLACE afterwards
+// without committing again does not affect it.
+int test_uncommitted_placement(sycl::device* dev) {
+    using complex_t = std::complex<float>;
+    using config_param = oneapi::mkl::dft::config_param;
+    using config_value = oneapi::mkl::dft::config_value;
+    using descriptor_t = oneapi::mkl::dft::descriptor<oneapi::mkl::dft::precision::SINGLE,
+                                                      oneapi::mkl::dft::domain::COMPLEX>;
+    sycl::queue sycl_queue(*dev, exception_handler);
+    const std::int64_t n = 64;
+    const auto size = static_cast<std::size_t>(n);
+    std::vector<complex_t> x, h;
+    rand_vector(x, size);
+    rand_vector(h, size);
+    const auto reference = reference_filter(x.data(), h, { n }, false);
+
+    descriptor_t descriptor{ n };
+    descriptor.set_value(config_param::BACKWARD_SCALE, 1.0 / static_cast<double>(n));
+    descriptor_t filter_descriptor{ n };
+    try {
+        commit_descriptor(descriptor, sycl_queue);
+        commit_descriptor(filter_descriptor, sycl_queue);
+    }
+    catch (oneapi::mkl::unimplemented& e) {
+        std::cout << "Skipping because the configuration is not supported. Reason: \"" << e.what()
+                  << "\"\n";
+        return test_skipped;
+    }
+    descriptor.set_value(config_param::PLACEMENT, config_value::NOT_INPLACE);
+
+    auto* x_dev = sycl::malloc_shared<complex_t>(size, sycl_queue);
+    auto* h_dev = sycl::malloc_shared<complex_t>(size, sycl_queue);
+    std::copy(x.begin(), x.end(), x_dev);
+    std::copy(h.begin(), h.end(), h_dev);
+    auto filter_event =
+        oneapi::mkl::dft::compute_forward<descriptor_t, complex_t>(filter_descriptor, h_dev);
+    oneapi::mkl::dft::compute_convolution(descriptor, x_dev, h_dev, { filter_event })
+        .wait_and_throw();
+    EXPECT_TRUE(check_equal_vector(x_dev, reference, size, 10.0 * std::log2(n),
+                                   10.0 * std::log2(n), std::cout));
+    sycl::free(x_dev, sycl_queue);
+    sycl::free(h_dev, sycl_queue);
+
+    return !::testing::Test::HasFailure();
+}
+
+class ConvolutionTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(ConvolutionTests, ScrambledConvolutionSingle) {
+    EXPECT_TRUEORSKIP(test_scrambled_convolution<oneapi::mkl::dft::precision::SINGLE>(GetParam()));
+}
+
+TEST_P(ConvolutionTests, ScrambledConvolutionDouble) {
+    EXPECT_TRUEORSKIP(test_scrambled_convolution<oneapi::mkl::dft::precision::DOUBLE>(GetParam()));
+}
+
+TEST_P(ConvolutionTests, ComplexConvolutionSingle) {
+    EXPECT_TRUEORSKIP(test_complex_filter<oneapi::mkl::dft::precision::SINGLE>(GetParam(), false));
+}
+
+TEST_P(ConvolutionTests, ComplexConvolutionDouble) {
+    EXPECT_TRUEORSKIP(test_complex_filter<oneapi::mkl::dft::precision::DOUBLE>(GetParam(), false));
+}
+
+TEST_P(ConvolutionTests, ComplexCorrelationSingle) {
+    EXPECT_TRUEORSKIP(test_complex_filter<oneapi::mkl::dft::precision::SINGLE>(GetParam(), true));
+}
+
+TEST_P(ConvolutionTests, ComplexCorrelationDouble) {
+    EXPECT_TRUEORSKIP(test_complex_filter<oneapi::mkl::dft::precision::DOUBLE>(GetParam(), true));
+}
+
+TEST_P(ConvolutionTests, RealConvolutionSingle) {
+    EXPECT_TRUEORSKIP(test_real_filter<oneapi::mkl::dft::precision::SINGLE>(GetParam(), false));
+}
+
+TEST_P(ConvolutionTests, RealConvolutionDouble) {
+    EXPECT_TRUEORSKIP(test_real_filter<oneapi::mkl::dft::precision::DOUBLE>(GetParam(), false));
+}
+
+TEST_P(ConvolutionTests, RealCorrelationSingle) {
+    EXPECT_TRUEORSKIP(test_real_filter<oneapi::mkl::dft::precision::SINGLE>(GetParam(), true));
+}
+
+TEST_P(ConvolutionTests, RealCorrelationDouble) {
+    EXPECT_TRUEORSKIP(test_real_filter<oneapi::mkl::dft::precision::DOUBLE>(GetParam(), true));
+}
+
+TEST_P(ConvolutionTests, RealConvolutionRank) {
+    EXPECT_TRUEORSKIP(test_real_filter_rank(GetParam()));
+}
+
+TEST_P(ConvolutionTests, UncommittedPlacement) {
+    EXPECT_TRUEORSKIP(test_uncommitted_placement(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(ConvolutionTestSuite, ConvolutionTests, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -17,6 +17,8 @@
 *
 **************************************************************************/
 
+#include <algorithm>
+#include <complex>
 #include <iostream>
 #include <vector>
 #include <variant>
@@ -428,6 +430,72 @@ static void get_commited(sycl::queue& sycl_queue) {
     EXPECT_EQ(commit_status, oneapi::mkl::dft::config_value::COMMITTED);
 }
 
+template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
+static void copy_shares_commit(sycl::queue& sycl_queue) {
+    using oneapi::mkl::dft::config_param;
+    using oneapi::mkl::dft::config_value;
+    using oneapi::mkl::dft::detail::get_commit;
+
+    oneapi::mkl::dft::descriptor<precision, domain> descriptor{ default_1d_lengths };
+    commit_descriptor(descriptor, sycl_queue);
+    auto* committed = get_commit(descriptor);
+
+    oneapi::mkl::dft::descriptor<precision, domain> descCopy{ descriptor };
+    config_value commit_status;
+    descCopy.get_value(config_param::COMMIT_STATUS, &commit_status);
+    EXPECT_EQ(commit_status, config_value::COMMITTED);
+    EXPECT_EQ(get_commit(descCopy), committed);
+
+    // Recommitting the copy with other values must not reconfigure the original.
+    descCopy.set_value(config_param::FORWARD_SCALE, 2.0);
+    commit_descriptor(descCopy, sycl_queue);
+    EXPECT_NE(get_commit(descCopy), committed);
+    EXPECT_EQ(get_commit(descriptor), committed);
+
+    // The workspace is set on the plan, so it is not shared.
+    oneapi::mkl::dft::descriptor<precision, domain> external{ default_1d_lengths };
+    external.set_value(config_param::WORKSPACE_PLACEMENT, config_value::WORKSPACE_EXTERNAL);
+    commit_descriptor(external, sycl_queue);
+    oneapi::mkl::dft::descriptor<precision, domain> externalCopy{ external };
+    externalCopy.get_value(config_param::COMMIT_STATUS, &commit_status);
+    EXPECT_EQ(commit_status, config_value::UNCOMMITTED);
+}
+
+template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
+static void commit_async_orders_compute(sycl::queue& sycl_queue) {
+    using oneapi::mkl::dft::config_param;
+    using oneapi::mkl::dft::config_value;
+    using PrecisionType =
+        typename std::conditional_t<precision == oneapi::mkl::dft::precision::SINGLE, float,
+                                    double>;
+
+    oneapi::mkl::dft::descriptor<precision, domain> descriptor{ default_1d_lengths };
+    sycl::event commit_event;
+    EXPECT_NO_THROW(commit_event = commit_descriptor_async(descriptor, sycl_queue));
+
+    config_value commit_status;
+    descriptor.get_value(config_param::COMMIT_STATUS, &commit_status);
+    EXPECT_EQ(commit_status, config_value::COMMITTED);
+
+    if constexpr (domain == oneapi::mkl::dft::domain::COMPLEX) {
+        // The transform is submitted without waiting for the plan; it must still see the built
+        // plan. The transform of a unit impulse is all ones.
+        using complex_t = std::complex<PrecisionType>;
+        auto* inout = sycl::malloc_shared<complex_t>(default_1d_lengths, sycl_queue);
+        std::fill(inout, inout + default_1d_lengths, complex_t(0));
+        inout[0] = complex_t(1);
+        oneapi::mkl::dft::compute_forward<decltype(descriptor), complex_t>(descriptor, inout)
+            .wait_and_throw();
+        for (std::int64_t i = 0; i < default_1d_lengths; ++i) {
+            EXPECT_NEAR(inout[i].real(), PrecisionType(1), PrecisionType(1e-5));
+            EXPECT_NEAR(inout[i].imag(), PrecisionType(0), PrecisionType(1e-5));
+        }
+        sycl::free(inout, sycl_queue);
+    }
+
+    EXPECT_NO_THROW(commit_event.wait_and_throw());
+}
+
 template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
 inline void recommit_values(sycl::queue& sycl_queue) {
     using oneapi::mkl::dft::config_param;
@@ -597,6 +665,44 @@ static int test_move() {
     return !::testing::Test::HasFailure();
 }
 
+template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
+static int test_copy() {
+    using config_param = oneapi::mkl::dft::config_param;
+    std::int64_t fwdDistanceRef(123);
+    {
+        // Copy constructor
+        oneapi::mkl::dft::descriptor<precision, domain> descriptor{ default_1d_lengths };
+        descriptor.set_value(config_param::FWD_DISTANCE, fwdDistanceRef);
+        oneapi::mkl::dft::descriptor<precision, domain> descCopy{ descriptor };
+        std::int64_t fwdDistance(0), dftLength(0);
+        descCopy.get_value(config_param::FWD_DISTANCE, &fwdDistance);
+        EXPECT_EQ(fwdDistance, fwdDistanceRef);
+        descCopy.get_value(config_param::LENGTHS, &dftLength);
+        EXPECT_EQ(default_1d_lengths, dftLength);
+
+        // The copy is independent of the original.
+        descCopy.set_value(config_param::FWD_DISTANCE, fwdDistanceRef + 1);
+        descriptor.get_value(config_param::FWD_DISTANCE, &fwdDistance);
+        EXPECT_EQ(fwdDistance, fwdDistanceRef);
+    }
+    {
+        // Copy assignment
+        oneapi::mkl::dft::descriptor<precision, domain> descriptor{ default_1d_lengths };
+        descriptor.set_value(config_param::FWD_DISTANCE, fwdDistanceRef);
+        oneapi::mkl::dft::descriptor<precision, domain> descCopy{ default_3d_lengths };
+        descCopy = descriptor;
+        std::int64_t fwdDistance(0), dftDimension(0), dftLength(0);
+        descCopy.get_value(config_param::FWD_DISTANCE, &fwdDistance);
+        EXPECT_EQ(fwdDistance, fwdDistanceRef);
+        descCopy.get_value(config_param::DIMENSION, &dftDimension);
+        EXPECT_EQ(dftDimension, 1);
+        descCopy.get_value(config_param::LENGTHS, &dftLength);
+        EXPECT_EQ(default_1d_lengths, dftLength);
+    }
+
+    return !::testing::Test::HasFailure();
+}
+
 template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
 static int test_getter_setter() {
     set_and_get_lengths<precision, domain>();
@@ -632,6 +738,8 @@ int test_commit(sycl::device* dev) {
 
     get_commited<precision, domain>(sycl_queue);
     recommit_values<precision, domain>(sycl_queue);
+    copy_shares_commit<precision, domain>(sycl_queue);
+    commit_async_orders_compute<precision, domain>(sycl_queue);
     change_queue_causes_wait<precision, domain>(sycl_queue);
     swap_out_dead_queue<precision, domain>(sycl_queue);
 
@@ -656,6 +764,24 @@ TEST(DescriptorTests, DescriptorMoveComplexDouble) {
         (test_move<oneapi::mkl::dft::precision::DOUBLE, oneapi::mkl::dft::domain::COMPLEX>()));
 }
 
+TEST(DescriptorTests, DescriptorCopyRealSingle) {
+    EXPECT_TRUE((test_copy<oneapi::mkl::dft::precision::SINGLE, oneapi::mkl::dft::domain::REAL>()));
+}
+
+TEST(DescriptorTests, DescriptorCopyRealDouble) {
+    EXPECT_TRUE((test_copy<oneapi::mkl::dft::precision::DOUBLE, oneapi::mkl::dft::domain::REAL>()));
+}
+
+TEST(DescriptorTests, DescriptorCopyComplexSingle) {
+    EXPECT_TRUE(
+        (test_copy<oneapi::mkl::dft::precision::SINGLE, oneapi::mkl::dft::domain::COMPLEX>()));
+}
+
+TEST(DescriptorTests, DescriptorCopyComplexDouble) {
+    EXPECT_TRUE(
+        (test_copy<oneapi::mkl::dft::precision::DOUBLE, oneapi::mkl::dft::domain::COMPLEX>()));
+}
+
 TEST(DescriptorTests, DescriptorTestsRealSingle) {
     EXPECT_TRUE((
         test_getter_setter<oneapi::mkl::dft::precision::SINGLE, oneapi::mkl::dft::domain::REAL>()));
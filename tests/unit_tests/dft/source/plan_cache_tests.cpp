@@ -0,0 +1,185 @@
+/***************************************************************************
+*  Copyright (C) Codeplay Software Limited
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  For your convenience, a copy of the License has been included in this
+*  repository.
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**************************************************************************/
+
+#include <iostream>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "test_helper.hpp"
+#include "test_common.hpp"
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+constexpr std::int64_t default_1d_lengths = 4;
+
+// Sets the capacity of the plan cache for the scope of a test and empties the
+// cache on both ends.
+class scoped_plan_cache {
+public:
+    explicit scoped_plan_cache(std::size_t capacity)
+            : saved_capacity_(oneapi::mkl::dft::get_plan_cache_stats().capacity) {
+        oneapi::mkl::dft::clear_plan_cache();
+        oneapi::mkl::dft::set_plan_cache_capacity(capacity);
+    }
+    ~scoped_plan_cache() {
+        oneapi::mkl::dft::clear_plan_cache();
+        oneapi::mkl::dft::set_plan_cache_capacity(saved_capacity_);
+    }
+
+private:
+    std::size_t saved_capacity_;
+};
+
+template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
+static void identical_configs_share_a_plan(sycl::queue& sycl_queue) {
+    using oneapi::mkl::dft::detail::get_commit;
+    scoped_plan_cache cache(4);
+
+    oneapi::mkl::dft::descriptor<precision, domain> first{ default_1d_lengths };
+    oneapi::mkl::dft::descriptor<precision, domain> second{ default_1d_lengths };
+    commit_descriptor(first, sycl_queue);
+    commit_descriptor(second, sycl_queue);
+
+    auto stats = oneapi::mkl::dft::get_plan_cache_stats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.size, 1u);
+    EXPECT_EQ(get_commit(first), get_commit(second));
+
+    // Reconfiguring one of the descriptors must leave the other's plan alone.
+    second.set_value(oneapi::mkl::dft::config_param::FORWARD_SCALE, 2.0);
+    commit_descriptor(second, sycl_queue);
+    stats = oneapi::mkl::dft::get_plan_cache_stats();
+    EXPECT_EQ(stats.misses, 2u);
+    EXPECT_EQ(stats.size, 2u);
+    EXPECT_NE(get_commit(first), get_commit(second));
+
+    oneapi::mkl::dft::descriptor<precision, domain> third{ default_1d_lengths };
+    third.set_value(oneapi::mkl::dft::config_param::FORWARD_SCALE, 2.0);
+    commit_descriptor(third, sycl_queue);
+    EXPECT_EQ(get_commit(second), get_commit(third));
+    EXPECT_EQ(oneapi::mkl::dft::get_plan_cache_stats().hits, 2u);
+}
+
+template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
+static void least_recently_used_plan_is_evicted(sycl::queue& sycl_queue) {
+    using oneapi::mkl::dft::detail::get_commit;
+    scoped_plan_cache cache(1);
+
+    oneapi::mkl::dft::descriptor<precision, domain> first{ default_1d_lengths };
+    oneapi::mkl::dft::descriptor<precision, domain> second{ 2 * default_1d_lengths };
+    commit_descriptor(first, sycl_queue);
+    commit_descriptor(second, sycl_queue);
+
+    auto stats = oneapi::mkl::dft::get_plan_cache_stats();
+    EXPECT_EQ(stats.misses, 2u);
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_EQ(stats.size, 1u);
+    // The descriptor keeps its plan after the cache drops it.
+    EXPECT_NE(get_commit(first), nullptr);
+
+    oneapi::mkl::dft::descriptor<precision, domain> again{ default_1d_lengths };
+    commit_descriptor(again, sycl_queue);
+    EXPECT_EQ(oneapi::mkl::dft::get_plan_cache_stats().misses, 3u);
+    EXPECT_NE(get_commit(first), get_commit(again));
+}
+
+template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
+static void disabled_cache_is_bypassed(sycl::queue& sycl_queue) {
+    using oneapi::mkl::dft::detail::get_commit;
+    scoped_plan_cache cache(0);
+
+    oneapi::mkl::dft::descriptor<precision, domain> first{ default_1d_lengths };
+    oneapi::mkl::dft::descriptor<precision, domain> second{ default_1d_lengths };
+    commit_descriptor(first, sycl_queue);
+    commit_descriptor(second, sycl_queue);
+
+    auto stats = oneapi::mkl::dft::get_plan_cache_stats();
+    EXPECT_EQ(stats.hits, 0u);
+    EXPECT_EQ(stats.misses, 0u);
+    EXPECT_EQ(stats.size, 0u);
+    EXPECT_NE(get_commit(first), get_commit(second));
+}
+
+template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
+int test_plan_cache(sycl::device* dev) {
+    sycl::queue sycl_queue(*dev, exception_handler);
+
+    if constexpr (precision == oneapi::mkl::dft::precision::DOUBLE) {
+        if (!dev->has(sycl::aspect::fp64)) {
+            std::cout << "Device does not support double precision." << std::endl;
+            return test_skipped;
+        }
+    }
+
+    try {
+        oneapi::mkl::dft::descriptor<precision, domain> descriptor{ default_1d_lengths };
+        commit_descriptor(descriptor, sycl_queue);
+    }
+    catch (oneapi::mkl::unimplemented& e) {
+        std::cout << "Skipping because simple commit not supported. Reason: \"" << e.what()
+                  << "\"\n";
+        return test_skipped;
+    }
+
+    identical_configs_share_a_plan<precision, domain>(sycl_queue);
+    least_recently_used_plan_is_evicted<precision, domain>(sycl_queue);
+    disabled_cache_is_bypassed<precision, domain>(sycl_queue);
+
+    return !::testing::Test::HasFailure();
+}
+
+class PlanCacheTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(PlanCacheTests, PlanCacheTestsRealSingle) {
+    EXPECT_TRUEORSKIP(
+        (test_plan_cache<oneapi::mkl::dft::precision::SINGLE, oneapi::mkl::dft::domain::REAL>(
+            GetParam())));
+}
+
+TEST_P(PlanCacheTests, PlanCacheTestsRealDouble) {
+    EXPECT_TRUEORSKIP(
+        (test_plan_cache<oneapi::mkl::dft::precision::DOUBLE, oneapi::mkl::dft::domain::REAL>(
+            GetParam())));
+}
+
+TEST_P(PlanCacheTests, PlanCacheTestsComplexSingle) {
+    EXPECT_TRUEORSKIP(
+        (test_plan_cache<oneapi::mkl::dft::precision::SINGLE, oneapi::mkl::dft::domain::COMPLEX>(
+            GetParam())));
+}
+
+TEST_P(PlanCacheTests, PlanCacheTestsComplexDouble) {
+    EXPECT_TRUEORSKIP(
+        (test_plan_cache<oneapi::mkl::dft::precision::DOUBLE, oneapi::mkl::dft::domain::COMPLEX>(
+            GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(PlanCacheTestSuite, PlanCacheTests, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,272 @@
+/***************************************************************************
+*  Copyright (C) Codeplay Software Limited
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  For your convenience, a copy of the License has been included in this
+*  repository.
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**************************************************************************/
+
+#include <cmath>
+#include <complex>
+#include <iostream>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "test_helper.hpp"
+#include "test_common.hpp"
+#include "reference_dft.hpp"
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+// The portFFT backend can only be selected explicitly with compile-time dispatching.
+#if defined(ENABLE_PORTFFT_BACKEND) && !defined(CALL_RT_API)
+
+namespace {
+
+struct real_real_case {
+    std::vector<std::int64_t> sizes;
+    std::int64_t batches;
+};
+
+const std::vector<real_real_case> real_real_cases{ { { 16 }, 1 },
+                                                   { { 16 }, 3 },
+                                                   { { 4, 8 }, 2 } };
+
+enum class memory { buffer, usm };
+
+// Complex transforms with COMPLEX_STORAGE set to REAL_REAL committed on portFFT. The forward
+// output is compared with the reference, then the backward transform must give back the input.
+template <oneapi::mkl::dft::precision precision>
+int test_portfft_real_real(sycl::device* dev, oneapi::mkl::dft::config_value placement,
+                           memory mem) {
+    using real_t = std::conditional_t<precision == oneapi::mkl::dft::precision::SINGLE, float,
+                                      double>;
+    using complex_t = std::complex<real_t>;
+    using config_param = oneapi::mkl::dft::config_param;
+    using config_value = oneapi::mkl::dft::config_value;
+    using descriptor_t = oneapi::mkl::dft::descriptor<precision, oneapi::mkl::dft::domain::COMPLEX>;
+
+    if constexpr (precision == oneapi::mkl::dft::precision::DOUBLE) {
+        if (!dev->has(sycl::aspect::fp64)) {
+            std::cout << "Device does not support double precision." << std::endl;
+            return test_skipped;
+        }
+    }
+    sycl::queue sycl_queue(*dev, exception_handler);
+    const bool in_place = placement == config_value::INPLACE;
+
+    for (const auto& test_case : real_real_cases) {
+        std::size_t size = 1;
+        for (auto length : test_case.sizes) {
+            size *= static_cast<std::size_t>(length);
+        }
+        const auto batches = static_cast<std::size_t>(test_case.batches);
+        const std::size_t total = size * batches;
+
+        std::vector<complex_t> input;
+        rand_vector(input, total);
+        std::vector<complex_t> reference(total);
+        for (std::size_t b = 0; b < batches; ++b) {
+            reference_forward_dft(test_case.sizes, input.data() + b * size,
+                                  reference.data() + b * size);
+        }
+        std::vector<real_t> in_re(total), in_im(total);
+        for (std::size_t i = 0; i < total; ++i) {
+            in_re[i] = input[i].real();
+            in_im[i] = input[i].imag();
+        }
+
+        descriptor_t descriptor{ test_case.sizes };
+        descriptor.set_value(config_param::COMPLEX_STORAGE, config_value::REAL_REAL);
+        descriptor.set_value(config_param::PLACEMENT, placement);
+        descriptor.set_value(config_param::NUMBER_OF_TRANSFORMS, test_case.batches);
+        descriptor.set_value(config_param::FWD_DISTANCE, static_cast<std::int64_t>(size));
+        descriptor.set_value(config_param::BWD_DISTANCE, static_cast<std::int64_t>(size));
+        descriptor.set_value(config_param::BACKWARD_SCALE, 1.0 / static_cast<double>(size));
+        try {
+            TEST_RUN_PORTFFT_SELECT_NO_ARGS(sycl_queue, descriptor.commit);
+        }
+        catch (oneapi::mkl::unimplemented& e) {
+            std::cout << "Skipping because portFFT does not support this configuration. Reason: \""
+                      << e.what() << "\"\n";
+            return test_skipped;
+        }
+
+        std::vector<real_t> out_re(total), out_im(total);
+        std::vector<real_t> back_re(total), back_im(total);
+        if (mem == memory::buffer) {
+            sycl::buffer<real_t, 1> re_buf{ in_re.data(), sycl::range<1>(total) };
+            sycl::buffer<real_t, 1> im_buf{ in_im.data(), sycl::range<1>(total) };
+            if (in_place) {
+                oneapi::mkl::dft::compute_forward<descriptor_t, real_t>(descriptor, re_buf,
+                                                                        im_buf);
+                {
+                    auto re = re_buf.get_host_access();
+                    auto im = im_buf.get_host_access();
+                    std::copy(re.begin(), re.end(), out_re.begin());
+                    std::copy(im.begin(), im.end(), out_im.begin());
+                }
+                oneapi::mkl::dft::compute_backward<descriptor_t, real_t>(descriptor, re_buf,
+                                                                         im_buf);
+                auto re = re_buf.get_host_access();
+                auto im = im_buf.get_host_access();
+                std::copy(re.begin(), re.end(), back_re.begin());
+                std::copy(im.begin(), im.end(), back_im.begin());
+            }
+            else {
+                sycl::buffer<real_t, 1> out_re_buf{ out_re.data(), sycl::range<1>(total) };
+                sycl::buffer<real_t, 1> out_im_buf{ out_im.data(), sycl::range<1>(total) };
+                sycl::buffer<real_t, 1> back_re_buf{ back_re.data(), sycl::range<1>(total) };
+                sycl::buffer<real_t, 1> back_im_buf{ back_im.data(), sycl::range<1>(total) };
+                oneapi::mkl::dft::compute_forward<descriptor_t, real_t, real_t>(
+                    descriptor, re_buf, im_buf, out_re_buf, out_im_buf);
+                oneapi::mkl::dft::compute_backward<descriptor_t, real_t, real_t>(
+                    descriptor, out_re_buf, out_im_buf, back_re_buf, back_im_buf);
+            }
+        }
+        else {
+            auto* re = sycl::malloc_shared<real_t>(total, sycl_queue);
+            auto* im = sycl::malloc_shared<real_t>(total, sycl_queue);
+            std::copy(in_re.begin(), in_re.end(), re);
+            std::copy(in_im.begin(), in_im.end(), im);
+            if (in_place) {
+                oneapi::mkl::dft::compute_forward<descriptor_t, real_t>(descriptor, re, im)
+                    .wait_and_throw();
+                std::copy(re, re + total, out_re.begin());
+                std::copy(im, im + total, out_im.begin());
+                oneapi::mkl::dft::compute_backward<descriptor_t, real_t>(descriptor, re, im)
+                    .wait_and_throw();
+                std::copy(re, re + total, back_re.begin());
+                std::copy(im, im + total, back_im.begin());
+            }
+            else {
+                auto* fwd_re = sycl::malloc_shared<real_t>(total, sycl_queue);
+                auto* fwd_im = sycl::malloc_shared<real_t>(total, sycl_queue);
+                oneapi::mkl::dft::compute_forward<descriptor_t, real_t, real_t>(
+                    descriptor, re, im, fwd_re, fwd_im)
+                    .wait_and_throw();
+                std::copy(fwd_re, fwd_re + total, out_re.begin());
+                std::copy(fwd_im, fwd_im + total, out_im.begin());
+                // Overwrite the input so that the backward transform has to produce it again.
+                std::fill(re, re + total, real_t(0));
+                std::fill(im, im + total, real_t(0));
+                oneapi::mkl::dft::compute_backward<descriptor_t, real_t, real_t>(
+                    descriptor, fwd_re, fwd_im, re, im)
+                    .wait_and_throw();
+                std::copy(re, re + total, back_re.begin());
+                std::copy(im, im + total, back_im.begin());
+                sycl::free(fwd_re, sycl_queue);
+                sycl::free(fwd_im, sycl_queue);
+            }
+            sycl::free(re, sycl_queue);
+            sycl::free(im, sycl_queue);
+        }
+
+        std::vector<complex_t> forward(total), backward(total);
+        for (std::size_t i = 0; i < total; ++i) {
+            forward[i] = complex_t(out_re[i], out_im[i]);
+            backward[i] = complex_t(back_re[i], back_im[i]);
+        }
+        const double tolerance = std::log2(size);
+        EXPECT_TRUE(check_equal_vector(forward, reference, total, tolerance, tolerance,
+                                       std::cout));
+        EXPECT_TRUE(check_equal_vector(backward, input, total, tolerance, tolerance,
+                                       std::cout));
+    }
+
+    return !::testing::Test::HasFailure();
+}
+
+// Real transforms with real-real storage are rejected when they are committed, rather than by
+// every compute call.
+int test_portfft_real_domain_real_real(sycl::device* dev) {
+    using descriptor_t = oneapi::mkl::dft::descriptor<oneapi::mkl::dft::precision::SINGLE,
+                                                      oneapi::mkl::dft::domain::REAL>;
+    sycl::queue sycl_queue(*dev, exception_handler);
+    descriptor_t descriptor{ 16 };
+    descriptor.set_value(oneapi::mkl::dft::config_param::COMPLEX_STORAGE,
+                         oneapi::mkl::dft::config_value::REAL_REAL);
+    try {
+        TEST_RUN_PORTFFT_SELECT_NO_ARGS(sycl_queue, descriptor.commit);
+    }
+    catch (oneapi::mkl::invalid_argument& e) {
+        std::cout << "Skipping because the configuration is rejected. Reason: \"" << e.what()
+                  << "\"\n";
+        return test_skipped;
+    }
+    catch (oneapi::mkl::unimplemented&) {
+        return !::testing::Test::HasFailure();
+    }
+    ADD_FAILURE() << "portFFT committed a real transform with real-real storage";
+    return !::testing::Test::HasFailure();
+}
+
+class PortfftRealRealTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(PortfftRealRealTests, InPlaceBufferSingle) {
+    EXPECT_TRUEORSKIP(test_portfft_real_real<oneapi::mkl::dft::precision::SINGLE>(
+        GetParam(), oneapi::mkl::dft::config_value::INPLACE, memory::buffer));
+}
+
+TEST_P(PortfftRealRealTests, InPlaceUsmSingle) {
+    EXPECT_TRUEORSKIP(test_portfft_real_real<oneapi::mkl::dft::precision::SINGLE>(
+        GetParam(), oneapi::mkl::dft::config_value::INPLACE, memory::usm));
+}
+
+TEST_P(PortfftRealRealTests, OutOfPlaceBufferSingle) {
+    EXPECT_TRUEORSKIP(test_portfft_real_real<oneapi::mkl::dft::precision::SINGLE>(
+        GetParam(), oneapi::mkl::dft::config_value::NOT_INPLACE, memory::buffer));
+}
+
+TEST_P(PortfftRealRealTests, OutOfPlaceUsmSingle) {
+    EXPECT_TRUEORSKIP(test_portfft_real_real<oneapi::mkl::dft::precision::SINGLE>(
+        GetParam(), oneapi::mkl::dft::config_value::NOT_INPLACE, memory::usm));
+}
+
+TEST_P(PortfftRealRealTests, InPlaceBufferDouble) {
+    EXPECT_TRUEORSKIP(test_portfft_real_real<oneapi::mkl::dft::precision::DOUBLE>(
+        GetParam(), oneapi::mkl::dft::config_value::INPLACE, memory::buffer));
+}
+
+TEST_P(PortfftRealRealTests, InPlaceUsmDouble) {
+    EXPECT_TRUEORSKIP(test_portfft_real_real<oneapi::mkl::dft::precision::DOUBLE>(
+        GetParam(), oneapi::mkl::dft::config_value::INPLACE, memory::usm));
+}
+
+TEST_P(PortfftRealRealTests, OutOfPlaceBufferDouble) {
+    EXPECT_TRUEORSKIP(test_portfft_real_real<oneapi::mkl::dft::precision::DOUBLE>(
+        GetParam(), oneapi::mkl::dft::config_value::NOT_INPLACE, memory::buffer));
+}
+
+TEST_P(PortfftRealRealTests, OutOfPlaceUsmDouble) {
+    EXPECT_TRUEORSKIP(test_portfft_real_real<oneapi::mkl::dft::precision::DOUBLE>(
+        GetParam(), oneapi::mkl::dft::config_value::NOT_INPLACE, memory::usm));
+}
+
+TEST_P(PortfftRealRealTests, RealDomainRejected) {
+    EXPECT_TRUEORSKIP(test_portfft_real_domain_real_real(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(PortfftRealRealTestSuite, PortfftRealRealTests,
+                         testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
+
+#endif // ENABLE_PORTFFT_BACKEND && !CALL_RT_API
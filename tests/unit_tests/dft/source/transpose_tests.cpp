@@ -0,0 +1,200 @@
+/***************************************************************************
+*  Copyright (C) Codeplay Software Limited
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  For your convenience, a copy of the License has been included in this
+*  repository.
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**************************************************************************/
+
+#include <cmath>
+#include <complex>
+#include <iostream>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "test_helper.hpp"
+#include "test_common.hpp"
+#include "reference_dft.hpp"
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+const std::vector<std::vector<std::int64_t>> transpose_sizes{ { 4, 6 }, { 16, 8 }, { 4, 6, 10 } };
+
+// Out-of-place complex transforms with TRANSPOSE set. The forward output is compared with the
+// reference in reversed dimension order, then the backward transform reads it back in place of
+// the natural layout.
+template <oneapi::mkl::dft::precision precision>
+int test_transposed_round_trip(sycl::device* dev) {
+    using real_t = std::conditional_t<precision == oneapi::mkl::dft::precision::SINGLE, float,
+                                      double>;
+    using complex_t = std::complex<real_t>;
+    using config_param = oneapi::mkl::dft::config_param;
+    using config_value = oneapi::mkl::dft::config_value;
+
+    if constexpr (precision == oneapi::mkl::dft::precision::DOUBLE) {
+        if (!dev->has(sycl::aspect::fp64)) {
+            std::cout << "Device does not support double precision." << std::endl;
+            return test_skipped;
+        }
+    }
+    sycl::queue sycl_queue(*dev, exception_handler);
+
+    for (const auto& sizes : transpose_sizes) {
+        std::size_t size = 1;
+        for (auto length : sizes) {
+            size *= static_cast<std::size_t>(length);
+        }
+        std::vector<complex_t> input;
+        rand_vector(input, size);
+        std::vector<complex_t> reference(size);
+        reference_forward_dft(sizes, input.data(), reference.data());
+
+        // Element (i0, ..., id) of the row-major reference lands at the column-major offset.
+        std::vector<complex_t> transposed_reference(size);
+        for (std::size_t row_major = 0; row_major < size; ++row_major) {
+            std::size_t remainder = row_major;
+            std::size_t column_major = 0;
+            std::size_t stride = size;
+            for (auto it = sizes.rbegin(); it != sizes.rend(); ++it) {
+                const auto length = static_cast<std::size_t>(*it);
+                stride /= length;
+                column_major += (remainder % length) * stride;
+                remainder /= length;
+            }
+            transposed_reference[column_major] = reference[row_major];
+        }
+
+        oneapi::mkl::dft::descriptor<precision, oneapi::mkl::dft::domain::COMPLEX> descriptor{
+            sizes
+        };
+        descriptor.set_value(config_param::PLACEMENT, config_value::NOT_INPLACE);
+        descriptor.set_value(config_param::TRANSPOSE, true);
+        descriptor.set_value(config_param::BACKWARD_SCALE, 1.0 / static_cast<double>(size));
+        // Backends without TRANSPOSE either report it as unimplemented or reject the
+        // configuration.
+        try {
+            commit_descriptor(descriptor, sycl_queue);
+        }
+        catch (oneapi::mkl::unimplemented& e) {
+            std::cout << "Skipping because TRANSPOSE is not supported. Reason: \"" << e.what()
+                      << "\"\n";
+            return test_skipped;
+        }
+        catch (oneapi::mkl::invalid_argument& e) {
+            std::cout << "Skipping because TRANSPOSE is not supported. Reason: \"" << e.what()
+                      << "\"\n";
+            return test_skipped;
+        }
+
+        auto* fwd = sycl::malloc_shared<complex_t>(size, sycl_queue);
+        auto* bwd = sycl::malloc_shared<complex_t>(size, sycl_queue);
+        std::copy(input.begin(), input.end(), fwd);
+
+        oneapi::mkl::dft::compute_forward<decltype(descriptor), complex_t, complex_t>(descriptor,
+                                                                                      fwd, bwd)
+            .wait_and_throw();
+        EXPECT_TRUE(check_equal_vector(bwd, transposed_reference, size, std::log2(size),
+                                       std::log2(size), std::cout));
+
+        oneapi::mkl::dft::compute_backward<decltype(descriptor), complex_t, complex_t>(descriptor,
+                                                                                       bwd, fwd)
+            .wait_and_throw();
+        EXPECT_TRUE(check_equal_vector(fwd, input, size, std::log2(size), std::log2(size),
+                                       std::cout));
+
+        sycl::free(fwd, sycl_queue);
+        sycl::free(bwd, sycl_queue);
+    }
+
+    return !::testing::Test::HasFailure();
+}
+
+// TRANSPOSE replaces the output strides other than the offset, so setting them is an error, and
+// so is a backward distance that would overlap the transposed transforms of a batch.
+int test_transposed_invalid_layout(sycl::device* dev) {
+    using config_param = oneapi::mkl::dft::config_param;
+    using config_value = oneapi::mkl::dft::config_value;
+    using descriptor_t = oneapi::mkl::dft::descriptor<oneapi::mkl::dft::precision::SINGLE,
+                                                      oneapi::mkl::dft::domain::COMPLEX>;
+    sycl::queue sycl_queue(*dev, exception_handler);
+    const std::vector<std::int64_t> sizes{ 4, 6 };
+    auto make_descriptor = [&]() {
+        descriptor_t descriptor{ sizes };
+        descriptor.set_value(config_param::PLACEMENT, config_value::NOT_INPLACE);
+        descriptor.set_value(config_param::TRANSPOSE, true);
+        return descriptor;
+    };
+
+    {
+        auto descriptor = make_descriptor();
+        // Only the offset is taken from OUTPUT_STRIDES.
+        std::int64_t offset_only[3] = { 2, 6, 1 };
+        descriptor.set_value(config_param::OUTPUT_STRIDES, offset_only);
+        try {
+            commit_descriptor(descriptor, sycl_queue);
+        }
+        catch (oneapi::mkl::unimplemented& e) {
+            std::cout << "Skipping because TRANSPOSE is not supported. Reason: \"" << e.what()
+                      << "\"\n";
+            return test_skipped;
+        }
+        catch (oneapi::mkl::invalid_argument& e) {
+            std::cout << "Skipping because TRANSPOSE is not supported. Reason: \"" << e.what()
+                      << "\"\n";
+            return test_skipped;
+        }
+    }
+    {
+        auto descriptor = make_descriptor();
+        std::int64_t column_major[3] = { 0, 1, 4 };
+        descriptor.set_value(config_param::OUTPUT_STRIDES, column_major);
+        EXPECT_THROW(commit_descriptor(descriptor, sycl_queue), oneapi::mkl::invalid_argument);
+    }
+    {
+        auto descriptor = make_descriptor();
+        descriptor.set_value(config_param::NUMBER_OF_TRANSFORMS, std::int64_t{ 3 });
+        descriptor.set_value(config_param::FWD_DISTANCE, std::int64_t{ 24 });
+        descriptor.set_value(config_param::BWD_DISTANCE, std::int64_t{ 23 });
+        EXPECT_THROW(commit_descriptor(descriptor, sycl_queue), oneapi::mkl::invalid_argument);
+    }
+
+    return !::testing::Test::HasFailure();
+}
+
+class TransposeTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(TransposeTests, TransposedRoundTripSingle) {
+    EXPECT_TRUEORSKIP(test_transposed_round_trip<oneapi::mkl::dft::precision::SINGLE>(GetParam()));
+}
+
+TEST_P(TransposeTests, TransposedRoundTripDouble) {
+    EXPECT_TRUEORSKIP(test_transposed_round_trip<oneapi::mkl::dft::precision::DOUBLE>(GetParam()));
+}
+
+TEST_P(TransposeTests, TransposedInvalidLayout) {
+    EXPECT_TRUEORSKIP(test_transposed_invalid_layout(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(TransposeTestSuite, TransposeTests, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace